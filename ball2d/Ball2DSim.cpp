@@ -1,12 +1,15 @@
 #include "Ball2DSim.h"
 
 #include "scisim/CollisionDetection/CollisionDetectionUtilities.h"
+#include "scisim/CollisionDetection/SpatialGrid.h"
 #include "scisim/UnconstrainedMaps/UnconstrainedMap.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/ImpactMap.h"
 #include "scisim/ConstrainedMaps/ImpactFrictionMap.h"
+#include "scisim/Constraints/ContactBatch.h"
 #include "scisim/Math/MathUtilities.h"
 #include "scisim/Utilities.h"
 #include "scisim/Math/Rational.h"
+#include "scisim/Timer/Profiler.h"
 
 #include "Constraints/BallBallConstraint.h"
 #include "Constraints/KinematicKickBallBallConstraint.h"
@@ -18,15 +21,15 @@
 #include "StaticGeometry/StaticDrum.h"
 #include "StaticGeometry/StaticPlane.h"
 
-#include "SpatialGridDetector.h"
-
 #include "PythonScripting.h"
 
 #ifdef USE_HDF5
 #include "scisim/HDF5File.h"
+#include "scisim/HDF5TimeSeries.h"
 #endif
 
 #include <iostream>
+#include <set>
 
 Ball2DState& Ball2DSim::state()
 {
@@ -119,6 +122,16 @@ const SparseMatrixsc& Ball2DSim::Minv0() const
   return m_state.Minv();
 }
 
+const BlockDiagonalMass& Ball2DSim::MBlocks() const
+{
+  return m_state.MBlocks();
+}
+
+const BlockDiagonalMass& Ball2DSim::MinvBlocks() const
+{
+  return m_state.MinvBlocks();
+}
+
 void Ball2DSim::computeMomentum( const VectorXs& v, VectorXs& p ) const
 {
   const unsigned nballs{ m_state.nballs() };
@@ -154,6 +167,10 @@ void Ball2DSim::computeActiveSet( const VectorXs& q0, const VectorXs& qp, const
   assert( q0.size() / 2 == m_state.nballs() );
   assert( q0.size() == qp.size() );
   assert( active_set.empty() );
+  SCISIM_PROFILE_SCOPE( ProfilePhase::NARROW_PHASE );
+
+  // Recycle the storage of the previous step's constraints
+  constraintArena().reset();
 
   // Detect ball-ball collisions
   if( m_state.numPlanarPortals() == 0 )
@@ -165,15 +182,30 @@ void Ball2DSim::computeActiveSet( const VectorXs& q0, const VectorXs& qp, const
     computeBallBallActiveSetSpatialGridWithPortals( q0, qp, active_set );
   }
 
-  // Check all ball-drum pairs
-  computeBallDrumActiveSetAllPairs( q0, qp, active_set );
+  // Cull balls against the static geometry with a tree over the balls
+  if( !m_state.staticDrums().empty() || !m_state.staticPlanes().empty() )
+  {
+    buildBallTree( qp );
+    computeBallDrumActiveSetAABBTree( q0, qp, active_set );
+    computeBallPlaneActiveSetAABBTree( q0, qp, active_set );
+  }
 
-  // Check all ball-half-plane pairs
-  computeBallPlaneActiveSetAllPairs( q0, qp, active_set );
+  SCISIM_PROFILE_COUNT( ProfileCounter::CONTACTS, active_set.size() );
 }
 
 void Ball2DSim::computeImpactBases( const VectorXs& q, const std::vector<std::unique_ptr<Constraint>>& active_set, MatrixXXsc& impact_bases ) const
 {
+  if( !active_set.empty() )
+  {
+    ContactBatch local_batch;
+    const ContactBatch* const batch{ ContactBatch::acquire( q, active_set, local_batch ) };
+    if( batch != nullptr )
+    {
+      batch->computeImpactBases( impact_bases );
+      return;
+    }
+  }
+
   const unsigned ncols{ static_cast<unsigned>( active_set.size() ) };
   impact_bases.resize( 2, ncols );
   for( unsigned col_num = 0; col_num < ncols; ++col_num )
@@ -187,6 +219,17 @@ void Ball2DSim::computeImpactBases( const VectorXs& q, const std::vector<std::un
 
 void Ball2DSim::computeContactBases( const VectorXs& q, const VectorXs& v, const std::vector<std::unique_ptr<Constraint>>& active_set, MatrixXXsc& contact_bases ) const
 {
+  if( !active_set.empty() )
+  {
+    ContactBatch local_batch;
+    const ContactBatch* const batch{ ContactBatch::acquire( q, active_set, local_batch ) };
+    if( batch != nullptr )
+    {
+      batch->computeContactBases( v, contact_bases );
+      return;
+    }
+  }
+
   const unsigned ncols{ static_cast<unsigned>( active_set.size() ) };
   contact_bases.resize( 2, 2 * ncols );
   for( unsigned col_num = 0; col_num < ncols; ++col_num )
@@ -365,20 +408,38 @@ void Ball2DSim::enforcePeriodicBoundaryConditions()
   }
 }
 
-void Ball2DSim::computeBallBallActiveSetSpatialGridWithPortals( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const
+void Ball2DSim::computePossibleOverlaps( const std::vector<AABB<2>>& aabbs )
+{
+  SCISIM_PROFILE_SCOPE( ProfilePhase::BROAD_PHASE );
+
+  switch( m_state.broadPhase() )
+  {
+    case BroadPhase::SPATIAL_GRID:
+    {
+      m_spatial_grid.getPotentialOverlaps( aabbs, m_possible_overlaps );
+      break;
+    }
+    case BroadPhase::SWEEP_AND_PRUNE:
+    {
+      m_sweep_and_prune.update( aabbs );
+      m_possible_overlaps = m_sweep_and_prune.overlaps();
+      break;
+    }
+  }
+}
+
+void Ball2DSim::computeBallBallActiveSetSpatialGridWithPortals( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set )
 {
   assert( q0.size() % 2 == 0 ); assert( q0.size() == q1.size() );
   assert( m_state.r().size() == q0.size() / 2 );
 
   const unsigned nbodies{ m_state.nballs() };
 
-  // Candidate bodies that might overlap
-  std::set<std::pair<unsigned,unsigned>> possible_overlaps;
   // Map from teleported AABB indices and body and portal indices
   std::map<unsigned,TeleportedBall> teleported_aabb_body_indices;
   {
     // Compute an AABB for each ball
-    std::vector<AABB> aabbs;
+    std::vector<AABB<2>> aabbs;
     aabbs.reserve( nbodies );
     for( unsigned bdy_idx = 0; bdy_idx < nbodies; ++bdy_idx )
     {
@@ -411,7 +472,7 @@ void Ball2DSim::computeBallBallActiveSetSpatialGridWithPortals( const VectorXs&
     }
 
     // Determine which bodies possibly overlap
-    SpatialGridDetector::getPotentialOverlaps( aabbs, possible_overlaps );
+    computePossibleOverlaps( aabbs );
   }
 
   std::set<TeleportedCollision> teleported_collisions;
@@ -421,7 +482,7 @@ void Ball2DSim::computeBallBallActiveSetSpatialGridWithPortals( const VectorXs&
   #endif
 
   // Create constraints for balls that actually overlap
-  for( const auto& possible_overlap_pair : possible_overlaps )
+  for( const auto& possible_overlap_pair : m_possible_overlaps )
   {
     const bool first_teleported{ possible_overlap_pair.first >= nbodies };
     const bool second_teleported{ possible_overlap_pair.second >= nbodies };
@@ -433,7 +494,7 @@ void Ball2DSim::computeBallBallActiveSetSpatialGridWithPortals( const VectorXs&
       // We can run standard narrow phase
       if( BallBallConstraint::isActive( possible_overlap_pair.first, possible_overlap_pair.second, q1, m_state.r() ) )
       {
-        active_set.emplace_back( new BallBallConstraint{ possible_overlap_pair.first, possible_overlap_pair.second, q0, m_state.r()( possible_overlap_pair.first ), m_state.r()( possible_overlap_pair.second ), false } );
+        active_set.emplace_back( new( constraintArena() ) BallBallConstraint{ possible_overlap_pair.first, possible_overlap_pair.second, q0, m_state.r()( possible_overlap_pair.first ), m_state.r()( possible_overlap_pair.second ), false } );
       }
     }
     // If at least one of the balls was teleported
@@ -490,7 +551,7 @@ void Ball2DSim::computeBallBallActiveSetSpatialGridWithPortals( const VectorXs&
       }
     }
   }
-  possible_overlaps.clear();
+  m_possible_overlaps.clear();
   teleported_aabb_body_indices.clear();
 
   #ifndef NDEBUG
@@ -550,18 +611,16 @@ void Ball2DSim::computeBallBallActiveSetSpatialGridWithPortals( const VectorXs&
 }
 
 
-void Ball2DSim::computeBallBallActiveSetSpatialGrid( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const
+void Ball2DSim::computeBallBallActiveSetSpatialGrid( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set )
 {
   assert( q0.size() % 2 == 0 ); assert( q0.size() == q1.size() );
   assert( m_state.r().size() == q0.size() / 2 );
 
   const unsigned nbodies{ m_state.nballs() };
 
-  // Candidate bodies that might overlap
-  std::set<std::pair<unsigned,unsigned>> possible_overlaps;
   {
     // Compute an AABB for each ball
-    std::vector<AABB> aabbs;
+    std::vector<AABB<2>> aabbs;
     aabbs.reserve( nbodies );
     for( unsigned bdy_idx = 0; bdy_idx < nbodies; ++bdy_idx )
     {
@@ -573,11 +632,11 @@ void Ball2DSim::computeBallBallActiveSetSpatialGrid( const VectorXs& q0, const V
     assert( aabbs.size() == nbodies );
 
     // Determine which bodies possibly overlap
-    SpatialGridDetector::getPotentialOverlaps( aabbs, possible_overlaps );
+    computePossibleOverlaps( aabbs );
   }
 
   // Create constraints for balls that actually overlap
-  for( const auto& possible_overlap_pair : possible_overlaps )
+  for( const auto& possible_overlap_pair : m_possible_overlaps )
   {
     assert( possible_overlap_pair.first < nbodies );
     assert( possible_overlap_pair.second < nbodies );
@@ -602,7 +661,7 @@ void Ball2DSim::computeBallBallActiveSetSpatialGrid( const VectorXs& q0, const V
         assert( ( (x0 - x1).squaredNorm() - (ra + rb) * (ra + rb) ) <= 1.0e-9 );
       }
       #endif
-      active_set.emplace_back( new BallBallConstraint{ possible_overlap_pair.first, possible_overlap_pair.second, q0a, q0b, ra, rb, false } );
+      active_set.emplace_back( new( constraintArena() ) BallBallConstraint{ possible_overlap_pair.first, possible_overlap_pair.second, q0a, q0b, ra, rb, false } );
     }
   }
 }
@@ -704,7 +763,7 @@ void Ball2DSim::generateTeleportedBallBallCollision( const VectorXs& q0, const V
   // If neither portal is Lees-Edwards
   if( !portal0_is_lees_edwards && !portal1_is_lees_edwards )
   {
-    active_set.emplace_back( new BallBallConstraint{ teleported_collision.bodyIndex0(), teleported_collision.bodyIndex1(), x0, x1, ri, rj, true } );
+    active_set.emplace_back( new( constraintArena() ) BallBallConstraint{ teleported_collision.bodyIndex0(), teleported_collision.bodyIndex1(), x0, x1, ri, rj, true } );
   }
   // Otherwise, there is a relative velocity contribution from the Lees-Edwards boundary condition
   else
@@ -723,7 +782,7 @@ void Ball2DSim::generateTeleportedBallBallCollision( const VectorXs& q0, const V
       // N.B. q1 because collision detection was performed with q1
       kinematic_kick = -m_state.planarPortals()[teleported_collision.portalIndex0()].getKinematicVelocityOfBall( q1.segment<2>( 2 * teleported_collision.bodyIndex0() ), ri );
     }
-    active_set.emplace_back( new KinematicKickBallBallConstraint{ teleported_collision.bodyIndex0(), teleported_collision.bodyIndex1(), x0, x1, ri, rj, kinematic_kick, true } );
+    active_set.emplace_back( new( constraintArena() ) KinematicKickBallBallConstraint{ teleported_collision.bodyIndex0(), teleported_collision.bodyIndex1(), x0, x1, ri, rj, kinematic_kick, true } );
   }
 }
 
@@ -738,7 +797,7 @@ void Ball2DSim::computeBallDrumActiveSetAllPairs( const VectorXs& q0, const Vect
     {
       if( StaticDrumConstraint::isActive( ball_idx, q1, m_state.r(), m_state.staticDrums()[drm_idx].x(), m_state.staticDrums()[drm_idx].r() ) )
       {
-        active_set.emplace_back( std::unique_ptr<Constraint>( new StaticDrumConstraint{ ball_idx, q0, m_state.r()( ball_idx ), m_state.staticDrums()[drm_idx].x(), static_cast<unsigned>(drm_idx) } ) );
+        active_set.emplace_back( std::unique_ptr<Constraint>( new( constraintArena() ) StaticDrumConstraint{ ball_idx, q0, m_state.r()( ball_idx ), m_state.staticDrums()[drm_idx].x(), static_cast<unsigned>(drm_idx) } ) );
       }
     }
   }
@@ -755,7 +814,63 @@ void Ball2DSim::computeBallPlaneActiveSetAllPairs( const VectorXs& q0, const Vec
     {
       if( StaticPlaneConstraint::isActive( ball_idx, q1, m_state.r(), m_state.staticPlanes()[pln_idx].x(), m_state.staticPlanes()[pln_idx].n() ) )
       {
-        active_set.push_back( std::unique_ptr<Constraint>( new StaticPlaneConstraint{ ball_idx, m_state.r()( ball_idx ), m_state.staticPlanes()[pln_idx], static_cast<unsigned>(pln_idx) } ) );
+        active_set.push_back( std::unique_ptr<Constraint>( new( constraintArena() ) StaticPlaneConstraint{ ball_idx, m_state.r()( ball_idx ), m_state.staticPlanes()[pln_idx], static_cast<unsigned>(pln_idx) } ) );
+      }
+    }
+  }
+}
+
+void Ball2DSim::buildBallTree( const VectorXs& q1 )
+{
+  SCISIM_PROFILE_SCOPE( ProfilePhase::BROAD_PHASE );
+
+  const unsigned nballs{ m_state.nballs() };
+  m_ball_aabbs.resize( nballs );
+  for( unsigned ball_idx = 0; ball_idx < nballs; ++ball_idx )
+  {
+    m_ball_aabbs[ball_idx].min() = q1.segment<2>( 2 * ball_idx ).array() - m_state.r()( ball_idx );
+    m_ball_aabbs[ball_idx].max() = q1.segment<2>( 2 * ball_idx ).array() + m_state.r()( ball_idx );
+  }
+  m_ball_tree.build( m_ball_aabbs );
+}
+
+// Same constraints, in the same order, as computeBallDrumActiveSetAllPairs
+void Ball2DSim::computeBallDrumActiveSetAABBTree( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set )
+{
+  assert( q0.size() == q1.size() ); assert( q0.size() % 2 == 0 ); assert( q0.size() / 2 == m_state.r().size() );
+  using st = std::vector<StaticDrum>::size_type;
+  for( st drm_idx = 0; drm_idx < m_state.staticDrums().size(); ++drm_idx )
+  {
+    const StaticDrum& drum{ m_state.staticDrums()[drm_idx] };
+    // Only balls that reach the wall of the drum can be active
+    m_static_candidates.clear();
+    m_ball_tree.query( [&drum]( const Array2s& min, const Array2s& max ) { return CollisionDetectionUtilities::aabbReachesSphere<2>( min, max, drum.x(), drum.r() ); }, m_static_candidates );
+    for( const unsigned ball_idx : m_static_candidates )
+    {
+      if( StaticDrumConstraint::isActive( ball_idx, q1, m_state.r(), drum.x(), drum.r() ) )
+      {
+        active_set.emplace_back( std::unique_ptr<Constraint>( new( constraintArena() ) StaticDrumConstraint{ ball_idx, q0, m_state.r()( ball_idx ), drum.x(), static_cast<unsigned>(drm_idx) } ) );
+      }
+    }
+  }
+}
+
+// Same constraints, in the same order, as computeBallPlaneActiveSetAllPairs
+void Ball2DSim::computeBallPlaneActiveSetAABBTree( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set )
+{
+  assert( q0.size() == q1.size() ); assert( q0.size() % 2 == 0 ); assert( q0.size() / 2 == m_state.r().size() );
+  using st = std::vector<StaticPlane>::size_type;
+  for( st pln_idx = 0; pln_idx < m_state.staticPlanes().size(); ++pln_idx )
+  {
+    const StaticPlane& plane{ m_state.staticPlanes()[pln_idx] };
+    // Only balls that touch the half plane can be active
+    m_static_candidates.clear();
+    m_ball_tree.query( [&plane]( const Array2s& min, const Array2s& max ) { return CollisionDetectionUtilities::aabbTouchesHalfPlane<2>( min, max, plane.x(), plane.n() ); }, m_static_candidates );
+    for( const unsigned ball_idx : m_static_candidates )
+    {
+      if( StaticPlaneConstraint::isActive( ball_idx, q1, m_state.r(), plane.x(), plane.n() ) )
+      {
+        active_set.push_back( std::unique_ptr<Constraint>( new( constraintArena() ) StaticPlaneConstraint{ ball_idx, m_state.r()( ball_idx ), plane, static_cast<unsigned>(pln_idx) } ) );
       }
     }
   }
@@ -763,6 +878,28 @@ void Ball2DSim::computeBallPlaneActiveSetAllPairs( const VectorXs& q0, const Vec
 
 #ifdef USE_HDF5
 // TODO: 0 size matrices are not output due to a bug in an older version of HDF5
+// Collects the centers of planes into a single matrix
+static Matrix2Xsc staticPlaneCenters( const std::vector<StaticPlane>& planes )
+{
+  Matrix2Xsc static_plane_centers{ 2 , planes.size() };
+  for( std::vector<StaticPlane>::size_type pln_idx = 0; pln_idx < planes.size(); ++pln_idx )
+  {
+    static_plane_centers.col( pln_idx ) = planes[pln_idx].x();
+  }
+  return static_plane_centers;
+}
+
+// Collects the normals of the planes into a single matrix
+static Matrix2Xsc staticPlaneNormals( const std::vector<StaticPlane>& planes )
+{
+  Matrix2Xsc static_plane_normals{ 2 , planes.size() };
+  for( std::vector<StaticPlane>::size_type pln_idx = 0; pln_idx < planes.size(); ++pln_idx )
+  {
+    static_plane_normals.col( pln_idx ) = planes[pln_idx].n();
+  }
+  return static_plane_normals;
+}
+
 void Ball2DSim::writeBinaryState( HDF5File& output_file ) const
 {
   if( m_state.q().size() != 0 )
@@ -774,37 +911,33 @@ void Ball2DSim::writeBinaryState( HDF5File& output_file ) const
     // Output the ball radii
     output_file.write( "r", m_state.r() );
     // Output the mass
-    {
-      // Assemble the mass into a single flat vector like q, v, and r
-      assert( unsigned(m_state.M().nonZeros()) == 2 * m_state.nballs() );
-      const VectorXs m{ Eigen::Map<const VectorXs>( &m_state.M().data().value(0), m_state.q().size() ) };
-      output_file.write( "m", m );
-    }
+    output_file.write( "m", massVector() );
   }
   // Output the static planes
   if( !m_state.staticPlanes().empty() )
   {
-    // Collect the centers of planes into a single matrix
-    Matrix2Xsc static_plane_centers{ 2 , m_state.staticPlanes().size() };
-    for( std::vector<StaticPlane>::size_type pln_idx = 0; pln_idx < m_state.staticPlanes().size(); ++pln_idx )
-    {
-      static_plane_centers.col( pln_idx ) = m_state.staticPlanes()[pln_idx].x();
-    }
-    // Save out the plane centers
-    output_file.write( "static_plane_centers", static_plane_centers );
-  }
-  if( !m_state.staticPlanes().empty() )
-  {
-    // Collect the normals of the planes into a single matrix
-    Matrix2Xsc static_plane_normals{ 2 , m_state.staticPlanes().size() };
-    for( std::vector<StaticPlane>::size_type pln_idx = 0; pln_idx < m_state.staticPlanes().size(); ++pln_idx )
-    {
-      static_plane_normals.col( pln_idx ) = m_state.staticPlanes()[pln_idx].n();
-    }
-    // Save out the plane normals
-    output_file.write( "static_plane_normals", static_plane_normals );
+    output_file.write( "static_plane_centers", staticPlaneCenters( m_state.staticPlanes() ) );
+    output_file.write( "static_plane_normals", staticPlaneNormals( m_state.staticPlanes() ) );
   }
 }
+
+void Ball2DSim::writeBinaryState( HDF5TimeSeries& output_series ) const
+{
+  // Balls and planes can be added or moved by scripts, so everything is appended each frame
+  output_series.append( "q", m_state.q() );
+  output_series.append( "v", m_state.v() );
+  output_series.append( "r", m_state.r() );
+  output_series.append( "m", massVector() );
+  output_series.append( "static_plane_centers", staticPlaneCenters( m_state.staticPlanes() ) );
+  output_series.append( "static_plane_normals", staticPlaneNormals( m_state.staticPlanes() ) );
+}
+
+VectorXs Ball2DSim::massVector() const
+{
+  // Assemble the mass into a single flat vector like q, v, and r
+  assert( unsigned(m_state.M().nonZeros()) == 2 * m_state.nballs() );
+  return Eigen::Map<const VectorXs>( m_state.M().data().valuePtr(), m_state.q().size() );
+}
 #endif
 
 void Ball2DSim::serialize( std::ostream& output_stream ) const
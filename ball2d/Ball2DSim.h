@@ -7,6 +7,9 @@
 
 #include "scisim/UnconstrainedMaps/FlowableSystem.h"
 #include "scisim/Constraints/ConstrainedSystem.h"
+#include "scisim/CollisionDetection/AABBTree.h"
+#include "scisim/CollisionDetection/SpatialGrid.h"
+#include "scisim/CollisionDetection/SweepAndPruneDetector.h"
 #include "Ball2DState.h"
 #include "ConstraintCache.h"
 
@@ -21,6 +24,7 @@ template<typename T> class Rational;
 
 #ifdef USE_HDF5
 class HDF5File;
+class HDF5TimeSeries;
 #endif
 
 class Ball2DSim final : private FlowableSystem, private ConstrainedSystem
@@ -58,6 +62,8 @@ public:
   virtual const SparseMatrixsc& Minv() const override;
   virtual const SparseMatrixsc& M0() const override;
   virtual const SparseMatrixsc& Minv0() const override;
+  virtual const BlockDiagonalMass& MBlocks() const override;
+  virtual const BlockDiagonalMass& MinvBlocks() const override;
 
   virtual void computeMomentum( const VectorXs& v, VectorXs& p ) const override;
   virtual void computeAngularMomentum( const VectorXs& v, VectorXs& L ) const override;
@@ -87,6 +93,8 @@ public:
 
   #ifdef USE_HDF5
   void writeBinaryState( HDF5File& output_file ) const;
+  // Appends the state to a time series
+  void writeBinaryState( HDF5TimeSeries& output_series ) const;
   #endif
 
   void serialize( std::ostream& output_stream ) const;
@@ -94,6 +102,10 @@ public:
 
 private:
 
+  #ifdef USE_HDF5
+  VectorXs massVector() const;
+  #endif
+
   // TODO: Most of these methods don't need to be methods...
 
   void updatePeriodicBoundaryConditionsStartOfStep( const unsigned next_iteration, const scalar& dt );
@@ -103,14 +115,27 @@ private:
   bool teleportedBallBallCollisionHappens( const VectorXs& q, const TeleportedCollision& teleported_collision ) const;
   void generateTeleportedBallBallCollision( const VectorXs& q0, const VectorXs& q1, const VectorXs& r, const TeleportedCollision& teleported_collision, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
 
-  void computeBallBallActiveSetSpatialGrid( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
-  void computeBallBallActiveSetSpatialGridWithPortals( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
+  // Fills m_possible_overlaps using the state's broad phase
+  void computePossibleOverlaps( const std::vector<AABB<2>>& aabbs );
+  void computeBallBallActiveSetSpatialGrid( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set );
+  void computeBallBallActiveSetSpatialGridWithPortals( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set );
   void computeBallDrumActiveSetAllPairs( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
   void computeBallPlaneActiveSetAllPairs( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
+  void buildBallTree( const VectorXs& q1 );
+  void computeBallDrumActiveSetAABBTree( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set );
+  void computeBallPlaneActiveSetAABBTree( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set );
 
   Ball2DState m_state;
   ConstraintCache m_constraint_cache;
 
+  // Broad phase storage, retained across timesteps to avoid reallocation
+  SpatialGrid<2> m_spatial_grid;
+  SweepAndPruneDetector<2> m_sweep_and_prune;
+  std::vector<std::pair<unsigned,unsigned>> m_possible_overlaps;
+  std::vector<AABB<2>> m_ball_aabbs;
+  AABBTree<2> m_ball_tree;
+  std::vector<unsigned> m_static_candidates;
+
 };
 
 #endif
@@ -9,6 +9,7 @@
 #include "scisim/Utilities.h"
 #include "scisim/StringUtilities.h"
 #include "Forces/Ball2DGravityForce.h"
+#include "Forces/PenaltyForce.h"
 
 #include "StaticGeometry/StaticDrum.h"
 #include "StaticGeometry/StaticPlane.h"
@@ -23,10 +24,13 @@ Ball2DState::Ball2DState( const Ball2DState& other )
 , m_fixed( other.m_fixed )
 , m_M( other.m_M )
 , m_Minv( other.m_Minv )
+, m_M_blocks( other.m_M_blocks )
+, m_Minv_blocks( other.m_Minv_blocks )
 , m_static_drums( other.m_static_drums )
 , m_static_planes( other.m_static_planes )
 , m_planar_portals( other.m_planar_portals )
 , m_forces( Utilities::clone( other.m_forces ) )
+, m_broad_phase( other.m_broad_phase )
 {}
 
 Ball2DState& Ball2DState::operator=( const Ball2DState& other )
@@ -69,6 +73,7 @@ void Ball2DState::setMass( const VectorXs& m )
 {
   m_M = createM( m );
   m_Minv = createMinv( m );
+  updateMassBlocks();
   #ifndef NDEBUG
   const SparseMatrixsc should_be_id{ m_M * m_Minv };
   const Eigen::Map<const ArrayXs> should_be_id_data{ should_be_id.valuePtr(), should_be_id.nonZeros() };
@@ -126,6 +131,22 @@ const SparseMatrixsc& Ball2DState::Minv() const
   return m_Minv;
 }
 
+const BlockDiagonalMass& Ball2DState::MBlocks() const
+{
+  return m_M_blocks;
+}
+
+const BlockDiagonalMass& Ball2DState::MinvBlocks() const
+{
+  return m_Minv_blocks;
+}
+
+void Ball2DState::updateMassBlocks()
+{
+  m_M_blocks.setFromSparse( m_M, 1 );
+  m_Minv_blocks.setFromSparse( m_Minv, 1 );
+}
+
 std::vector<StaticDrum>& Ball2DState::staticDrums()
 {
   return m_static_drums;
@@ -166,6 +187,16 @@ std::vector<std::unique_ptr<Ball2DForce>>& Ball2DState::forces()
   return m_forces;
 }
 
+void Ball2DState::setBroadPhase( const BroadPhase& broad_phase )
+{
+  m_broad_phase = broad_phase;
+}
+
+BroadPhase Ball2DState::broadPhase() const
+{
+  return m_broad_phase;
+}
+
 scalar Ball2DState::computeKineticEnergy() const
 {
   return 0.5 * m_v.dot( m_M * m_v ) ;
@@ -269,6 +300,7 @@ void Ball2DState::serialize( std::ostream& output_stream ) const
   Utilities::serialize( m_static_planes, output_stream );
   Utilities::serialize( m_planar_portals, output_stream );
   Utilities::serialize( m_forces, output_stream );
+  Utilities::serialize( m_broad_phase, output_stream );
 }
 
 void Ball2DState::deserialize( std::istream& input_stream )
@@ -286,6 +318,7 @@ void Ball2DState::deserialize( std::istream& input_stream )
   // TODO: Assert data is all positive
   MathUtilities::deserialize( m_Minv, input_stream );
   // TODO: Assert data is all positive
+  updateMassBlocks();
   m_static_drums = Utilities::deserialize<std::vector<StaticDrum>>( input_stream );
   m_static_planes = Utilities::deserialize<std::vector<StaticPlane>>( input_stream );
   m_planar_portals = Utilities::deserialize<std::vector<PlanarPortal>>( input_stream );
@@ -303,6 +336,10 @@ void Ball2DState::deserialize( std::istream& input_stream )
       {
         m_forces[force_idx] = std::unique_ptr<Ball2DForce>{ new Ball2DGravityForce{ input_stream } };
       }
+      else if( "hertzian_penalty" == force_name )
+      {
+        m_forces[force_idx] = std::unique_ptr<Ball2DForce>{ new PenaltyForce{ input_stream } };
+      }
       else
       {
         std::cerr << "Unknown force in deserialize." << std::endl;
@@ -310,6 +347,7 @@ void Ball2DState::deserialize( std::istream& input_stream )
       }
     }
   }
+  m_broad_phase = Utilities::deserialize<BroadPhase>( input_stream );
 }
 
 void Ball2DState::pushBallBack( const Vector2s& q, const Vector2s& v, const scalar& r, const scalar& m, const bool fixed )
@@ -366,4 +404,5 @@ void Ball2DState::pushBallBack( const Vector2s& q, const Vector2s& v, const scal
     Minv.finalize();
     m_Minv.swap( Minv );
   }
+  updateMassBlocks();
 }
@@ -9,6 +9,8 @@
 #include <memory>
 
 #include "scisim/Math/MathDefines.h"
+#include "scisim/Math/BlockDiagonalMass.h"
+#include "scisim/CollisionDetection/BroadPhase.h"
 #include "Forces/Ball2DForce.h"
 #include "StaticGeometry/StaticDrum.h"
 #include "StaticGeometry/StaticPlane.h"
@@ -40,6 +42,9 @@ public:
   const VectorXs& r() const;
   const SparseMatrixsc& M() const;
   const SparseMatrixsc& Minv() const;
+  // M and Minv are diagonal, so their blocks are 1x1
+  const BlockDiagonalMass& MBlocks() const;
+  const BlockDiagonalMass& MinvBlocks() const;
 
   // Kinematic boundary conditions
   std::vector<StaticDrum>& staticDrums();
@@ -53,6 +58,10 @@ public:
 
   std::vector<std::unique_ptr<Ball2DForce>>& forces();
 
+  // Broad phase used for ball-ball collision detection
+  void setBroadPhase( const BroadPhase& broad_phase );
+  BroadPhase broadPhase() const;
+
   // Energy, momentum, etc computations
   scalar computeKineticEnergy() const;
   scalar computePotentialEnergy() const;
@@ -76,12 +85,16 @@ public:
 
 private:
 
+  void updateMassBlocks();
+
   VectorXs m_q;
   VectorXs m_v;
   VectorXs m_r;
   std::vector<bool> m_fixed;
   SparseMatrixsc m_M;
   SparseMatrixsc m_Minv;
+  BlockDiagonalMass m_M_blocks;
+  BlockDiagonalMass m_Minv_blocks;
 
   std::vector<StaticDrum> m_static_drums;
   std::vector<StaticPlane> m_static_planes;
@@ -90,6 +103,8 @@ private:
 
   std::vector<std::unique_ptr<Ball2DForce>> m_forces;
 
+  BroadPhase m_broad_phase = BroadPhase::SPATIAL_GRID;
+
 };
 
 #endif
@@ -5,6 +5,8 @@
 
 #include "BallBallConstraint.h"
 
+#include "scisim/Constraints/ContactBatch.h"
+
 bool BallBallConstraint::isActive( const unsigned idx0, const unsigned idx1, const VectorXs& q, const VectorXs& r )
 {
   assert( q.size() % 2 == 0 ); assert( r.size() == q.size() / 2 );
@@ -99,6 +101,12 @@ void BallBallConstraint::evalgradg( const VectorXs& q, const int col, SparseMatr
   G.insert( 2 * m_sphere_idx1 + 1, col ) = - m_n.y();
 }
 
+bool BallBallConstraint::addToContactBatch( const VectorXs& q, ContactBatch& batch ) const
+{
+  batch.addContact( ContactBatch::Kind::Particle, int( 2 * m_sphere_idx0 ), -1, Vector2s::Zero(), int( 2 * m_sphere_idx1 ), -1, Vector2s::Zero(), m_n, Vector2s::Zero() );
+  return true;
+}
+
 //void BallBallConstraint::computeGeneralizedFrictionDisk( const VectorXs& q, const VectorXs& v, const int start_column, const int num_samples, SparseMatrixsc& D, VectorXs& gdotD ) const
 //{
 //  assert( start_column >= 0 ); assert( start_column < D.cols() );
@@ -5,6 +5,8 @@
 
 #include "BallStaticDrumConstraint.h"
 
+#include "scisim/Constraints/ContactBatch.h"
+
 bool StaticDrumConstraint::isActive( const unsigned ball_idx, const VectorXs& q, const VectorXs& r, const Vector2s& X, const scalar& R )
 {
   assert( 2 * r.size() == q.size() );
@@ -65,6 +67,13 @@ void StaticDrumConstraint::evalgradg( const VectorXs& q, const int col, SparseMa
   G.insert( 2 * m_idx_ball + 1, col ) = m_n.y();
 }
 
+bool StaticDrumConstraint::addToContactBatch( const VectorXs& q, ContactBatch& batch ) const
+{
+  // No kinematic scripting here, yet
+  batch.addContact( ContactBatch::Kind::Particle, int( 2 * m_idx_ball ), -1, Vector2s::Zero(), -1, -1, Vector2s::Zero(), m_n, Vector2s::Zero() );
+  return true;
+}
+
 void StaticDrumConstraint::computeGeneralizedFrictionDisk( const VectorXs& q, const VectorXs& v, const int start_column, const int num_samples, SparseMatrixsc& D, VectorXs& gdotD ) const
 {
   assert( start_column >= 0 ); assert( start_column < D.cols() );
@@ -5,6 +5,8 @@
 
 #include "BallStaticPlaneConstraint.h"
 
+#include "scisim/Constraints/ContactBatch.h"
+
 #include "ball2d/StaticGeometry/StaticPlane.h"
 
 bool StaticPlaneConstraint::isActive( const unsigned ball_idx, const VectorXs& q, const VectorXs& r, const Vector2s& x, const Vector2s& n )
@@ -72,6 +74,12 @@ void StaticPlaneConstraint::evalgradg( const VectorXs& q, const int col, SparseM
   G.insert( 2 * m_ball_idx + 1, col ) = m_static_plane.n().y();
 }
 
+bool StaticPlaneConstraint::addToContactBatch( const VectorXs& q, ContactBatch& batch ) const
+{
+  batch.addContact( ContactBatch::Kind::Particle, int( 2 * m_ball_idx ), -1, Vector2s::Zero(), -1, -1, Vector2s::Zero(), m_static_plane.n(), computePlaneCollisionPointVelocity( q ) );
+  return true;
+}
+
 void StaticPlaneConstraint::computeGeneralizedFrictionDisk( const VectorXs& q, const VectorXs& v, const int start_column, const int num_samples, SparseMatrixsc& D, VectorXs& gdotD ) const
 {
   assert( v.size() % 2 == 0 ); assert( q.size() == v.size() ); assert( start_column >= 0 );
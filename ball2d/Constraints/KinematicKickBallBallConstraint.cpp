@@ -5,6 +5,8 @@
 
 #include "KinematicKickBallBallConstraint.h"
 
+#include "scisim/Constraints/ContactBatch.h"
+
 KinematicKickBallBallConstraint::KinematicKickBallBallConstraint( const unsigned idx0, const unsigned idx1, const Vector2s& x0, const Vector2s& x1, const scalar& r0, const scalar& r1, const Vector2s& kinematic_kick, const bool teleported )
 : BallBallConstraint( idx0, idx1, x0, x1, r0, r1, teleported )
 , m_kinematic_kick( kinematic_kick )
@@ -25,6 +27,12 @@ void KinematicKickBallBallConstraint::evalKinematicNormalRelVel( const VectorXs&
   gdotN( strt_idx ) = - m_n.dot( m_kinematic_kick );
 }
 
+bool KinematicKickBallBallConstraint::addToContactBatch( const VectorXs& q, ContactBatch& batch ) const
+{
+  batch.addContact( ContactBatch::Kind::Particle, int( 2 * m_sphere_idx0 ), -1, Vector2s::Zero(), int( 2 * m_sphere_idx1 ), -1, Vector2s::Zero(), m_n, m_kinematic_kick );
+  return true;
+}
+
 std::string KinematicKickBallBallConstraint::name() const
 {
   if( m_teleported )
@@ -5,49 +5,115 @@
 
 #include "PenaltyForce.h"
 
+#include <algorithm>
+#include <cstdint>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "scisim/StringUtilities.h"
 #include "scisim/Utilities.h"
 
-PenaltyForce::PenaltyForce( const scalar& k, const scalar& power )
+PenaltyForce::PenaltyForce( const scalar& k, const scalar& power, const scalar& skin )
 : m_k( k )
 , m_power( power )
+, m_skin( skin )
+, m_neighbors()
+, m_list_q()
+, m_list_r()
+, m_grid()
+, m_aabbs()
+, m_thread_forces()
 {
   assert( m_k > 0.0 );
+  assert( m_skin >= 0.0 );
 }
 
 PenaltyForce::PenaltyForce( std::istream& input_stream )
 : m_k( Utilities::deserialize<scalar>( input_stream ) )
 , m_power( Utilities::deserialize<scalar>( input_stream ) )
+, m_skin( Utilities::deserialize<scalar>( input_stream ) )
+, m_neighbors()
+, m_list_q()
+, m_list_r()
+, m_grid()
+, m_aabbs()
+, m_thread_forces()
 {
   assert( m_k > 0.0 );
+  assert( m_skin >= 0.0 );
+}
+
+void PenaltyForce::updateNeighborList( const VectorXs& q, const VectorXs& r ) const
+{
+  assert( q.size() == 2 * r.size() );
+
+  // Two balls can approach each other by twice the largest displacement, so the list stays valid until some ball
+  // has moved half the skin
+  if( m_list_q.size() == q.size() && ( m_list_r.array() == r.array() ).all() )
+  {
+    const Eigen::Map<const Eigen::Matrix<scalar,2,Eigen::Dynamic>> x{ q.data(), 2, r.size() };
+    const Eigen::Map<const Eigen::Matrix<scalar,2,Eigen::Dynamic>> x_list{ m_list_q.data(), 2, r.size() };
+    if( r.size() == 0 || ( x - x_list ).colwise().squaredNorm().maxCoeff() < 0.25 * m_skin * m_skin )
+    {
+      return;
+    }
+  }
+
+  m_list_q = q;
+  m_list_r = r;
+  m_neighbors.clear();
+  if( r.size() < 2 )
+  {
+    return;
+  }
+
+  const unsigned nballs{ unsigned( r.size() ) };
+  m_aabbs.resize( nballs );
+  for( unsigned ball = 0; ball < nballs; ++ball )
+  {
+    const scalar inflated_radius{ r( ball ) + 0.5 * m_skin };
+    m_aabbs[ball].min() = q.segment<2>( 2 * ball ).array() - inflated_radius;
+    m_aabbs[ball].max() = q.segment<2>( 2 * ball ).array() + inflated_radius;
+  }
+  m_grid.getPotentialOverlaps( m_aabbs, m_neighbors );
+
+  // Keep the pairs whose inflated balls overlap
+  m_neighbors.erase( std::remove_if( m_neighbors.begin(), m_neighbors.end(),
+    [&q,&r,this]( const std::pair<unsigned,unsigned>& pair )
+    {
+      const scalar cutoff{ r( pair.first ) + r( pair.second ) + m_skin };
+      return ( q.segment<2>( 2 * pair.second ) - q.segment<2>( 2 * pair.first ) ).squaredNorm() > cutoff * cutoff;
+    } ), m_neighbors.end() );
 }
 
 scalar PenaltyForce::computePotential( const VectorXs& q, const SparseMatrixsc& M, const VectorXs& r ) const
 {
   assert( q.size() % 2 == 0 ); assert( q.size() == M.rows() ); assert( q.size() == M.cols() ); assert( r.size() == q.size() / 2 );
 
+  updateNeighborList( q, r );
+
   scalar U{ 0.0 };
-  // For each ball
-  for( unsigned ball0 = 0; ball0 < r.size(); ++ball0 )
+  // For each pair of nearby balls
+  for( const std::pair<unsigned,unsigned>& pair : m_neighbors )
   {
-    // For each subsequent ball
-    for( unsigned ball1 = ball0 + 1; ball1 < r.size(); ++ball1 )
+    const unsigned ball0{ pair.first };
+    const unsigned ball1{ pair.second };
+    // Compute the total radius
+    const scalar total_radius{ r(ball0) + r(ball1) };
+    // Compute a vector pointing from ball0 to ball1
+    const Vector2s n{ q.segment<2>( 2 * ball1 ) - q.segment<2>( 2 * ball0 ) };
+    // If the squared distance is greater or equal to the sum of the radii squared, no force
+    if( n.squaredNorm() > total_radius * total_radius )
     {
-      // Compute the total radius
-      const scalar total_radius{ r(ball0) + r(ball1) };
-      // Compute a vector pointing from ball0 to ball1
-      const Vector2s n{ q.segment<2>( 2 * ball1 ) - q.segment<2>( 2 * ball0 ) };
-      // If the squared distance is greater or equal to the sum of the radii squared, no force
-      if( n.squaredNorm() > total_radius * total_radius )
-      {
-        continue;
-      }
-      // Compute the penetration depth
-      const scalar delta{ n.norm() - total_radius };
-      assert( delta < 0.0 );
-      // U = 0.5 * k * pen_depth ^ power
-      U += 0.5 * m_k * std::pow( -delta, m_power );
+      continue;
     }
+    // Compute the penetration depth
+    const scalar delta{ n.norm() - total_radius };
+    assert( delta < 0.0 );
+    // U = 0.5 * k * pen_depth ^ power
+    U += 0.5 * m_k * std::pow( -delta, m_power );
   }
 
   return U;
@@ -58,12 +124,28 @@ void PenaltyForce::computeForce( const VectorXs& q, const VectorXs& v, const Spa
   assert( q.size() % 2 == 0 ); assert( q.size() == v.size() ); assert( q.size() == M.rows() );
   assert( q.size() == M.cols() ); assert( r.size() == q.size() / 2 ); assert( q.size() == result.size() );
 
-  // For each ball
-  for( unsigned ball0 = 0; ball0 < r.size(); ++ball0 )
+  updateNeighborList( q, r );
+
+  #ifdef _OPENMP
+  const unsigned num_threads{ unsigned( omp_get_max_threads() ) };
+  #else
+  const unsigned num_threads{ 1 };
+  #endif
+  m_thread_forces.resize( num_threads );
+
+  // Each thread accumulates a contiguous block of the pairs into its own buffer
+  const unsigned num_pairs{ unsigned( m_neighbors.size() ) };
+  #pragma omp parallel for schedule( static, 1 )
+  for( unsigned thread = 0; thread < num_threads; ++thread )
   {
-    // For each subsequent ball
-    for( unsigned ball1 = ball0 + 1; ball1 < r.size(); ++ball1 )
+    VectorXs& forces{ m_thread_forces[thread] };
+    forces.setZero( q.size() );
+    const unsigned pair_begin{ unsigned( std::uint64_t( num_pairs ) * thread / num_threads ) };
+    const unsigned pair_end{ unsigned( std::uint64_t( num_pairs ) * ( thread + 1 ) / num_threads ) };
+    for( unsigned pair_idx = pair_begin; pair_idx < pair_end; ++pair_idx )
     {
+      const unsigned ball0{ m_neighbors[pair_idx].first };
+      const unsigned ball1{ m_neighbors[pair_idx].second };
       // Compute the total radius
       const scalar total_radius{ r(ball0) + r(ball1) };
       // Compute a vector pointing from ball0 to ball1
@@ -83,18 +165,23 @@ void PenaltyForce::computeForce( const VectorXs& q, const VectorXs& v, const Spa
       // Compute the penetration depth
       d -= total_radius;
       assert( d < 0.0 );
-      // F = 5 * k * pen_depth^(3/2) * n
       // F = 0.5 * k * power * pen_depth ^ ( power - 1.0 )
       const Vector2s F{ 0.5 * m_k * m_power * std::pow( -d, m_power - 1.0 ) * n };
-      result.segment<2>( 2 * ball1 ) += F;
-      result.segment<2>( 2 * ball0 ) -= F;
+      forces.segment<2>( 2 * ball1 ) += F;
+      forces.segment<2>( 2 * ball0 ) -= F;
     }
   }
+
+  // Reduce in thread order so the result depends only on the number of threads
+  for( const VectorXs& forces : m_thread_forces )
+  {
+    result += forces;
+  }
 }
 
 std::unique_ptr<Ball2DForce> PenaltyForce::clone() const
 {
-  return std::unique_ptr<Ball2DForce>{ new PenaltyForce{ m_k, m_power } };
+  return std::unique_ptr<Ball2DForce>{ new PenaltyForce{ m_k, m_power, m_skin } };
 }
 
 void PenaltyForce::serialize( std::ostream& output_stream ) const
@@ -103,4 +190,5 @@ void PenaltyForce::serialize( std::ostream& output_stream ) const
   StringUtilities::serialize( "hertzian_penalty", output_stream );
   Utilities::serialize( m_k, output_stream );
   Utilities::serialize( m_power, output_stream );
+  Utilities::serialize( m_skin, output_stream );
 }
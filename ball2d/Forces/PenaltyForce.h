@@ -8,12 +8,20 @@
 
 #include "Ball2DForce.h"
 
+#include <utility>
+#include <vector>
+
+#include "scisim/CollisionDetection/SpatialGrid.h"
+
+// Pairwise penalty between overlapping balls. Candidate pairs are cached in a Verlet list built with a spatial grid
+// over balls inflated by half the skin distance; the list is rebuilt only once some ball has moved more than half
+// the skin since the last build, so a larger skin trades longer lists for fewer rebuilds.
 class PenaltyForce final : public Ball2DForce
 {
 
 public:
 
-  PenaltyForce( const scalar& k, const scalar& power );
+  PenaltyForce( const scalar& k, const scalar& power, const scalar& skin );
   explicit PenaltyForce( std::istream& input_stream );
 
   virtual ~PenaltyForce() override = default;
@@ -29,8 +37,21 @@ public:
 
 private:
 
+  // Rebuilds the Verlet list if the balls have changed or moved too far since it was last built
+  void updateNeighborList( const VectorXs& q, const VectorXs& r ) const;
+
   const scalar m_k;
   const scalar m_power;
+  const scalar m_skin;
+
+  // Verlet list: pairs within the sum of their radii plus the skin at m_list_q, sorted with first < second
+  mutable std::vector<std::pair<unsigned,unsigned>> m_neighbors;
+  mutable VectorXs m_list_q;
+  mutable VectorXs m_list_r;
+  mutable SpatialGrid<2> m_grid;
+  mutable std::vector<AABB<2>> m_aabbs;
+  // Per thread force accumulators
+  mutable std::vector<VectorXs> m_thread_forces;
 
 };
 
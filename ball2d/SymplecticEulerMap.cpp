@@ -6,6 +6,7 @@
 #include "SymplecticEulerMap.h"
 
 #include "scisim/UnconstrainedMaps/FlowableSystem.h"
+#include "scisim/Math/BlockDiagonalMass.h"
 
 SymplecticEulerMap::SymplecticEulerMap()
 {}
@@ -26,7 +27,8 @@ void SymplecticEulerMap::flow( const VectorXs& q0, const VectorXs& v0, FlowableS
   // Use q1 as temporary storage for the force
   fsys.computeForce( q0, v0, next_time, q1 );
   // Velocity update
-  v1 = v0 + dt * fsys.Minv() * q1;
+  fsys.MinvBlocks().multiply( q1, v1 );
+  v1 = v0 + dt * v1;
   // Position update
   q1 = q0 + dt * v1;
 }
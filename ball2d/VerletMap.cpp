@@ -6,6 +6,7 @@
 #include "VerletMap.h"
 
 #include "scisim/UnconstrainedMaps/FlowableSystem.h"
+#include "scisim/Math/BlockDiagonalMass.h"
 
 VerletMap::VerletMap( std::istream& input_stream )
 {
@@ -28,7 +29,9 @@ void VerletMap::flow( const VectorXs& q0, const VectorXs& v0, FlowableSystem& fs
   fsys.computeForce( q0, v0, next_time, F );
 
   // v1/2 = v0 + (1/2) h a0
-  v1 = v0 + 0.5 * dt * fsys.Minv() * F;
+  VectorXs a{ N };
+  fsys.MinvBlocks().multiply( F, a );
+  v1 = v0 + 0.5 * dt * a;
 
   // q1 = q0 + h v0 + (1/2) h^2 a0
   q1 = q0 + dt * v1;
@@ -37,7 +40,8 @@ void VerletMap::flow( const VectorXs& q0, const VectorXs& v0, FlowableSystem& fs
   fsys.computeForce( q1, v0, next_time, F );
 
   // v1 = v0 + (1/2) h ( a0 + a1 )
-  v1 += 0.5 * dt * fsys.Minv() * F;
+  fsys.MinvBlocks().multiply( F, a );
+  v1 += 0.5 * dt * a;
 }
 
 std::string VerletMap::name() const
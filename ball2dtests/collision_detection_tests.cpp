@@ -3,11 +3,17 @@
 // Breannan Smith
 // Last updated: 09/05/2015
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <iterator>
 #include <cstdlib>
 #include <string>
 
-#include "ball2d/SpatialGridDetector.h"
+#include "scisim/CollisionDetection/AABBTree.h"
+#include "scisim/CollisionDetection/CollisionDetectionUtilities.h"
+#include "scisim/CollisionDetection/SpatialGrid.h"
+#include "scisim/CollisionDetection/SweepAndPruneDetector.h"
 
 const scalar test_00_data[] = {-59.3942,-62.4467,-53.263,-59.7861,-16.123,-65.8537,-13.8147,-62.9074,-42.9792,-35.6779,-38.313,-31.8577,-25.2162,-17.1421,-19.5624,-12.283,-16.4972,-45.6063,-12.2567,-42.6644,6.88601,12.4418,12.0288,18.0384,-49.4808,-18.6911,-45.7298,-15.6437,-61.4636,-11.1411,-56.8424,-7.27075,-52.282,-32.7273,-49.232,-28.9521,-80.3857,-56.2957,-74.9536,-49.972,-34.5398,-16.5745,-31.6181,-10.6689,-27.4868,-71.1344,-22.2907,-65.6193,0.629833,-36.7931,4.38543,-31.9649,-53.8847,-71.043,-48.5185,-67.5565,-38.8529,-35.1789,-36.0283,-28.7781,-28.4473,-71.2701,-24.3701,-66.4309,-53.2405,-75.6418,-50.8293,-69.4163,-75.2491,-19.6222,-72.224,-15.8898,-35.9275,-20.3685,-29.3612,-16.3124,-25.2991,3.70146,-22.5405,9.82458,7.04719,15.3862,12.3682,17.8371,-48.035,-14.4152,-45.7233,-12.4609,-41.7015,-37.5287,-37.5793,-32.1305,7.60919,9.23125,11.4096,12.1032,-24.4175,-25.9086,-20.1955,-22.5327,-64.6064,-5.41574,-61.2234,-1.97594,-47.8945,-38.8994,-41.3073,-34.2439,-58.4984,-28.8835,-53.7516,-26.0036,-0.315426,7.47921,4.28609,10.0093,-56.8086,-78.7067,-51.26,-76.8816,10.3708,-4.7453,13.3717,-0.288788,-54.6455,-61.4422,-49.66,-56.1641,-16.6556,-13.2623,-11.8986,-9.08251,9.09963,-68.236,12.0861,-66.0423,-62.2013,1.20355,-56.3701,7.86543,15.1833,-37.7987,17.678,-35.8202,-47.6312,-33.8451,-42.5603,-31.7844,-53.5917,-39.5717,-49.5649,-32.9212,-60.3899,-78.6804,-53.958,-71.9915,-45.168,-67.6805,-42.3622,-65.7595,-78.229,-74.7128,-73.7044,-68.669,-64.1621,-17.4085,-57.4021,-14.4483,-44.3733,3.6827,-39.8291,5.79066,-54.8544,-2.71172,-50.966,0.396756,-74.1206,-29.3156,-68.8623,-24.1784,-45.4477,3.36267,-42.3856,7.24022,14.6124,10.0897,16.7639,13.1465,-67.6616,-72.3729,-64.3845,-66.411,-72.7805,-51.2641,-66.2686,-45.2167,-75.7146,-18.1316,-72.2858,-15.6774,-24.0897,-79.7424,-20.2917,-77.3016,-29.9559,-24.775,-26.3306,-20.3451,-11.4267,-60.3904,-8.16442,-55.0644,-21.884,-23.3799,-17.6315,-21.0404,-2.94496,8.69752,1.73243,10.5656,-65.944,-34.9741,-59.5012,-29.1705,-11.2617,4.44607,-8.81024,6.61942,12.4804,-58.6446,17.551,-55.283,-24.7276,6.58765,-21.3291,12.0085,-53.8392,-0.328972,-51.9589,5.98584,-29.2556,-52.2431,-26.3171,-48.2428,-64.7724,-81.4223,-60.862,-74.7512,-61.8943,-77.6046,-56.7508,-73.2371,-39.2166,-61.0846,-34.931,-55.9532,-77.3372,-9.5395,-71.5748,-3.32161,5.19032,-76.5572,8.42613,-71.8811,-46.8644,-2.8169,-40.1495,-0.120236,-45.6132,-73.9974,-42.6489,-70.9705,-79.6888,-52.8064,-75.3462,-49.4245,-71.3119,-63.5239,-66.6156,-57.6159,-71.4936,-22.2461,-67.8157,-19.4832,-54.9134,14.4555,-50.2837,19.1461,-43.7615,12.804,-37.5324,16.6778,-43.3673,-47.2088,-39.0441,-44.1676,-35.2722,-43.4542,-32.7595,-41.2268,-58.0837,11.5521,-55.3721,13.5443,-52.5663,-35.5633,-46.673,-31.5864,4.11394,-46.952,8.26126,-42.3862,-1.11768,3.0021,2.69598,6.04578,-16.9717,0.253662,-10.5982,5.53143,-8.38833,-41.6287,-2.02273,-36.8577,-12.6393,-75.1846,-8.83134,-69.624,-79.4755,5.78879,-72.9478,12.3171,-69.3871,-16.7152,-64.2264,-12.2167,-6.4452,-18.3621,-2.37659,-16.4476,-57.6446,12.6889,-55.6314,16.2811,-75.7054,-4.06003,-69.4234,1.96228,2.31643,-14.5075,9.00303,-9.70846,-46.4168,-16.8508,-41.4522,-12.1571,-4.14412,-75.9653,-0.462162,-69.8079,-7.21524,6.35423,-5.37399,8.24355,-73.3735,-56.4253,-67.0343,-52.6318,-63.2355,-59.9122,-58.6359,-54.6284,-57.2827,-32.122,-53.8964,-27.2002,-67.4661,-34.1144,-63.2532,-28.7217,-62.161,-54.0675,-56.6415,-50.9106,2.49353,13.4003,7.38218,16.4144,-6.05215,-44.306,0.334101,-38.4528,-51.5704,-0.00143514,-47.3576,4.91881,-5.88542,-49.9949,-2.0001,-45.6894,-49.0609,-64.0548,-42.9664,-57.9233,-26.8632,-59.1777,-20.9296,-53.393,-52.0166,5.65326,-46.1385,11.0785,-32.018,-6.03245,-28.7583,-3.01063,-28.9411,1.27822,-25.1139,6.21193,-80.3023,2.69553,-73.5778,7.59444,-4.65435,-6.55082,0.559573,-2.16047,-42.7513,-56.0075,-40.5917,-49.9726,-18.4088,-24.2396,-14.6564,-17.5358,-65.5134,-46.0451,-61.8555,-40.1975,-78.4356,-78.1244,-76.2695,-72.1952,-61.63,-25.1484,-56.3886,-22.4335,-35.0265,-13.0745,-28.7389,-11.1954,-9.97273,-56.1601,-4.114,-51.3038,-71.1738,6.9327,-68.3874,9.35576,-26.0014,-49.4622,-19.764,-45.4929,-43.1867,-73.6649,-40.7443,-71.2409,5.19455,-75.9368,8.80074,-70.4594,-37.0024,-46.0296,-33.6241,-42.7062,-4.32254,-10.0858,-0.072341,-7.33272,-54.7241,-57.2668,-49.9825,-54.205,-15.5824,-23.8537,-9.82378,-21.3815,-62.2824,-15.2145,-57.3853,-12.3191,-53.7848,-25.2073,-51.7091,-20.7918,-76.3586,-68.9416,-74.3638,-65.4036,-33.3727,-15.0569,-30.4443,-10.713,11.526,-33.5434,18.0099,-27.5332,-18.2203,-3.63509,-14.1256,1.70793,8.3995,-80.3067,13.0686,-75.2715,-26.5737,-26.4524,-24.6326,-23.043,-24.2308,8.79967,-18.8315,11.3625,-74.8329,-71.8337,-72.5356,-69.3388,-62.6023,-39.5719,-60.5824,-33.4763,-15.3421,-56.9253,-9.28423,-54.7612,-78.8547,-48.0762,-76.5189,-44.2375,0.831829,-25.2963,6.67292,-19.3453,-44.8766,-60.1791,-39.8818,-57.5386,1.85765,-7.33408,7.19944,-2.28689,-17.1067,-52.6165,-11.88,-46.3025,13.2461,-23.8625,16.6096,-19.4543,-39.1247,14.1934,-36.3981,18.5275,-12.9775,5.62618,-6.31835,8.27643,-12.0324,-32.4007,-9.74801,-29.6546,-1.0459,-36.0234,2.83868,-32.1883,-18.4521,2.55907,-15.5516,7.88255,-70.5359,-31.1641,-65.9947,-25.9226,-13.7575,-23.8179,-8.88052,-18.678,-55.6055,-24.1488,-49.0764,-17.7265,13.2719,-48.6641,16.5319,-42.8571,-78.1926,-69.0362,-72.633,-62.2474,-58.6999,-76.9687,-55.2159,-74.85,-38.9251,-15.3495,-35.0135,-10.9551,-35.531,13.8709,-29.3457,17.0808,-23.6576,-80.1107,-21.4772,-73.5327,-46.5216,-12.1523,-39.7364,-9.58165,-10.2357,-44.6711,-8.02354,-39.7532,1.58335,-43.64,8.05355,-39.521,-19.46,-43.9371,-16.2292,-38.4755,-54.7358,-41.3081,-49.8823,-36.137,-0.309972,4.62325,5.50117,9.03413,-28.063,-79.1827,-22.8107,-74.5949,-31.6183,-53.2456,-25.4702,-46.7456,-44.3486,-76.0532,-38.7038,-70.4,-72.3277,-30.628,-66.8898,-24.5246,-24.8181,-20.9235,-20.352,-18.4598,-19.7133,-59.8977,-17.6771,-54.1275,-11.7537,-77.038,-7.87468,-72.0386,-48.4719,-5.1776,-45.7255,-2.69287,-60.5181,-63.7375,-56.7384,-58.4042,-81.0165,10.6095,-74.5745,15.5348,-50.2716,-38.9553,-44.8397,-32.349,-1.32818,2.47162,4.15512,7.76989,-70.4528,-18.8714,-63.9215,-15.9529,14.7013,7.40653,18.2321,13.0369,-76.1537,-34.2914,-73.8258,-28.3888,-19.0477,-42.256,-12.3772,-36.4293,-62.0199,-2.19464,-56.9217,0.703166,-32.1295,-5.92777,-27.2881,-1.66229,-5.1952,-44.6147,1.19746,-41.4555,-16.3059,-3.51989,-11.0926,-0.913666,1.051,-29.4186,4.74489,-24.8974,-0.657078,-7.77784,3.2916,-5.45526,-1.87699,-61.1756,0.322139,-55.9492,-10.3745,-15.0744,-7.00164,-12.8555,-51.5625,-67.494,-48.713,-62.7633,-40.3849,-3.24889,-38.2184,3.08818,-73.5065,6.98836,-68.6878,10.1837,10.965,-42.9672,14.4949,-38.248,-16.5046,-8.13055,-12.1593,-4.10305,-52.829,-21.0576,-49.4915,-18.6574,-81.3391,-14.1936,-76.1432,-10.5056,7.75219,-71.9685,9.74545,-68.1097,9.05802,-22.6893,14.0766,-16.5616,-8.95478,-48.8189,-4.11995,-45.1242,-67.1691,0.0970522,-62.4196,6.46685,-69.5347,-41.5074,-65.3113,-39.0597,-39.27,-79.0739,-33.0398,-74.0147,-30.4856,-77.332,-26.1151,-73.0557,-45.8763,-24.9072,-40.3157,-20.3729,-50.3422,7.93261,-44.7863,12.9866,3.77859,-75.0002,10.347,-71.5514,14.6287,-58.2731,16.8247,-54.5583,-27.7487,-2.73453,-24.9064,-0.757159,-75.5969,-45.8629,-72.879,-41.3544,-43.3074,-46.665,-39.0769,-40.1681,3.77775,-74.1533,8.76439,-71.409,4.77005,-54.413,9.40499,-50.3446,-55.1689,-35.112,-49.4701,-31.7633,-35.5662,-61.7628,-29.1754,-56.4302,-46.9554,6.63594,-43.5645,13.313,-4.06516,-8.83761,-2.21086,-3.65777,-48.625,10.7056,-45.8832,14.0791,4.45092,-79.7437,10.4466,-75.6197,-38.0206,-36.676,-32.0155,-34.8244,7.41385,2.35638,10.8349,8.51171,-66.1041,-64.1024,-62.1679,-62.1425,-35.1732,-7.24176,-32.2862,-3.30388,-53.2866,-39.6213,-49.3067,-34.9644,-59.5459,-32.749,-54.9938,-26.599,-17.7206,-59.4351,-11.4214,-56.4043,-47.275,-14.467,-41.8273,-9.63458,-27.3702,-47.3008,-23.7573,-45.0794,-42.9905,9.91894,-40.5934,16.332,-62.4717,-29.9091,-56.9803,-26.4027,0.651083,-74.9791,4.9356,-70.9386,-32.0001,1.44444,-26.7915,3.32936,-56.6838,-23.8008,-52.7364,-21.4127,-27.1042,13.4897,-21.1357,17.6445,-75.1141,-76.2209,-68.8255,-70.9911,-75.4995,-27.6132,-71.1272,-21.2939,-78.0219,-51.9975,-73.6844,-46.7244,-28.324,-10.3502,-23.9897,-6.09886,9.65997,12.8158,11.5703,17.1965,5.54342,-59.0958,11.7147,-54.1759,-71.3704,2.97102,-66.2413,6.49504,-51.2908,-62.7652,-44.6837,-56.2842,-72.9291,-50.325,-66.5907,-48.3545,13.9782,-1.17301,16.725,1.58899,-55.121,-33.6655,-49.4877,-28.2401,-28.7204,-71.9905,-23.1041,-66.7132,-61.1303,-44.9255,-57.3975,-40.3694,-22.9005,-42.497,-17.7653,-37.8166,-14.7952,-74.2984,-10.7892,-69.838,-73.4399,-51.2707,-69.4673,-47.6733,-17.0229,-35.694,-10.664,-33.163,-78.5689,-53.8096,-76.0105,-49.1703,-61.168,-0.0368781,-58.1844,4.47202,-8.96434,-79.2999,-2.82656,-76.1883,-11.8282,-21.3285,-7.12163,-17.568,-46.7908,-8.29993,-44.6747,-6.45268,-42.2075,-34.5569,-35.6141,-30.7946,12.1454,-59.4298,17.9404,-55.7333,-67.7593,-75.5959,-63.9316,-71.7453,-23.7197,-48.6522,-21.1611,-43.2687,-22.5487,-6.69405,-18.2381,-4.45716,8.44383,-34.5929,11.4631,-31.7677,-47.0306,-60.6838,-45.2285,-54.2122,5.44217,-57.9049,9.93859,-55.992,2.65756,-34.3152,5.6743,-28.8529,-60.9359,-78.7416,-56.1209,-72.9424,-18.4915,-35.0066,-15.8843,-30.2187,-14.7392,-58.7392,-8.25354,-52.6999,-63.4468,-79.8747,-60.5054,-76.6872,-62.1167,-40.9173,-55.4589,-35.7933,-29.8422,-58.4496,-25.9305,-54.5696,-13.8956,-55.4993,-8.41667,-49.6672,-58.2804,-32.0982,-52.2097,-28.3709,-67.2471,-39.9037,-62.622,-37.3202,-49.9783,12.6336,-47.7663,15.656,-76.2409,-42.2136,-71.8451,-37.4827,-74.996,-23.7335,-72.3785,-19.7169,-74.2621,-53.1618,-68.008,-50.2683,-46.4392,-8.30215,-41.6694,-4.23594,11.645,-23.1285,13.999,-21.2592,1.50626,-49.6009,5.48031,-43.4456,-4.8973,-48.9134,-1.7239,-44.6986,-59.2212,10.751,-57.2346,16.1051,13.7941,2.7439,16.0178,8.71062,-27.5836,-62.5046,-24.4129,-56.6753,5.02187,-8.19088,6.89367,-3.20206,11.2569,0.164747,18.0007,4.08393,-68.5027,-67.9965,-64.0085,-66.1004,-5.10718,-31.039,0.00596891,-28.5431,14.4019,-27.7798,16.3336,-21.9829,-55.7567,-70.9414,-49.9113,-68.9578,-25.8426,-63.7836,-23.1282,-57.4363,8.95967,-4.64081,14.8085,-0.605898,-9.60964,-29.0059,-6.30175,-23.8412,-0.350331,10.4926,4.83339,16.6921,-74.3231,-47.4483,-70.0344,-40.6781,9.1463,-0.242978,14.19,4.9852,-38.377,0.892112,-33.0764,5.78033,-76.7278,-32.2941,-73.2424,-27.5664,-42.4354,-51.6992,-40.6065,-47.1558,-12.5916,-11.4426,-7.76955,-8.7886,-34.7167,7.2396,-32.0004,10.1074,-59.3894,-22.5471,-56.2989,-18.3011,-14.0692,13.2643,-7.91664,16.023,-34.0085,-21.3526,-30.129,-16.87,-38.4959,-18.5015,-35.1375,-14.9557,-25.5835,-6.67777,-20.8636,-2.77572,-42.3257,-57.2948,-39.0396,-53.9157,-13.5776,-66.6722,-8.15433,-62.1641,-35.4338,-18.569,-33.0489,-15.9056,-54.6038,-58.7509,-48.3731,-54.0003,-6.43047,-56.2146,-3.97042,-49.7259,-18.3861,-59.1381,-15.8587,-55.1342,-11.2109,4.28861,-6.53197,8.5885,-61.8163,-69.2481,-56.0339,-66.6556,5.18673,-59.9109,9.06124,-56.9374,-58.872,-68.6439,-55.8676,-63.2735,-47.845,-47.5401,-41.3113,-42.4923,-74.7361,0.170393,-71.5708,3.22188,-8.6892,-18.7675,-4.0915,-12.2981,-31.358,-15.8099,-27.2122,-11.7556,-17.0661,-74.5024,-11.4474,-69.1711,1.44667,-33.0529,7.56169,-30.6578,-5.33712,-54.3357,-2.01349,-51.4126,-70.9429,-50.1301,-64.3023,-43.7183,-42.3931,-5.81017,-38.8816,0.0147159,-79.5029,-29.9192,-74.5512,-23.5691,-3.00242,-67.9024,3.23061,-61.1491,-21.8786,7.39118,-18.7694,11.8005,-8.14118,-32.2848,-2.99325,-30.2073,1.46441,-15.9042,7.18353,-10.3481,-81.1106,-45.4099,-74.8312,-41.1125,14.3584,-59.6078,19.4657,-54.5083,-78.7832,-51.4987,-75.5529,-45.9145,-47.2098,-6.57172,-43.1287,-1.71668,13.5095,-69.7023,15.8788,-63.264,-78.6637,-2.56258,-74.1575,0.84723,-7.95388,-30.1189,-5.13701,-26.1931,-74.5997,-17.2894,-70.9259,-10.7769,-28.4717,-0.418891,-25.1503,2.19967,-78.432,-0.506843,-73.1587,3.85923,-1.11618,-16.6493,1.32933,-13.2065,-56.6241,-32.2436,-50.729,-28.0951,-26.9832,-37.6422,-21.3542,-34.3488,-58.857,-5.93266,-52.8786,-1.22053,13.3123,-67.9529,16.7157,-63.8545,-35.5337,1.13719,-29.9722,7.92733,-67.7135,-29.088,-61.2313,-22.8539,-40.245,-16.5518,-38.0892,-10.6668,-60.2344,-11.6375,-54.0767,-5.29813,8.16785,-71.7257,10.5752,-69.7381,-28.5021,-64.9169,-22.8164,-59.2096,-32.1821,7.29263,-27.0941,9.63063,-24.444,-56.8004,-21.9449,-52.3305,-60.1291,-55.6082,-57.2668,-53.1755,-34.6952,-48.9236,-32.4552,-46.0954,-71.1284,-74.22,-67.7149,-69.8091,-37.2062,-45.9045,-31.7309,-43.5859,-12.9399,-63.6839,-8.78745,-60.4443,-64.9028,5.69512,-62.1352,8.89307,-53.9274,-74.8015,-47.4753,-69.1131,-42.9354,-40.7807,-36.9,-38.2924,-67.4968,14.0192,-62.7584,15.9289,-75.7036,-42.5863,-69.027,-36.2026,-23.5132,-4.68427,-17.7957,2.00815,-44.2162,-54.7,-40.3429,-50.6533,-4.26782,8.82286,1.28163,10.9106,-59.8396,5.70814,-57.1693,10.6795,-69.7881,7.28578,-65.8062,13.4846,-73.5297,-70.8944,-71.0504,-65.3008,-50.0435,-7.20091,-48.0281,-0.890293,-11.881,-5.80402,-6.49296,-3.77374,-49.4442,-32.4708,-44.6264,-25.9079,-52.4992,-25.1149,-45.8943,-20.8029,8.81437,-2.96474,10.774,2.584,10.783,-62.6804,17.0032,-60.1589,-27.5448,-48.3202,-23.3415,-42.5845,-6.1078,-24.7097,-3.5336,-19.0611,-46.6191,-30.0649,-41.8616,-27.2929,-60.8271,-62.685,-56.7053,-59.0925,-17.7055,-78.5159,-12.0677,-76.1452,4.47684,-57.322,9.98519,-54.8997,-23.4896,-74.5378,-19.2854,-70.7328,0.365027,-54.916,5.5157,-49.8111,5.33408,-45.5075,8.04747,-41.229,-59.968,-69.331,-55.5994,-64.9659,-18.1503,-63.0745,-12.163,-58.7372,-68.9388,-9.24341,-64.3075,-3.82046,-36.9904,-36.9787,-32.46,-33.7953,-28.1893,-75.5244,-22.7737,-69.93,-27.772,-78.2036,-24.8828,-73.3063,-65.9037,-53.3391,-62.9548,-48.5273,-23.9951,-43.4939,-20.2791,-38.4664,-42.1438,-33.1223,-39.539,-30.6883,6.00598,-19.9823,9.43728,-17.8896,-78.7295,-70.5694,-75.0674,-67.133,-42.1607,-77.4796,-37.4033,-72.1995,-28.4197,-10.8745,-23.1067,-8.60015,14.0479,-74.0047,17.2174,-71.1888,-76.8304,-62.9951,-72.498,-59.9031,12.0118,2.59077,15.6422,4.92069,-13.0162,-63.1287,-6.9012,-57.5498,13.7536,-31.3684,18.2595,-25.6656,-25.9101,-50.2722,-23.7609,-47.2164,14.0165,-14.6928,18.4032,-10.2006,-28.461,-6.28658,-22.364,0.438827,-59.2226,11.2325,-53.383,15.5568,-68.1907,-75.244,-65.0089,-69.9235,-5.09313,-51.241,0.520365,-49.2667,8.89335,-27.9468,10.8801,-24.6662,-53.8514,-45.9714,-51.9534,-43.9906,-16.8444,11.7722,-14.2195,13.9318,-78.3613,-29.9976,-73.5655,-23.2162,-32.8848,-31.2565,-26.1016,-28.5643,-27.9343,-73.028,-24.8003,-69.8575,-51.4261,1.60168,-44.9654,6.43515,-70.0668,-0.803355,-64.6427,2.15093,-1.83388,-23.2073,4.36796,-17.7176,-77.8471,-61.0005,-72.3012,-57.2837,-76.0708,-35.6141,-71.387,-32.5702,-44.4768,-34.9873,-38.2651,-30.3103,-69.994,-35.2289,-65.6609,-32.2988,-11.821,-32.5178,-5.61664,-30.2301,-39.3146,-69.8732,-37.1272,-66.1234,-39.9779,-35.6916,-33.6655,-29.5997,0.17226,-28.1901,4.33706,-21.4781,-1.15912,-66.3652,4.26825,-60.6308,-30.3124,-24.8697,-26.3033,-19.803,-81.7137,-74.4883,-75.2164,-70.0537,12.0081,-73.0727,16.149,-66.7175,-54.664,-71.5777,-51.3989,-68.3806,14.3346,-19.152,18.6101,-16.6796,-11.4582,-51.7015,-5.53517,-48.595,13.7314,-68.1063,19.5128,-63.3836,-57.0548,1.73712,-54.0356,6.95527,-74.7073,-47.4136,-69.465,-43.9571,-61.866,-5.45032,-59.3512,-3.10682,-23.9377,-61.7967,-19.259,-59.8279,-31.452,-79.0816,-29.6409,-76.5947,-60.3565,-58.3776,-56.4421,-55.0216,-68.0615,-36.6652,-64.5404,-30.3828,-68.2461,-53.0106,-62.4163,-47.3179,-30.3906,-64.7053,-26.22,-60.354,-4.32981,-6.24239,2.29912,-4.28656,-66.2443,4.29838,-60.4289,10.7978,-26.4197,-48.9204,-22.3758,-42.9059,-0.835569,-75.8542,1.79672,-69.816,-30.4092,-6.23337,-28.0229,-0.196089,-58.3033,-24.4113,-51.5087,-22.1957,8.12766,-36.1147,10.0394,-30.6668,-47.4148,-69.9844,-43.0081,-66.3902,-52.144,-2.41497,-47.8394,2.03138,-62.5321,-55.1228,-60.3792,-53.2852,-15.6844,-50.4851,-10.2341,-44.1003,7.01009,-8.15094,11.5569,-4.61628,-54.9178,-55.9317,-50.2825,-52.0011,-4.86175,-64.0291,0.92663,-58.0865,-80.1979,-76.311,-77.4099,-71.6984,-41.8438,-39.9365,-35.5786,-36.2728,-38.8016,3.68724,-35.4702,9.39431,-2.6867,-5.67936,0.601572,-2.44475,4.97599,-24.5561,9.72409,-20.8978,14.249,-46.7788,17.7844,-42.7392,-41.5406,-33.0665,-38.3817,-29.4132,-17.0623,-22.0327,-14.5693,-18.7752,-8.9727,-78.9742,-4.90738,-75.0943,-0.12229,-38.7974,2.5467,-35.6436,-9.63737,0.165909,-7.76937,3.9616,-23.7655,-31.4858,-18.9253,-29.0675,-29.1942,-57.2904,-23.2596,-54.7522,12.3417,-14.6248,18.5287,-11.1732,-80.4955,-31.8121,-75.9269,-26.8336,-70.708,-63.5195,-66.6304,-57.7357,-19.6281,-20.5273,-13.4172,-14.7256,-7.35529,-0.864,-3.48989,4.82892,-53.1494,-29.0825,-47.8387,-26.2845,-5.03051,4.55626,0.879909,9.97142,-15.7194,-21.945,-10.9935,-15.216,12.8994,-79.897,19.1165,-77.0444,-76.2491,-37.4082,-70.1014,-32.7062,-73.0915,-39.3984,-67.4254,-35.3891,-18.0155,7.87397,-14.4563,11.5186,-76.8333,13.2012,-74.7981,19.285,-69.1727,-68.2268,-64.0148,-62.744,-68.5126,7.41527,-66.6363,9.93474,-79.4291,-51.2305,-74.7591,-46.9235,-77.3061,-65.8168,-72.8742,-60.1534,10.2987,-18.6984,16.4507,-16.6111,-43.8447,-41.5781,-40.742,-37.7526,-64.6115,-16.7696,-62.5046,-13.429,13.4516,15.9469,18.3649,18.1531,-6.69071,-4.39099,-1.74992,-0.892408,-28.5585,-13.3627,-26.0769,-7.61056,-27.0696,-74.3625,-24.6091,-70.0854,-55.3266,-4.61965,-52.3955,1.16363,15.2312,-71.7833,18.1219,-68.6195,-58.9105,-25.0018,-55.3546,-18.3208,-32.5855,-17.979,-27.6751,-12.0134,-2.2815,-30.8272,1.723,-26.6614,-51.3574,-73.7921,-45.8909,-69.4016,-80.579,-65.2606,-74.3003,-59.6514,0.848234,-0.664704,3.54177,5.4141,-54.2731,12.547,-50.8739,17.9709,-70.9116,10.0718,-67.8077,13.9203,0.415661,-54.2787,4.30966,-52.1329,13.9399,-18.1465,16.6785,-11.4146,0.262114,-52.3534,5.84341,-47.2815,-36.331,0.512297,-33.9885,4.88512,-75.2504,9.50858,-68.952,11.8799,-67.9618,-0.726951,-63.056,4.09536,13.5027,-26.7184,19.8809,-22.3115,-73.1209,-8.11064,-69.868,-2.41665,-6.07669,-46.1468,-4.09336,-42.0916,-4.86494,-69.7315,-0.421608,-63.5492,-32.5862,-28.7725,-27.0517,-24.2592,-14.8012,-34.3681,-9.01757,-29.7727,-28.1418,-14.9152,-25.3003,-8.39288,-81.0518,-54.2436,-74.3431,-50.5737,-46.827,-49.4029,-42.4313,-46.738,-56.3328,-55.8517,-52.0855,-53.1153,-6.40589,-26.2232,-3.79624,-23.1031,6.37329,-39.3583,9.17025,-36.2038,-8.85575,8.00357,-3.38254,13.2391,-48.8763,-3.0305,-46.5543,0.104487,-68.1592,-71.7872,-63.6084,-68.4018,5.72295,-68.9468,8.85316,-66.6615,-68.2851,1.7108,-64.7501,6.1392,-57.3567,-71.0604,-55.551,-68.8064,7.5636,1.24057,13.5611,5.72463,-41.6469,-55.4644,-37.2292,-49.2087,-24.3538,-57.5165,-22.0544,-51.6424,-0.558064,-4.66525,5.89389,0.932932,3.20009,-62.9456,8.29796,-57.3225,-55.8407,-74.4142,-49.6636,-71.403,4.48507,-69.4205,9.31587,-64.7995,-25.6326,-70.8035,-21.8935,-67.4601,-56.0869,-42.293,-54.1556,-37.4191,-56.9733,-20.0875,-53.3554,-16.3938,11.4394,-65.7886,16.2404,-61.9937,0.144746,-2.37444,4.58529,1.48504,-68.2587,-80.5765,-65.6802,-76.5405,-67.1065,-27.7068,-65.1699,-21.083,-23.1155,-0.791491,-18.5957,2.49815,8.58805,-28.9706,14.9144,-25.8657,-45.1776,-54.6737,-41.5069,-49.7748,-34.2949,-26.9816,-32.0089,-23.2447,-75.7819,2.04713,-70.6778,5.39075,-47.4889,-45.5782,-44.7503,-43.6596,11.325,-22.6149,17.9526,-18.1864,-20.2392,-74.5595,-14.9655,-68.3709,-69.2631,-10.564,-66.994,-8.47179,-68.2713,-70.2941,-63.6375,-67.4136,-23.1047,-50.4823,-17.7438,-45.3878,-51.1998,-32.9958,-48.0475,-27.1961,-30.0614,-61.0589,-24.244,-55.8385,-1.05375,-25.517,3.27199,-19.1635,-80.4435,-76.031,-74.9166,-70.3138,-19.5989,-29.7622,-15.0809,-26.3573,-79.8668,-53.3425,-76.9912,-50.134,-32.8061,-45.3344,-30.5218,-42.8043,-9.65549,-5.41635,-4.7127,-2.98814,-41.9551,-11.5569,-35.5596,-6.10116,-62.5482,-74.7408,-59.4531,-69.0322,-33.0239,-2.99199,-30.652,3.08468,9.86672,-46.5017,16.3569,-40.3449,-19.4479,-0.682332,-14.0943,2.20299,-52.6184,-55.7726,-49.4888,-49.8688,-8.32266,-2.59098,-4.41635,-0.582472,-34.8016,-48.6793,-28.5119,-46.0341,-27.2127,-2.96358,-23.6725,0.248288,-38.3389,-15.0158,-36.417,-11.0587,-33.2977,-49.3948,-29.1826,-45.1817,-69.3171,-1.72822,-63.1674,4.73053,-4.42434,-37.1278,0.790483,-33.8535,-61.5541,-59.0518,-57.0713,-54.3972,-18.5184,-58.5737,-16.2167,-53.1707,6.57226,-1.01255,11.0971,1.24273,2.49847,-29.9234,6.94869,-23.2627,10.3081,7.20698,15.9424,13.8593,-54.7433,-74.1569,-52.264,-67.4766,-80.0157,0.878856,-75.2496,4.88444,-18.3443,8.97676,-13.3963,11.6206,-28.8582,8.97806,-22.2892,13.0317,10.7286,5.80195,17.3642,8.35314,-67.5431,-55.3239,-61.3462,-49.8276,-49.9607,8.11312,-46.3886,10.1642,-21.0348,-48.8954,-18.9612,-43.7558,-33.1879,-54.6132,-29.3901,-52.246,-8.32953,2.29495,-5.42075,4.96043,-14.0426,-3.75938,-9.73953,1.21461,-17.465,-27.6835,-13.0148,-21.9789,-16.8894,-42.754,-14.6588,-39.3045,-70.4649,-53.6368,-68.004,-51.2759,-17.7427,-9.22891,-11.274,-2.57889,-70.0386,-54.2715,-65.2665,-48.4635,-3.03632,-56.6132,2.49225,-53.4958,8.99364,-66.161,13.9925,-64.1346,-71.2379,-33.1458,-66.4469,-27.0715,10.6256,12.3829,16.6079,15.381,1.14936,-57.882,7.12412,-51.1134,6.73655,-51.8261,9.00095,-46.26,-58.9581,-44.7446,-55.8639,-40.8254,-16.1831,-37.1558,-10.8182,-34.5537,-76.7028,13.8915,-71.7761,15.8337,-20.5144,-74.5955,-14.1223,-69.7431,-68.9368,6.71171,-65.2596,12.5241,-27.3368,-65.6125,-23.1473,-62.1069,-33.7461,-29.303,-27.3332,-23.9619,-7.42578,-36.5028,-1.86585,-30.5335,9.89107,-65.8253,11.9871,-62.658,-39.4061,-76.3913,-32.7766,-70.9335,-8.05724,-72.1178,-1.71717,-67.0012,-49.4764,-51.8208,-47.3466,-45.8683,-77.0143,-9.2462,-73.783,-5.44068,-65.2386,12.903,-59.1178,17.8308,-11.3387,-9.95481,-4.59666,-6.08784,-9.72891,-7.50387,-3.91553,-4.67723,-25.0819,-81.7044,-19.5609,-75.5942,-52.9814,-41.0606,-46.2674,-34.2642,-10.0451,2.33648,-5.12102,7.67091,-30.0365,-76.4404,-27.9023,-71.218,4.91167,-47.9626,9.41063,-46.0082,-57.601,-2.71223,-55.0952,3.77636,-70.6909,-49.5411,-64.8621,-46.9355,11.2874,-52.5281,15.2167,-50.2458,-6.47902,-37.6656,-1.57399,-31.2939,-6.508,-28.8017,-3.69156,-23.9777,-43.74,-26.4671,-38.0829,-22.9247,-15.8453,-59.8058,-13.6888,-55.4563,-75.9274,-45.8927,-69.7988,-41.4584,-67.5399,-38.7134,-62.2631,-33.6573,0.857592,-11.9834,7.03636,-8.04271,-44.9204,-36.1758,-42.6477,-29.5244,7.63644,-26.9644,10.3018,-24.8661,-35.9848,-46.4918,-33.4068,-44.5657,-58.8828,-49.5816,-52.4352,-44.381,-49.0648,-43.2308,-47.0747,-36.8855,-48.9051,-64.7049,-45.6228,-59.1929,-59.0383,-37.2465,-54.9688,-34.1394,2.24746,-19.4669,8.25248,-12.911,4.74081,-47.6924,9.52211,-42.5209,-71.5924,-28.3665,-67.561,-23.8072,-61.1848,9.82045,-55.7182,13.2082,-17.3078,-45.6702,-14.1953,-42.1429,-24.4688,-6.97031,-19.8025,-2.63453,-28.3154,-76.5008,-24.6107,-69.7715,10.9805,-31.6989,14.8187,-25.7047,-54.5893,-17.7395,-48.4783,-14.2362,-66.7198,-38.1766,-60.9237,-32.1117,-61.5226,-59.324,-59.491,-56.903,-52.7279,-17.5165,-50.0678,-14.9471,-70.4536,-45.1577,-63.6966,-42.5962,-49.7756,-8.73589,-43.2413,-5.55688,-28.4573,8.52438,-25.479,15.1599,-54.6919,-63.6356,-49.3662,-59.4968,-51.564,-72.6595,-46.4722,-67.4267,-67.2911,-5.10262,-62.0911,1.2765,11.3813,-34.9569,15.3314,-30.8726,-22.0224,-24.9298,-18.0907,-20.2369,-34.6846,-14.272,-30.899,-11.8411,-28.6312,-8.28824,-25.8131,-5.6674,10.3994,-4.24472,16.3757,0.104692,-15.3432,-75.6034,-11.7309,-72.3411,-24.3694,-20.4894,-19.1275,-15.063,-47.138,-67.3971,-41.0438,-61.0048,-26.4481,-6.1233,-23.6853,0.312513,10.9165,-19.5569,15.2658,-15.4408,-68.7503,-45.3578,-62.882,-39.0261,-73.5482,-32.8629,-68.2432,-30.6518,-24.1476,-66.8212,-19.8417,-62.6722,-39.9839,-61.2277,-33.8291,-55.273,-16.438,-1.94263,-10.724,2.82604,-14.8965,-79.8596,-11.2732,-75.2072,-64.7643,-24.3814,-61.4854,-18.2234,-9.10571,-78.342,-3.40877,-71.8332,-35.9217,-48.8819,-30.8676,-42.4848,10.1679,-30.2421,16.2961,-26.0258,-47.3024,-60.1535,-42.7521,-53.8429,-54.7137,-16.6851,-50.3346,-14.6888,-56.5785,-16.2946,-50.5697,-11.5349,10.3582,-74.6203,13.4129,-68.1106,-78.4668,-9.53671,-73.2687,-4.1587,-11.4988,0.525479,-8.44745,4.50045,-64.7339,10.0537,-60.1983,16.8536,8.60829,2.71279,12.9703,5.12793,-37.5482,-14.8321,-33.1756,-9.07196,-43.6996,-29.1255,-37.0749,-22.6675,-22.5811,-23.661,-19.3284,-20.7312,-11.2138,-44.0134,-9.01922,-37.6353,-29.9742,0.437335,-25.8084,3.28854,-47.0383,-53.818,-44.3572,-51.9705,-13.198,-32.4473,-7.75551,-26.4831,-0.563392,-50.7425,1.93723,-46.9255,-16.4164,4.89376,-13.9521,8.52663,-40.4217,1.53467,-37.9231,5.87128,7.4107,-70.6849,10.9912,-67.7745,-52.4709,-49.9461,-49.4097,-44.0157,-32.4379,-60.6856,-26.721,-57.5691,7.46995,-63.8441,9.94462,-61.4354,-60.4688,4.67523,-56.0717,10.4515,-16.5592,3.93619,-11.9345,6.91897,-47.5195,5.59,-42.3866,7.82178,-13.2362,-27.4627,-9.87809,-21.5504,-25.9078,-12.0589,-22.6407,-7.84465,-67.06,-7.92245,-61.2834,-4.76889,-50.5172,-4.51944,-48.4402,0.133774,-75.8336,-36.9541,-72.9668,-31.8712,-45.2384,-56.5656,-39.6406,-53.0109,-57.4561,-56.8955,-53.4773,-53.7097,-70.3861,13.1829,-64.5089,15.6697,-40.1756,-5.9815,-35.7734,-2.68889,-63.2435,3.92101,-58.5795,10.3801,-31.6594,-20.9506,-27.3214,-18.7427,-64.5618,-60.0156,-62.6025,-53.6732,-32.4482,-42.6169,-28.7535,-38.1478,-37.7004,-15.2845,-33.9537,-9.17872,-56.8881,-16.6133,-51.9199,-14.0252,-43.585,-4.63229,-39.4014,-1.53662,-80.4093,2.7063,-73.784,9.21828,-49.1917,-65.3112,-46.3672,-62.0041,-42.4679,-44.3859,-37.0833,-38.5473,-10.2515,15.2564,-7.98122,17.2217,-51.762,-45.2827,-45.2936,-38.6786,-54.8282,-71.4179,-52.8987,-69.4385,-43.2322,-32.054,-40.4852,-27.1733,-45.4666,-19.8178,-40.0675,-15.8966,2.13158,-35.1245,4.38602,-32.3626,-55.4442,-1.42565,-48.9509,3.00943,-48.9568,-68.5669,-46.4869,-61.9614,-69.3572,-65.5661,-66.5804,-62.611,-1.26482,-8.38613,4.81401,-5.1662,-30.4066,-14.7235,-24.6248,-9.45977,-51.7049,-9.92211,-48.6644,-3.24778,6.25991,1.05206,11.031,5.55837,-40.2188,8.21531,-36.5303,11.8878,-75.4743,-28.2253,-70.3885,-23.7188,-62.4191,-51.8162,-55.8488,-48.8651,-79.607,-6.5888,-74.8304,-2.4292,-26.7312,-45.4917,-24.2209,-38.8243,-43.459,7.38417,-39.9784,13.0397,-74.6751,-0.247538,-72.6334,1.90156,-32.0397,11.1144,-26.3028,16.8715,-69.2832,-21.1618,-64.4628,-18.8315,-41.6612,-48.1363,-34.8739,-44.5224,-72.8382,-29.9923,-66.1874,-26.8035,-55.7818,-17.5476,-49.1465,-14.0091,-4.68995,-76.4001,-1.61452,-71.414,-80.4403,-17.5512,-75.7134,-13.8096,-14.4082,-42.3948,-10.9115,-39.4222,-54.7333,-38.8459,-50.0891,-36.3766,-6.79803,-22.2289,-2.68326,-19.2881,-42.9216,-40.2388,-40.5844,-38.3491,-42.2232,-43.3183,-37.3743,-37.8912,-39.0434,-58.4265,-33.5983,-51.9432,0.542774,1.65319,3.70306,6.07559,0.268116,-7.93278,2.71179,-4.83654,-70.021,-64.8991,-63.8771,-59.7514,-59.7341,-7.96139,-53.214,-2.88182,6.90151,-1.82406,12.3611,2.79366,-0.953176,-22.1759,5.2437,-17.1331,2.7089,-34.1304,6.38473,-30.2409,0.147057,-27.2942,3.01018,-24.492,-64.4708,-65.4308,-60.4334,-63.5976,-19.6509,-59.3846,-16.8865,-52.9853,11.0793,-29.7279,13.2003,-25.3272,-29.6265,14.6203,-25.056,17.0417,-20.2924,-25.0005,-14.6443,-22.1144,-32.7271,-80.4128,-29.8276,-77.1211,-80.5553,-0.223731,-74.7127,2.03846,-8.08666,-62.3598,-2.4334,-59.0369,-45.7602,10.1637,-40.4926,16.3042,-53.5392,-76.0688,-49.0459,-72.1737,-73.0646,-4.60355,-68.5487,-2.56124,-6.58208,-58.9795,-4.52783,-55.8556,2.88979,-31.5641,8.76586,-28.0195,-13.2496,-57.5301,-7.83318,-55.5557,-73.5525,-76.0833,-69.1529,-71.6406,14.935,-13.5078,16.8698,-8.02773,-6.88261,-36.7347,-1.20885,-31.2689,-78.4005,-51.856,-76.5161,-49.9108,0.261468,-38.3183,4.16465,-34.4238,-47.7257,-18.7663,-44.5035,-12.5622,-45.2178,-16.6734,-39.4423,-10.7842,-60.2017,-48.1781,-55.9029,-44.5023,-54.8471,-26.0497,-50.7643,-19.4452,-29.3643,-36.8265,-23.0779,-30.2827,-47.677,-57.5761,-45.4369,-53.0676,-57.9704,-74.8572,-54.8282,-70.7705,-75.324,-72.3145,-72.4744,-66.4024,-5.2777,-53.0429,-2.76315,-50.6109,-78.327,-14.0196,-75.887,-11.6319,-79.2634,-6.93684,-72.4968,-3.3244,-35.0733,-29.2152,-31.9054,-24.934,-47.592,-60.7482,-42.5186,-58.0338,-58.5814,-71.1188,-52.489,-66.3766,9.77813,-9.70521,12.5948,-5.89012,9.20153,-78.4737,11.6968,-71.8366,-42.9396,-69.1341,-40.8365,-65.1832,-48.3487,-55.8172,-44.5832,-49.9382,-54.0994,-19.4621,-50.2594,-12.8094,-9.92069,5.24397,-3.98343,11.9479,-72.098,-26.0465,-67.5793,-22.7757,-29.7626,-45.4195,-27.0113,-43.3069,-21.6352,-25.1858,-16.8141,-20.6299,-56.5802,-61.4701,-53.2882,-56.5141,-41.9756,-34.1902,-38.3197,-29.6616,-73.8004,5.01022,-69.348,10.4416,-44.3453,-42.3371,-39.2491,-39.2951,-13.6045,-60.2122,-9.79338,-57.9069,14.1072,-21.8855,17.8755,-15.6183,-2.68724,-31.619,-0.444378,-28.2572,-79.4149,-46.5221,-74.1735,-40.2083,-59.1542,8.03383,-54.7168,12.465,-30.0547,1.09034,-23.4578,4.7363,7.85088,-44.0389,10.8108,-39.6253,-38.4453,-70.363,-33.1923,-67.0558,6.28885,-42.9866,8.52358,-39.6793,-14.5337,-19.3907,-12.3211,-14.6844,-75.72,-22.1129,-69.1527,-18.1132,-49.4129,-23.1359,-46.3817,-16.4147,-17.7248,-6.61405,-14.5554,-0.903724,-20.3753,6.49145,-17.5747,9.24754,4.86838,-15.8013,7.67002,-11.2431,-11.8141,-8.94082,-9.06021,-3.24385,-41.8307,-60.0468,-37.0325,-56.6409,-80.3103,-18.8808,-74.3214,-14.4807,-50.0552,-14.5582,-46.0134,-11.0258,-59.1099,-73.0888,-52.5678,-68.9471,-69.7995,2.70968,-64.5605,4.53103,-2.45143,-11.764,0.799788,-5.25103,-65.6707,-61.3371,-60.4209,-55.8173,-62.5802,-74.34,-58.9097,-68.6622,-54.4521,-20.6316,-49.909,-18.3469,-77.5106,5.7106,-73.6812,7.86292,-36.1277,-16.5845,-29.6893,-13.604,-81.0794,13.0535,-76.1178,16.4019,-69.1218,10.1175,-65.2263,13.3843,-57.3088,-29.288,-52.1895,-25.3077,-49.6428,-37.6347,-45.5913,-34.6785,-36.1941,-12.2784,-32.3565,-9.37011,-48.2117,-17.946,-42.5374,-14.0289,-52.2472,-5.44218,-49.2966,-3.10976,-51.6903,-0.981284,-48.3377,2.1546,-5.93771,-39.3404,-1.60562,-35.1488,-4.38125,-59.7307,1.49428,-55.4428,2.87536,-0.191349,9.2792,2.72195,-46.177,-43.5269,-41.5889,-39.4149,-23.0209,-12.5519,-19.5248,-8.31699,-7.87338,-52.7506,-5.45064,-47.9408,-32.3205,-16.0868,-26.1567,-11.5456,-45.1347,-62.0531,-39.1416,-58.7663,-4.41788,-66.6798,0.103038,-61.2187,-66.8587,-30.7604,-61.5401,-26.1986,-41.6525,-13.6994,-36.1741,-8.08487,11.0399,-69.7544,15.0826,-65.9031,-47.3022,7.50919,-42.7402,14.2649,-6.14677,-52.4463,-2.49727,-45.9395,-80.7907,-33.5543,-73.9987,-28.4143,-56.6589,-37.7506,-50.3001,-35.3108,-54.5058,-72.7274,-49.1326,-70.4045,-41.3377,-58.039,-36.5353,-53.4844,-9.42668,-47.3001,-7.34697,-42.0167,-79.8903,-30.9767,-74.5129,-26.8979,7.6324,3.34722,12.1083,6.44596,-20.7048,-8.69027,-16.5847,-4.44601,-1.84628,2.73778,4.18156,7.97372,-29.5213,-20.6001,-26.7343,-17.1921,-43.5725,-30.086,-37.3236,-27.905,13.1583,-64.8321,19.9445,-61.1254,2.092,-61.5612,5.54187,-55.9484,-47.1549,-77.1694,-43.3909,-71.182,-4.66166,-39.0183,1.52673,-35.4333,-31.8955,-69.5598,-25.2955,-63.2968,-63.7148,-30.4644,-58.7085,-26.1361,-64.7037,-18.7796,-60.4601,-13.4674,-2.85842,-1.46762,0.763275,3.76258,-1.62304,8.05611,3.13279,12.8424,-59.9524,-40.8529,-54.5191,-35.7357,3.6136,-8.60482,10.1429,-3.79401,-0.0458279,-29.1365,2.34176,-24.8632,-54.1923,-24.5241,-51.84,-22.554,-32.7821,-46.0495,-26.5694,-40.3084,-19.5812,2.28638,-13.7108,7.00477,-46.4124,-42.4845,-44.241,-39.6364,-27.7043,-22.8471,-21.3496,-18.94,-47.7441,-23.2591,-41.7389,-17.4153,-19.1039,-30.4498,-13.2186,-24.9689,-19.4168,-32.2603,-15.302,-27.4501,4.44991,-48.0271,6.39297,-44.2719,-6.60512,-5.05971,-3.6686,-2.82029,-74.1185,-78.8764,-68.3029,-74.5873,-64.0747,1.1067,-57.9347,5.97317,-10.4387,-17.347,-4.10301,-13.614,-45.718,7.66722,-42.6305,11.74,-68.0372,-54.9928,-62.0258,-48.6061,-6.50568,-80.8375,-1.03067,-76.9032,-55.1087,-47.8433,-51.1193,-42.4551,-10.9726,-75.5471,-4.62957,-70.891,-9.81468,-12.5026,-6.64637,-10.053,-70.0761,8.29196,-66.6689,11.4252,-63.115,-53.4028,-59.1403,-46.8767,-12.0144,-13.6501,-5.51997,-10.3731,6.19115,10.5067,8.06103,13.5102,-3.08415,-17.4326,1.07236,-13.5899,-8.43795,-54.259,-2.24504,-52.1876,-25.2941,-59.3873,-20.6324,-57.2457,11.2108,-32.8706,14.7797,-26.3482,2.87862,-31.7655,8.39695,-29.8942,-37.4355,-6.30993,-33.8251,-2.53702,2.28914,-17.6583,5.64288,-14.1263,-75.8849,10.9812,-71.9748,15.7582,-29.6696,-34.3722,-23.1066,-32.3674,-31.9779,-28.6941,-28.1182,-26.8566,-6.90891,-39.9382,-1.24177,-35.0346,-48.9969,-4.17323,-45.27,-1.42198,-77.805,-6.28392,-72.9956,-1.71674,-59.2614,11.6068,-52.8582,14.7612,-36.9157,-15.7731,-32.6739,-9.97141,10.1137,8.02183,12.2096,10.2364,-16.2111,-69.0232,-14.0453,-65.8899,11.1138,-12.0056,17.6541,-7.79867,-27.519,-48.2481,-25.7012,-45.3567,-23.8885,13.4603,-19.2636,16.8015,-14.4132,-78.6673,-8.5171,-74.737,-68.0176,-79.0738,-64.5868,-75.5298,-51.3883,10.8948,-48.8209,14.6371,-26.2769,-22.4092,-23.1528,-19.9747,-0.0313867,-29.1144,4.86834,-22.5413,-62.2289,-21.0933,-58.1158,-15.514,-80.9942,-10.265,-74.6182,-7.61414,0.827616,-3.71299,5.94466,-1.30668,-50.3217,-5.99664,-45.2177,-3.50323,-24.7833,-69.3507,-18.9836,-65.4235,-24.193,-34.0086,-18.5465,-30.7338,-47.4462,-12.0038,-43.9305,-6.27689,-33.0278,-46.5899,-27.1378,-40.3173,-32.4552,-0.964101,-25.8971,3.06343,-45.4697,-66.2265,-42.256,-61.2813,11.6563,4.49395,14.9905,6.95878,-71.2361,13.9539,-64.6063,18.1973,-11.6967,-15.2575,-5.55084,-13.2447,-57.2312,-36.569,-52.0287,-30.878,-29.2694,-64.7086,-27.467,-62.6812,8.08766,-57.3185,11.49,-51.8592,-12.0111,-32.8693,-9.70735,-26.7832,-65.5391,1.91579,-60.2638,4.8717,-8.88034,-54.8963,-5.82851,-49.9487,-56.9991,-53.8581,-50.922,-47.1889,7.10589,-74.4562,9.70984,-71.2113,-53.6759,-19.7428,-50.5689,-13.0327,-26.2166,-75.6569,-20.3416,-72.5294,-72.2366,-2.12336,-70.1772,1.04112,-26.8219,9.49058,-22.8569,15.5733,-27.0376,1.0347,-23.7799,5.39616,-5.96695,-30.8347,-0.958559,-25.2769,8.31246,-41.4151,12.6421,-39.0126,-7.40566,-79.1619,-1.354,-76.2371,-15.2675,-9.65961,-10.5196,-3.94646,-4.87392,3.41358,1.62546,9.3159,-41.056,-22.9861,-36.1799,-19.3166,-77.1685,9.03842,-73.0374,12.6788,11.7313,-63.6967,17.4295,-59.9573,-10.2831,7.10494,-6.37468,13.0968,12.277,-66.0155,16.1529,-62.8962,-48.6165,-58.4361,-43.8591,-56.338,13.4266,3.82019,18.0999,10.1886,-76.5438,-69.4389,-72.2343,-66.4166,-24.2745,2.38362,-18.1475,8.70989,-1.03486,-37.8237,1.85861,-35.122,-81.0295,-19.1583,-74.7679,-15.8669,-44.143,-34.7327,-39.1262,-30.8875,-63.1975,-9.37651,-58.4252,-6.79058,-29.7909,-39.9325,-27.9171,-34.3645,-66.702,-78.4862,-63.3031,-71.697,-19.3444,-30.7123,-15.9235,-26.995,-33.3532,-15.766,-28.4359,-12.956,-79.551,-59.7891,-75.9393,-57.1818,-39.8656,-47.093,-35.6836,-44.3671,-72.3387,-11.529,-70.128,-5.42977,5.56201,-15.4723,10.2041,-9.35305,-24.0485,-73.456,-17.9468,-69.8587,-59.6796,-42.2599,-54.3717,-40.3686,-56.0756,-16.9415,-50.4022,-13.9483,-0.816064,-5.22224,1.08892,-2.07016,12.4189,-72.3681,18.5017,-70.5489,-0.889581,-3.50955,4.84632,3.18479,-6.7052,-5.08623,-0.0650799,-1.22491,-28.3613,-53.5329,-23.909,-50.8558,1.56589,-38.1273,8.012,-36.316,-69.2019,-3.88314,-67.2914,-1.56791,-53.4838,-3.06669,-47.6131,3.1674,-28.2185,-0.829533,-23.4968,1.03854,-78.8284,-67.4401,-72.03,-61.6524,-17.2537,7.75001,-13.1663,12.3848,0.376062,-35.7025,6.95643,-33.4763,-27.1113,-20.9313,-22.2601,-18.3932,1.8831,1.85294,7.94176,5.51675,-34.0414,-13.3806,-32.0422,-9.09585,-68.8887,-9.72157,-65.7007,-4.99114,-32.9785,-67.833,-29.78,-61.4674,-15.7292,-39.7193,-13.1937,-33.3587,-13.8911,-29.1599,-9.11972,-23.9711,-36.7008,-46.449,-34.0446,-42.6172,-15.9878,-53.109,-10.8308,-47.2992,-63.0379,-1.0216,-56.4586,1.26244,5.64483,-23.4945,10.2112,-18.0668,-54.4247,-41.9907,-51.4134,-37.8636,-16.4013,6.35909,-9.85466,11.5678,5.75449,-72.6567,7.57826,-70.7809,10.3296,-52.4561,13.0497,-49.1822,0.317763,-54.0479,3.8932,-49.5375,-77.695,-32.277,-72.2295,-27.2359,-48.5714,-47.1657,-42.0802,-44.0914,10.499,-40.2449,15.0866,-34.6158,-8.14905,1.53515,-2.69801,4.8533,-11.7954,-31.0434,-9.70223,-27.2276,-58.5741,-32.1056,-55.5262,-27.7433,0.634151,-66.7161,3.57668,-62.4929,-49.9511,-4.52124,-47.1063,-0.181874,-5.31728,9.17412,-2.74173,15.0254,-70.1639,-56.1708,-63.6277,-51.1732,-35.6696,-3.3998,-31.2747,2.16633,-52.8349,-45.4186,-47.3847,-41.1533,-21.1422,-17.6501,-15.0569,-12.776,-47.8093,-8.72046,-43.7654,-3.36015,-43.827,-29.7178,-39.4765,-25.5742,-36.4302,-37.8334,-31.4328,-35.4059,-21.7699,-0.462167,-17.6728,3.69817,-55.7834,-65.3343,-51.767,-58.7155,-30.1274,-34.7139,-27.1537,-30.872,-61.1524,2.58643,-56.5292,5.15078,-68.0164,1.2753,-62.89,6.75103,-57.7461,-8.05814,-51.2935,-3.0056,-1.05287,-70.5388,3.17482,-64.4503,-32.9328,-5.14947,-27.2104,0.0451308,1.82123,-19.9327,7.2464,-17.4536,-18.4089,-29.8903,-15.3782,-26.8526,-13.8878,10.4608,-11.2413,15.8736,-21.4159,-64.6456,-18.9231,-62.5085,-36.3926,-34.8254,-30.2198,-29.1908,-17.2927,-80.365,-11.4853,-74.0328,-0.438067,-12.1421,5.19283,-8.9706,-67.9937,-73.9496,-63.8959,-68.5307,4.02034,7.46565,7.66476,13.931,-29.3616,-19.4341,-27.3907,-14.2953,-10.9147,-13.6402,-5.09308,-11.3417,-13.6455,-31.0957,-7.53542,-28.7585,-8.54438,-68.4605,-4.74265,-65.0605,1.24447,-0.393076,5.32672,2.55999,-31.5047,-71.1106,-28.0858,-65.5248,8.13718,-6.19472,14.9005,-2.36176,-49.4882,-46.1566,-46.5172,-39.5031,-44.3043,-69.8959,-40.514,-63.1426,-9.95322,-57.3604,-6.43462,-54.7433,-50.7367,-56.68,-47.7632,-51.7354,15.3,-7.77182,18.5654,-3.16977,1.95484,3.11554,5.43132,8.00569,-18.7597,-11.2984,-14.9114,-5.26761,-42.7947,-42.5677,-40.6001,-39.6072,-34.0219,-77.8666,-29.1905,-74.0937,-40.0247,-54.0385,-34.6054,-50.4825,-21.7068,-6.61444,-18.9262,-1.91475,-42.8409,-4.52223,-40.8861,-0.838301,8.71057,-69.596,13.8828,-64.0067,8.67822,-57.1848,15.0923,-55.0832,-38.3307,-25.2221,-36.3448,-19.898,-17.765,-10.0058,-14.5004,-6.60102,-76.1893,11.4006,-73.5592,15.3446,13.074,-71.2115,14.9608,-65.6821,-1.32859,7.95704,0.88344,12.9852,-50.1261,-59.0443,-47.9752,-55.6187,-34.0042,-41.6852,-29.2852,-36.2764,0.570657,7.02057,3.83944,9.87888,-71.0026,-74.1105,-67.0366,-71.3852,-7.24773,-13.5554,-2.19733,-9.34003,6.25794,-79.7909,12.0594,-73.0105,-52.7116,-28.6706,-49.8458,-26.5699,-69.1666,-64.5763,-65.9676,-60.6368,-6.53844,-32.3206,-4.16305,-25.878,-1.64402,15.0477,4.57493,17.5392,-43.2609,-12.4737,-39.9644,-7.72821,-1.53629,13.9739,3.50175,17.8053,1.17364,-61.3223,3.47885,-54.7474,-71.3318,-14.1023,-69.2112,-10.3224,-62.3488,-77.4997,-57.6058,-71.7207,-23.4502,-48.1955,-18.8077,-46.3779,-22.2563,-47.9069,-20.0667,-43.8453,-54.9496,-56.8327,-49.9492,-54.6192,-70.5136,3.33814,-65.143,6.03429,-6.20143,5.84408,-1.79924,10.3696,-78.998,-66.8979,-75.8148,-61.4462,-66.2811,-75.4137,-63.0634,-72.0203,-59.5722,-54.3143,-53.9551,-52.2303,-12.0312,3.60739,-8.738,6.65547,-69.0386,-0.39237,-66.5206,2.50247,4.26052,-63.427,9.7212,-60.2111,-55.4135,9.25251,-50.8622,14.7246,-58.1372,-24.3234,-55.5116,-20.8076,-13.1869,-33.7803,-9.04033,-27.1864,-6.39688,-42.735,-1.13871,-36.3614,-59.8806,-59.8734,-55.0562,-56.7709,-35.5806,-30.4553,-31.9588,-25.4242,-56.9277,-33.4311,-53.8124,-27.377,-20.5037,-36.5324,-15.6122,-32.4545,-8.3742,-42.0236,-3.09523,-39.0191,-39.6457,-57.3118,-35.4605,-51.4356,3.88283,-32.0644,9.24328,-29.701,-74.5731,-58.394,-69.4576,-52.8705,-10.8298,-22.7103,-8.01751,-16.275,-53.7964,5.36816,-49.7402,8.82179,7.41904,-42.1872,11.1148,-35.6777,9.06699,-75.4917,13.6116,-72.3903,-0.584371,-44.1408,2.12192,-39.7014,-74.0586,-34.569,-68.8107,-31.7516,-52.1044,-14.5502,-48.2025,-11.7524,-3.95864,-19.3738,-1.42745,-14.7782,-71.7271,-67.4258,-65.3007,-64.8307,-78.4063,-17.4766,-72.0155,-13.9731,-70.9828,-14.0099,-67.3189,-7.7186,-58.49,-42.9053,-56.176,-40.4437,-16.4408,5.23501,-11.791,7.64517,-40.4052,-47.2081,-34.1535,-42.3744,-53.2281,12.8549,-46.8074,19.2637,-6.62453,-63.5685,-0.327962,-58.4157,-55.3588,-53.6784,-50.806,-47.6037,-59.1653,5.02232,-55.8994,7.6743,-79.7529,-71.92,-73.7093,-68.6132,-8.66899,-61.5777,-2.32139,-57.5438,-55.4446,6.81081,-52.3682,11.9043,-5.90962,-49.0503,-1.92344,-45.9456,-76.4889,-74.8601,-73.135,-71.305,-19.6017,-20.0499,-14.9409,-14.8478,8.40328,7.64078,10.8844,10.3532,10.6174,12.0671,17.1771,17.0819,-5.31162,-10.1549,-2.10574,-6.38651,-23.1618,-66.0258,-16.5476,-62.1469,-53.1734,5.3536,-48.1259,9.61674,-31.775,-10.059,-26.5925,-7.24623,-31.6042,-49.2716,-27.3418,-45.3176,-25.9189,10.9029,-23.7623,13.9406,-36.171,-31.7886,-29.4441,-26.789,-68.625,-2.45051,-64.857,1.24539,-75.1133,-40.3929,-69.4693,-33.6039,0.358011,-29.3279,5.42168,-26.5722,4.24712,6.96228,10.5824,13.3625,-57.9127,-71.5749,-51.6491,-66.9165,-14.6714,0.311023,-9.57115,5.44301,-59.1523,-66.7141,-55.8353,-62.1488,-36.3481,-69.9416,-32.8577,-67.5406,-48.1451,10.0574,-45.2269,16.7873,-2.79373,-6.16772,0.317652,-0.140374,-33.5531,1.17474,-29.5539,3.62108,-74.7791,-3.8564,-72.9074,1.04478,15.224,-32.2523,18.9472,-26.0496,-47.4425,-76.366,-44.4843,-72.415,-48.7115,-69.0558,-43.5489,-65.1907,-46.3418,-53.5925,-41.1387,-49.0179,-0.987329,-74.1126,4.8854,-70.933,-67.489,-26.6913,-60.8799,-22.4817,-50.3173,-61.479,-47.3692,-58.1519,1.1601,-1.32885,3.87216,5.25538,-72.0303,-14.8768,-66.2933,-8.18209,-23.5941,-21.9579,-17.7288,-19.4159,-33.44,-21.1839,-27.422,-17.3103,-24.3619,-69.3179,-18.3771,-67.2989,-2.54708,-80.0928,0.249788,-73.4786,-38.9333,5.7186,-32.1577,11.7529,-74.2965,-31.2334,-71.4788,-28.9025,-72.6243,-39.2527,-67.9836,-32.7616,-11.2158,-47.6924,-7.02204,-45.1687,-76.9786,-68.4877,-70.935,-62.0365,-71.6576,-41.3036,-67.7639,-37.0632,-3.8127,-28.767,2.31178,-24.1711,-43.2201,-47.3655,-37.4651,-40.7782,-72.1493,7.41551,-69.0138,11.8907,-19.1624,-4.90932,-16.5422,-2.69454,13.7533,-55.3592,19.8938,-51.2254,-30.9413,-49.678,-27.1356,-43.3859,-50.313,11.5849,-45.7475,13.8623,12.7184,-50.6249,16.308,-45.2477,-53.8297,-39.827,-49.54,-37.5109,-40.0267,-48.8372,-33.6859,-45.9994,-37.2271,-10.6045,-31.8643,-4.52289,-67.4772,-4.96973,-63.1782,-0.657094,-45.0909,-32.8525,-42.23,-30.2711,-23.9083,-19.5953,-17.813,-14.8756,-22.6411,8.47873,-16.7726,12.1953,-34.5656,9.13752,-30.9325,13.2915,-33.6729,9.10563,-31.6694,13.1837,0.852905,-58.1966,6.77345,-54.8107,-44.8519,-11.1058,-39.0188,-8.38985,5.55265,-68.2771,10.6768,-63.1465,-63.2399,5.13699,-60.629,11.711,-39.0127,-81.501,-34.4436,-74.8408,-80.6479,11.0872,-75.1503,15.2596,-1.4523,-47.1449,2.75357,-43.1267,-54.051,-59.8157,-51.5381,-55.6514,-14.211,-74.4651,-11.6997,-72.4527,-80.0626,-67.6278,-74.4965,-63.2495,-78.4303,-38.4186,-73.4826,-36.21,8.67313,-74.9821,13.0482,-70.92,-54.1936,-24.7025,-51.4675,-20.5449,-43.3355,-38.9581,-39.9008,-35.9542,-20.7339,-71.2668,-15.1372,-65.3725,15.0266,4.2354,17.6541,10.1424,-42.2616,11.485,-40.1134,13.4061,-4.95598,-14.2095,-1.41967,-7.82407,13.2234,-27.7138,19.7393,-23.3498,11.2314,-63.9078,13.7462,-58.7947,-48.7614,6.37446,-43.9954,12.6957,-2.71826,-51.3748,-0.0385399,-45.8663,-11.905,-62.144,-8.46519,-60.2174,-58.7712,12.8923,-56.3631,15.6246,-60.786,-69.6049,-56.8731,-66.3897,6.74007,-5.14572,8.7318,0.539871,-17.6084,-25.9961,-14.2705,-19.9875,-12.5857,-26.7443,-10.3651,-20.7715,-67.8128,-33.8166,-65.4204,-30.4809,-44.7548,-31.113,-41.8056,-26.2888,-40.706,-80.5403,-38.7076,-76.2825,-0.942345,3.09585,1.47796,4.97247,12.4488,-55.9084,15.2361,-53.8081,-44.1566,-43.405,-40.8062,-41.2984,-15.8436,-44.7564,-13.305,-41.0523,-20.2045,-42.9837,-17.4247,-37.2015,-3.67283,-17.0093,0.0239514,-11.2649,-63.039,-69.4239,-58.9304,-63.9368,7.48518,-77.9862,9.87539,-72.1026,-35.4086,6.98058,-28.621,11.3075,-20.74,-16.3967,-18.0053,-11.0273,-77.4928,-56.9386,-72.4266,-54.5154,-36.2449,-26.1559,-33.7763,-23.9574,-15.5252,-36.9262,-12.1205,-31.5914,-4.2024,-76.3811,-0.564188,-73.5811,-1.06304,-47.7818,4.94153,-43.7343,9.36522,-59.1374,12.4682,-56.8026,-8.92929,1.46527,-5.17585,7.91613,-42.3749,-55.7211,-39.0201,-51.1273,-9.06129,-19.8712,-4.92668,-17.9649,-33.6774,-60.6438,-31.5382,-56.3399,-6.3369,-74.7903,-2.31567,-69.9603,-24.5325,14.6237,-20.0649,19.1632,-42.4641,-66.3266,-36.8009,-62.7732,-15.0782,-73.5471,-9.51077,-70.2966,-19.6488,-59.9325,-14.5559,-56.5368,-13.4365,-3.35293,-7.42812,-1.28885,6.66131,-44.8197,12.4306,-41.7686,4.19452,-6.6496,10.0117,-1.45586,-36.5778,-78.7916,-30.5674,-73.1567,1.38087,6.2059,6.74843,10.9034,-14.7195,-4.05784,-12.3403,1.5065,-58.4128,-22.0016,-54.7066,-18.7113,-2.68656,-12.5804,2.54187,-7.39089,-9.61742,-52.165,-3.89171,-48.4324,-41.4567,-55.0171,-38.6975,-49.0428,-45.6627,-57.9941,-40.5435,-53.0886,-30.0425,-76.0403,-26.6233,-69.9825,-47.2882,-57.4654,-42.1167,-53.8934,-6.84126,3.32312,-4.81104,6.06336,-70.4209,-14.1034,-68.2899,-10.3189,-37.6832,-77.9702,-31.1091,-72.676,-26.8354,-64.1147,-24.6279,-59.3492,-6.79951,-40.9102,-1.06111,-34.1469,-10.7304,-5.30786,-8.61499,-0.223093,13.6225,-9.79649,16.7766,-3.15727,-55.6681,-36.3719,-50.9235,-32.0127,-65.348,-48.9845,-61.6765,-44.7046,-46.5908,-21.3646,-41.9169,-18.1505,-46.1494,-0.30557,-40.1978,2.41787,-82.2548,-63.1105,-75.5999,-57.7839,-59.2256,-57.9955,-52.4975,-54.6275,-65.8578,-31.5252,-63.3989,-27.5082,-13.1992,-68.5268,-10.4741,-62.509,-46.0262,-24.4635,-43.3823,-22.5629,-43.9103,-81.0739,-41.33,-74.491,14.5727,-53.1411,18.4708,-48.9702,-5.43179,-13.1784,-2.86027,-9.69756,-53.5932,-74.0731,-49.8629,-69.4659,-12.1327,-80.2498,-8.90701,-75.8521,-51.7495,-65.5712,-48.5908,-63.0356,-62.2127,-22.9961,-56.4835,-17.515,-43.7593,-11.0915,-40.0721,-5.08385,-0.276722,-30.3082,3.63144,-25.7107,-44.9169,3.69772,-42.0142,5.76219,-22.3415,-75.2116,-19.3245,-71.72,-12.201,-26.8742,-7.88649,-21.1578,-33.8109,8.89613,-31.6589,14.2903,-18.139,-28.679,-15.8119,-25.0047,-8.80363,-64.4804,-4.09789,-60.0771,-38.141,-28.1141,-32.5762,-22.5651,-35.444,-79.4127,-31.9855,-74.1928,-33.4569,-30.8747,-30.9251,-24.4957,-47.4661,-30.3187,-44.8963,-25.3981,-15.898,-47.2696,-11.8979,-43.5799,-9.76511,-52.3252,-5.21646,-48.5808,-74.0478,8.94348,-69.688,15.3306,2.43715,-36.4645,9.14087,-30.1367,-72.4562,-11.2955,-66.8051,-6.21881,-79.358,-14.6884,-75.4613,-12.8818,-54.9802,-13.2858,-53.1621,-8.79175,-76.6765,2.38954,-70.5516,8.83424,-76.2688,-33.5418,-71.4455,-27.0277,3.19192,13.3021,8.02872,18.7905,-41.307,-79.4687,-35.6378,-76.2598,-17.9508,-70.6738,-15.6051,-65.6283,4.54148,-73.7467,11.0718,-71.2551,-67.6203,-25.4583,-64.3547,-20.4077,-32.8903,-55.6402,-28.9691,-52.2906,-19.9074,-63.8468,-15.353,-57.2441,-47.3287,-13.5932,-42.1077,-7.85624,-5.21821,-42.7718,-1.02916,-39.6956,5.81231,-74.283,11.6,-68.6012,-50.2154,-73.1061,-45.7217,-67.061,-17.3155,-2.28553,-14.3419,1.96441,-17.5533,-16.1121,-13.9751,-12.1771,-78.3952,-19.363,-75.6548,-15.6086,-62.3146,-23.4255,-58.7025,-17.3264,-68.6014,-67.717,-62.0554,-61.283,-81.2137,-43.7689,-74.4898,-40.2968,-10.9642,-52.3203,-5.31781,-47.4136,-29.4999,-18.9301,-24.516,-14.3482,-30.6153,-17.7223,-25.715,-11.9889,-78.4662,-62.8721,-75.1602,-56.808,-9.10611,7.13456,-2.77617,13.3196,13.3626,-29.7124,19.7275,-26.4797,-30.9485,-34.96,-24.3429,-29.6808,-54.9615,0.745138,-48.403,5.626,-14.3865,-56.7307,-11.1523,-51.2477,-73.6907,-22.1352,-67.2629,-15.3583,-57.7434,-3.59189,-54.9672,-0.240103,-1.21718,-36.7839,2.15172,-32.7994,6.25079,-29.696,9.63534,-27.8436,-31.6934,12.6954,-28.243,14.6006,-23.233,-29.3301,-16.6389,-23.932,-45.4732,-31.3912,-42.5136,-27.3518,-26.4234,-9.59388,-19.6651,-6.33521,11.4246,-1.84085,14.3754,1.55791,-53.2205,-42.5078,-51.2307,-40.6074,-35.272,-21.6937,-31.682,-16.4368,-19.8448,-2.08614,-15.7707,3.19494,-1.92631,-48.7609,3.81094,-44.0696,-12.6251,-8.72495,-10.6913,-2.75135,-73.6286,-79.142,-70.7495,-77.2483,-79.0248,-79.0008,-76.1022,-74.0843,-18.4513,-28.7958,-12.6984,-26.347,-58.0339,-43.8537,-52.3382,-39.6561,-6.51088,-69.7213,-4.16507,-65.6372,-12.0689,10.5024,-9.37849,13.4471,-31.6043,-25.652,-25.7256,-23.55,-77.6448,-45.052,-71.447,-39.0946,-34.2731,5.48124,-28.5684,11.4935,-67.9647,-36.8202,-62.6416,-31.1649,-76.4624,-75.5398,-69.8103,-71.2769,-57.0581,-46.4134,-53.9226,-39.8988,-5.01328,-8.6187,-0.0443684,-5.26328,-4.40373,-9.96845,-1.37768,-7.65821,-77.3634,-76.3231,-75.0761,-73.6808,-25.5526,-39.5262,-19.0406,-33.4038,-36.4378,5.8166,-34.0614,9.05833,-37.2894,-18.4434,-30.616,-16.2505,0.125359,-63.0972,3.32566,-61.2263,-51.7757,-29.794,-48.1385,-26.0395,13.3886,-29.6014,18.7008,-24.461,-25.5095,-25.3796,-18.7333,-19.1583,-63.4031,-62.5782,-59.5294,-57.0872,-80.6265,-64.877,-74.5876,-58.3386,-0.0170534,-62.8485,2.10311,-58.9971,-28.1812,-43.8913,-22.9882,-37.8689,-47.6876,-8.06059,-42.6839,-2.62592,-3.55572,-1.56045,-1.28168,2.49016,-20.9806,-40.1636,-16.8346,-35.6662,-70.9412,-63.9819,-68.9437,-59.3231,-66.9549,-42.2113,-63.2197,-36.4851,-2.55856,-39.7604,1.48454,-36.6025,-41.2006,-45.8075,-35.5749,-43.2205,-73.8975,-63.5744,-70.2326,-58.4871,14.0331,-11.5754,18.0271,-5.75128,-43.4584,-35.6448,-37.9016,-31.4326,-80.8781,-17.5945,-74.5965,-15.4314,-17.707,5.7726,-15.8786,11.1169,-71.1153,-5.07261,-66.3216,1.57611,-29.6342,-32.2973,-23.4982,-25.6592,-79.0665,-74.1015,-76.9562,-71.9264,13.725,-21.5046,17.6043,-15.5625,-23.1825,-5.18493,-18.327,-0.780593,-5.71731,11.3884,0.730222,14.6908,-53.6781,-10.3522,-51.768,-4.73665,-64.6042,-48.3206,-57.8472,-42.2262,5.32891,-9.56791,12.0592,-5.26934,-78.4097,-74.3869,-73.6169,-68.2444,-37.4004,-15.1335,-32.1689,-12.8016,-69.5177,-70.4433,-66.7629,-66.4787,-44.1048,11.6013,-41.3251,15.762,-57.3661,-74.8964,-52.8625,-72.5252,-49.6353,-79.6321,-45.927,-73.7312,-66.3245,8.18047,-61.8461,10.1456,-70.2248,-76.8959,-64.0682,-71.0015,13.5753,-51.6742,18.9386,-49.2002,-78.3869,1.10287,-75.5475,6.48398,-58.1949,10.1119,-56.0715,12.1071,-74.2489,5.74128,-70.1301,7.83643,-20.4342,14.4188,-16.364,17.9,-31.2791,-78.8926,-27.1149,-74.138,-38.5872,8.8065,-35.622,11.0246,-63.1328,-33.3842,-57.2689,-27.7724,1.17976,-9.02425,5.11632,-3.27242,13.4651,-5.83441,15.7438,-0.809721,-5.54172,5.53877,0.799719,10.4388,-54.3552,2.12044,-49.9808,5.0049,-42.9195,-69.9592,-39.5806,-66.4986,-34.7662,-46.2371,-29.8513,-43.3394,-64.4338,-63.8553,-57.6751,-57.587,-33.3931,-36.7299,-30.6401,-30.644,-32.695,1.10738,-26.3393,6.88796,-67.8165,-59.4697,-65.1267,-56.1768,-5.46943,-0.894382,-2.68264,5.63694,-41.6033,-15.0991,-38.3057,-8.45654,-9.43659,-39.1344,-3.16394,-33.8611,-24.076,-55.4876,-20.6631,-53.3292,-59.5211,-78.8475,-53.3478,-76.6156,-39.8841,-74.7336,-36.4091,-70.7212,14.1166,-58.0987,19.2345,-53.2059,-37.714,-26.3009,-33.8355,-21.675,13.7616,-38.4249,18.4438,-34.8914,-70.168,-56.4683,-66.8606,-52.7489,-37.0675,-58.6983,-34.3632,-56.5404,-8.6421,-69.9664,-2.67592,-64.2243,14.8914,12.3781,17.2257,15.8377,11.4074,-73.2878,14.2661,-69.0464,-58.0655,-41.9739,-54.3556,-38.9174,-33.9996,-47.3811,-30.6223,-42.6883,-15.2278,-56.3754,-13.0947,-53.1667,-20.4038,-38.9688,-15.8642,-36.9754,-50.1109,-76.9487,-43.839,-73.2883,-70.433,-35.6413,-66.9406,-32.8226,-46.0978,-53.093,-40.8632,-50.6834,-62.6784,-22.8241,-56.2537,-18.4051,-8.35627,-64.0983,-5.64035,-60.3849,-56.0867,8.024,-51.0023,10.4743,-14.8328,-43.1926,-10.1011,-40.2745,-52.9152,-25.5145,-50.6573,-21.2481,9.86704,1.21152,12.0369,6.92668,-19.7706,-42.6142,-14.2991,-40.6373,-54.8058,-28.4461,-51.6337,-26.3028,-5.6838,-79.0774,0.643103,-75.4304,-4.23417,-10.8723,2.46941,-6.7173,-48.96,-51.1894,-42.7538,-47.064,-22.4985,-40.7961,-16.1065,-37.9543,-24.684,-58.1825,-18.9826,-56.373,-75.17,1.48285,-71.8018,3.33639,-73.6398,-18.2619,-69.0666,-12.2315,-46.8582,-78.5858,-43.5667,-74.0254,-0.370034,-19.1721,1.87501,-14.5401,-54.4563,-15.6797,-51.9011,-9.48501,-68.78,-33.5064,-65.8394,-28.1923,2.7123,3.72393,8.33492,7.90124,-78.6341,-40.4641,-74.294,-37.4584,-0.686459,-48.4779,2.38501,-42.2899,-64.8428,-3.85968,-58.0881,1.4525,-50.745,-52.9477,-44.2212,-47.7618,-19.2942,-78.1771,-12.5238,-75.0284,-18.3652,-80.9657,-15.5301,-76.1448,-37.4745,-57.7422,-32.0794,-55.3122,-77.0447,-56.2325,-71.2755,-53.0773,-47.9466,-58.0564,-43.0299,-51.3205,-69.8235,-24.0194,-64.4796,-21.9379,-16.9487,-57.5581,-12.8343,-52.3067,9.51323,-42.3637,12.592,-37.3409,-43.8575,-23.4275,-37.0602,-20.7441,-27.2864,-2.0753,-23.1147,-0.140433,-11.127,-50.472,-9.28076,-47.7069,-61.8233,-27.8453,-57.3394,-22.8931,-69.3897,-74.4532,-64.3168,-68.1085,-50.5871,-25.7368,-46.7827,-19.3591,-66.9679,-25.4845,-61.6953,-21.5903,-53.5165,-56.9913,-51.5273,-50.7727,-31.0434,4.27759,-29.236,9.29403,-5.60569,-40.0978,-1.11535,-34.4258,-51.878,-40.6321,-49.6998,-38.4077,3.84741,9.94504,6.572,16.7138,-71.5374,8.82164,-69.2645,14.6415,-18.7172,-28.2707,-13.3353,-25.2801,-68.4939,-69.8713,-64.1195,-67.636,-73.454,-28.743,-67.5547,-22.7942,-71.9396,-28.196,-67.0781,-23.5329,-45.0675,-69.6833,-39.3826,-65.7532,-1.98403,-70.3795,0.433175,-67.1967,-68.8178,-29.8264,-62.7108,-23.8806,9.81863,14.8553,16.6145,18.1127,-56.904,-59.5796,-51.0933,-53.9752,-35.8513,10.235,-29.9383,12.0584,-5.46052,-45.5101,-2.24707,-39.6685,-79.087,-51.1164,-76.8716,-47.0703,-48.0586,7.55842,-44.0237,11.2519,-22.6605,-64.0645,-16.9281,-58.1385,7.48549,-81.107,11.0347,-75.2506,-35.2459,-49.3181,-31.0628,-45.5912,-33.1521,-4.83251,-27.2335,1.87615,-50.8881,-60.3372,-46.2692,-54.5058,-58.3594,-60.9557,-53.2293,-57.8463,-5.88688,-57.9653,-2.20806,-55.3808,7.76904,-42.7117,10.7225,-38.2172,11.3216,-41.0192,14.3252,-35.4293,-77.5047,-2.61916,-74.4678,2.85791,-50.0622,2.29367,-44.8752,8.22265,-2.32965,-16.9998,-0.126537,-12.8995,-73.4488,-44.6383,-67.2063,-38.8994,-68.3147,-62.5955,-65.8208,-56.2018,-76.1059,-57.5645,-73.6492,-51.4537,-28.473,-45.2679,-24.785,-39.3564,11.9458,-41.6883,13.797,-36.4231,3.47209,6.83549,7.99538,10.9007,-49.5932,12.1563,-46.8036,14.4261,-33.0872,-14.0492,-28.6084,-11.8844,-68.0144,-11.8094,-63.4091,-9.46223,-73.5017,-32.3022,-68.3357,-28.5709,-41.9065,-69.6233,-39.7721,-67.2471,-19.2192,-80.0918,-16.2524,-77.4536,-73.1334,-31.7629,-67.8937,-27.5692,-54.0965,-11.2237,-51.6214,-8.68948,-45.6018,-74.0099,-41.8423,-68.9139,12.5526,2.00235,18.2336,4.62456,-45.4693,-39.5829,-39.6427,-36.819,-60.2822,3.05654,-57.3295,5.95279,-36.1453,-10.8617,-31.5458,-7.78584,-60.7644,-79.0775,-55.3271,-73.3536,-21.124,-9.76991,-16.7601,-7.18413,-12.0695,14.2803,-9.20401,19.0703,-40.3032,-53.869,-35.5584,-48.8458,-33.5453,-67.6379,-29.1479,-64.1317,9.81877,-46.8469,16.0797,-40.867,-28.5307,-64.2739,-23.316,-61.2004,-75.8488,14.303,-72.6034,18.8488,-46.9933,-38.8696,-42.8709,-34.7553,-41.7232,-59.5246,-36.8296,-54.7019,-28.6524,5.25585,-24.2063,9.58822,13.5812,-36.1608,17.2103,-31.5018,-30.3376,-46.319,-27.7718,-42.1095,-74.1784,-72.045,-72.1687,-66.973,-72.7017,-48.0641,-67.8494,-45.0295,9.08312,-37.3494,11.5194,-32.1983,-5.39893,-30.3025,-0.988544,-23.6543,3.26393,-4.46076,6.00032,0.791788,-25.4395,-25.6779,-19.6364,-21.0042,-17.5736,-64.5112,-12.4735,-60.1013,-9.81068,14.9455,-3.10366,16.8649,-53.4586,-22.5971,-47.5659,-17.6495,-54.9398,15.5618,-50.9841,17.8469,-42.8578,-60.6372,-36.9939,-57.6626,-73.0423,-9.77932,-70.4466,-5.49656,-14.7782,-44.1938,-9.61842,-40.2094,-38.569,-71.903,-35.097,-69.8916,-78.7615,14.2962,-75.1289,17.1047,-64.8684,10.4979,-60.1278,14.8889,-55.368,-31.1895,-51.5025,-26.1885,-65.3012,-19.9284,-60.3883,-13.7027,-24.9625,-41.9277,-20.3719,-36.4124,-14.273,-24.9794,-8.03413,-21.4325,-75.1622,-2.15679,-71.6371,0.767729,-42.4959,-0.532114,-36.2111,1.86553,-8.72413,-51.4352,-4.41877,-47.7567,-40.0413,-19.6435,-37.8594,-14.323,-42.3527,6.77723,-36.3766,11.926,-42.5742,-28.3393,-37.2193,-24.5087,-77.784,-7.22723,-74.5395,-4.05996,-23.4107,-30.4917,-21.1903,-28.3825,-38.4731,-57.5111,-35.7898,-51.5852,-49.0731,-22.0856,-44.8753,-18.4404,-21.6354,-39.739,-18.9609,-36.4826,-63.1812,-62.9047,-57.5494,-58.4229,-18.0598,9.25773,-12.2098,11.9076,-40.1788,-47.8758,-37.0466,-45.2759,-30.5677,-66.4242,-26.0421,-62.5721,-4.03139,-77.5237,-1.79499,-71.0264,-28.5886,-58.6319,-21.9052,-53.5955,-68.4888,-81.2799,-63.1373,-74.5465,-76.6935,-50.2447,-71.6564,-45.6893,-43.4949,-40.8621,-39.4455,-37.9143,-25.9968,-73.98,-20.4815,-68.7386,-78.1397,-14.3337,-73.0895,-8.41442,2.03004,2.18198,6.6134,5.89305,-81.6387,-21.0901,-75.4753,-15.1622,1.10503,2.24574,4.47382,4.37274,-12.7338,7.83737,-9.76614,14.1478,-30.2902,-69.7996,-24.7764,-64.7355,-78.9663,-56.2334,-77.1326,-49.8521,-6.86811,-61.3987,-2.10767,-58.9738,-36.7481,-40.5341,-34.0585,-37.438,2.34459,-34.1691,6.67848,-31.0521,-34.02,-20.5916,-31.1674,-14.2599,-67.3401,-64.5252,-62.4689,-59.9655,-65.4517,-9.40431,-60.2932,-4.2653,-37.6257,-4.65962,-35.3689,-1.53121,-10.4626,-31.1811,-6.22789,-29.134,2.08174,-5.70365,4.87924,-3.59338,1.16355,-38.4932,4.19922,-33.4517,-44.0699,-63.1515,-41.6964,-59.2918,-64.495,-29.0554,-59.7643,-23.1376,-11.659,-11.4817,-8.05971,-4.70051,-38.2777,-62.7393,-34.8524,-57.9224,-10.8872,-7.68678,-5.92325,-1.60539,3.6245,-41.5512,9.01182,-38.3189,-51.6896,-26.6051,-46.8497,-23.3231,-3.1364,-44.1175,2.18182,-40.806,-73.4764,-72.3862,-68.6176,-69.9848,-35.985,-34.7764,-29.5897,-32.1519,-38.0601,-11.6534,-33.9279,-5.01192,-8.10556,-61.859,-4.12489,-59.4222,-32.3002,-22.8358,-28.3135,-19.5343,1.72119,-75.1833,7.44146,-70.7908,-77.3948,-58.1677,-75.5874,-56.1583,-41.4941,-34.2465,-35.7988,-30.6737,-33.3012,-5.50174,-30.5801,-2.39645,11.0799,3.17217,13.7882,9.08359,-14.6109,3.77623,-9.76398,10.1546,-45.7262,-65.1003,-42.0009,-62.2882,2.2448,8.23152,4.11805,14.7265,-43.0672,-59.1347,-37.4804,-53.6716,-33.1645,-14.6904,-31.1891,-8.44871,-3.34545,-24.6021,2.32974,-19.8257,-36.6791,-43.7085,-33.4273,-38.9078,13.5601,-33.4818,15.7464,-29.3226,-77.851,-35.0477,-73.0509,-29.2742,-37.2458,-6.87976,-33.2832,-3.19784,-34.1493,-54.3792,-29.886,-49.6003,7.63872,-27.1549,13.9992,-22.5428,-24.8312,-37.6684,-19.3366,-31.6986,-47.6066,-78.8993,-42.1273,-76.6323,-26.8952,1.43157,-21.0109,3.38079,-34.8898,-13.0908,-30.9789,-10.6371,-53.1678,-57.6211,-50.5748,-53.4937,-78.9058,-44.1269,-75.095,-41.5005,-0.741622,-49.7317,5.83446,-46.5026,-7.24963,-22.8588,-1.43581,-18.3164,-48.211,-28.8267,-45.262,-22.1447,-36.2861,-30.7939,-29.5927,-26.1464,5.873,-36.5616,8.29022,-30.6085,-80.7475,-26.2301,-75.0358,-22.6527,7.05138,-5.67569,13.5119,-2.09405,14.1406,-58.4668,19.5419,-53.5834,-17.4151,-80.0928,-12.4422,-74.7048,-1.0335,-73.6552,5.45489,-67.2212,-0.8526,-73.092,2.57204,-67.3596,-75.366,-45.8087,-71.4381,-43.2907,-0.382337,-69.8285,5.93796,-63.0897,5.64807,0.876313,10.0163,5.0166,-47.1378,-66.9065,-40.3927,-64.9686,-31.6895,-54.0421,-28.1514,-49.3328,-47.6639,-56.6435,-45.616,-51.8661,-41.4779,-81.8189,-37.4358,-75.0815,-12.5011,-25.0001,-10.0161,-21.5809,-59.179,-63.415,-53.9239,-58.7732,-72.8741,-30.3732,-68.4628,-23.8916,-27.4829,2.98231,-23.7596,9.1723,-0.762113,-6.17013,1.6384,-1.83912,-12.5465,-56.5514,-8.3927,-51.3162,-42.9339,13.5836,-38.2314,19.0099,-1.77531,-63.7895,4.66661,-57.0216,-74.5831,-39.5764,-71.4796,-35.0371,-56.2122,-11.1551,-49.697,-7.60495,-62.4783,0.739249,-58.6824,2.98457,-29.576,-10.2623,-26.89,-5.99942,-64.5633,3.02425,-58.0918,7.23426,-42.3218,-33.2441,-38.4316,-27.2078,-39.9459,-59.5253,-34.2309,-53.1078,4.89327,-27.7715,10.3,-24.5792,-28.5157,-26.2079,-25.1614,-20.1875,-27.8492,-3.2793,-25.4873,2.75382,-54.5646,-75.5313,-50.4734,-68.7933,-57.6391,-76.6797,-51.5857,-74.5595,-14.3528,-5.58102,-10.1151,-0.237976,-2.21257,-3.33098,0.926155,3.09824,-39.1017,-54.9869,-34.4023,-49.1794,-63.6613,-1.51583,-60.1009,1.96331,9.95935,7.59604,16.5049,10.0273,-70.9138,-17.0704,-65.7087,-10.6089,-42.6709,-56.2945,-39.2591,-52.8227,-32.9071,-75.1089,-30.5639,-72.4298,2.88344,8.79724,8.40793,14.0346,-12.3773,-51.3351,-9.4811,-45.3114,-44.8755,-57.4868,-38.7637,-54.6346,-29.2519,-53.1347,-24.0509,-47.4584,-12.6739,-12.7107,-6.95734,-6.21773,4.74241,-21.5274,7.18895,-16.484,-2.8076,-50.2827,2.44471,-46.8948,11.8031,-3.71774,16.9907,2.06672,-34.8598,4.77794,-28.8283,10.2777,-59.682,-25.5046,-56.9231,-20.8551,-16.7108,-8.83063,-12.2314,-4.46391,-44.2046,0.133118,-41.3939,6.86125,-61.4689,-49.1185,-56.2656,-45.5133,-80.7164,-71.6524,-76.1529,-67.4629,13.6677,-25.8422,15.7753,-21.0411,-76.3046,-69.1884,-71.2259,-65.2759,-4.51436,-62.5027,-1.0779,-60.6938,-68.3357,-75.3019,-63.3724,-69.4786,-61.7979,-1.56088,-59.4307,3.43556,-59.5376,-35.352,-57.3139,-30.6696,-30.4411,8.43006,-26.3144,12.8346,-24.0863,-23.2648,-20.3477,-18.4181,-40.4296,-19.0545,-37.641,-13.8104,-17.5663,-35.9533,-15.503,-31.4119,-14.1014,3.83166,-8.77848,9.88356,-48.0704,-57.3787,-42.1532,-51.3617,-32.8063,-75.0278,-30.5655,-68.8643,-11.1728,-21.5332,-8.13248,-17.3618,-6.60132,-67.6439,-0.174355,-63.0439,-42.688,-39.2938,-40.4071,-36.1405,-73.5334,-63.8322,-67.7595,-57.1029,-79.8268,-21.0244,-75.8729,-17.4895,-6.93369,-14.0928,-2.54799,-8.08601,-60.4448,-7.16867,-57.5169,-4.15605,-3.74914,-67.1733,-1.02522,-60.7968,-25.0892,-28.6084,-19.5785,-23.2589,7.03565,-2.84277,9.42655,0.0540267,-26.5062,-67.0715,-22.5668,-63.9419,3.75525,-0.866075,5.76319,1.99281,-54.7473,-14.8291,-51.7781,-10.443,-44.934,-0.775242,-39.274,4.6341,7.38746,-67.4145,13.1374,-62.0379,-75.3478,-24.2773,-69.2395,-18.0446,-18.0348,-46.0329,-15.4921,-42.7793,-16.416,1.68176,-11.4536,6.36112,-13.9089,-19.0337,-9.93423,-15.2988,-14.337,-32.4058,-10.017,-29.0921,-14.7938,-19.967,-12.2329,-13.8109,-60.5575,-25.595,-57.2578,-20.5117,-35.9076,-3.41605,-30.8833,2.50091,-72.8287,13.6844,-68.0928,19.5712,8.47974,-28.0574,11.5957,-22.234,-13.6741,-65.1779,-10.9579,-61.066,-41.6408,-54.596,-37.1505,-52.5507,-75.1278,-62.1959,-69.4745,-56.2136,-8.12447,-55.8598,-5.02055,-49.5638,-54.5288,10.371,-51.2786,16.6486,-23.0653,-68.1346,-16.9757,-64.5373,5.88207,7.77092,8.18108,12.9402,-35.3272,-69.9277,-30.7757,-67.3762,-28.2122,13.4298,-24.148,15.9678,-54.1246,4.88194,-52.1452,9.561,-64.2607,-3.73174,-62.1761,1.19221,-63.1756,-42.8271,-58.6795,-38.1889,-66.9881,-35.0043,-62.6968,-32.3093,-14.7266,5.89804,-12.0645,12.2276,-75.5207,-18.7532,-71.6621,-14.2292,-17.5518,-51.731,-10.9327,-46.9877,-68.8882,-3.50286,-65.5892,2.06031,-73.456,-23.9147,-68.0972,-17.5372,-62.5371,-53.6169,-59.0706,-48.0427,-41.7997,-58.1463,-36.6894,-54.5952,-2.17605,13.0184,4.17773,19.3622,-41.4097,-12.1517,-37.0791,-8.61509,-62.4697,-61.4975,-59.3642,-57.9511,-27.4924,-67.3168,-25.0408,-63.0246,-38.2436,-4.46071,-33.8171,2.06981,-1.84332,-29.6356,2.1486,-25.9426,-14.9975,-19.668,-10.102,-16.4112,-7.3734,8.92818,-1.36584,14.3383,-69.9635,-62.3098,-66.9435,-56.1888,-72.0749,-57.8911,-67.1551,-52.2329,-49.1115,-67.0093,-47.0973,-60.251,-23.6404,-76.6597,-21.7271,-74.1744,-28.6861,-45.2163,-25.105,-39.2875,-30.2795,-61.5136,-23.5539,-59.6782,-3.61544,-13.4722,0.076192,-10.9989,-42.22,-5.88214,-35.7189,-0.381888,-48.6072,-77.0855,-46.3536,-74.1033,-40.6487,-16.5089,-36.683,-11.5175,-6.94497,-29.2333,-1.48678,-26.3787,-68.6328,-38.328,-63.0883,-32.2134,-18.0884,-71.7205,-11.9833,-66.7109,-62.6383,-26.1339,-60.2996,-23.4952,-29.634,-25.1169,-25.7797,-18.611,15.5353,-34.6006,17.9728,-31.652,-30.5577,6.20307,-26.5177,12.2101,-21.6039,-58.1556,-16.7387,-54.4956,-11.4647,-40.1161,-7.23112,-34.4306,-5.30285,-20.5134,-0.616794,-16.4461,-58.9063,-50.6997,-52.5657,-44.8324,-70.8681,-10.4636,-68.0958,-5.05278,-40.5472,-33.9761,-34.6457,-28.665,-81.4658,-37.0502,-74.7693,-34.1631,5.67129,5.58604,8.95876,7.75749,2.524,-31.1834,5.61801,-25.2964,-53.5071,-38.3321,-47.4243,-33.5719,-9.77778,13.4733,-3.04935,16.0616,-8.14106,-6.84335,-1.97044,-3.36637,-1.52992,-44.52,1.31904,-42.0004,-26.2378,-39.4108,-22.7009,-37.2005,0.407929,-62.7752,2.87696,-60.7726,-42.4436,-19.2577,-38.7776,-16.6055,-32.3485,-31.9783,-26.1277,-26.1126,-78.1635,13.6725,-76.1314,18.7123,-27.4939,-56.0794,-21.0112,-52.7304,-63.9565,-59.1159,-59.8507,-54.8641,-56.9148,10.1844,-51.3744,13.326,-17.2176,-20.2459,-11.2934,-15.3662,-47.2959,-21.8694,-43.1214,-17.4209,-54.2293,1.45824,-50.2792,5.93374,-69.5357,-64.0501,-63.3482,-59.1725,-62.1563,-70.5247,-59.6557,-66.0022,-19.8805,-38.5604,-16.7827,-34.4373,-37.9051,-7.36324,-34.9397,-3.19159,8.06676,7.28148,10.9656,13.472,8.17738,-15.3593,13.1444,-12.7469,-65.8918,-32.9624,-60.3546,-28.1218,-60.7868,-8.32923,-56.4026,-5.41343,-1.63303,-7.02323,2.0619,-2.4425,3.90439,11.5777,7.13255,14.1033,-51.7669,-77.8675,-47.6156,-71.1272,-27.6179,1.65906,-24.9962,7.02992,-34.8847,-15.4037,-28.2714,-9.19487,-11.5395,-41.2207,-7.99907,-35.6759,-61.16,-33.3802,-56.8122,-27.7066,7.76971,-45.3259,13.5651,-39.8919,-36.4055,-66.1619,-33.4643,-62.2058,-60.0384,-28.0402,-54.7645,-25.733,-43.2319,-53.6542,-38.204,-48.5402,-50.5773,-80.775,-44.8325,-75.6849,-23.4101,-20.3714,-17.7692,-18.4195,-54.409,13.4568,-52.5035,16.8899,-62.3538,-53.7609,-58.2836,-51.6903,-19.9077,-35.7023,-15.4817,-33.895,-12.8416,8.00991,-6.54431,12.273,-38.6861,4.29729,-31.8951,8.78978,12.1512,-42.0804,14.8294,-36.7844,-67.6433,-9.31839,-63.2995,-6.37791,-14.957,-15.1809,-9.09938,-11.0313,-36.7758,-39.9502,-31.5101,-37.9297,6.14935,-38.8577,9.58672,-32.7021,-13.6889,-68.3075,-9.55039,-61.6838,-65.963,12.3083,-61.0249,16.9301,-28.4929,-64.6245,-25.2726,-61.5272,-80.5032,-23.505,-76.5831,-18.9932,-27.834,-17.705,-22.7769,-13.0416,9.39788,-30.646,15.9797,-24.3056,-54.3525,0.352564,-51.4649,4.29895,-42.6307,-54.0884,-38.6576,-49.0816,-32.3185,10.6794,-29.1673,15.8383,-1.08409,-80.6841,1.61103,-75.6008,-33.1218,-19.4576,-26.72,-16.6914,2.87336,1.19642,5.5552,4.4757,-75.8028,-79.857,-70.1123,-76.0046,-77.1639,-21.4025,-70.844,-16.3581,4.12292,11.971,7.50759,15.3187,-64.1277,-21.7666,-57.6582,-15.2591,-20.1193,-39.327,-13.8462,-36.8778,-13.8623,-52.5145,-8.43243,-49.1801,3.33138,-30.6027,6.11703,-28.014,-57.4807,-46.8183,-52.7584,-43.4528,-50.5481,-6.34894,-48.2106,0.0245205,-24.4424,-36.3385,-20.367,-34.222,-62.0996,11.0451,-56.7925,16.6134,-81.1733,-46.577,-75.0533,-44.5287,-77.9503,-8.47185,-72.1384,-5.67676,-80.7957,-64.6044,-75.7948,-58.8157,10.6899,-51.3688,16.5048,-44.8676,3.57439,-16.4986,9.16606,-12.2931,-55.234,-21.9939,-50.3093,-17.3372,6.7339,9.77042,9.60939,14.7922,-62.1763,-67.3967,-56.5727,-64.7308,1.0254,-28.2908,3.38455,-24.9982,-63.5062,-67.1537,-58.5122,-63.8471,-71.8947,-51.2872,-69.7465,-45.1478,-37.4642,-67.9197,-31.3971,-61.5253,-12.4744,-20.1864,-8.58983,-13.7134,-35.9166,3.95198,-34.1156,6.83821,-35.6939,-38.345,-30.86,-34.6625,-31.6041,5.90522,-25.803,7.93851,-0.129718,-2.06273,2.6441,2.69746,-35.8574,-25.1522,-33.7227,-22.9054,-17.9441,-11.6648,-13.6851,-5.61308,-12.4565,-36.0034,-9.01129,-33.4214,-57.3195,-71.5946,-52.373,-69.78,-49.1297,-75.0558,-45.3892,-71.804,-7.71046,-60.8038,-5.90882,-58.9992,-70.0058,-28.9657,-65.0563,-23.6244,5.05977,-6.15589,9.96887,-2.55543,-19.9582,-42.0331,-15.7707,-38.984,-22.3677,-73.3418,-16.3057,-70.7712,4.03407,-29.3718,8.77999,-23.6733,-63.2203,-2.44996,-56.6187,0.628055,-14.3227,-37.3627,-10.9828,-33.2962,-66.3769,1.46267,-61.8976,7.59985,3.0197,-26.7469,8.35969,-22.4893,13.9376,12.4697,15.9108,14.3638,-17.9412,-2.60208,-11.8681,0.896769,-23.7047,-33.5305,-19.1628,-29.7166,-64.0153,-43.0284,-61.1876,-37.0326,-1.02152,1.32135,4.25853,3.41676,-37.9303,2.20694,-32.4206,5.86853,-60.1311,-65.6198,-53.568,-63.7467,11.0485,-30.3361,13.7795,-24.5271,-79.4515,-13.9037,-75.7244,-11.6604,-19.3862,-0.728465,-17.1995,2.42805,-34.7952,-22.8593,-31.5642,-19.4782,-37.8531,-48.6804,-32.0842,-45.8858,-42.4307,-40.9472,-40.4546,-35.5204,-72.3531,-4.49586,-70.4435,1.80554,-10.0062,5.11756,-7.98011,9.44202,2.16167,0.697018,8.87746,2.70635,-25.2128,-13.3162,-21.8821,-6.93997,0.342747,-6.79199,2.83139,-1.02024,6.82975,-33.6759,10.6051,-31.0789,-11.2925,-50.6469,-9.07543,-44.1675,-78.0362,2.29473,-73.2073,7.56784,-60.2479,-14.9172,-57.9966,-10.5508,-30.4484,-16.2407,-27.3745,-11.7718,-39.9714,-68.3752,-34.6256,-66.1034,-36.9005,13.7503,-35.0696,19.1787,-1.94255,-43.8125,0.00978942,-38.2889,-23.6682,-15.1317,-21.7024,-13.203,-24.0292,-4.67351,-21.9338,-1.21963,-16.9458,-28.9091,-10.2387,-24.2614,-34.4053,-6.81275,-28.1629,-0.155005,-73.2645,-19.6354,-68.9597,-13.489,-8.49437,-43.8495,-4.27075,-37.8975,5.86165,14.0557,10.4894,15.8856,-5.05012,-0.513528,-2.18298,5.0115,-58.1332,-72.0758,-54.8768,-68.8616,10.5574,-68.1294,15.359,-64.6417,-25.3253,-21.3193,-19.3827,-18.5808,-50.8151,-22.388,-44.8508,-20.5218,-0.842524,-1.03936,5.26617,4.75507,-79.3463,0.787009,-74.1529,3.86057,-18.1799,-0.710355,-14.5881,5.62726,-10.2414,-38.8597,-5.5834,-34.6924,-50.5359,-79.2772,-46.4306,-76.8111,-74.2556,-77.0427,-71.0555,-72.9093,-27.4096,-50.1587,-25.597,-44.6783,-56.9456,-56.2369,-55.1187,-52.277,-2.2446,-34.5287,3.85682,-30.2917,-13.661,3.58773,-11.4394,6.97484,-76.3422,-16.4565,-71.9942,-12.1365,-79.0976,-27.4724,-76.1868,-21.1267,-9.73557,-37.3063,-4.14086,-33.0913,-54.3536,-53.2944,-52.4232,-50.069,-9.51374,-30.9023,-4.62111,-27.7254,12.0172,13.2253,18.4301,16.4291,9.37998,-74.93,13.4416,-70.9697,-23.2922,-4.10242,-18.0609,-1.27522,-66.5853,-30.1129,-63.7475,-23.3909,-56.9972,-74.3953,-53.5831,-70.979,-43.5263,-38.5796,-39.5607,-33.6433,-20.9272,-63.3986,-18.6667,-59.3816,-30.2804,-79.1762,-26.1292,-73.2497,-40.345,-2.46896,-34.3855,-0.468867,-50.7598,9.59233,-47.4245,11.6565,-32.4914,-73.7042,-30.1889,-70.8644,-39.1254,-62.2886,-36.4106,-56.0505,-11.5695,-34.0522,-9.57026,-27.6283,-33.0183,-44.3178,-27.9991,-38.3894,-21.4467,-38.2791,-18.1579,-32.7514,-56.0661,10.3878,-49.4495,13.8398,-52.782,-26.1789,-47.3651,-23.2216,-18.6774,-9.60307,-13.2454,-4.05166,12.7446,-60.4799,17.2704,-58.5092,-18.0363,3.99947,-12.1672,6.19419,-72.5725,-48.7488,-70.0155,-42.4862,-29.3623,-67.6445,-26.1498,-65.563,-19.374,-27.932,-14.8411,-24.4361,-0.892258,8.20804,1.80558,14.9214,-28.7987,-4.28096,-26.5732,-1.88213,-26.649,-17.5375,-24.4477,-11.2538,4.46564,-80.9433,9.72469,-76.7632,-47.2631,-39.2922,-41.4919,-34.8984,3.14759,-42.9741,5.55369,-36.9971,-16.2478,-46.8244,-11.165,-40.5081,-45.6428,-54.3439,-42.7269,-50.209,-30.244,-0.244639,-26.7376,3.51313,-7.93588,-71.0482,-5.09341,-67.5503,-69.1113,-39.2572,-65.9346,-36.0077,-37.5145,-7.67355,-31.1183,-5.78299,8.29962,-16.4508,12.4593,-12.3295,-70.5181,-47.2105,-65.3178,-45.2838,1.51795,7.10554,5.42041,13.1029,-66.4814,-77.0946,-60.7806,-71.8691,-30.0991,-20.7994,-25.9623,-14.1108,-35.0411,-19.6605,-31.5409,-15.4041,-73.0652,-75.4199,-66.3186,-72.9952,-30.0839,-53.0078,-27.3987,-50.1446,2.51159,-12.8904,7.62417,-11.0593,-81.3711,-4.57193,-76.4325,1.94459,-5.72737,-58.253,0.750663,-52.8174,-49.852,6.01006,-48.0141,12.1247,-11.2681,-4.6098,-7.76868,1.47901,-71.5083,-16.7945,-65.3773,-13.5765,-63.4421,-16.0614,-61.0659,-11.7607,-12.2937,-47.7711,-8.27287,-42.8144,1.21598,-67.775,6.9247,-62.7049,-43.6152,-43.2772,-38.6895,-38.0855,-27.6224,-48.6427,-25.7022,-45.0802,-24.0726,-27.4918,-21.9499,-22.2533,-35.9056,-53.5515,-33.3016,-48.8378,-64.7932,-21.7502,-61.7988,-15.3371,-35.7191,10.8229,-33.0415,16.71,-70.2219,-1.71135,-67.2748,3.13097,-72.5885,-17.6427,-68.1025,-14.2079,-77.9241,-60.1551,-74.365,-57.3504,-26.7742,-59.0308,-23.8445,-53.2472,-57.6685,11.5843,-53.6118,15.5505,-54.5219,-64.6878,-51.7998,-61.9104,-68.4023,1.60028,-65.6544,3.67737,-34.0789,-72.3623,-31.2379,-68.968,-67.3119,-20.8459,-63.95,-15.0867,-70.3618,-11.7235,-68.1188,-6.84942,4.04361,13.4216,8.45594,16.3663,-1.38272,-0.750531,1.22862,4.38693,-70.1737,3.2839,-67.0479,7.2344,-29.1362,7.04563,-25.7958,9.63777,-16.1266,-3.65856,-12.5543,1.99472,5.32702,-71.5684,7.80895,-68.1649,-71.8202,-25.897,-68.4559,-20.47,-57.5571,-74.5668,-52.9003,-71.6233,-20.7178,-58.4435,-15.2504,-53.64,-70.3839,-55.702,-66.7968,-50.9437,-15.4857,-29.4565,-11.5843,-27.3859,-21.8994,-53.0022,-16.7857,-48.7319,-70.8266,-7.48171,-67.8808,-4.32775,0.0811068,-0.616623,4.11319,1.86235,-11.2559,-19.1968,-8.77855,-16.3533,-74.4313,-54.1514,-70.6542,-51.0869,-72.3557,-40.1614,-66.2252,-34.9165,-61.9832,-38.6064,-59.865,-35.9629,-42.9898,-22.5977,-37.4959,-16.8902,-14.3319,-80.1447,-10.1948,-73.4014,0.878535,-52.8795,3.02144,-49.9059,-14.798,-28.8286,-9.61514,-22.1194,-51.9307,-65.1299,-46.0253,-61.4334,-46.0596,10.7772,-42.321,12.8574,-55.5677,-63.5055,-52.4809,-58.6263,-72.8831,-8.47093,-66.3008,-5.28042,-39.6674,-61.001,-33.5571,-55.6549,-62.7717,-39.3626,-58.1165,-36.0597,-12.7384,-17.6133,-5.97906,-11.2837,-43.0331,-62.5683,-39.6882,-58.1892,-6.34556,-73.4735,-3.999,-68.0684,-60.2042,-23.7399,-58.2728,-17.723,13.5993,2.35931,16.4439,4.64619,-40.5599,-60.4149,-36.7538,-54.3977,-5.25993,3.70177,0.496629,7.17915,-4.41537,-78.4157,2.28411,-76.2008,-71.2595,-41.8771,-69.3894,-37.9719,-25.1834,-33.0597,-20.9271,-29.8063,-20.1593,-1.29345,-14.1559,1.21143,-12.4408,-21.5487,-8.12093,-17.2042,-75.6184,-68.4644,-70.4252,-63.8487,14.2231,-25.9255,19.6194,-23.9797,-56.6946,-78.8524,-54.7769,-72.1192,-68.7094,15.5114,-62.4465,18.3083,-39.4984,-52.1613,-35.7244,-49.7523,-27.3921,-16.7037,-23.9896,-10.4652,-47.1405,-76.3213,-44.7354,-70.9214,-64.9139,-16.1353,-62.8554,-12.4759,8.04067,13.395,12.2319,18.7674,4.43216,-52.0422,10.7852,-48.3318,-19.1569,-19.36,-12.7778,-14.5342,-63.4077,4.71055,-58.1689,8.12904,-35.4082,-47.6962,-28.9273,-45.7109,-63.7806,10.2216,-57.7205,13.6028,10.9782,-49.9359,15.6855,-45.1792,-72.8145,-5.34055,-69.0645,-2.12493,12.0061,7.81274,18.4951,10.97,-51.7734,-71.5484,-46.9237,-68.4804,-68.7378,-52.0798,-65.0952,-46.1866,-15.9489,-43.8824,-12.1027,-41.3344,-67.6755,-59.2689,-64.3215,-56.2049,-77.4502,-49.1848,-71.1867,-46.5308,-41.0235,-63.832,-35.5146,-59.4894,11.7039,-11.9532,14.3886,-6.88146,-29.3229,-6.95775,-24.7115,-1.05059,-24.8528,-47.6228,-22.5468,-45.2258,-26.0375,-57.5636,-19.3851,-53.9317,-67.0618,11.0085,-61.7723,12.9155,-25.6437,-40.1215,-20.5825,-36.9963,-51.4798,-60.1601,-45.3598,-56.0786,-29.119,-32.0378,-22.5387,-27.1781,-20.0689,-59.2758,-16.6705,-54.9871,-56.3936,-75.0829,-53.2426,-69.391,-16.0869,-65.1313,-9.54341,-61.1087,-4.64914,13.3258,-1.37731,19.1128,2.52253,-37.3139,5.17499,-33.2373,-66.7178,-16.0137,-63.4343,-9.73398,-23.5546,-31.3952,-17.4371,-26.8526,-26.1314,13.4936,-23.028,15.4873,-63.6231,-72.11,-60.7274,-69.164,-66.0721,-59.2561,-64.2471,-53.6304,-63.8812,-72.8155,-61.4435,-70.8549,-17.3212,5.84654,-13.8011,8.95238,3.00719,-15.1443,5.55197,-11.1988,-77.2554,-3.488,-71.023,1.2897,-29.2162,5.29199,-23.8817,8.16417,-41.5893,8.60555,-38.4974,11.4824,-65.7011,-77.3889,-60.4525,-73.6602,-26.6488,-29.7394,-23.2248,-26.7139,-55.4737,-30.8996,-50.9316,-26.782,-16.758,5.90419,-10.0865,11.9776,-30.2674,0.870581,-25.1363,5.68914,-5.52905,-0.777428,1.08825,4.4976,-72.4927,-21.5819,-66.6546,-17.7096,-41.3398,-16.227,-39.1372,-11.7697,3.66233,2.77096,7.2887,6.91863,-19.6582,-52.0842,-17.2438,-46.707,-4.94322,-14.0115,-1.6082,-7.47693,-52.9257,-16.5834,-48.4032,-12.5519,0.575495,-67.5449,4.06166,-64.6605,-35.116,-52.3915,-31.2755,-48.7982,6.0086,-35.8916,11.6577,-29.1539,-19.7433,-75.6378,-15.8663,-70.5526,-46.0931,7.92349,-41.6884,11.4254,-76.8962,-51.5967,-73.7299,-49.3579,-23.1709,-2.42995,-18.0689,3.79971,-10.0435,-42.8851,-4.49036,-38.3132,-7.22582,-25.3317,-5.17128,-19.9334,-60.3132,5.13781,-54.3347,8.32518,-20.0525,-10.8933,-15.8323,-5.47822,15.5332,-63.4708,17.6828,-61.0253,-58.454,-6.2845,-52.6721,-0.551185,-66.8578,-65.35,-63.4861,-59.09,-20.4241,-20.2414,-13.6899,-14.5643,8.59052,8.06134,13.646,13.4902,-61.8283,-44.6392,-56.2895,-41.5898,-74.7432,-68.2709,-72.5733,-62.0049,8.6573,3.63823,15.4413,7.59998,-29.8627,-39.3593,-23.578,-36.2322,-23.0687,12.3926,-17.117,19.1318,-17.2969,-28.3606,-11.0695,-22.9028,-76.6405,-32.2137,-71.1663,-27.4033,-52.0234,-76.5655,-47.9573,-73.8451,5.47723,-22.9946,11.7478,-20.4456,-19.0729,11.2863,-14.9857,13.5246,-69.7735,-9.25095,-66.5063,-5.75949,-3.08389,-59.9692,-0.570721,-54.7143,-12.759,2.44153,-9.98696,7.47275,-7.54005,-56.5484,-3.23658,-54.6353,-57.8006,-19.288,-54.649,-15.0574,-75.337,-10.6238,-72.1513,-5.64272,13.7352,-22.2898,16.1553,-19.3662,-34.91,-60.7431,-29.6747,-54.875,-58.5726,-56.7878,-54.9634,-54.3877,0.358264,-26.7212,4.78927,-23.7531,7.82487,-54.2523,10.8826,-47.5871,-50.4154,-21.3036,-44.2919,-16.3799,-12.8099,-8.96105,-6.97896,-6.3455,-31.6478,-11.5057,-27.3725,-5.26087,-5.36477,-34.186,1.03931,-29.5141,12.9592,-55.1229,16.6627,-52.0201,-53.9249,12.5296,-48.5391,16.8022,-28.8427,-41.5916,-22.3625,-34.9747,-60.8402,-35.2164,-54.759,-32.8799,-32.3552,-71.1684,-25.5972,-65.3943,11.3279,-37.791,14.1269,-34.1331,-77.5448,-69.7704,-75.3911,-67.0119,-17.7468,-72.9535,-11.9611,-70.6821,-3.65157,11.6133,0.973872,17.4313,2.88744,-35.9703,8.77635,-32.5795,-24.6561,13.4805,-19.5902,20.1925,-70.0012,3.66501,-67.0827,6.18983,-75.5684,-56.5667,-73.3016,-51.1298,-17.7293,-36.4179,-14.9998,-32.0578,-0.785027,-16.2905,4.70039,-14.4145,9.23032,-64.4789,15.5505,-58.6238,-23.0722,3.15128,-18.0907,8.59861,-23.3264,-79.7896,-17.6385,-73.694,-54.8879,-47.8015,-51.8616,-41.6784,-47.4442,-10.8553,-43.1578,-6.04551,3.33611,-34.5912,8.02435,-28.4728,-49.9101,-34.1344,-44.2429,-28.4315,9.01361,-69.8018,12.0336,-63.2288,-77.4108,-14.2723,-73.2238,-12.2172,-0.564574,-15.4712,5.35654,-12.9431,-39.2023,-49.9319,-36.1168,-43.2813,-50.5792,-19.0249,-48.5087,-16.0877,-34.226,-68.3864,-30.571,-64.0441,-32.9402,-55.5146,-29.7841,-52.3439,-58.2966,-71.9242,-55.4968,-66.0901,-20.0811,1.30212,-13.8263,7.58512,-32.8122,-51.6695,-26.8316,-45.9158,-33.7505,-12.4153,-30.9987,-10.1678,-60.3155,-67.8989,-58.132,-65.0227,-4.49225,-34.9457,0.743482,-30.7707,-59.3902,-27.3131,-54.0556,-21.5413,-36.1531,12.9986,-33.1656,14.9227,-24.2604,-50.7685,-19.1572,-46.567,-56.3449,-30.6863,-50.4996,-27.3987,-4.40712,-38.8184,1.60933,-36.2062,-61.4147,4.11593,-58.1262,7.73298,4.82948,-32.9388,8.31346,-30.5915,-33.0651,-74.753,-31.0218,-72.6107,-25.5344,-28.0136,-22.0884,-22.4553,-74.5304,-31.8596,-70.8663,-29.202,-78.8633,11.5466,-75.5772,17.4943,-51.189,-80.4233,-44.7073,-75.1485,-8.03424,-41.0611,-1.51795,-34.801,13.4001,-77.5092,18.5218,-72.6598,-73.2136,-7.21152,-67.4805,-2.64669,-55.493,-27.1593,-50.4018,-24.0199,11.9698,-59.2067,17.2555,-57.02,-20.4022,-51.2904,-13.8563,-45.0964,-2.02485,-9.86567,0.229719,-6.16766,-3.94351,-28.6457,2.12049,-26.3133,-16.8526,-6.35035,-10.7893,-2.09534,12.5279,-7.01222,17.8375,-2.56116,-21.3816,-41.5453,-19.4918,-36.5219,-62.929,-20.014,-57.0997,-15.3785,-72.4916,6.95518,-70.1717,9.86222,-11.6697,-49.7655,-7.57018,-45.3146,-40.2475,-77.091,-35.4308,-70.6295,-34.3518,-36.4124,-28.8717,-32.5905,-13.7657,-65.5624,-11.4154,-59.6918,-68.8375,-11.5804,-65.019,-4.82254,-75.4992,-33.4288,-72.9946,-31.2268,-8.49269,-8.37238,-2.76596,-3.68238,-51.6198,-24.7996,-46.4575,-18.1605,3.9949,-39.0812,6.91791,-36.014,-57.376,4.59404,-52.8693,9.44958,-47.0866,-8.07748,-43.2399,-4.21801,8.2583,-12.0642,12.3018,-8.68171,-26.3159,-74.8631,-19.8433,-72.8437,-74.6647,-30.9852,-70.1901,-27.2548,2.22821,6.35437,7.48238,11.8878,1.14589,-33.7353,6.70568,-27.6865,-20.9771,-51.8303,-15.6916,-49.1372,-16.4359,-66.3038,-14.3354,-60.0764,8.02943,-33.9415,12.9104,-28.456,-46.0979,-4.90419,-41.4309,0.787906,-51.7207,-8.86008,-48.5947,-2.85796,6.33608,-37.7168,9.26355,-33.6907,2.33506,-25.0133,4.65776,-21.1475,-75.8144,-58.953,-72.0184,-54.3647,-24.7466,-52.4625,-21.3434,-47.3149,-55.357,-63.843,-52.8083,-61.5644,-78.7915,11.1804,-76.6001,17.927,-62.8586,-37.2861,-56.7347,-31.5105,-14.3024,-23.7271,-8.84268,-21.037,-5.00546,-39.8466,-1.08326,-36.3091,-9.91876,-72.6899,-4.1772,-69.0899,-51.1014,-80.3125,-47.0687,-75.6049,-6.41279,1.36718,-0.471552,5.02932,-50.0298,10.7679,-44.7344,13.8386,-0.838153,-12.4182,4.11453,-9.10977,-8.37702,-17.3181,-3.39082,-14.3907,-11.6365,-0.630596,-7.26187,1.80835,-70.0785,-45.6824,-63.565,-40.4019,-19.4021,-18.9912,-15.3804,-13.6393,-47.1757,-49.6235,-41.2139,-44.3545,-46.7342,-51.7502,-39.9689,-49.2278,-17.9871,-70.9777,-15.9521,-68.8962,-11.6588,-53.9494,-6.11876,-51.4727,-13.6337,-57.3544,-9.63425,-52.4505,-77.3137,-34.9074,-72.7622,-29.5432,-22.7142,-55.5492,-19.8119,-49.2648,-60.1426,-66.5538,-53.638,-64.373,9.23504,-59.8794,14.3509,-56.9256,-0.182901,3.03207,4.20756,8.24499,3.38752,5.88613,5.77507,11.2412,-32.352,-69.8672,-27.2111,-66.732,-54.2416,-24.9646,-49.3234,-19.1733,-25.5899,-27.3524,-22.8729,-22.5783,15.1734,-14.2523,17.5755,-8.90561,-72.8741,-67.179,-68.805,-63.9087,-13.567,-26.3574,-10.1099,-22.3659,-10.8163,-71.1312,-5.14826,-67.2591,-76.9481,-21.8899,-70.9183,-16.5742,8.63214,-39.6887,12.6791,-36.4997,-65.0725,-9.61117,-59.5304,-4.6058,-42.9849,7.4433,-38.109,9.43542,-57.7248,-65.2794,-54.7872,-61.7228,-28.3632,0.564701,-25.3405,6.23588,2.31283,-4.57879,6.8189,0.510536,-51.708,-23.8903,-47.8786,-19.5775,-67.7914,-71.2077,-64.5213,-66.4934,6.31606,12.751,8.26276,15.6535,-74.5363,-49.985,-69.3504,-45.7198,-71.786,-34.8684,-66.0192,-32.2996,15.4091,-23.8287,17.8068,-17.0825,-12.4402,1.06948,-5.68648,5.65483,-46.1451,-8.25242,-42.0252,-3.28728,-14.9798,-13.4325,-10.0212,-8.92939,-2.13375,-39.7349,1.33721,-36.7937,-26.7287,-24.7695,-22.209,-21.4342,7.55817,-70.897,10.2578,-65.5644,-52.9737,-31.5639,-46.6946,-26.889,-10.8704,-54.5754,-7.7286,-48.6504,-19.2363,-7.88354,-14.4918,-3.89682,-74.4737,-40.9796,-72.0707,-39.1238,-15.6409,-10.7184,-12.9785,-6.45547,-29.3024,-12.3902,-25.3765,-7.44778,-15.4437,-21.8325,-11.0493,-16.0953,-36.705,-60.7955,-34.4046,-55.3816,-75.8622,-59.8869,-72.9106,-54.5175,-28.1466,13.0046,-25.3984,19.5045,-1.15082,-46.9742,3.20439,-42.5943,-3.52145,-39.0447,0.528543,-36.3903,9.09,-60.4917,15.6215,-57.3636,-48.6131,-38.3483,-46.008,-32.7026,-11.1139,-11.4283,-4.99089,-6.91737,-52.3383,3.22193,-50.1935,6.62486,-20.9205,-67.8257,-15.4119,-62.1268,0.0713513,-46.5985,3.53199,-44.1189,-59.8087,-64.9696,-54.9115,-60.1328,-38.6999,-79.2801,-36.1223,-72.7454,-71.4664,-70.0728,-68.0018,-65.2303,14.8119,-70.5397,16.7412,-67.3345,-41.1556,-3.73316,-36.3931,-0.403347,-1.05951,-7.61322,4.97498,-3.9211,-10.0011,-49.4094,-5.43232,-42.6125,-10.3332,-63.9843,-7.39618,-60.5991,-65.1476,-16.8073,-58.5551,-11.545,-39.3257,-20.4453,-36.5791,-14.2028,-74.5643,11.9694,-69.6896,15.7042,-61.9508,-65.5428,-59.7278,-61.4468,-56.8392,-44.8094,-51.9409,-38.4675,-55.4921,-17.9952,-53.0045,-14.9253,5.56936,-72.486,10.75,-67.0121,-50.4443,-20.5627,-47.7475,-17.9368,-2.08277,-1.32772,0.575146,5.19031,-8.7277,-47.6523,-5.86046,-45.2467,-56.5206,-70.445,-50.5285,-63.9854,-6.6686,-36.6228,-4.48965,-32.7324,-26.6108,-0.977604,-22.7999,2.45188,-1.18001,10.411,1.64991,13.9008,9.89783,-73.2422,13.0655,-70.3118,-18.7408,-33.911,-12.1318,-30.5109,-52.1035,-31.9792,-46.6222,-25.5448,-66.7348,-10.5034,-62.9845,-7.23954,-68.6698,-39.71,-63.3504,-33.0928,-33.1807,-8.68495,-26.4843,-5.53013,-75.7906,-32.422,-69.4419,-27.4454,7.78318,-66.9695,14.5245,-64.7953,-55.9762,-55.0599,-52.2182,-48.9276,-45.3807,-57.1941,-41.1749,-50.9037,-62.5953,-40.449,-57.9022,-37.1273,-4.7414,-25.2857,-2.62598,-20.9514,6.76663,-58.1763,9.29659,-52.033,13.254,6.5768,19.3148,9.88961,-64.5762,-16.7569,-59.1612,-12.3073,-6.56862,-43.6377,-2.20783,-38.3442,-9.28586,-58.5647,-4.17035,-54.8914,-34.558,-18.7238,-30.2813,-13.7544,-63.189,-32.422,-60.5909,-29.4734,-76.3547,-62.5143,-74.0068,-57.668,-46.8903,-7.94857,-44.2942,-5.63328,-45.8503,-26.7442,-41.9049,-21.7527,13.2781,5.26121,17.6086,7.19868,-44.972,-48.3092,-41.4788,-41.5844,12.7186,-35.176,15.9258,-30.0082,3.70776,-51.8721,7.67732,-46.2256,1.94214,5.13705,5.37426,10.1092,-1.76938,-55.1945,0.631233,-49.2101,-0.495095,13.553,2.29091,18.9663,8.13248,-1.63138,14.6587,0.74186,-51.1598,-62.8386,-46.1433,-58.1797,-33.3436,-5.28051,-28.265,1.31057,2.47783,-35.3254,5.54582,-31.8617,-62.6612,-8.43427,-57.3764,-6.58245,-3.54007,-68.7932,0.00209235,-64.2564,-67.4283,-80.6322,-65.1803,-77.0715,-16.226,-22.0098,-13.0551,-20.0037,-11.0363,-55.9758,-6.7829,-51.2083,8.63671,-15.0485,14.0768,-10.3482,-9.60261,-58.863,-7.73221,-52.7054,-53.2976,-57.1427,-49.8546,-53.8385,-61.6964,-0.583713,-57.1982,3.63683,-22.5981,-47.8125,-17.4021,-43.3027,15.6402,-76.7397,18.2602,-70.8411,-58.6086,-29.7617,-55.6149,-24.7104,2.57849,-24.5436,6.09104,-21.5557,-54.4822,-36.5179,-50.7065,-30.7809,-1.14206,-79.263,5.39046,-76.5874,-70.5278,-24.8573,-64.8833,-18.3111,-33.2486,-58.5687,-28.2304,-55.7723,0.584353,-10.8574,3.51016,-8.6679,-61.6798,-61.153,-58.057,-57.5497,-6.3738,7.56989,-2.4181,12.0829,3.39838,-53.8046,9.22519,-48.9473,-14.6938,-77.5243,-8.76153,-72.7154,4.14048,-13.6926,9.89701,-11.454,-3.03589,6.54006,3.28434,10.3178,-48.7235,-11.0728,-44.6932,-6.84263,4.39673,-74.5523,11.1599,-68.3992,-26.1557,-52.8665,-20.5056,-49.9034,-48.7652,-46.4287,-43.1901,-40.1367,-25.2034,-77.0079,-19.9256,-73.7005,5.94305,-44.3178,11.1234,-41.5104,-51.3397,-74.9589,-45.5461,-69.9764,-17.2496,-37.1569,-13.8523,-31.1525,-62.9523,-60.9854,-57.1619,-55.5286,-79.8923,-40.1713,-77.0985,-37.4687,3.11131,-1.40778,6.83857,4.16881,-57.9761,-77.5408,-55.7922,-72.7851,-39.367,-29.7471,-36.6008,-22.995,-57.4198,-57.1577,-54.4979,-52.9879,-3.29922,-65.7294,-0.486417,-59.3789,-76.7994,14.2052,-74.1212,19.0971,-33.9849,-20.1748,-29.4345,-18.3012,-18.4592,-76.8575,-14.7493,-72.2802,-76.774,-60.8087,-70.5622,-54.2697,-21.2382,-0.768686,-14.9375,3.47229,-52.811,-43.949,-47.5763,-40.6257,5.80318,-59.7059,12.5568,-57.2455,-64.631,-0.408742,-60.0006,4.15273,-20.02,-22.2998,-13.8616,-18.345,9.39909,-73.9335,13.6169,-69.0797,-22.0352,-20.5498,-16.39,-18.4838,-23.2142,-63.1159,-20.9096,-59.6778,7.74639,-17.4331,13.3628,-12.9845,-1.46498,-10.2369,3.83763,-6.90939,-74.8676,-53.1505,-68.9969,-50.5133,11.387,-45.2983,16.0958,-43.2828,-38.3325,-33.6741,-33.9878,-27.5728,2.03001,-27.3602,5.62121,-24.2097,-2.58067,-11.2519,2.46145,-8.68742,8.09994,-45.9624,14.0963,-41.7119,-80.8099,-21.6256,-74.686,-17.0467,-5.67035,-62.919,-1.88141,-59.1342,-19.1908,9.81889,-15.4681,14.3074,-32.6358,-55.0967,-25.8394,-48.8246,-73.579,-64.5673,-71.6062,-60.6477,-24.3127,-18.7024,-21.4755,-15.9203,-48.5077,-79.7972,-45.6078,-76.9795,-45.868,-40.3697,-42.335,-34.27,-49.0118,-60.043,-42.314,-55.93,-26.5656,-7.62789,-19.8249,-5.1665,-72.1696,-45.6569,-70.0346,-40.9503,-36.8293,13.8678,-32.668,19.1135,5.61915,-21.8157,11.965,-15.0375,-43.4667,-0.465022,-37.4726,3.94683,-33.6591,-59.839,-28.1815,-56.7738,-47.4168,-71.488,-41.2596,-65.9783,-29.7264,-51.5867,-24.329,-45.5261,-13.6497,-30.5014,-9.95297,-27.6895,-70.3831,-11.0611,-68.4998,-6.18966,-57.7648,11.4702,-51.1734,13.7163,-68.1525,-1.66222,-64.9457,1.35212,-1.96679,-5.02851,0.832928,0.466878,-36.1235,-26.5162,-33.2291,-23.1498,-68.4987,-60.5649,-65.7355,-55.0029,-2.52526,-51.0541,0.701711,-48.049,-20.9271,-39.8715,-16.8505,-36.0171,-6.53539,-59.1697,-1.36917,-54.9283,-12.5754,-26.144,-10.1477,-23.8509,-78.8708,8.27174,-74.9066,11.7302,-64.0178,7.79821,-61.3727,14.0012,-40.781,-20.382,-35.0248,-18.2601,8.9129,-1.93883,12.496,1.2666,-45.805,9.81928,-39.7095,13.2096,-79.2623,-59.5887,-75.3279,-54.7512,-20.6965,-31.8853,-14.5436,-27.1202,-69.3943,-62.8824,-66.1622,-60.7738,-22.7112,-48.8864,-18.9291,-42.7612,-8.99659,-75.787,-2.4065,-69.2224,9.61785,-20.9669,13.9214,-15.2057,-71.9821,3.2632,-65.9585,5.50434,-21.5573,-32.9812,-15.9492,-26.6688,-27.0246,6.67772,-23.8516,13.1101,-27.2685,-70.3232,-23.5181,-64.7553,15.0493,-62.7606,16.8779,-58.3963,-14.2794,-74.546,-10.4257,-67.8657,-38.7451,-31.4493,-34.0094,-24.6517,-67.7363,-46.2294,-61.9126,-44.2797,-29.9282,-79.6094,-26.3955,-73.5766,-0.959643,2.94711,1.60052,8.68049,-73.2412,-65.1055,-71.0904,-63.1142,-69.6536,-73.9403,-66.5358,-71.6321,-36.4977,-11.9308,-29.9696,-5.26047,-74.2487,-46.8537,-67.831,-41.1789,-62.8658,-5.1157,-60.0529,-0.423695,-77.6272,-62.22,-73.8049,-60.3987,-72.8818,-6.94752,-69.6638,-1.00634,-15.7119,-15.8571,-9.54133,-13.9909,-64.8329,-31.3182,-62.3375,-25.5215,-0.653002,-30.9956,5.20091,-25.0654,-28.9531,-59.678,-26.1831,-57.3591,-41.9696,-7.99173,-39.99,-4.8823,13.6253,-54.7366,19.7096,-48.4018,-54.9605,-75.2625,-51.8569,-72.2216,-62.332,-6.70503,-60.2338,-4.48236,-4.22516,-24.9622,1.72702,-18.2057,-54.1228,-77.8339,-47.9535,-73.2146,-73.0345,-36.4799,-70.7801,-33.3632,-77.6209,-21.6373,-72.8101,-16.7192,-16.778,-59.3658,-12.1213,-56.1424,-55.6379,4.5056,-50.2882,7.54813,-9.52838,-17.0526,-6.44853,-14.7339,-64.5827,2.76961,-58.4831,8.29354,-63.3799,-15.9207,-58.2567,-9.85011,-36.7541,4.45288,-33.5417,7.23349,-24.465,-34.4666,-19.7245,-31.0261,-5.04314,-66.9236,-1.16109,-62.7354,-53.2979,3.46789,-47.3,6.41779,-61.2248,-52.9267,-57.2829,-49.9446,7.77183,-64.2475,11.6643,-60.6712,-75.5587,-72.6924,-72.793,-69.8294,9.59613,-40.4406,16.2377,-35.3831,14.8098,-20.0998,17.332,-14.1944,-46.3992,-55.1295,-40.8982,-49.5447,-52.1701,-30.7286,-50.2813,-25.3765,-61.8788,-51.9128,-55.1599,-47.5897,-32.3366,-59.0904,-28.8242,-53.5026,-14.2017,-74.8774,-10.9898,-70.5834,-74.4713,-5.65633,-71.9655,-3.03138,-68.2154,-7.7974,-62.7799,-2.04718,-17.8908,-45.406,-11.9165,-42.5287,-42.3061,-37.7904,-39.5904,-33.5854,-56.2011,-31.5695,-50.1549,-28.0609,3.70777,-31.3644,9.27687,-25.6428,-57.3556,-76.4685,-52.8353,-71.6039,-35.1606,10.5502,-31.6456,12.8794,-34.6728,-56.5953,-31.197,-50.4213,-54.1499,-80.1058,-52.2991,-73.7075,-46.3516,-7.72338,-40.8242,-1.80103,-22.3238,-69.7843,-16.4837,-67.7919,-61.8766,13.6679,-58.2421,16.7344,-70.4593,-53.4888,-66.1823,-49.823,-75.4747,-74.8531,-72.5434,-72.9419,-33.6608,-31.2531,-31.0192,-29.334,14.7394,-50.273,18.7971,-43.5285,-80.1272,-20.8125,-77.2966,-17.1825,13.327,-4.70374,17.7806,1.75666,-26.0656,-35.016,-22.9478,-29.0865,-66.7463,-41.2196,-63.5632,-35.3148,-67.0614,-72.6452,-63.9124,-67.1243,-52.3098,-77.1681,-50.4349,-72.8591,-26.3588,-25.8988,-22.0849,-20.1192,6.06095,-17.8567,11.9763,-13.2014,-25.8331,-77.9368,-22.9184,-72.9473,-11.48,-73.9384,-7.64579,-71.7679,-59.1208,-30.6275,-55.9859,-26.2368,-27.1159,-7.01821,-23.7101,-4.47378,-31.8246,-81.4775,-29.7941,-75.4471,-12.0507,-7.73398,-5.53198,-5.80543,-26.8931,-3.37562,-23.8609,-0.890587,-18.9528,-14.2442,-16.9187,-11.7948,-77.6573,5.05806,-72.8141,9.59596,-45.5485,-17.5127,-43.6273,-11.3917,-17.6432,-60.3971,-15.7601,-54.9706,-56.2316,-5.74888,-50.6648,-1.06168,-15.3377,-36.3496,-9.5334,-29.9133,-19.7368,-45.2123,-16.4847,-40.6419,-56.4744,-68.1158,-53.3478,-65.8686,-71.5896,-48.6011,-69.4474,-42.5452,-76.6743,13.1836,-73.1851,19.2119,6.35578,-43.8684,9.73177,-37.7945,-35.1448,3.00243,-30.693,7.32344,-56.0911,-75.0381,-49.9375,-68.868,-5.44427,-7.33237,-1.47288,-2.49412,-40.4983,2.90655,-34.3568,7.64413,1.49899,-3.04387,6.66869,-0.819868,-61.6635,13.5563,-59.4714,19.9358,0.0875852,-67.6377,5.65007,-63.3757,-56.7201,10.4011,-53.0972,16.696,-31.0276,14.149,-27.3216,16.9184,-39.9542,4.86423,-33.3974,9.43246,-1.12752,-71.0317,3.51723,-66.8416,-48.5561,-37.1592,-42.9733,-31.5797,-49.3568,-80.0774,-44.2054,-74.8602,-68.1097,-34.8263,-65.9293,-30.3578,-42.4348,-39.169,-40.6314,-35.4848,-76.5686,-64.123,-70.9896,-58.7707,-53.0936,-79.8454,-50.5594,-73.2769,3.72442,-31.2901,7.82588,-29.3196,-61.9301,-15.726,-59.0972,-9.46073,-19.3019,-19.1979,-13.1295,-12.7614,9.20415,-70.8367,11.7847,-66.3879,-23.088,11.1859,-19.7445,16.5934,-19.6115,-27.6205,-17.3294,-22.9669,9.68601,-21.8794,14.1217,-15.1369,-14.7203,5.30961,-10.5442,9.52244,12.4285,-36.9081,18.1314,-31.8595,-13.5073,-65.3254,-6.97103,-61.7175,-18.2576,-15.796,-16.2165,-13.8503,-31.1484,4.91948,-25.0408,8.17185,-52.9049,-5.77779,-47.7616,-0.912422,-75.2342,-60.5854,-69.1215,-56.2281,-14.6961,-26.6597,-8.41878,-21.2344,-4.62556,-35.9816,-0.674246,-30.0834,-79.283,7.15872,-75.0258,12.4025,-25.4613,-23.7983,-20.606,-17.8504,-12.0624,-25.2732,-9.05439,-19.9201,-21.339,-75.5157,-18.892,-69.8056,-75.6978,-45.7124,-70.8955,-42.1567,-24.4873,0.879,-18.809,5.50349,-6.95649,-70.3208,-0.808336,-64.16,-79.1188,-44.6134,-73.2337,-38.1361,-58.0629,-59.1263,-55.7387,-53.7432,-21.5428,-73.6866,-15.5702,-70.0025,-63.1475,3.65922,-59.8575,7.96899,-21.2673,-39.5981,-17.8474,-35.5311,-22.3342,-59.1996,-18.9342,-52.5606,-33.6103,-6.59906,-30.1032,-1.77646,-4.84669,2.15784,0.310428,4.98512,-52.6029,-58.4345,-46.3712,-53.8176,10.7586,-65.0037,16.2187,-63.068,-76.9322,-14.1735,-72.9528,-7.72264,-2.47436,-53.8533,3.87075,-48.646,-44.9324,-74.7262,-42.176,-67.959,12.8874,-12.0529,15.0025,-7.74687,-65.5026,10.0458,-62.3633,16.2979,-34.9103,-59.0727,-28.6159,-52.6296,13.7052,-46.4831,17.6411,-42.7127,-71.0453,6.25655,-67.7303,8.20997,-53.7138,-31.8872,-50.8198,-26.6696,-10.9068,-28.1963,-8.20413,-22.1881,9.34742,-30.7789,13.0005,-26.2415,7.53926,-71.2058,11.9831,-64.4456,-66.2574,-62.0947,-60.3688,-58.9441,1.18789,-79.1998,5.54361,-73.9854,-16.7325,15.081,-12.3198,18.6089,-26.884,-58.7986,-24.6039,-55.0289,-14.8427,-54.5538,-11.271,-48.3725,4.45818,-17.6628,7.11772,-10.8922,-66.575,7.0663,-63.9133,13.8146,-38.8754,-34.615,-35.064,-29.1165,-51.1163,-16.3642,-45.4559,-10.5605,-53.3271,-35.4356,-50.3768,-31.5953,-9.44293,-22.627,-6.00207,-18.3138,-66.3421,-44.1906,-60.5319,-40.2362,-42.6848,-79.4646,-40.7209,-73.66,-56.0754,-25.5487,-54.2283,-20.5299,-40.2379,-53.0037,-35.6332,-49.7134,-18.3085,7.30613,-16.2978,13.1019,-41.8665,15.3209,-35.3465,18.5053,-55.6762,-56.4976,-49.6019,-54.4778,-42.4463,-5.72949,-38.5925,-3.21596,-62.8579,12.9686,-59.2262,15.2652,-47.1826,-76.8265,-44.519,-72.4889,-18.2813,-52.5233,-15.7936,-48.0212,-18.126,-49.8674,-14.8645,-47.9921,-4.7615,-54.4757,-2.80759,-48.8929,-26.3573,-27.5813,-21.8699,-25.2874,-38.9019,-3.27305,-35.3592,-1.45613,-57.5745,-18.6473,-51.353,-14.5294,-80.1421,-66.0536,-77.0725,-61.7271,-54.4602,-9.73099,-51.03,-3.81334,-14.7642,-73.2779,-8.19962,-69.5214,-55.9307,2.44997,-50.4786,5.26557,-23.6514,2.51702,-19.8888,8.93752,13.1322,-64.6026,15.6265,-58.8772,-51.1815,-20.9266,-49.3626,-15.5473,-51.9564,5.32267,-48.4901,9.62013,-29.3849,-70.5859,-25.3127,-68.1666,-63.9946,3.39751,-59.7367,6.16282,-33.8678,-57.792,-27.0996,-55.8921,-63.4631,-74.7881,-61.3766,-68.0012,-22.5141,4.17436,-16.1199,6.86738,-71.8312,-23.4731,-69.3085,-17.8212,-18.3445,-49.8712,-16.361,-47.1721,-63.0744,-31.7262,-60.2378,-29.4759,-38.2071,-46.7165,-35.2466,-40.0825,-8.11934,-35.7356,-2.74504,-32.6628,-61.6546,-29.5919,-58.2586,-24.0037,-35.5431,-18.7425,-31.3065,-16.1801,-61.6853,-78.3397,-58.2303,-75.4955,-11.1871,-51.4708,-8.24722,-44.7295,-10.2825,-0.336296,-5.32377,6.16614,-35.9096,-62.0117,-33.4954,-56.462,-49.3226,-44.698,-46.6453,-41.5434,7.42869,-25.1442,12.6282,-21.1256,-8.36687,-76.6672,-5.51156,-71.7219,9.93484,-77.9294,14.7465,-74.1908,-4.95519,12.1382,-2.22523,15.7965,6.87716,-49.8616,13.395,-45.5338,-23.3636,-28.5424,-18.3436,-24.5663,-72.9314,-9.97915,-68.5983,-7.73138,-70.1483,-56.1552,-67.693,-54.2027,-80.0264,-16.8469,-75.7527,-11.1917,-29.2033,-81.376,-26.6726,-75.138,-66.9844,-45.0191,-63.8535,-41.3824,8.68244,-77.0732,14.1417,-72.895,7.96776,-42.0372,11.2551,-36.2235,-62.098,-9.57327,-56.9752,-6.31945,11.1816,-28.4199,16.7592,-23.4051,5.28867,-51.1992,8.76584,-46.4635,-32.3376,-42.3782,-27.4733,-39.7229,-20.7929,-9.55276,-16.0858,-5.06832,1.73778,-57.5251,3.97803,-54.5918,-21.1032,-74.9192,-15.1846,-70.6577,-75.7689,-50.9312,-70.8431,-44.2933,-52.1234,-66.2125,-45.4947,-61.8756,-40.632,-5.83991,-34.101,-1.26856,-16.097,7.03363,-11.0018,11.8565,-6.8223,15.2029,-4.62595,17.9851,-27.916,-28.8704,-21.6543,-23.643,-14.8892,0.569685,-9.27603,3.45939,-53.0457,-9.25361,-49.7488,-3.08428,3.0343,-22.584,4.99367,-19.6947,-19.7619,-36.0644,-17.053,-31.0027,-78.6918,-32.0402,-72.4945,-29.7831,-42.0626,-57.7625,-35.861,-54.2513,5.84217,4.57935,11.8438,7.85943,-68.5116,-51.1737,-64.7207,-47.3848,-46.419,-3.41835,-41.6153,2.25078,-32.4065,-62.9197,-27.1545,-56.7588,-78.816,-11.0702,-74.2599,-9.20368,2.73399,-48.0423,8.42673,-41.5376,-8.7176,-34.5733,-3.92293,-28.7651,6.31336,14.0112,10.481,18.3174,-5.22245,-66.4759,-2.03287,-64.5075,4.63994,-34.4179,7.76132,-30.4348,6.1846,-37.2351,9.97731,-33.303,-44.3669,-61.5648,-39.7643,-59.6236,-12.7562,-52.3524,-6.81811,-50.1751,-47.9012,-77.4688,-44.4052,-73.3807,-28.5189,-74.5924,-23.6535,-68.1691,-22.1084,-79.4471,-17.4189,-75.9545,-73.9962,-44.5008,-72.0318,-41.3062,-36.3619,-19.6537,-30.2437,-16.8053,-11.3615,-55.8286,-9.33901,-50.0015,-16.2633,4.40988,-9.46762,10.0316,-10.6655,-32.0224,-8.65418,-27.1436,-39.5753,-42.5077,-33.4818,-39.7059,-47.3118,-5.47115,-45.1544,-3.17089,-74.0316,-64.1817,-69.782,-57.912,10.6834,-18.7694,16.2173,-14.8233,-59.7295,-61.789,-57.2728,-55.3282,-37.886,-48.2527,-33.988,-44.8282,-49.2919,-57.7777,-45.6846,-54.9256,-13.0213,-57.8029,-7.40891,-54.0218,-49.635,11.1541,-46.3547,16.3132,-31.0261,-36.9544,-27.4458,-32.9022,-71.9252,-28.1691,-66.3771,-26.3199,14.3156,-50.1202,16.7778,-46.6226,-4.36602,-58.7586,-1.21257,-52.8116,-14.1148,-8.14855,-9.4002,-4.05431,-51.0833,-34.8389,-49.1815,-31.7345,-55.3547,-66.3031,-50.5092,-62.6925,-14.7065,-47.2692,-10.4536,-40.7532,-35.716,-60.2439,-32.141,-57.1761,-28.7496,-53.5882,-22.6436,-47.1728,-58.6031,-19.896,-55.6476,-18.0763,-66.4274,-79.2045,-63.5888,-72.5045,-17.5623,-7.70163,-13.826,-0.931203,14.8438,-58.0956,19.3649,-55.1592,-21.1197,-17.9713,-16.1314,-11.9885,-74.1402,-72.0441,-69.8012,-66.0214,-25.997,-42.1868,-20.5969,-38.6847,-35.2123,-53.5228,-33.3554,-48.5445,12.7266,-55.9459,16.0723,-49.2373,-30.855,-63.2896,-24.4735,-58.5761,-13.0984,1.23758,-6.49705,3.15375,-43.1346,-42.9452,-40.4763,-37.3115,-53.0572,-6.08386,-46.8759,-0.639112,-4.00196,-41.0269,1.64916,-35.8374,-10.8133,-22.2704,-4.23838,-16.1645,-56.6608,10.4935,-50.0834,15.0469,-64.2268,-32.155,-59.5212,-29.7909,-2.0577,-5.72805,3.86631,-3.45197,-56.8404,-76.6853,-51.3576,-72.9954,-38.7768,5.8265,-36.9263,11.5046,-81.5014,2.6889,-75.0877,9.03374,-64.146,-40.6278,-57.5444,-37.8128,5.32061,-36.6224,10.4522,-31.0581,-9.55033,-58.6264,-4.47099,-53.3723,-52.9994,-17.7977,-49.008,-14.83,-78.1712,8.73663,-75.6593,13.8232,-55.5353,-20.1107,-48.8034,-15.7591,-3.85974,-14.4339,-1.42159,-7.76224,-75.4487,-57.1019,-69.2993,-51.8561,-82.0868,6.28276,-75.7625,9.61756,-52.4682,-42.0915,-49.2893,-38.3233,-36.5211,-2.40451,-34.4791,2.28832,-53.2617,-53.1058,-47.0037,-50.5012,0.848605,-36.3828,4.91541,-31.4342,-34.5781,0.285509,-30.1621,7.05029,-13.3649,-68.865,-7.66448,-66.329,-50.5183,2.64897,-47.5557,6.37825,8.11069,-21.6295,10.3748,-17.4163,-44.7843,-19.8804,-41.8884,-16.2236,-38.2703,-18.9363,-34.7576,-12.6296,-29.6153,-9.48379,-26.4315,-3.28838,-4.19664,-20.6501,1.82884,-16.6854,-55.0391,-80.8423,-49.9422,-75.4787,-30.795,-72.4865,-27.8114,-70.275,-8.41083,11.0945,-1.68722,14.7231,-40.6464,-13.6629,-38.3167,-8.80812,-8.64125,-14.0749,-4.98746,-10.3906,-70.1152,-7.52378,-65.8738,-1.61141,-43.2832,-22.1884,-41.016,-18.7746,-9.43656,4.7319,-5.78228,9.28277,-40.7263,-29.0926,-35.5614,-23.8973,-44.3765,-76.3074,-38.6124,-74.4745,-27.9962,13.4849,-23.6824,19.8419,-17.3512,-66.7831,-14.3821,-61.7602,-39.2896,-76.232,-34.8848,-73.6148,-75.4524,-69.6922,-69.0413,-62.9571,-61.6784,-1.39163,-59.0426,2.78584,-10.1086,-80.4519,-4.84871,-75.9762,-70.5692,-23.8609,-65.6237,-21.5533,-17.5988,-34.2357,-14.0997,-31.7852,-1.52599,-33.1953,3.34236,-29.6082,-1.96987,-41.599,3.56825,-35.8693,-76.4303,-63.7983,-74.0441,-60.6212,-3.38738,7.19178,1.16915,11.9402,-63.4317,-80.3153,-60.4903,-76.0032,1.91871,-26.2082,7.83937,-21.4448,-8.81072,4.27822,-4.78918,7.53244,-10.422,-37.8955,-7.12293,-34.2704,-44.324,-28.3743,-39.3419,-21.9261,-2.99209,-67.9028,-0.499346,-61.1362,-39.1652,-2.4036,-37.1846,2.05877,14.6522,-77.2691,16.7239,-75.4473,0.0020085,-23.7863,6.64143,-20.2253,-62.8613,-9.3902,-56.9148,-6.31395,-79.0479,6.28357,-76.9289,12.059,5.96765,-13.078,8.17981,-6.78262,-79.9262,-52.5777,-75.6045,-48.597,-17.4559,-54.3722,-11.2493,-48.3628,-45.516,-72.1976,-43.1025,-66.3914,-80.3687,9.40427,-77.0345,14.9268,-9.55988,-34.4505,-6.93904,-29.4209,-11.373,6.91561,-6.63958,13.535,-46.8246,12.9899,-44.8687,18.0727,-30.5425,7.87043,-25.6019,9.91833,-51.3897,1.73519,-45.8752,5.83193,-4.48001,0.548429,-2.54281,4.92651,-58.9183,-23.8363,-54.1069,-20.8472,-72.7927,-24.8888,-69.7825,-21.742,-31.1965,-37.7815,-28.8477,-32.6626,12.8451,2.99287,19.6223,9.61263,-45.0069,-52.5162,-42.0224,-49.2869,-50.0717,-8.10802,-45.8036,-3.11102,-6.91303,-50.2556,-4.45627,-44.1916,-79.6375,-53.5672,-77.7921,-47.9303,-57.593,-15.0069,-54.3075,-9.66451,13.5632,0.136918,19.2655,5.34121,-14.5995,-53.5973,-9.85103,-51.2918,-12.6706,-56.3624,-7.13357,-51.6096,-38.401,-15.8527,-35.5404,-10.0252,-38.1369,-13.9454,-31.9526,-11.9864,-50.9632,1.42345,-44.3016,3.27249,-42.0719,-11.0794,-38.023,-6.57203,-21.8614,-52.2735,-16.8511,-46.4231,-57.8635,14.655,-51.5525,17.0783,-35.6739,-16.2105,-32.8479,-9.41458,-8.91358,-15.0878,-5.35376,-8.74902,-30.131,-16.8542,-28.2321,-13.3269,-34.3083,-11.491,-28.2194,-8.18615,-6.34057,-25.0667,-1.09233,-20.1706,-0.362763,4.02839,2.98224,9.91473,-19.9982,-6.44077,-15.5041,-3.98034,-42.0618,-58.4466,-36.5683,-55.9915,-40.6562,-21.3682,-37.0128,-17.2114,-59.5892,-10.5565,-52.8167,-7.21585,-36.7753,-14.9649,-32.4119,-10.373,-8.01392,-34.2664,-6.0761,-30.7219,-29.5039,1.24035,-25.2739,4.06052,-11.5368,-55.4446,-8.30745,-49.9735,-20.2508,-67.3864,-17.564,-61.9654,-79.9879,10.6539,-76.3944,12.6348,-59.9442,-30.3604,-54.0832,-27.6281,-69.4109,-3.1604,-65.1389,0.950464,-1.10378,-12.9259,1.89051,-6.73748,-71.8962,-57.6268,-68.1839,-51.7876,-69.0919,-0.929871,-64.5596,4.8047,-9.64584,-14.7784,-7.34052,-9.56482,-9.28467,-48.5102,-6.16924,-41.8882,-68.4214,-5.12971,-64.8469,-1.43967,-38.3333,-19.6488,-35.8056,-15.8328,-20.3493,1.16753,-15.0332,5.13302,-75.4754,-44.1358,-71.4273,-39.0798,-18.5543,2.80659,-12.9519,6.77356,-25.4976,7.02281,-19.5854,10.7463,-58.6344,-11.6074,-53.8921,-6.3438,-47.8497,11.1669,-44.3621,17.2264,-39.6043,-62.5991,-37.6582,-59.0803,-74.8137,-50.34,-68.3439,-46.7391,-33.5973,-24.4603,-28.7518,-21.2502,-41.1947,-33.5397,-37.6961,-29.0991,-11.287,11.6477,-7.76031,17.5625,-79.1255,-38.0317,-72.7714,-34.8696,-27.436,-66.7929,-22.4688,-63.0045,-75.0502,-35.3794,-72.4205,-30.1025,-59.8298,2.10578,-53.8522,7.01967,-75.4793,-26.5077,-69.0828,-20.3254,-52.9911,-80.9706,-47.0047,-74.6733,-4.69697,-32.4306,-1.21687,-27.672,-61.8512,-0.297082,-59.7591,5.13014,-6.00837,-36.7105,-3.75958,-32.31,-5.88738,-19.4772,0.0204503,-17.6317,-31.7631,-13.19,-28.556,-7.96221,-0.504868,-33.022,4.38153,-30.9776,-41.4055,-67.1556,-38.2457,-60.8801,-0.000340063,-19.9154,2.51852,-17.1523,-16.5696,-3.40275,-14.6871,2.63371,-32.5654,-64.5885,-29.9632,-61.2425,-11.3376,-42.5099,-5.12502,-38.4028,-21.7505,-32.879,-16.0356,-28.8688,6.84352,-29.0984,12.6679,-26.68,-26.8199,-81.4333,-23.873,-75.2856,-30.5617,-57.0959,-27.9065,-50.9214,-45.4694,-1.94991,-40.3276,2.18923,-72.6467,-53.9191,-68.2271,-51.2902,9.44119,-22.6919,16.1663,-20.429,-68.7401,-42.1933,-62.2042,-37.0901,-63.6107,-14.5675,-57.9441,-11.7126,-13.9352,-49.6542,-8.675,-43.651,-41.5739,-52.2942,-36.0936,-50.1711,-40.7555,-39.8947,-36.562,-37.8991,14.249,-6.03304,19.7474,-2.53101,-50.7653,-48.3247,-45.7522,-44.8051,-66.729,-0.51687,-61.6772,2.76272,-3.89726,0.213381,-0.669597,5.12838,-27.0753,-40.4434,-21.5399,-35.6151,-3.17714,9.41304,-1.19303,11.3003,0.645325,-4.4958,6.38777,-2.38679,-49.4324,-51.5046,-47.5009,-48.0027,-31.4682,-19.631,-28.1181,-16.66,-49.4108,-14.072,-45.8477,-8.30779,14.5641,-28.9895,18.8669,-23.0926,-74.9392,-3.91675,-70.549,0.755179,-3.45968,12.9794,1.1721,19.1938,-0.681013,-1.58258,3.89095,4.94305,-60.1175,-50.4914,-55.7093,-47.6865,-31.7453,-57.9185,-28.7348,-55.6828,-61.6495,8.08874,-58.2962,10.7066,-18.6375,-16.9937,-11.8922,-14.4305,7.67245,-43.2996,13.2025,-37.464,4.50714,5.59041,10.9468,12.1302,11.8639,-35.9057,18.647,-29.9266,-57.1095,-64.7356,-53.0807,-62.9017,-71.7189,-5.51529,-64.9724,-2.47051,-66.5511,-21.3289,-62.7288,-17.437,-65.0017,6.27511,-59.4753,9.70195,-55.6223,-48.4539,-53.3211,-42.6802,-41.8648,-16.2679,-36.6394,-12.6872,-49.0683,-68.2086,-46.6583,-61.5871,12.567,-48.1289,16.2886,-45.555,-4.85062,-10.1524,0.474675,-5.08131,-45.6764,-7.87826,-40.4239,-5.84471,9.3169,-29.8076,12.1065,-27.9652,-52.3558,-51.5822,-49.0835,-46.7842,-51.8245,-78.2689,-49.87,-75.1284,-38.5217,-57.9764,-36.4915,-55.4545,-29.4285,5.63916,-23.5837,7.88738,-45.1844,-4.26156,-38.7127,0.402032,7.62148,-33.9022,13.9889,-29.4461,3.24609,-63.5302,8.46656,-61.7231,-13.5527,-37.1079,-9.02486,-33.6986,-81.0262,-1.6457,-74.7339,2.40861,-71.7653,-13.1748,-65.4544,-6.95204,-54.7829,-61.3963,-50.6328,-57.5148,-47.0338,3.54812,-42.908,5.98189,-36.0231,14.3614,-30.9864,17.7086,15.0034,2.81411,18.1729,6.04922,-38.1974,-26.2602,-35.1333,-22.8784,-44.3636,-16.0628,-38.5588,-13.1811,-55.0457,-28.7925,-52.4903,-26.2371,-42.6357,-1.7618,-38.3796,0.624146,7.70832,-46.0832,10.0492,-43.328,-57.9242,-62.2351,-51.1576,-59.2732,-80.0754,-5.18652,-76.444,-2.33355,-46.9807,-17.9059,-44.0965,-12.671,10.539,-0.578891,14.3782,1.72624,-49.6365,8.38237,-44.355,10.6924,-36.2424,-71.2806,-34.3119,-64.7669,-19.5084,-35.8434,-14.2136,-29.9522,4.33149,-9.96237,10.4668,-4.37892,-56.2356,-12.6231,-49.8808,-9.90783,-23.8619,-54.9273,-17.4499,-51.7558,-35.1949,-55.7341,-32.4483,-50.1079,-13.8396,5.73044,-9.4789,9.33193,-39.7669,-78.4837,-35.1674,-72.8126,-59.4579,-11.3313,-55.0628,-6.28496,-79.2537,-13.4346,-72.5551,-9.52888,-60.1672,-64.6301,-57.6224,-60.9385,-46.7637,-50.7127,-41.4333,-48.7282,2.67358,-12.8289,4.56228,-10.9755,-68.4937,-1.73063,-61.8728,4.78346,-80.8565,-11.4013,-74.2048,-5.44258,-13.1184,-70.977,-8.36919,-66.6814,-79.92,7.13544,-74.1868,10.9571,-50.8604,-29.173,-44.1181,-24.559,10.0298,2.93498,16.7985,8.18909,-68.3241,-32.6472,-65.9181,-26.0615,-63.0412,-15.0377,-57.5543,-11.229,-72.2177,-43.6202,-65.5463,-39.425,3.66903,-75.6315,6.40599,-73.7542,3.81943,-46.0526,9.89503,-40.4655,-56.2173,-53.1769,-51.6333,-50.4895,-74.223,-71.9767,-72.0323,-69.5095,-5.94106,-10.1845,-2.38175,-5.96667,-42.0133,-1.46928,-38.3208,2.54965,-0.64897,-48.2685,1.88886,-42.6688,-73.8062,7.04768,-70.7929,10.4263,1.58457,-73.9633,8.17073,-71.5988,11.735,-43.5681,13.825,-37.3473,-12.9201,-18.9387,-8.21463,-16.6938,0.902799,-31.4075,7.20544,-27.5819,5.46615,-29.812,10.275,-26.8286,-52.7988,-60.1099,-49.838,-55.6064,-65.9766,-50.4403,-62.8054,-43.8226,-22.3917,-68.9508,-16.8058,-64.6444,11.2542,-73.8362,14.7312,-67.9179,-23.5884,-12.6196,-19.1532,-5.94082,5.24923,-1.38906,9.51784,1.26712,-46.494,3.26097,-44.5777,5.12675,-8.07736,-13.5187,-1.88299,-7.26131,-12.5584,-54.1812,-7.85446,-51.9506,-41.9991,-64.3854,-36.8286,-61.6476,1.10465,-42.8707,6.19384,-40.1171,-49.5884,8.16484,-45.6272,14.4729,-4.2302,-25.98,-0.140586,-19.4435,-42.3291,-29.834,-37.8821,-24.8953,0.432096,-24.3855,5.65721,-22.1825,-47.6005,12.1269,-45.5355,18.625,-7.55639,-78.2102,-0.837561,-74.0011,6.40627,-77.884,10.057,-73.1419,-7.6989,-3.72708,-4.35595,-0.945328,-20.7323,-36.6449,-16.0419,-33.9457,-1.94157,-21.6301,2.82699,-17.5364,-46.1569,-60.5353,-42.8875,-54.5365,-0.575501,-30.1599,2.55297,-24.7201,-29.881,3.73206,-26.9864,9.7789,-43.6973,-10.481,-39.6446,-8.62052,4.86514,-42.4425,10.8772,-38.9493,-15.6536,-9.91663,-13.7495,-7.07695,-28.9003,-20.0612,-22.46,-17.9209,-1.39877,-61.9376,4.97696,-58.9051,-61.3558,-80.3204,-54.9292,-76.2108,-40.4573,-2.47785,-34.1142,1.32469,-75.1053,-81.962,-70.199,-75.4627,-38.3454,-38.9254,-31.8769,-36.7563,3.51013,-23.7762,7.57408,-20.1534,-38.0658,-49.5753,-35.9319,-46.4107,-3.33449,-11.9419,1.66044,-5.99569,-57.3318,-65.2793,-50.9762,-59.2249,-53.0357,-34.6316,-51.1417,-28.1213,1.3699,13.0174,7.7661,19.5374,-79.6359,-79.1226,-76.1898,-76.7783,-29.9187,-40.771,-24.2722,-37.2119,-16.6467,-37.7606,-13.6686,-35.7657,-22.7497,-5.26052,-17.7035,1.39777,-45.5186,-11.6191,-42.93,-8.34506,-24.0256,-5.5316,-21.9916,-3.57828,6.07249,-24.5164,11.9397,-21.2149,2.85861,-23.0718,8.95887,-16.8236,-27.3001,-46.8972,-24.1509,-41.2465,-79.1102,-1.90264,-74.1481,1.85941,-29.9997,-1.04187,-24.6562,4.20713,-78.4332,-34.8568,-75.593,-30.2759,-53.4603,-37.3819,-49.747,-32.1659,-51.3547,-28.7581,-48.7891,-23.0328,-5.2572,-59.3112,-0.153746,-52.8536,-73.0274,-53.3346,-68.5177,-46.8468,9.85878,-78.0186,14.7329,-73.5266,-22.2884,-59.2768,-20.0604,-53.7661,-64.4232,5.57928,-59.8321,8.7762,-59.6605,2.51535,-55.1912,4.62178,-3.46273,-72.3088,1.85359,-67.8267,-2.87386,-61.2322,-0.925795,-58.43,-53.5929,-61.271,-50.7265,-56.0093,-77.1763,-46.6314,-74.1905,-43.4745,-79.4097,-29.1114,-73.0686,-27.1875,-8.71431,-0.013682,-4.40184,3.45778,9.02526,12.0474,13.4682,15.429,-6.60653,-41.6618,-2.83279,-39.7475,6.0836,-14.258,10.9722,-9.52236,-62.427,-30.8791,-57.2656,-25.5293,-44.4661,-63.7674,-40.0218,-59.0221,-61.6626,-32.27,-59.0061,-27.7095,4.76364,2.75894,10.5064,8.73136,-57.1614,-3.31093,-50.4983,0.0928902,-46.6158,-78.3246,-41.9439,-75.2674,-14.5061,-27.6546,-9.0819,-24.2732,-68.4164,2.76585,-62.7782,9.02457,7.34023,3.49223,12.1502,6.5956,3.83198,-57.348,5.97269,-53.5747,-23.5329,-77.1273,-20.0339,-74.7774,-58.5384,-26.1639,-53.5159,-23.5173,-32.0122,-13.3029,-26.4571,-10.1055,14.8127,-39.7549,18.7703,-34.0717,-70.507,-34.6153,-65.9659,-32.3425,-19.2274,13.5083,-13.0952,16.7158,-51.0754,11.3237,-46.5926,15.4522,-17.8195,-17.0842,-12.5125,-13.4386,-38.9786,12.6828,-33.3746,15.5034,-59.7094,-16.0451,-56.2915,-9.48584,-67.3321,-18.0542,-64.2241,-11.6406,-43.2155,-39.019,-40.9649,-32.8641,-63.7563,-37.3401,-60.2546,-31.356,-58.9977,-72.5455,-54.5663,-70.3855,-33.1561,12.741,-29.5946,14.5502,-4.42002,-72.7127,-0.580702,-66.4492,2.48419,-47.835,7.63896,-42.5012,10.4925,-3.50542,13.1224,2.32828,-61.7925,-26.2914,-58.2062,-23.0956,-16.8246,-80.324,-10.2308,-75.8436,-52.4495,-81.6616,-50.208,-76.0107,-10.3115,-25.0183,-8.3782,-20.1419,1.14245,-22.5747,7.90794,-20.0066,-19.5034,-63.0599,-16.569,-60.4311,5.15626,-43.8987,9.34508,-37.8129,-46.7538,2.38147,-44.341,5.54971,-79.4586,-63.8181,-73.0873,-59.8358,-69.5357,-48.5424,-67.3816,-44.6895,1.56972,-10.4277,7.40054,-6.85476,-33.7959,-71.2483,-31.0471,-65.2673,12.6818,-57.093,17.1518,-55.1669,-39.8448,-6.18481,-34.6632,-2.27086,-73.4828,-58.2038,-68.0269,-53.521,-49.9077,-27.8787,-43.5318,-23.0338,0.619091,-40.073,3.60542,-37.5037,-54.6775,-54.0618,-50.2762,-51.0894,6.05963,-59.5868,11.0668,-57.2585,8.89666,-64.4074,12.1221,-59.3237,0.715275,-38.9024,3.0426,-32.8426,-5.33669,2.89724,0.0662297,8.21852,7.03875,-69.5516,10.7977,-67.5827,-13.3702,-20.9353,-7.73553,-15.7058,-64.2175,-0.911992,-61.9354,1.00676,-68.3933,-0.334538,-62.5827,2.95444,3.99369,9.00745,6.8504,15.4392,-17.9578,-74.2276,-13.6546,-67.6166,-0.884875,-15.0032,2.74289,-11.4889,-66.5816,-48.6914,-59.8866,-46.1199,9.97243,-73.0321,13.4898,-66.8621,12.3086,0.171639,18.256,4.37343,-22.5685,-78.1369,-20.0312,-73.4967,-65.7208,-55.8372,-61.5762,-51.6976,9.9325,-15.3261,15.,-11.2263,-19.9228,-53.796,-17.1895,-49.2474,-42.7823,-21.5092,-40.8471,-19.1879,-7.9123,-77.4441,-1.22884,-73.4332,-1.17319,-63.226,3.55191,-60.5279,7.96995,-81.1503,12.2097,-75.1404,-59.519,-75.8087,-57.5864,-70.3632,-77.5876,-14.4405,-73.6235,-7.76085,-65.7028,13.3867,-60.7572,15.5388,0.10503,-74.1062,4.97911,-67.8736,-45.4157,-39.0473,-39.0152,-36.3821,-68.9992,9.77402,-67.1529,14.6411,-51.2303,-44.8719,-49.0326,-39.2727,-33.6478,-27.277,-28.9559,-23.5864,-5.99265,-22.7788,0.663504,-18.2835,-38.8773,-37.2005,-34.8831,-33.6388,-79.8985,-40.0596,-76.8324,-37.6367,14.7006,-78.6216,18.9493,-72.9674,-33.4036,-14.8955,-29.8239,-10.4883,-23.3319,-3.67086,-16.754,-1.82681,10.9928,-21.8723,13.145,-16.718,-75.9669,12.9184,-69.4835,17.835,14.7159,-19.9574,16.7328,-13.324,-66.217,-45.2684,-62.2365,-42.6043,-17.0021,-15.6825,-13.1128,-13.549,-23.2632,-35.9022,-18.2008,-32.2298,-12.0428,-67.8905,-6.64501,-61.4834,-79.4142,-40.8419,-72.7448,-36.2363,13.1008,-76.2296,18.2726,-71.4094,-32.87,-56.5884,-27.7347,-52.6752,-41.5878,0.321771,-37.169,3.84598,-69.5847,-27.9779,-63.7902,-22.4838,10.9749,-20.1882,15.1318,-13.6188,-48.3635,-10.0377,-43.1774,-6.81192,-37.6852,-46.0704,-33.7252,-43.566,9.36011,-36.5307,16.154,-34.5631,-43.7566,-14.9838,-40.6143,-11.6169,-6.36018,-30.126,-4.38833,-27.0043,-36.4817,0.0337886,-30.5801,3.27929,-78.5584,-18.132,-75.0008,-12.4338,-35.2595,-31.1235,-31.6993,-25.4852,-4.24807,-17.26,-0.385161,-11.4354,8.91573,-3.61673,11.7215,-0.0425984,7.59949,-32.2618,12.7058,-29.8054,-59.486,-8.73306,-54.9387,-2.03654,-53.7994,-71.7593,-49.8224,-67.7727,-71.957,-27.9691,-65.886,-24.6619,-66.1037,2.68226,-64.2081,8.30084,10.8382,-8.95796,15.9267,-6.02872,-34.7313,15.1988,-30.5296,18.4644,11.6093,-34.5035,14.3597,-28.9932,-50.829,-63.2654,-48.5919,-60.3263,-22.6223,-60.9797,-17.8949,-54.6874,-47.5174,-6.2635,-44.0122,-0.226563,-70.5082,-72.949,-68.6452,-68.072,-35.9053,-8.68626,-30.3754,-6.49319,-37.709,-48.2404,-34.1829,-45.2839,-70.9395,-68.1953,-65.6511,-66.1048,-16.1676,-65.5717,-13.5163,-60.4699,-1.31077,-35.4974,5.12161,-33.6085,-9.50015,-51.8687,-3.38612,-47.4577,-46.1091,6.77376,-42.5102,12.7191,-0.27323,-13.4112,6.00896,-9.48211,13.467,-69.0806,19.6577,-64.9666,-43.1305,7.1376,-40.8981,10.3874,-2.11436,-71.0891,3.73935,-64.69,-8.20105,-10.6856,-4.46077,-8.72874,-14.9517,12.8758,-12.2931,19.131,-28.5727,-69.5789,-23.3943,-63.3156,-25.6758,-21.8796,-23.8007,-16.3588,-6.34434,12.536,-1.39254,16.7502,-52.115,-73.3381,-48.1295,-67.5037,-43.2987,-7.43368,-38.8036,-5.34431,-4.20061,-41.9613,1.64214,-39.1516,-32.9969,-29.5047,-26.7682,-25.2827,15.5369,-44.3801,18.5676,-42.4387,12.213,-36.9929,18.0063,-33.4534,-46.8192,-58.6248,-41.1157,-54.3751,-14.6005,-50.7723,-10.2749,-48.7263,-60.1669,-76.3093,-53.43,-73.9102,-49.5838,-71.7642,-42.8957,-65.2383,-45.8212,-6.58366,-39.531,-2.73963,-56.1831,-60.1283,-52.4818,-54.0435,-32.6381,-77.8188,-29.6609,-73.7941,-76.1433,-72.0054,-73.6383,-68.2437,-54.5907,-52.0807,-48.1202,-45.5329,-61.7289,-47.7782,-59.606,-45.1873,-55.6343,-55.6048,-50.474,-49.1493,-59.6066,-25.8039,-57.6478,-22.3712,-30.6307,-60.6595,-25.9914,-56.047,-43.5506,5.39311,-41.3362,11.0564,-48.5209,-28.3518,-44.4913,-26.0387,-51.113,-18.2784,-45.6311,-14.87,-68.5202,-49.193,-64.0528,-43.0329,2.51192,-71.4493,8.78013,-66.4667,-60.0165,-56.9921,-54.0931,-55.1551,-77.6878,-38.2143,-74.6036,-36.2891,-67.6357,-63.2401,-65.4088,-60.3645,-59.2031,-21.2788,-56.2152,-16.4609,-64.9276,-15.1866,-60.8835,-9.46797,-50.2648,1.98893,-45.8493,5.35684,-44.0373,-0.8088,-37.4629,3.38259,-62.9051,-20.7253,-56.1626,-14.8778,-73.4373,-19.841,-68.6443,-16.9109,-44.2482,1.61818,-39.0387,4.87172,-34.6057,-36.932,-31.8085,-31.6744,-67.2393,-41.3464,-64.266,-38.8882,10.3745,-67.0652,14.1858,-62.209,-28.572,-21.9991,-23.0129,-16.2125,-29.0744,-39.7323,-24.2977,-33.8122,-17.5281,-42.0201,-11.7517,-38.2635,-21.3498,-36.7398,-18.2526,-33.2563,-43.6578,-54.7286,-39.5033,-49.463,-81.2893,-28.3552,-75.5644,-23.8976,-0.430142,-8.70847,4.51187,-4.83309,-48.2502,-76.1868,-42.9046,-73.9137,-22.7113,-56.4379,-19.2442,-51.7444,1.80927,-81.7587,4.60904,-75.7385,1.66905,-57.5647,6.42125,-53.3451,-74.377,10.7186,-70.6412,14.4495,-38.5622,-49.9662,-36.0195,-44.0803,-70.6569,-76.2177,-65.0891,-72.8689,0.0390415,-60.569,6.10095,-57.74,-64.5425,-46.3183,-61.1678,-43.0931,8.46265,4.24383,13.3947,6.48714,-27.4989,-68.1176,-22.9791,-64.8286,10.1585,-15.0946,13.809,-10.4223,-48.0113,-22.3205,-46.0664,-16.1015,-36.3592,-26.5538,-31.8506,-21.0065,-77.1565,-8.70126,-74.9515,-2.69838,-41.4544,-72.2866,-36.5319,-66.6924,-5.81945,-65.7082,-2.39644,-61.1511,-29.7929,6.75117,-23.7932,10.6678,-1.58046,14.7415,0.233036,17.0841,8.45143,7.38436,11.2589,9.47969,-69.3525,-50.317,-63.2317,-44.3489,-79.2067,-57.133,-73.2128,-51.8091,-37.6101,-54.749,-35.2175,-50.8642,-53.0573,11.4491,-51.0507,16.5094,-47.7312,-54.8529,-43.8389,-51.9029,-42.8095,-48.7957,-39.475,-46.2974,-62.2136,7.1317,-56.157,13.3679,-71.6577,-51.3489,-68.5808,-44.6397,-24.7587,-30.0628,-21.5594,-26.357,-23.7418,-26.6524,-19.5049,-20.3064,-18.7332,-13.6373,-14.7103,-11.2206,-25.4731,-57.0059,-22.4872,-54.5235,-67.9391,-71.0054,-62.9927,-65.3326,-78.9589,-60.4887,-72.5606,-56.0544,-42.0383,-59.0147,-39.3034,-56.9379,12.869,-10.1409,18.6087,-7.67461,-1.6008,-33.592,3.0781,-27.7142,5.79457,-73.1507,11.4295,-68.1642,-78.125,-62.9424,-74.2101,-57.1585,-68.1281,-4.43682,-65.0891,0.296738,-66.4895,-4.33365,-62.3837,0.210909,-4.04847,9.6652,0.785037,15.9085,-43.1414,-58.0649,-40.07,-55.9979,-50.3855,5.84558,-44.9065,10.08,-77.9813,-53.7441,-72.697,-47.9958,-3.07126,-1.24219,0.417005,4.82256,-37.2643,-44.6399,-35.0405,-42.8267,-8.04789,1.63132,-3.80644,4.08005,-39.7171,-4.6067,-35.3877,-2.43956,-60.9624,3.53306,-54.3884,9.69081,-22.7284,-47.6867,-19.7988,-44.4886,-14.8621,-61.1777,-12.8244,-59.2227,-62.9784,-2.58784,-56.8508,-0.0227049,-0.946123,-38.8868,3.73692,-36.3507,-34.245,-16.6213,-29.7684,-13.7238,-9.22645,-39.4868,-4.74135,-33.9041,15.4952,-21.0117,18.6915,-14.7229,-58.4334,-9.52625,-53.0929,-6.83479,1.10857,-16.7565,6.0125,-12.3422,-70.5875,-46.2683,-66.8728,-40.8461,-19.9656,1.46957,-13.7968,3.72978,-56.039,14.0694,-50.7733,16.4897,-71.8537,-17.309,-65.8479,-15.1664,-74.8876,-38.4888,-69.0635,-33.5258,-34.0769,-51.448,-28.9217,-46.0642,-67.2825,-57.6262,-63.0788,-53.6428,-42.0219,-76.45,-36.3288,-70.4966,5.32169,4.77549,11.2369,10.2638,4.20328,-8.02756,10.0916,-5.83569,-25.7229,-18.7653,-19.2807,-15.4292,10.4819,-40.152,17.2079,-34.7501,14.3004,-1.20195,17.4616,1.8343,-39.5685,-9.44497,-37.4272,-7.40667,-60.2616,-0.287746,-57.0591,4.1835,-57.0312,-74.7974,-52.1204,-71.4059,12.1452,-69.6316,17.1979,-66.9491,-63.1438,-73.7478,-59.094,-67.5379,-78.9198,9.01199,-74.9733,15.6287,2.92576,-19.1169,8.25118,-12.6917,-8.03554,-47.4211,-4.14376,-41.0145,-5.73866,9.63399,-1.40804,12.4129,10.2031,-55.2884,13.3833,-53.3805,-24.1133,-44.3547,-20.3548,-39.1223,-71.7504,-58.956,-69.4559,-53.2101,-75.1553,-34.8513,-68.621,-30.565,-0.199809,-14.2979,5.84856,-8.78957,0.590302,-51.4762,7.30337,-49.4867,-81.8263,-71.4296,-75.5295,-66.1164,-16.3482,-17.9499,-13.2012,-12.9879,-75.2889,-37.8221,-71.4187,-34.4281,-1.84459,-5.18756,4.32628,0.442536,-34.2164,-81.6927,-30.1747,-75.3526,-13.1527,-53.4972,-9.04011,-49.7222,-16.1339,-25.5916,-13.619,-23.555,-70.1632,-60.8824,-66.5952,-54.9918,-23.6844,-59.571,-18.3006,-57.4644,14.2705,-25.8634,19.0883,-23.8035,6.83897,-69.4326,11.9127,-65.1386,-45.0297,-73.1615,-38.5544,-67.8227,-9.2211,-69.1535,-5.3567,-66.7942,-29.0107,-58.7117,-23.9986,-53.6043,-73.9572,-52.1154,-68.1109,-45.657,4.87006,-58.3378,8.96306,-51.7898,2.75084,-58.3567,7.12862,-52.5851,-30.8566,11.7672,-28.4574,13.6404,-2.55557,-61.6125,-0.686148,-58.8017,-40.2893,-65.0586,-37.7133,-60.8289,-11.0475,-48.0055,-4.9147,-43.3396,-51.0454,-21.921,-44.4262,-18.8156,-58.7131,-26.328,-54.796,-23.731,-80.0904,-7.80391,-74.7731,-1.43244,-79.0138,-41.9824,-73.7409,-36.4472,4.11319,-6.48484,10.4513,-0.157619,-69.8788,-62.1667,-64.418,-60.3641,-72.8291,-40.5916,-70.1288,-35.5318,8.12371,-5.21189,13.1083,-0.301963,-25.8748,15.3047,-24.0602,18.1732,9.48659,-43.9708,11.5225,-40.557,-11.8269,9.44586,-6.63048,15.7659,6.21423,-26.0951,12.2303,-24.0044,2.68119,-11.201,8.71498,-8.15369,-66.9833,3.31139,-64.0072,7.30506,-14.4842,-29.286,-8.66603,-26.4182,-47.7891,13.7289,-43.8518,20.4126,-57.6842,-65.0674,-53.3476,-58.3202,12.2713,4.96807,17.4051,10.6022,-30.8727,-73.8929,-27.4345,-67.1591,-67.7621,-32.6414,-64.5513,-27.4849,7.0411,-42.8993,11.9934,-41.0605,-63.429,-55.4647,-57.5216,-49.3731,-21.8669,-61.827,-15.1138,-56.2807,-3.63709,12.5314,-0.451517,18.5591,-19.8458,13.9469,-15.1847,17.8874,-63.2491,-43.5459,-57.1208,-37.8713,-39.0094,-24.3317,-33.6599,-21.9084,-1.10039,-37.4994,5.52763,-31.1685,-59.1911,-37.1795,-53.7516,-31.4229,-47.7721,10.9372,-45.8195,13.0975,-3.28449,-43.9623,-1.12234,-37.5141,-12.3343,-74.0425,-9.02818,-67.5833,-3.21213,-66.437,1.20853,-61.4582,-49.7397,-26.7186,-45.1076,-20.4406,-56.518,-52.964,-49.7872,-46.3869,-13.0943,-53.134,-6.6981,-47.4662,4.46662,-52.9335,8.00703,-50.6645,-67.8628,5.20519,-64.7084,7.35984,-47.1329,-74.8404,-44.4322,-68.6716,-22.1694,-21.8615,-18.2113,-15.3456,-4.89711,-34.9076,-2.90148,-32.523,-74.8543,-50.2597,-71.5536,-44.7449,1.73313,-4.38297,4.25083,2.26262,-51.1482,-77.747,-48.1443,-73.1308,-30.0838,-9.38174,-24.9668,-5.99497,0.391628,-39.069,4.39186,-35.9692,-31.5769,14.0641,-29.418,16.0389,-74.1263,-51.015,-72.188,-45.8111,10.6282,6.56851,16.7643,11.5111,12.1431,-43.0949,16.6696,-39.0071,-2.18052,6.94153,4.29193,9.97237,-63.3369,-1.427,-57.9275,1.67631,-14.0342,-20.5138,-7.64617,-14.6712,10.3214,-49.1723,13.3585,-44.598,-14.6827,-34.0622,-11.7238,-31.2855,-58.9076,-65.6372,-54.1518,-60.447,-12.4676,-45.373,-7.26741,-38.6705,-68.6377,-12.0319,-65.6765,-6.78799,2.24546,-13.0914,4.94678,-9.04618,-61.0075,-76.2453,-58.4554,-70.5236,-43.1868,-69.2881,-40.7053,-66.4664,-5.64394,-14.1383,0.691295,-7.74931,-47.1216,-22.549,-42.8392,-19.5198,-73.0367,-7.00995,-69.5884,-3.32497,-76.9169,-3.45817,-73.0143,1.31675,-40.8579,6.62297,-34.2899,9.78969,-55.7895,-76.3715,-50.4721,-69.5795,-17.968,-12.2372,-15.336,-5.9466,-62.4337,9.64247,-58.9724,12.6798,-56.8271,-47.1069,-50.2259,-42.2577,-6.52612,6.44288,-1.11792,11.0392,-8.5591,-2.15212,-6.43495,4.23778,3.3153,-36.4061,6.05017,-31.8486,-62.8503,-14.2776,-58.1507,-9.17214,-18.039,-2.26747,-12.2103,2.62529,-31.0375,-55.848,-25.7696,-51.3435,-53.6368,3.54993,-48.5107,6.82068,-57.6203,-54.58,-52.8483,-51.7177,0.987448,-1.19273,7.38978,5.50842,-59.8541,-13.2902,-56.5678,-8.17426,-68.2312,-48.359,-63.0597,-42.6853,-75.1159,-55.8657,-72.1439,-50.3717,-26.5654,-34.3959,-20.4102,-29.2439,-48.1468,-33.2484,-44.5291,-31.0354,4.42224,-30.6395,6.86644,-26.0907,-47.6188,-68.7599,-45.0305,-62.3985,-51.8962,-33.4415,-46.4132,-30.1528,-44.3637,-6.35102,-39.13,-1.16539,0.559965,-61.0442,4.12533,-55.649,-30.5045,-14.5752,-28.0151,-12.1389,-42.1731,-38.1943,-36.3675,-34.7637,-46.8457,-27.255,-42.3113,-20.8148,-74.8159,-67.3441,-72.5686,-62.3764,-38.9535,12.2788,-33.3075,15.585,-42.8211,-22.4463,-40.8083,-20.0641,-9.38931,-47.1367,-5.7393,-40.3853,-63.1774,-39.5254,-57.4069,-32.9995,10.3378,8.61788,14.392,13.3184,-9.39072,10.1432,-7.28227,14.0979,-0.610919,9.38696,1.78674,14.7634,-58.744,-56.728,-56.5231,-54.2975,-28.7591,-53.4765,-26.4479,-46.7353,-52.8986,-29.0519,-49.5972,-24.8491,7.74186,-28.6186,12.2973,-24.8031,-58.543,-1.21397,-52.6282,3.15227,-23.5658,-58.7365,-18.8354,-54.6789,-29.9343,-53.9901,-24.2019,-52.1678,-39.6143,-35.5767,-33.3492,-33.1256,-16.4602,-40.7857,-11.8956,-38.3612,-57.8629,-80.2306,-55.482,-77.3227,-64.3084,-50.1979,-61.7689,-44.1881,-60.1471,-57.831,-58.3277,-52.9175,-57.3082,11.3936,-51.4673,14.541,-65.5515,-52.6655,-62.3163,-48.7579,-70.7315,-38.2295,-64.9363,-33.6117,-74.2721,-28.9916,-72.3078,-23.7346,-42.9692,-27.1378,-37.0728,-23.2227,-25.3635,-70.0234,-20.4347,-65.1607,3.33511,3.1135,5.73627,4.96888,-14.4059,-28.5041,-8.77682,-24.1011,-68.9445,-31.744,-63.8647,-27.9593,-21.5536,-58.2679,-19.1421,-55.7974,-16.9711,7.62659,-11.9958,12.666,-26.0583,-65.6395,-20.086,-62.0126,-51.9712,-80.1501,-49.7728,-74.7131,-34.7436,-7.57305,-28.806,-5.4859,-37.5457,-24.3721,-31.2891,-20.5357,-8.11042,-40.7982,-3.94297,-38.4345,0.909675,-0.0500133,2.86145,3.04422,13.2597,-18.1566,16.5775,-16.3285,-46.2305,-17.8798,-42.4977,-12.9186,-41.1766,-39.2604,-38.17,-35.7534,-11.227,-11.3427,-5.73277,-6.42008,-79.7724,13.2848,-77.4112,18.8255,-2.89603,-4.42779,2.1877,-0.527052,-54.1654,-14.1614,-51.0195,-12.1898,-65.2876,-73.7583,-59.1806,-71.513,-46.6862,-3.07406,-43.0262,0.819695,2.7079,-74.2849,8.21042,-71.4945,-10.6703,-56.6738,-6.57797,-52.8314,2.39925,-52.0368,8.56969,-48.9564,-75.9921,-63.3542,-71.1277,-61.3753,-19.0418,-71.2663,-13.663,-68.2384,-31.0012,-68.3298,-28.9069,-62.6403,-34.5936,-39.9219,-32.5066,-37.2529,-68.5966,-26.8392,-62.7439,-24.0714,-54.4382,8.17413,-51.7037,10.6795,0.862871,-75.3162,4.74613,-69.8021,-80.5134,-62.4091,-76.1454,-57.4775,-63.9944,15.004,-58.8337,18.5677,-47.9312,-77.5039,-45.1518,-72.5895,7.14956,-46.7948,12.2697,-44.8694,12.1234,-30.9497,14.1316,-26.5189,-23.4258,-8.07311,-20.4056,-1.78932,-65.7055,-55.1574,-60.8182,-52.7103,-26.709,-52.2315,-24.8316,-45.5431,-63.8264,-58.783,-61.9107,-54.4953,-32.8998,-78.2171,-30.5135,-71.5442,-47.8789,-18.5383,-42.6412,-15.0625,2.85098,3.57704,7.79034,6.60984,12.3711,-59.0397,14.2306,-55.1213,4.67288,-5.56876,9.16222,-2.4883,-53.6578,-61.3429,-50.3829,-57.8319,4.43333,-35.0117,8.38575,-32.4586,-32.5564,-61.7967,-29.3102,-59.2649,-38.0226,-57.8175,-33.8075,-55.4484,11.6521,-25.9652,16.3596,-20.5593,-9.49959,-41.0109,-5.49678,-38.9266,-70.0842,-36.1968,-64.388,-30.1546,-18.8514,-47.785,-15.8184,-42.5276,-18.0517,-15.0911,-13.4094,-13.0505,-47.7426,-46.8595,-44.7938,-40.9651,-9.19985,12.8495,-2.77309,16.8432,-38.7125,-1.44919,-35.8553,5.09308,-57.4022,-38.1034,-53.2045,-31.6755,-31.3944,-4.3476,-26.0001,-0.49916,9.20767,-10.023,12.6024,-6.62672,-13.9698,-42.9504,-9.82829,-38.9101,12.9848,-67.7511,15.0984,-64.4214,-71.06,-36.1358,-68.9893,-31.5081,-75.0482,-9.17996,-73.1493,-4.88424,-35.9295,-58.8623,-30.1244,-52.9537,-21.7866,-16.1117,-18.0607,-13.9101,14.7792,-4.77231,18.3758,-0.256072,-51.248,-31.5806,-47.7432,-27.5228,1.21561,-54.9377,3.08192,-51.141,-64.9358,-36.0651,-62.988,-31.6873,-52.0022,-33.7453,-46.5655,-27.9172,-26.0869,-54.109,-19.7652,-50.3296,-48.0127,-40.815,-44.8171,-35.0218,0.5953,-46.1697,3.09813,-42.214,-77.9953,-48.1047,-71.6731,-44.1847,-17.3135,-24.7801,-12.7769,-18.3739,-5.77602,-61.4241,-2.72408,-58.883,-9.24165,-23.5347,-6.96935,-17.061,8.78461,-59.3829,10.8518,-56.509,-40.708,-5.89388,-35.1608,-1.04242,-21.8594,-49.1369,-15.5412,-45.4422,-48.6932,-16.6187,-42.3931,-11.0217,-41.7131,-68.6858,-39.1203,-66.656,-78.3794,-62.958,-71.7097,-58.3293,-30.6312,-3.28985,-28.0996,-1.09704,-42.6322,-17.3528,-38.2076,-14.8087,-44.4894,-16.5415,-40.0907,-10.4571,-78.0808,-39.0736,-72.2574,-32.5709,-57.4969,-30.15,-50.926,-25.3533,-29.8657,1.86693,-26.0997,8.18173,-14.4374,-62.005,-9.67362,-56.1735,-79.1129,-25.0509,-76.6624,-22.4018,-36.901,-20.0336,-35.0119,-17.7864,4.1357,-34.012,8.86658,-30.2966,9.50789,1.36419,12.0303,5.53646,-56.8376,-51.8406,-51.486,-48.488,-52.0114,-9.36788,-45.7981,-7.51211,-35.3982,-62.0809,-31.7704,-58.1221,-25.3103,-80.1147,-22.2564,-74.8215,-72.2808,-47.0632,-70.3327,-40.282,-66.7491,-29.7448,-62.1457,-24.6182,-67.4526,-67.2344,-60.7729,-61.4543,-71.7929,-47.9684,-68.1613,-43.7535,-20.5769,-17.3919,-14.1107,-11.1664,-11.7249,13.4896,-8.13379,17.4837,-1.46879,-78.9939,1.81851,-73.3968,-22.4743,-58.8056,-18.6373,-55.3623,5.38661,-13.526,9.20056,-10.3644,-30.2642,-54.2854,-27.3184,-48.7216,4.5198,10.4866,7.46682,16.9943,9.75212,-76.6489,15.0315,-71.2287,10.8828,-11.4069,13.5395,-6.36842,-72.8908,7.76039,-68.3059,10.8738,0.91291,-1.85929,6.81771,2.95276,-40.0024,-76.8108,-36.6784,-72.2559,-20.0095,-78.0215,-15.9779,-73.1206,-38.7573,-25.3726,-35.8016,-20.4621,-59.4848,11.3369,-56.8037,17.9702,-48.6442,-4.1198,-45.7084,2.61946,-47.7173,-28.5161,-42.9089,-22.1513,-24.792,-58.8932,-21.9477,-55.5048,-49.3989,-79.8981,-43.489,-76.9142,-0.471068,-13.1444,4.91379,-10.7999,-67.5743,-24.1543,-63.8032,-17.4574,-28.5209,-67.9656,-25.0984,-62.0081,-75.7779,-19.1885,-72.8608,-16.3942,-2.8108,11.7835,1.72802,15.8893,11.1603,-76.4644,14.508,-72.8264,-34.3862,5.9656,-31.9142,12.7593,-77.4332,-59.8789,-74.7787,-57.786,-63.7636,-71.6583,-59.5429,-66.5793,-34.3267,-49.141,-32.162,-45.9821,-45.9903,-11.398,-43.7772,-6.19501,-4.56966,-5.96783,0.198316,0.476504,-13.6102,-72.2619,-7.01804,-66.5081,-37.2559,-67.4857,-32.0645,-63.5102,-31.4769,-28.8497,-25.4224,-24.5866,-19.2558,-74.5889,-13.5363,-71.6118,-45.6969,-27.2081,-38.9868,-23.1531,-8.96221,-2.97749,-3.72277,-0.869159,14.0543,-13.9724,17.1433,-10.1472,-58.7025,-80.7549,-55.8402,-74.9344,-67.6452,-38.066,-62.4834,-35.3906,-54.1876,-16.9381,-49.4825,-14.2563,-73.4386,-6.55393,-66.7186,-4.3054,-79.3939,-30.1118,-75.0156,-23.61,-41.2681,-65.0707,-37.9925,-61.3246,10.7151,-47.4847,16.0174,-43.9706,-22.0724,-66.6595,-19.7554,-61.009,-7.0717,10.2425,-4.44655,12.2757,-62.0613,10.2513,-57.9839,15.3792,-29.1762,-72.4755,-26.6039,-66.5874,0.375985,-41.7459,5.66198,-38.1442,-28.6588,-50.844,-26.4695,-47.0451,6.20579,-60.5353,8.46562,-55.6669,-17.6521,-45.7689,-13.4246,-39.9271,11.577,8.48182,15.5764,15.0262,-3.41187,-49.3551,0.749365,-45.1032,-44.6171,-2.74012,-37.9374,1.28231,-50.4102,-23.4391,-46.0926,-21.4711,3.58345,-23.8152,7.55388,-20.2519,-29.6952,15.2475,-23.2811,17.5127,-67.9556,-42.8705,-63.1694,-37.5613,2.88268,-1.5338,5.31996,2.52578,13.2468,-19.4263,16.5565,-14.8817,-2.44886,-78.2615,3.77224,-71.8085,-75.0277,-25.9568,-72.5463,-19.2958,-65.502,-50.1719,-63.2442,-46.8723,-8.82806,-22.1326,-6.29091,-18.2004,-62.4483,-58.4652,-56.1638,-52.1205,-6.898,-27.5324,-1.06423,-21.4195,-59.9477,-7.5795,-54.1729,-3.95498,7.35128,-72.9536,9.48453,-67.6163,-81.2583,-16.928,-75.842,-15.0435,-49.3269,-29.2634,-43.7676,-25.495,-44.2596,-43.8487,-41.6873,-38.348,14.9466,-26.1351,17.1229,-21.31,-68.8781,-37.0463,-64.9265,-30.8465,14.3469,9.17345,18.2084,14.615,-73.3969,7.36764,-66.8656,9.70946,-77.4046,-53.5609,-73.5169,-51.261,-16.9393,-75.3591,-11.5662,-72.8231,-55.406,-12.4626,-49.1925,-7.33309,-22.853,-59.4862,-17.3076,-55.9831,-29.7968,10.8401,-25.9637,15.6153,-79.4737,-5.71441,-76.9606,-1.40567,-15.2847,-73.6315,-8.71031,-68.0422,-68.8887,-79.7739,-66.3806,-73.5995,-16.5545,-39.4576,-11.0864,-33.2809,-75.2543,-43.9756,-70.0205,-40.456,-9.44192,-65.8288,-7.10184,-61.4135,-21.3316,-22.2646,-16.8962,-18.6308,-72.6649,-45.3004,-67.9949,-42.015,-31.1864,-22.134,-25.7884,-16.9758,-67.6516,6.88535,-65.6217,10.0185,-9.99101,-56.2642,-4.61172,-52.4614,8.7589,1.73817,10.5857,6.3204,7.98605,7.28461,12.4587,11.0528,-68.571,-61.4158,-66.6558,-56.0836,-29.0798,12.0555,-26.4775,17.539,-55.1535,-34.4416,-50.1395,-30.9654,13.2307,-11.221,19.0914,-6.29845,-9.64118,-56.1327,-4.83717,-53.4991,13.1681,-40.676,16.5441,-35.5675,-37.4449,-70.391,-34.1575,-64.1548,-35.1767,-77.6931,-32.614,-73.9712,-10.8648,-35.2439,-8.64216,-32.5768,13.4664,-63.0407,17.6098,-61.1117,3.23203,-5.82003,5.73349,-3.20037,-30.0234,-27.0023,-23.2749,-24.5711,-58.0834,-46.2423,-51.5708,-44.1555,-22.3369,-44.7307,-20.1286,-42.8286,-4.02762,0.379945,-0.294564,5.87631,-26.5763,-26.4114,-23.7289,-21.348,3.52283,-12.7143,8.04486,-9.17755,-81.1189,-40.1297,-75.6977,-37.6873,-25.4966,-39.2816,-19.6835,-33.4945,-16.1406,7.04045,-13.3781,10.1559,-60.7859,-55.5176,-56.9451,-52.7961,-20.06,-71.9405,-13.2836,-69.1155,-29.0297,-2.88738,-25.4031,-0.350501,-55.7491,-51.8757,-50.6766,-47.6242,-13.2853,-6.86787,-9.94403,-2.76156,-22.5724,10.911,-19.0935,16.9105,-32.1218,-79.1882,-29.353,-76.5359,-48.3874,-38.219,-42.771,-32.7729,-80.8876,-77.5316,-76.9648,-75.5565,-45.0065,-17.0105,-41.7326,-13.5688,0.80941,-42.2771,3.5017,-38.2131,-75.3685,-71.213,-70.2583,-69.0366,-22.0617,13.2444,-15.7989,19.5491,-33.6562,-76.0531,-31.3681,-70.426,-35.4856,-16.8726,-33.491,-11.9205,-10.7158,-39.9478,-8.74586,-33.6459,-36.1666,-69.1446,-29.9097,-62.9333,13.1908,-41.4676,15.8283,-35.5277,-70.3241,-20.2126,-66.8185,-13.8894,4.03511,-55.5845,8.53728,-49.8117,-64.7458,-74.1194,-61.7601,-70.0417,-71.2743,8.9978,-69.2473,13.6361,-68.6607,-71.9121,-64.2252,-68.7786,-17.4626,-47.3455,-11.9667,-44.6488,-43.0762,3.09748,-40.696,9.61092,-21.174,-46.9317,-18.1136,-44.9671,-42.5945,-77.2116,-39.3929,-75.0066,-57.5174,-43.0654,-52.2887,-40.9672,-35.8062,-61.467,-30.4932,-58.7808,-12.0739,-41.4553,-7.94584,-37.501,-25.1927,-24.2823,-20.2745,-21.7207,-79.3159,-29.5853,-76.6489,-26.8837,0.74847,7.63329,4.8978,10.5473,-43.0247,-42.5437,-39.6812,-35.8957,-34.0506,-5.42594,-30.75,-2.48349,5.75465,6.99035,8.1742,12.9305,9.88903,-25.5149,12.7372,-22.9527,-53.8582,-36.8361,-49.5893,-30.9164,2.12251,-57.2734,5.36736,-51.1473,-80.0966,-69.9659,-76.286,-64.0137,8.07368,11.3365,12.4894,15.9698,-78.1414,0.787246,-74.4022,7.07025,7.87694,3.43378,9.96758,9.33987,4.85482,-68.2378,11.6405,-64.3932,-3.61384,-77.7065,1.76458,-75.0874,-63.9835,-20.3856,-57.4878,-14.4657,-53.3456,-59.8577,-47.7794,-57.4571,-36.5251,-9.84177,-33.2998,-5.86972,14.2162,-12.9601,17.9545,-7.36264,-7.53752,-45.853,-5.02513,-40.7308,-56.4332,-2.93269,-53.6802,0.525282,-19.9087,-38.9059,-15.8654,-35.9269,-67.2484,8.15532,-63.4609,13.1074,-6.76521,-50.6565,-3.17653,-48.7297,8.44845,-50.6855,11.83,-47.6974,-20.4992,-50.2617,-14.5107,-47.3631,-68.5164,-54.8623,-65.7091,-49.7869,-46.7951,-58.1336,-43.1031,-52.6603,-79.4175,-39.0757,-77.1645,-35.6464,-39.7996,-58.0931,-35.1413,-53.3348,7.12385,-14.3075,9.08301,-8.99907,2.42634,-62.2156,8.46902,-56.2437,-15.8088,5.45039,-12.5663,9.3668,-17.1354,-56.0351,-10.4431,-50.2808,-51.2031,-46.324,-49.2556,-44.2871,-25.4873,-36.9477,-18.8936,-34.9975,-22.0215,-67.1336,-19.7528,-62.4897,-26.0391,13.0258,-22.3809,15.3224,-29.9828,-77.6993,-26.2098,-75.0444,-70.0448,-23.7228,-65.3603,-17.7448,-64.3378,2.24169,-58.6112,8.53736,-64.9094,-51.2267,-61.0472,-49.1894,-20.0783,-74.0509,-17.3792,-72.1642,-28.81,-1.36859,-24.0585,2.87191,-9.19966,-18.4558,-6.60747,-11.9966,-54.0315,-46.3185,-49.8578,-39.8348,-32.4979,-28.8146,-28.0636,-24.5877,-29.9859,-4.76304,-27.0092,0.564902,-31.3441,-53.9661,-27.2089,-51.9258,-76.6796,-76.827,-70.2971,-71.242,-71.501,-23.5423,-66.9726,-17.4642,-19.2903,-40.0244,-13.7301,-34.3991,-21.5701,-0.10038,-16.3209,3.0632,-39.808,-6.5425,-33.1509,-1.50581,-13.0749,-31.8734,-10.6773,-29.9813,-74.5137,-47.5869,-70.4935,-44.4306,-57.6187,-31.2196,-54.879,-27.1946,-37.8982,-14.11,-32.6399,-7.48261,0.0700927,-56.7943,5.83662,-50.7754,9.86161,-76.1866,13.8461,-72.4045,-16.2322,-78.5475,-9.46738,-74.5978,-77.1017,3.81435,-74.1177,6.82421,0.344604,8.40549,5.7851,13.4241,-41.7552,-13.592,-38.7378,-8.94367,-74.3646,-12.4744,-69.7458,-8.27873,-27.8728,1.95892,-21.2815,7.82734,-70.7799,-52.1028,-64.694,-48.4891,6.30973,-52.9875,13.0244,-50.1793,10.8389,-36.8764,17.1553,-34.4251,-13.4636,-36.3583,-11.1455,-31.4546,-22.5535,-19.0929,-19.478,-14.34,7.24009,-36.946,10.9806,-31.8683,6.7167,-19.2167,9.92599,-14.3923,-80.0484,-25.7125,-76.6889,-23.3254,-55.1284,10.2265,-51.1051,14.2414,-60.3548,3.58077,-53.9777,5.91109,-34.8424,-16.9102,-32.7778,-14.8597,-4.00579,-51.4141,-1.67937,-48.6228,-10.6092,-22.2228,-6.16176,-19.8344,-54.0406,14.902,-47.2973,19.2238,-60.5363,-68.2886,-58.4149,-66.4345,8.18266,-17.7859,12.2084,-14.6934,-58.5477,-22.3019,-54.4484,-19.7832,-79.3915,-30.2432,-74.9775,-23.8137,-19.7579,-44.319,-14.7402,-37.8522,-1.0132,-37.176,0.917277,-31.6426,-65.4586,-40.9967,-59.5211,-37.5398,-55.4468,-20.11,-48.7706,-13.7966,-60.4863,-12.4391,-54.3584,-6.92722,-54.4144,-9.14213,-48.5584,-7.13604,-54.6563,-72.513,-51.3158,-68.2816,-73.1666,-58.4494,-69.477,-54.1731,-61.259,-55.7774,-57.3086,-53.5762,-53.2508,2.70378,-50.0574,6.84707,-27.95,7.90164,-24.9893,10.0411,-74.8818,-17.0011,-72.2516,-10.7908,-2.20004,-24.3289,3.14129,-21.1872,-1.22031,5.7094,3.53777,10.7665,-63.7665,-47.0044,-59.5319,-43.4826,5.40741,-31.1119,10.0685,-25.2697,-56.5825,-72.1924,-53.1163,-67.7509,-26.4242,5.26551,-19.9697,10.3834,-5.27676,-63.088,0.904851,-56.5591,-28.079,2.33367,-21.3083,6.70339,-49.0306,13.9065,-43.3223,15.8914,-38.3553,-54.9663,-34.099,-49.7186,-38.1637,-65.2813,-34.4072,-60.639,-72.7977,1.11556,-69.3557,7.58601,-61.8513,6.886,-57.5778,11.6778,-75.915,-8.67003,-69.9175,-3.60912,-34.2348,-23.6553,-31.5312,-20.3847,-3.06267,13.8548,-0.0597035,18.2785,-59.5105,-68.9536,-53.8223,-63.6044,-70.3532,-50.0797,-65.3209,-45.1924,-22.3086,-7.03457,-18.5829,-4.82445,-7.83856,-53.5577,-1.36057,-46.9018,-44.9028,-79.0919,-38.5731,-77.0899,-72.9172,-15.8919,-70.3267,-9.66135,4.77346,-33.5588,7.01093,-31.3498,-10.7736,-19.9336,-7.04719,-13.2342,-59.415,-71.8178,-56.3237,-68.5144,-28.2597,-26.3209,-23.6182,-24.3057,-65.7397,-22.8936,-62.098,-18.1423,-0.23552,-46.5216,2.40887,-40.7146,7.93134,-39.1057,10.9448,-33.9292,-5.88621,-18.1455,-2.02067,-14.6173,2.70075,-37.9692,7.39873,-34.6216,-38.269,9.71749,-36.2115,12.148,-75.1272,1.34327,-71.8419,5.70749,-9.06712,-37.5501,-6.03753,-31.8976,-14.9866,-29.2025,-10.1946,-22.7904,-54.7567,-72.2819,-49.8749,-70.2091,-45.0538,-27.813,-41.9391,-25.6144,-36.9635,-19.8819,-32.6382,-15.306,-72.1573,-45.328,-69.4088,-43.2404,-0.905106,-53.5181,1.01727,-49.4415,-5.92958,12.426,-0.344156,16.4182,-9.13022,-81.1266,-2.8545,-76.0762,4.62205,-59.5732,10.6929,-56.9668,-1.1541,-30.1908,4.02071,-27.664,-25.1288,-69.4748,-22.7763,-66.0203,-54.7989,-42.5473,-49.4942,-37.9561,-72.607,-68.2007,-70.7261,-66.2421,-6.68467,-76.0794,-3.3929,-69.3233,3.59614,-39.1393,8.80829,-36.0192,-19.9578,-12.7356,-15.3979,-5.97884,-69.6573,-64.1711,-63.988,-60.1449,-16.6318,-0.471139,-11.5977,2.98495,-76.9902,-9.93462,-72.3035,-6.60184,-55.678,2.93074,-53.7929,9.59678,-60.3008,4.22066,-56.3722,9.46151,-6.73779,-59.1126,-1.08416,-55.0791,-51.4161,-6.22818,-46.1609,-3.85149,-54.5957,-65.5751,-52.6661,-59.5439,-57.2073,-59.3415,-52.2043,-53.9168,-45.4138,-29.8113,-40.9574,-25.9924,0.267153,2.07235,6.55765,6.66708,7.43102,-11.0724,11.3428,-6.90317,-11.2433,-56.4745,-6.4106,-54.5138,-65.8958,-64.1349,-63.7815,-58.4048,-44.9297,-78.3506,-38.8661,-76.3202,-46.3774,-36.4138,-43.8405,-33.8659,9.17188,-5.73093,14.7474,-2.36329,-9.01892,-65.9906,-2.51431,-61.6206,6.34222,-34.071,10.7316,-30.4525,8.7871,8.5901,15.062,10.9622,4.19975,-65.1655,7.85673,-61.254,-2.20641,-26.2002,4.33168,-22.473,-41.3413,-25.6146,-35.3317,-20.8743,-9.86781,11.3147,-3.83406,14.2698,-28.6372,-61.4615,-24.5134,-55.1327,-12.3372,14.9144,-10.5279,18.6188,-79.0675,-56.2305,-76.8154,-50.5593,-3.97735,-29.9922,-1.63195,-24.622,-43.1925,-5.23923,-36.5216,0.431462,-0.995678,-78.7904,1.25874,-72.0806,-29.0143,-58.7509,-23.7071,-56.5196,-20.2395,-35.8302,-15.8792,-31.3087,-69.541,-62.7859,-66.2071,-58.0892,7.20985,-57.9571,11.9047,-52.4814,-24.5279,-37.2751,-21.8464,-33.7737,-29.674,-73.6191,-27.7756,-69.8264,-41.557,-69.9496,-36.7582,-66.5325,-30.739,-12.0684,-28.6075,-7.56534,-23.8092,-50.1216,-21.5899,-48.2455,-47.0597,-28.2897,-43.5343,-23.3621,-31.1353,-33.975,-28.0379,-31.733,-43.065,-61.2266,-39.1665,-59.3403,-57.5287,-60.6071,-53.9199,-53.94,-15.0806,-80.678,-8.54912,-75.76,-78.784,-27.0881,-72.3078,-23.7482,-69.7014,-70.7714,-66.4632,-66.2689,-27.7809,1.82162,-25.7407,6.5434,-30.5105,-45.7846,-25.6257,-39.0714,-27.357,-32.9555,-22.8207,-30.87,-54.8996,-62.1523,-48.7061,-56.1649,-34.1075,-47.3558,-27.3667,-44.1457,-40.9639,-46.4167,-34.2946,-43.6539,-80.1473,-39.0102,-73.5712,-37.0909,-40.1816,-40.6734,-36.4337,-37.4864,-26.1368,-44.6546,-23.6188,-42.7467,-74.3664,-37.6329,-68.7435,-35.1327,11.0324,-29.5405,15.5617,-27.4204,-51.5368,-22.405,-48.7528,-19.354,-37.3373,-15.8919,-35.3199,-11.129,-63.0192,-29.8076,-58.2383,-25.1521,8.1912,-42.9944,11.3899,-39.812,-64.1504,-24.1985,-62.2381,-22.0532,-5.79436,-80.9034,-0.608455,-75.0035,12.9618,-78.605,17.1843,-74.0977,-13.6576,-28.1064,-11.2431,-26.1207,-14.7719,-55.3132,-12.3776,-52.8603,-43.8603,-9.0173,-37.8226,-5.47639,6.1188,-75.1079,12.3532,-71.3586,-48.1903,-23.3352,-46.0182,-17.0756,-64.3425,3.3269,-60.0163,8.76523,-4.01995,-65.1929,-0.803342,-61.295,-51.6697,-62.9834,-45.83,-57.4572,-52.7707,1.27176,-47.4129,3.48483,-26.2807,-21.1992,-24.1944,-15.6975,-72.8462,6.5028,-68.5539,9.50924,-17.9292,-64.9715,-13.4442,-62.6516,6.61488,-17.8381,10.1596,-13.881,-65.3042,-1.52506,-63.2339,2.7986,-35.697,-71.8632,-33.4991,-65.705,-4.49057,-49.5791,0.353766,-44.934,-0.299656,8.81935,4.23425,12.5242,-32.1871,5.31515,-25.6093,10.7083,5.08296,-77.4986,10.5173,-70.7993,-15.3523,-10.4513,-12.6925,-7.60572,-25.0869,-71.7459,-19.5724,-66.3118,5.27952,-72.0554,10.7625,-68.4477,-74.5404,-8.85297,-70.5981,-4.93091,-73.959,9.2987,-67.4838,14.3404,-75.0074,1.96805,-71.0225,5.87256,-60.669,-81.3217,-54.8741,-75.099,-36.0435,-44.5572,-31.7093,-42.6282,-53.7627,5.0595,-51.3206,10.8618,4.57654,-61.18,8.63668,-59.3429,-51.8678,-43.8744,-45.764,-40.2981,-79.4213,8.70708,-75.5952,14.6895,-19.0981,-69.784,-14.9771,-65.4853,-11.7252,-37.9721,-7.98197,-33.123,-32.8702,-9.25074,-26.3201,-4.58158,-64.383,-75.6838,-59.8845,-71.8342,-14.8499,-15.282,-8.28085,-11.7992,-17.5582,-21.2158,-15.2401,-18.5081,-10.8778,-12.7176,-7.05433,-10.3441,-12.9157,-34.5977,-7.80804,-28.8763,-46.3691,-3.62424,-40.1574,-0.723769,-79.0396,-78.2968,-73.6374,-73.0394,-56.5534,1.22187,-52.6981,4.43087,-81.7185,-13.6709,-75.8768,-9.26879,-73.8875,-34.1703,-71.6375,-28.5638,9.15554,-36.3544,15.7388,-30.3418,-61.2155,-48.063,-58.7778,-44.7826,-55.5747,-10.493,-50.5017,-8.39285,-51.6398,-51.8097,-45.0521,-47.5228,-17.7467,-71.1781,-14.0554,-65.285,-60.5715,-66.1058,-54.1681,-61.2857,-12.2193,-43.3717,-10.1273,-37.8958,-19.0534,-39.8268,-15.6888,-33.1381,14.6081,12.4218,17.4532,18.2788,-11.1767,8.07865,-6.09661,13.5869,-56.8348,-54.81,-54.8817,-52.8203,-77.0323,10.4536,-70.4939,16.9214,5.97916,-5.85341,12.6084,-2.63365,8.33012,1.02861,11.7199,5.71661,1.00659,-72.096,3.4363,-66.0356,9.90348,12.8696,15.6106,18.0103,0.409395,7.57791,6.77079,12.2977,-25.2066,-27.0981,-20.8894,-20.4931,-67.7785,-74.1503,-61.5287,-71.5859,-13.1101,-51.3399,-8.42523,-46.8053,-66.4121,-66.0794,-61.0332,-62.5841,-35.0948,-27.8919,-31.6028,-21.6833,-52.5089,2.19011,-50.3025,4.13583,-70.7418,-35.4982,-67.2067,-30.3399,-27.3531,-24.8753,-23.2925,-18.5904,-80.3267,-40.7177,-74.5519,-34.6687,13.732,12.1042,15.8021,13.9112,-37.389,-51.4572,-33.8244,-47.493,-55.8636,-81.0794,-53.555,-76.4347,-71.2927,-2.54484,-65.1927,4.13199,-5.60764,-13.5612,0.0208779,-10.3261,-19.7045,-42.7583,-15.4635,-38.6802,-44.0888,-34.94,-38.5879,-29.0281,-75.7052,-26.858,-71.6398,-21.0568,-40.7307,-33.9829,-36.1003,-30.3544,-70.8067,-0.966256,-66.9364,2.38153,8.92566,-33.931,15.4019,-29.9453,-45.8824,-62.4254,-41.6156,-60.4071,-45.1843,-65.0372,-41.1688,-60.4659,-37.3343,-56.2431,-31.6674,-53.3423,-9.0448,-36.6142,-5.32261,-31.4383,0.227701,-43.5635,5.42993,-40.1673,-78.1261,-78.5053,-75.8567,-73.802,-75.5001,-41.6306,-70.068,-37.5227,-29.8798,-68.6866,-25.3543,-64.8894,14.3077,-17.1406,17.8931,-10.461,-76.0542,-76.4827,-72.8893,-74.0378,-17.2389,-56.6642,-11.5462,-54.3318,-39.33,-14.4075,-34.5689,-11.073,-10.731,-77.7163,-7.35201,-74.5177,-78.0266,-70.0675,-71.3001,-63.6799,-72.4481,-31.4409,-69.6532,-26.5184,-42.2227,-42.5134,-38.2,-36.6604,-40.538,-27.336,-36.1497,-20.6257,-54.2178,-25.8072,-49.3644,-21.1463,-56.3171,-16.3625,-49.5879,-11.962,9.81069,-5.40371,12.643,-1.32151,-39.0157,-68.3427,-34.5252,-64.3611,-57.12,-44.9379,-52.8202,-41.2036,-18.1848,-44.2249,-14.4252,-39.5652,-25.6082,0.777487,-20.1599,6.02654,-14.4585,-47.0722,-10.1018,-40.7863,-36.3989,-41.2087,-30.1202,-39.1183,-52.118,-40.6795,-48.7897,-34.3254,-17.4075,-52.4227,-15.5704,-49.1192,0.815288,-28.3028,6.00285,-26.1361,-79.2946,-37.9704,-74.5087,-32.808,-30.1461,-61.414,-26.1774,-54.787,-72.9296,-15.8031,-70.9636,-12.0527,8.04746,-57.3363,10.4142,-54.7307,-78.2709,-43.0154,-73.975,-38.677,-32.4103,-78.7216,-29.9907,-75.7512,-60.7064,-37.8376,-56.5943,-35.3255,-64.8974,-22.2389,-60.3826,-18.5038,-54.1523,-35.1116,-50.9532,-30.675,-20.603,-58.9029,-15.4776,-55.9543,-16.7118,-72.9752,-10.3083,-67.2151,-27.381,-73.6825,-21.1341,-69.5591,10.3313,-74.4822,13.9092,-68.2024,-28.4348,-7.28958,-26.4233,-1.54884,-60.3232,-23.1626,-57.6446,-16.5589,-33.2858,-14.9476,-26.9249,-10.7071,11.8544,-35.5279,17.4347,-32.5309,-3.38236,-37.0968,0.115543,-34.5991,-59.3287,12.3106,-53.1882,18.1144,-17.6603,9.47786,-11.7043,15.1633,12.2218,-16.4834,17.6109,-13.5268,-43.9541,-32.6186,-41.3568,-28.9552,-25.8231,-5.7704,-22.3412,0.505383,-73.4266,-29.5587,-69.7279,-26.4805,-5.64194,-47.3643,-1.54589,-45.4788,-49.6993,4.55685,-47.1868,9.37448,-23.9947,-23.7124,-19.5304,-19.4753,-52.2811,-52.9509,-45.7624,-51.049,-30.7459,-4.7102,-26.4414,2.0146,-12.5403,-45.1921,-6.10397,-39.9829,-26.7427,9.71642,-21.6318,12.1959,-73.8999,-50.2338,-70.1777,-46.8441,-53.3681,-22.5724,-51.2712,-18.4509,-32.4013,3.05757,-27.872,8.24327,-63.0603,-79.4951,-58.1886,-75.9234,-75.1764,-8.03901,-71.0726,-3.2063,-2.61687,-21.763,1.06951,-18.5246,9.41916,-40.4195,14.1349,-36.2144,-40.4655,-50.8535,-34.7346,-48.7328,-43.7559,-51.2804,-37.2648,-44.6577,-21.0834,-54.3254,-18.9776,-52.4206,-78.6322,12.5674,-72.754,15.4519,8.44049,0.697026,12.4463,6.39236,-37.0377,14.6213,-33.9889,19.434,-74.6511,-51.8201,-68.9134,-46.8361,-29.2664,-4.13869,-25.9214,-1.99648,-63.2588,-14.4499,-57.6042,-9.25786,-30.8549,-20.2704,-26.2933,-13.8373,-66.9079,-19.3504,-64.3901,-15.8928,-68.4019,-57.4565,-64.1254,-51.6949,-4.92174,-59.4138,-0.0755975,-57.3621,-4.87877,-74.5262,0.458559,-72.6891,-62.5423,-31.0718,-59.3937,-24.4407,-3.99167,-13.9261,-0.334094,-8.35367,-33.7773,-40.9158,-27.0922,-35.8792,15.0998,-64.6743,18.386,-58.5682,6.11535,-49.091,11.7585,-44.6697,-21.24,-18.2852,-17.3017,-16.4012,-59.5729,-56.8867,-56.687,-53.6143,-15.9089,-9.65649,-10.7099,-5.73634,-62.0489,-4.37243,-58.5212,0.988268,-1.93299,-3.37249,4.51133,2.34056,-21.3474,-64.3066,-14.8417,-59.9184,9.25997,-49.657,11.2938,-44.6571,-46.7823,-42.6562,-40.1427,-38.8287,-45.5592,1.73183,-41.7899,5.75382,-71.615,-55.4795,-69.662,-53.6657,-20.8427,-10.308,-18.4664,-6.30826,-55.7451,-58.8907,-53.2209,-52.1559,-67.3319,-48.7804,-61.035,-46.8107,-81.2014,-66.0635,-74.6309,-61.6479,-69.7664,-66.8774,-66.167,-61.9019,-64.5277,-41.3997,-62.1083,-36.4348,-40.348,-78.7688,-34.2627,-76.9093,4.73537,-72.9331,6.60763,-68.026,4.02476,-80.7121,8.54446,-75.6018,2.17678,-36.8184,4.86253,-33.8279,-47.6622,-42.7661,-41.6792,-40.912,2.13126,0.561743,4.49229,3.12088,-49.2357,-1.22887,-43.329,2.94423,-77.6434,-7.61983,-74.795,-0.900592,-16.668,-28.3637,-12.634,-25.1498,-48.0446,-37.6366,-44.1519,-35.6096,-24.8621,-52.1032,-22.0007,-49.8183,-42.4025,-26.3344,-38.9079,-22.343,-61.0986,-13.3377,-55.5539,-10.6044,-0.0554147,-33.7826,5.72952,-29.66,-47.3031,-49.5867,-40.5923,-45.7851,-45.2967,-48.0817,-43.4902,-45.5643,-74.6197,-54.318,-68.9184,-48.4919,12.766,-57.475,17.785,-52.0578,-57.6455,-45.1309,-51.672,-42.1293,-70.7114,-12.597,-68.2263,-8.04757,4.44878,13.0011,9.20777,18.5023,-34.6755,-31.2672,-32.2052,-29.2724,-0.403542,-36.2043,4.30931,-30.7522,-40.7588,-10.0723,-35.2455,-5.05527,-1.33834,-50.6226,5.26265,-45.366,-76.4337,-18.8999,-71.9273,-13.3806,-79.8908,-18.2603,-77.7639,-11.9445,-32.8057,-69.9467,-27.1575,-64.3204,9.88112,-29.1944,15.102,-23.6222,-35.1573,-46.0998,-31.3288,-43.0253,-10.179,-37.5507,-5.69477,-33.8921,-23.4802,-61.2548,-21.3839,-55.823,-66.4575,-47.8554,-64.4087,-46.0347,-0.798275,-74.097,5.16584,-67.4758,4.4397,-22.1126,8.36386,-18.8482,1.82633,-43.9898,6.78947,-42.1691,9.57038,-48.2586,12.9308,-44.8713,-5.17934,-14.0982,-1.93447,-8.14554,-15.4578,-46.8758,-10.8147,-42.321,-67.3824,-46.2042,-64.7509,-43.9411,-71.2223,3.01596,-67.6285,7.11774,-30.4713,-76.4922,-26.0459,-71.0573,-31.796,1.63173,-27.7197,4.40701,5.27524,-66.338,9.17549,-63.2201,-65.9282,-64.9707,-60.8957,-59.021,-41.9534,8.09543,-36.7256,11.2079,-78.7858,-70.206,-76.8153,-67.7411,-2.5298,-28.5986,0.470574,-23.2592,-12.9064,6.94243,-11.0911,9.97367,-60.548,-77.0627,-57.1342,-74.1392,-16.4426,-25.4637,-10.946,-18.6999,-66.9414,-22.5822,-61.3381,-16.6942,-19.669,-53.4019,-14.6913,-50.3722,-52.4497,-69.4225,-46.8014,-63.616,-30.6717,-80.9147,-25.7449,-76.252,-75.8206,-21.0926,-73.9662,-15.1516,-76.8278,-64.0916,-70.7076,-59.0873,-56.2829,-62.2443,-50.0073,-56.3735,9.99589,-41.695,13.334,-39.7446,-72.8053,-70.3129,-67.5321,-64.2377,-38.6681,-46.5435,-32.5427,-41.7802,-64.055,8.52017,-61.2808,13.3109,-3.83714,-30.0948,-1.57553,-26.4914,2.21496,-3.95523,6.5897,2.41361,-19.3833,-65.2886,-14.88,-61.1401,-40.8405,-68.1444,-36.1805,-63.8626,-4.16733,-56.8157,0.663167,-54.5221,-47.9072,-36.9891,-43.197,-30.5133,-74.4331,-31.045,-71.9155,-27.5421,-0.285113,-65.2111,2.48602,-63.3533,-68.0938,-9.56342,-64.1284,-4.79952,-22.7784,-29.4734,-20.1215,-25.9768,-19.6589,-53.6779,-14.5713,-51.6246,5.90134,-26.5855,9.09725,-23.9691,-19.3249,-30.4866,-16.4842,-25.3753,-19.2453,-24.4288,-12.6559,-18.3399,11.949,-34.7337,14.445,-31.8758,-3.61212,-62.0092,2.5562,-58.1612,-38.5579,-22.769,-35.5437,-19.5237,9.18009,-69.5163,11.4669,-66.0838,-30.5116,-38.9486,-25.1327,-36.7698,-8.09263,-47.7186,-4.25033,-41.9284,-29.8586,-57.4746,-24.447,-54.8687,14.882,-31.9377,17.1793,-27.642,-24.9247,-71.0234,-19.0894,-66.3739,-72.6175,-24.8582,-66.4745,-20.1587,-65.2382,-9.90309,-62.3309,-3.89617,0.0197931,-46.753,4.20479,-40.0862,-76.3325,-13.1827,-70.2531,-7.35169,-19.5917,7.67123,-14.1938,13.5813,-18.5293,-13.9904,-15.0956,-8.71231,15.0333,-73.4796,17.1826,-69.1054,-18.6892,-60.5524,-16.0362,-54.756,-13.4917,-41.8945,-11.3716,-35.1612,-6.39402,-12.4128,-1.42615,-10.5668,4.22741,-56.7461,6.88396,-51.3238,4.72845,7.61097,8.40508,13.6653,2.1359,-21.8128,6.65563,-18.7042,-45.902,-13.7739,-40.4166,-10.0071,-36.0947,-48.4304,-33.7696,-42.5304,-5.23529,-38.8135,-2.51134,-33.7195,-23.0749,-72.0085,-18.2877,-66.8712,-13.4988,-40.8148,-10.641,-34.415,-64.2089,-1.24963,-61.9765,3.57523,11.8904,-63.8714,16.8563,-57.2611,1.93948,-20.7513,6.08572,-17.2582,-6.91243,-18.4612,-3.25509,-13.7849,-43.0843,-56.8948,-38.869,-54.4228,-28.6326,12.5153,-24.6311,17.8479,-21.4675,-58.6599,-19.6315,-56.3909,-10.0298,4.0375,-4.72011,8.35214,-12.9598,-69.0389,-8.52865,-66.5838,-79.8438,-21.3136,-77.6487,-18.5781,-68.4434,-49.9894,-62.4933,-46.8483,-42.6974,-27.5519,-38.4468,-22.1736,-8.86534,-4.51938,-5.32618,2.23755,8.36598,-64.7694,11.0636,-61.4372,-29.6563,5.88687,-24.7001,9.35025,-58.0666,-61.6118,-52.3814,-57.6631,-28.6252,-52.4651,-26.5261,-50.2894,-39.107,4.06386,-33.0077,10.7502,-45.2717,13.5579,-41.7879,16.8674,-68.6707,-16.8499,-66.2604,-12.0074,-25.9088,-71.1054,-22.24,-65.3624,-18.3275,-39.0458,-14.2862,-36.3648,-60.6925,-66.811,-57.712,-62.9495,-31.0915,-9.78256,-24.8353,-4.67229,6.34425,-5.94082,12.715,-1.03519,-67.8114,-66.1658,-65.515,-64.2108,-50.2669,-4.55038,-43.7122,1.79706,6.38655,-30.5035,8.47708,-24.9084,-25.6846,-37.6984,-23.8458,-32.7229,1.71819,11.3241,8.3362,16.1035,-55.7214,-32.706,-50.5349,-28.4051,-74.9515,-66.8796,-69.3996,-63.3797,13.2832,-2.28179,15.5412,1.36596,-5.90899,-10.1666,-2.11103,-7.60844,-47.1849,-56.9399,-44.2264,-52.5794,-55.6177,-75.3599,-49.151,-72.5098,-53.6091,-15.9709,-48.9376,-12.3331,-63.1062,-66.5284,-59.7101,-63.0445,-12.6143,-6.41551,-8.61391,-0.308677,-33.4423,-29.3817,-31.2652,-27.4759,-52.7554,-9.84803,-50.2691,-6.9485,5.60634,-16.2578,9.35281,-12.3775,-80.4863,-42.0144,-76.7469,-37.5669,-2.98953,9.08952,1.06207,12.7573,-13.6829,-39.4312,-7.11354,-36.482,-48.9723,-77.23,-46.304,-73.0262,7.26762,-79.7669,9.10444,-74.4425,3.75871,-24.8823,8.58671,-21.9548,-30.9833,-57.3385,-28.9891,-50.7114,-60.855,-75.4869,-55.9917,-68.8267,-30.369,-34.0131,-24.6934,-31.9185,-24.6974,-23.8539,-20.2133,-19.3121,-2.40156,-33.187,1.89321,-26.4971,-60.8778,5.01451,-58.0035,10.3523,-11.4191,-57.696,-8.59088,-51.0253,-69.5254,13.7269,-66.4538,20.3868,-9.29642,0.984685,-4.39579,7.70355,-38.6881,-68.9266,-35.9627,-66.5561,-14.9726,-56.2244,-9.08217,-49.8717,-32.3166,-66.0393,-27.5841,-63.7655,-64.3419,-41.0372,-61.0144,-38.9665,1.40669,-54.7955,6.83955,-48.546,-51.8418,-27.4807,-48.0501,-24.592,-29.2823,5.63954,-27.2979,10.7841,8.71028,-13.9285,12.9668,-10.5305,-15.0659,-21.0132,-11.0731,-15.3394,-60.0416,-12.9817,-54.8727,-7.44859,-7.22538,-71.5514,-3.68513,-68.4755,-60.4702,-51.1927,-57.1572,-46.8743,-26.9347,-69.8235,-24.2426,-64.7896,-23.0329,-37.8656,-20.5949,-34.6954,14.3573,-56.9625,18.8403,-52.9523,-9.69296,-79.5002,-6.52511,-77.2505,0.108051,-59.6661,4.83001,-53.2089,-59.3678,-25.6128,-53.5771,-21.314,-63.1361,-69.1354,-57.9495,-64.994,-41.4953,-25.7281,-38.1178,-20.9464,-47.2987,-25.0326,-42.4225,-20.9186,-9.64206,-26.644,-7.8349,-23.3341,-26.1676,-25.5621,-21.4955,-19.4922,-48.0595,-9.79451,-42.0524,-7.17331,-2.17983,-3.29109,3.57634,0.131395,-39.3414,-49.9179,-33.743,-47.091,-35.8177,-25.0224,-31.4146,-19.5528,-31.8666,-9.82429,-28.7007,-6.75951,13.0208,-32.5443,18.0715,-27.9206,-3.33851,-41.8182,1.60559,-37.8352,-0.468113,-34.5539,4.04256,-28.0985,-58.4594,-78.3483,-53.3122,-75.7682,-70.4059,13.701,-65.4127,15.8101,-47.4482,-69.8601,-40.682,-65.1293,-46.3868,-4.62838,-43.372,-1.66994,-9.83309,-56.8855,-5.84751,-54.5804,-42.4711,-31.859,-39.6465,-27.9803,-38.7826,-57.9898,-32.2513,-53.5428,-65.481,-55.7099,-61.9702,-51.9413,-4.89393,-46.7688,1.31442,-42.2248,-47.975,-54.8921,-43.1142,-49.5171,-46.2671,-41.3145,-40.667,-35.1363,-6.27264,-2.91877,-3.02335,-0.747304,-58.3436,3.10196,-51.6275,5.1073,-24.0024,-23.6314,-17.5507,-18.362,-53.2434,-66.3206,-46.5626,-61.8453,-10.0375,-54.0019,-3.82902,-49.9259,-43.8891,-40.4959,-41.1672,-34.3361,-12.0184,-67.9969,-7.16024,-65.7512,-20.7392,9.48859,-18.3845,14.8502,-37.0903,8.76019,-34.8607,14.1028,-67.5513,-59.7293,-65.594,-53.4159,-2.1271,-44.0994,2.03569,-41.2639,-52.1496,-57.6649,-49.5974,-51.8943,1.48299,-72.7042,5.13045,-69.5942,-80.8386,-12.0072,-76.7109,-7.99014,-42.5239,-63.9131,-38.5043,-59.5728,-78.091,-4.0836,-76.1452,-0.449778,-26.0099,-34.3207,-19.7079,-28.4048,-25.4604,-77.7257,-20.0547,-71.1043,9.55436,-72.8587,13.3916,-66.5075,-23.0922,-46.7049,-18.1946,-41.936,-72.7096,-68.0448,-67.5995,-63.3844,6.12328,5.3612,11.5676,11.9315,-44.8574,-43.7761,-42.5208,-37.5212,-72.7548,-68.0348,-66.2661,-64.0145,8.43679,-18.1504,10.5937,-12.4014,-41.9246,-79.9101,-36.976,-75.102,-72.114,-18.2755,-68.4601,-13.5137,14.1576,-6.62008,19.7575,-3.25887,-40.7821,-45.8404,-37.6318,-40.2584,-61.2548,-51.1417,-58.3051,-47.0118,-7.70651,-50.168,-5.67131,-45.9694,-5.35548,6.69253,-1.56368,10.0552,-5.25596,-23.7028,0.147979,-18.7343,-26.4654,-64.33,-21.5834,-61.6234,-69.0551,-2.09223,-66.8183,3.27359,-45.2212,-36.436,-40.2678,-30.104,-46.9742,-69.3037,-41.8929,-64.5071,-77.2423,-1.9396,-70.7819,2.49309,-9.31234,7.44184,-6.21689,13.3947,7.09383,-75.9788,9.12936,-70.2995,-25.3407,13.539,-22.8455,16.8189,-35.798,-11.2748,-31.7303,-5.25635,-34.8954,-79.5758,-28.3497,-73.0122,-15.2812,-75.1621,-11.4624,-72.5111,5.4466,-56.8044,8.21303,-52.5653,2.14406,-65.0544,8.57171,-62.3854,-56.287,-67.7455,-50.6036,-63.6259,0.47329,-76.7048,6.1887,-69.9493,-11.1482,-60.0685,-5.39806,-53.7564,-39.3296,-35.0108,-32.6676,-28.4939,-56.2699,-7.98523,-52.2811,-2.70198,-4.46555,-14.8627,1.172,-10.534,-33.0383,-80.0089,-30.9039,-75.0692,3.2207,-76.7342,5.28256,-72.0595,-9.87227,-33.5245,-6.72878,-29.048,-77.2905,-0.0892538,-73.6311,6.07858,-7.59228,-64.3295,-4.23342,-62.3771,-43.7233,-71.4008,-38.7378,-68.8601,-77.5618,9.92783,-71.3891,13.7936,-1.50897,-33.2671,1.4991,-26.8683,-55.7643,-47.2664,-50.0078,-43.9731,-4.7818,-4.01806,1.53626,2.30948,-15.7167,-37.34,-12.1221,-31.408,-79.8241,-69.192,-75.4819,-65.481,-7.19196,-58.6707,-3.06857,-56.7366,8.80172,11.5557,15.2122,14.0792,-67.9459,-30.6771,-64.3494,-25.8591,-31.1791,-24.1321,-24.5224,-20.6543,-59.502,-40.4395,-56.7773,-38.0578,-65.6878,-79.6396,-63.6648,-73.9679,0.748727,-38.8595,3.4769,-32.4109,-18.5234,-38.5993,-16.0622,-35.5332,-67.2505,-81.0222,-63.4887,-74.6134,-68.4023,-10.1328,-65.8707,-3.53293,-62.3851,-1.3709,-55.6533,2.9198,-59.5119,9.46965,-53.5605,12.758,-53.509,-42.5328,-47.3601,-35.8449,-16.5745,-33.7792,-9.99633,-28.2072,-14.9605,-12.6889,-9.37971,-7.39906,-47.2946,-42.4643,-41.8157,-38.4707,-12.1841,-30.3233,-9.70242,-24.831,-80.0942,-45.3444,-76.671,-40.2216,3.86976,-28.1134,8.00469,-25.4104,-58.2262,-14.6717,-54.5074,-11.4669,-59.4242,-42.6241,-52.9146,-36.6512,-29.5014,6.66507,-23.8752,12.5698,-19.1497,-71.1659,-13.4942,-67.8266,-17.341,14.3565,-13.9794,19.0313,-76.7529,6.50037,-73.7708,11.1342,-63.8307,-3.22567,-59.3044,3.19922,-50.9719,-8.9133,-47.9472,-2.73676,-69.0846,-17.9253,-63.2935,-15.1205,-72.7382,-1.11147,-70.0145,1.31215,-80.3079,-23.6445,-75.693,-17.0009,-49.9949,-66.2084,-43.3369,-60.1194,8.28163,-9.85069,14.1799,-7.64763,-71.251,2.43033,-67.8496,8.94135,-75.8281,-52.4177,-70.6131,-49.1068,-50.6019,-31.4388,-46.3325,-27.0344,-24.7962,-11.9378,-19.8349,-9.0625,-47.0092,-41.3505,-43.0872,-39.3357,-25.3658,-70.6882,-22.4586,-65.1218,-9.16618,-13.0311,-4.79093,-8.12413,-11.9578,-12.4135,-5.91981,-8.88697,-18.6595,-81.4731,-13.6683,-75.9041,-28.4829,-25.947,-25.987,-22.1476,-31.7326,9.81956,-28.2702,16.4633,-30.8848,-35.5154,-25.8303,-29.3148,-3.91109,-40.4518,1.15175,-34.4155,-24.6125,11.9553,-18.9911,15.2714,-70.7097,-73.0837,-68.3408,-71.0762,5.66612,-18.2834,8.34697,-14.7622,12.0127,-14.2763,17.8008,-10.1322,-20.0023,-20.7016,-16.9797,-17.4951,-30.1344,-21.2557,-23.9918,-14.9478,-28.3077,-71.6699,-26.3688,-65.4929,10.5914,-37.1212,13.9405,-31.4803,-47.5869,-6.67063,-44.1289,-0.388312,-45.5768,-15.4556,-41.3347,-11.1878,12.363,-52.299,15.6921,-46.3953,-13.4729,-54.7458,-11.0119,-50.3584,6.80563,-75.2157,10.9974,-72.691,-38.2139,-75.5895,-34.427,-70.6578,-28.3176,-4.32016,-23.9961,-1.75812,-7.33048,13.7273,-1.73016,19.9345,-81.5916,-24.2022,-75.78,-20.3472,-66.7355,-8.37149,-61.7223,-4.13497,-78.4543,-9.46325,-72.9674,-2.96644,12.531,-33.7634,14.5307,-31.4929,-67.6778,-48.7366,-61.8324,-43.2539,-1.32026,-37.1812,4.62402,-34.567,-10.7057,-57.627,-4.07035,-53.8256,-3.64982,-21.9224,-1.17876,-15.2977,-70.0723,-73.3887,-66.1738,-66.971,-9.48372,-79.1206,-4.46194,-75.3421,-49.0286,-34.2383,-46.7496,-31.4383,-70.4933,-57.9584,-64.4717,-51.6529,-7.64753,-8.51,-3.00991,-4.60147,-3.2772,-80.0504,1.10394,-77.1011,-31.7389,-0.251138,-26.9442,6.1168,7.51198,-14.6594,11.2605,-12.3214,-51.6023,-69.3044,-45.6955,-66.2952,-44.5547,-50.9552,-38.8785,-47.316,14.1371,-48.5371,19.3949,-46.3097,-60.52,3.60883,-57.8421,8.68999,5.73514,-48.8755,10.0798,-46.4619,-75.5907,-24.9106,-71.9463,-21.4683,-20.1141,-52.8112,-17.5729,-46.5086,-13.0998,11.7712,-9.87007,13.6232,-56.3374,-65.9349,-50.9148,-59.7345,-46.2888,-56.0338,-43.8757,-49.6969,-48.5967,-54.0753,-42.0567,-49.3156,-17.9759,-26.2649,-13.0658,-20.8654,-18.7554,11.9061,-14.1973,17.8896,-30.4231,-31.2949,-23.7402,-27.8225,7.10201,-56.6232,12.3331,-53.0186,-1.34182,-44.4635,4.41567,-37.8224,-1.49583,-30.3994,2.18523,-25.55,-67.2737,-16.507,-63.5094,-11.4792,-23.4703,-79.3927,-18.1264,-72.7396,15.8761,-61.1856,18.2922,-59.0086,-50.7353,12.1824,-48.449,14.1366,-36.723,-70.4489,-32.703,-68.4708,2.53452,-3.81059,5.80364,0.38876,12.6524,-59.5971,14.4791,-54.1398,-23.3348,0.131498,-19.1412,2.67051,-22.6295,-55.0277,-17.8291,-50.8825,-28.8525,-35.4108,-26.2424,-30.8838,-71.6081,-29.2411,-67.1474,-24.801,-10.0512,-68.2281,-8.21404,-65.0969,-18.4867,-65.9529,-13.3857,-59.2456,-67.6819,-77.5453,-65.7301,-72.1979,-14.0266,-56.837,-7.66207,-51.4534,-56.1502,-30.9579,-50.7907,-27.2035,-52.8293,-71.5071,-49.5288,-69.6938,-51.5145,-80.0467,-45.4545,-77.8185,-26.3165,-60.1853,-20.633,-56.2739,-33.524,7.34893,-27.1936,11.0735,-36.2972,-76.4022,-33.3878,-72.2617,-4.57866,-8.85954,-2.59405,-3.97927,-22.9752,-13.5888,-18.9443,-11.7399,-6.78402,-71.4043,-0.645426,-68.7973,-41.3945,-2.80692,-35.0066,2.39875,-23.6886,-1.23037,-19.9574,3.02164,-52.4917,-15.6238,-48.3492,-13.6711,0.98317,-56.6605,3.77221,-52.3732,-69.6536,-38.6517,-64.655,-32.5295,-32.8034,-7.32862,-28.659,-1.29179,-75.5114,-47.0756,-70.4324,-43.3135,-5.55001,-59.7616,-3.03821,-56.0457,-3.16377,13.533,3.21481,17.9865,-9.85932,-33.2562,-4.96422,-28.3074,1.07018,11.8399,7.09559,17.3879,-22.1069,-57.5232,-17.0194,-52.7611,-5.66218,6.30068,-0.756806,8.47724,6.11749,-24.9956,9.49802,-22.9499,-25.6095,-53.2423,-21.7197,-46.8559,3.69806,-67.4241,8.51288,-63.2624,-57.7484,-46.2729,-52.5713,-44.2884,-21.6379,-6.18407,-15.1925,-0.565229,-70.5398,-41.9673,-67.3182,-38.9153,-29.7737,-2.15526,-24.9719,-0.146076,-51.5544,-37.5965,-46.5659,-32.1491,7.45651,10.7624,10.3571,16.5816,-28.9414,-67.9475,-24.7632,-62.0383,-17.8609,-40.6089,-15.5701,-38.1292,-56.9271,-69.6597,-53.3471,-65.2585,-1.12835,-70.4325,4.89922,-67.8708,3.23447,10.9713,6.8107,13.6015,-42.53,-78.6753,-38.773,-74.8715,-61.0811,-74.6215,-56.6156,-69.2092,-23.4139,11.7396,-21.1696,16.478,-44.5868,-78.9327,-41.6983,-73.1485,6.98111,5.77186,12.343,10.4257,-5.09336,-67.756,-1.44985,-62.5358,-2.91016,-77.8436,1.46567,-71.7729,-41.9429,15.1708,-38.6919,17.1709,-46.7578,-58.4535,-42.5638,-55.5811,-71.9007,-21.9727,-65.6172,-18.9775,-7.56099,-27.8399,-2.08011,-21.6488,-70.5464,-34.5351,-65.0565,-31.7953,-46.6577,-0.615629,-43.5605,2.31398,-71.1483,-31.9982,-64.9766,-25.3074,-62.6282,-69.5833,-60.5446,-63.9038,4.21089,-66.4569,8.19653,-62.267,-19.4788,-70.9893,-17.224,-65.1078,-8.67187,-68.8472,-4.36282,-63.7438,-4.1511,-24.3918,1.29055,-20.6948,5.04083,-77.9988,9.80773,-75.1576,9.20832,-10.8136,13.7743,-8.43832,-33.6027,-26.0119,-27.0648,-19.4658,-27.0208,-63.2737,-22.66,-58.824,-55.7197,-3.205,-52.5393,0.245878,-36.0367,-58.5217,-33.1961,-56.2131,9.52034,-0.395343,13.377,2.69812,-70.9181,-72.5119,-67.3891,-69.1681,-25.7944,-4.21116,-19.0103,1.20546,-67.8587,-33.9055,-64.2688,-29.7762,-49.2839,-69.4892,-42.5437,-63.04,-73.4798,7.34409,-71.139,9.46398,-14.8755,-77.9088,-10.4907,-75.9517,5.64134,-8.1791,12.4383,-5.99629,-50.7312,-7.96541,-48.7679,-4.35647,-60.6419,-30.0419,-54.1407,-25.7166,-55.8723,-78.4628,-53.666,-76.4119,-64.4779,-30.6387,-61.301,-27.5505,-35.7135,5.47431,-31.7908,10.4476,-49.662,8.30095,-45.2325,13.7805,-4.28506,-56.093,-1.29719,-51.3868,-42.7333,-13.2165,-38.8132,-9.58415,-65.649,-64.1746,-63.7063,-57.7443,-79.9845,-35.1691,-73.7653,-32.2841,-24.2957,12.3481,-19.2799,18.5532,-0.0742554,-75.8281,3.28257,-70.692,-21.2035,-68.1335,-15.5567,-62.7622,-11.6537,-7.90505,-7.30483,-4.02363,-45.4392,-18.2476,-41.3499,-13.3484,2.92818,-38.8381,6.66731,-35.6372,-61.6093,-29.0304,-56.3658,-24.9553,-74.2102,-61.0932,-70.0129,-57.8204,-28.9515,-30.7537,-24.6533,-27.2038,-65.3387,-60.3857,-61.1525,-58.3789,-9.80529,-11.529,-6.50502,-9.31508,-45.3715,-27.6924,-43.5463,-25.215,-5.19212,-13.358,0.629497,-10.2446,-27.8904,1.95454,-21.7639,4.29162,-18.9306,-45.4312,-17.0411,-39.625,-12.4655,-74.4742,-9.55873,-68.4158,-46.7645,-79.4124,-44.8736,-76.1914,-36.9679,-53.597,-31.1171,-49.4429,-2.00894,-51.9956,1.13115,-46.3266,-39.307,-2.34852,-32.5264,-0.409036,-54.0413,-53.7266,-48.0972,-49.581,11.2047,-64.6967,16.3631,-61.764,-34.6354,-75.1541,-31.7541,-71.6085,3.87523,-29.8007,9.26054,-23.2148,-10.0456,-13.6077,-5.08589,-11.3566,-20.7901,-22.2987,-16.6745,-19.2682,-24.6595,-70.4473,-19.9531,-65.3802,-41.2864,-14.7635,-38.7141,-7.98313,-39.2546,-77.1244,-35.7266,-73.0275,-10.1657,-26.7488,-6.37873,-24.6106,-58.7264,-80.4904,-52.2446,-75.6738,-55.4237,-57.7728,-49.0458,-52.5684,-66.4236,9.17392,-64.2857,13.3218,-70.1315,8.88061,-63.6905,13.6055,3.98544,-66.2674,8.81568,-62.1811,-39.9874,-10.4183,-35.3657,-6.7321,-4.67885,9.55863,-1.21703,12.7461,-75.1384,-51.7206,-69.75,-49.2297,-78.4747,-37.3962,-76.52,-32.0511,-9.03426,-68.8955,-2.64826,-65.2226,-26.4336,-3.05402,-20.5484,-0.277553,4.28427,-24.4426,7.47632,-21.6775,9.52656,-38.7071,15.6487,-33.6337,-77.9537,6.82436,-75.0368,9.29723,-0.197587,-7.83809,2.01567,-1.6586,-40.5108,7.85081,-36.8118,11.4592,-57.114,-34.6218,-52.966,-32.3608,-46.8573,-52.4785,-44.7457,-50.3466,4.00805,-15.0114,8.4978,-8.51496,11.5467,-65.6011,13.4449,-60.0922,-76.2562,-37.6674,-71.5752,-33.9586,-75.3988,-66.7085,-72.1637,-62.4037,0.312957,-60.899,2.40125,-55.3279,-32.0273,-49.6321,-27.3836,-47.7463,-7.59904,-48.7962,-3.59751,-44.9272,-62.2993,-63.7041,-56.6897,-60.0761,-32.4445,-28.3257,-26.8685,-25.99,-16.0788,-2.18473,-14.1155,3.14464,-16.8014,-67.4871,-14.8219,-62.4154,9.11203,-30.2584,12.5324,-23.7509,9.78397,-21.0831,13.9171,-15.5314,-60.2675,-77.1044,-54.5215,-71.8084,-34.7867,-30.9786,-30.2789,-24.7042,-41.7615,-30.1015,-38.152,-23.5692,1.25671,-7.48873,5.02212,-2.5681,-69.6013,-16.2141,-66.6606,-12.0704,-5.54401,-0.640945,-0.26903,1.30906,-69.1935,-17.3503,-62.5092,-12.526,5.17686,11.1173,7.85952,16.3132,-37.7806,-50.9806,-34.5523,-48.833,-66.7448,-66.84,-60.859,-64.6043,-55.4813,-60.4917,-50.0635,-57.7989,-18.3287,-46.6562,-14.6086,-43.64,-64.7293,-29.7966,-62.2309,-25.6774,-61.6251,-58.9534,-59.5191,-53.171,-10.3864,-61.4215,-8.15457,-55.2764,-68.9768,-48.3016,-62.6842,-43.4221,-33.1117,-78.9996,-29.7606,-72.384,14.0907,-28.9458,20.1088,-25.754,-9.53663,-22.4256,-7.29517,-16.5423,-3.67824,-52.6248,2.20114,-49.9727,-80.6137,-11.4194,-75.0696,-4.62266,-46.0951,-43.3993,-41.5086,-37.0416,-64.2123,-68.217,-59.5363,-64.1339,-0.84995,-30.5052,5.10266,-26.451,-80.3202,4.76529,-77.4696,7.72151,-16.5162,-76.6133,-14.0301,-71.1354,14.4859,-65.01,18.3564,-59.8712,3.77172,9.07313,6.93799,13.5753,11.4839,-49.4416,18.233,-47.1784,-21.3406,-53.5008,-17.0881,-49.6199,-70.0964,10.5104,-66.2394,14.4776,-69.3389,-69.4515,-67.1393,-65.6348,-17.5494,-75.1831,-14.3527,-68.4207,-45.9557,4.40627,-40.9408,10.961,-9.92745,-4.62488,-6.94643,0.950899,-60.0498,-2.77329,-57.2893,2.72585,-1.3131,-62.0732,1.65384,-55.4035,-44.4379,-46.8192,-41.5754,-41.3013,7.95395,-6.83198,10.8123,-4.55036,0.201386,-9.39487,4.7386,-2.85405,6.25563,-6.07101,10.3583,-2.94808,0.29759,-32.2373,5.73808,-29.7605,-64.4768,-26.3454,-61.8493,-20.3384,-70.0479,-31.2782,-66.2644,-28.9009,-73.5788,-29.701,-67.8264,-23.3909,-66.2301,-78.1983,-59.593,-73.6868,-35.9481,-76.3207,-32.3453,-70.0438,-48.1741,5.95962,-43.9324,12.2023,-76.5903,-17.0576,-72.8301,-12.5283,-69.8447,-48.1372,-63.65,-44.8592,9.09298,5.37352,13.3971,9.02797,-66.99,14.7357,-60.5512,19.2653,-55.5478,-24.2002,-52.637,-19.8984,-25.1789,11.1297,-20.5961,17.7127,-59.5184,-66.5726,-56.184,-64.2947,-61.0484,12.4793,-56.4644,18.1457,-69.2941,5.33523,-66.2845,8.72196,-71.9278,-44.7425,-69.6405,-41.5643,-7.00758,-44.1089,-5.20637,-38.5115,-11.912,-54.7842,-9.37486,-52.9486,12.4523,-79.0225,18.997,-73.7073,-29.2512,12.8495,-25.74,17.3885,-44.9214,-71.2149,-38.6686,-66.5615,-60.0486,-50.1436,-54.0178,-46.8017,-63.2562,-55.4062,-57.8875,-52.4892,-3.72532,15.4355,0.316963,18.8504,-28.7387,-21.0108,-24.922,-17.345,-26.7725,-0.821166,-22.3658,5.45499,-78.018,-42.1463,-73.0521,-36.0352,-66.8969,6.85746,-63.4931,12.898,-57.3395,-75.3156,-52.0735,-72.047,-18.6166,-3.839,-13.377,1.44207,14.2148,-45.119,17.0399,-40.1567,-0.143489,-42.7311,3.55376,-37.3804,-10.8355,6.244,-8.51361,8.9213,-32.3956,-79.1672,-29.0966,-74.5704,-51.2345,-22.6393,-47.1901,-19.5054,1.20356,-31.359,6.50238,-27.2026,-57.8332,-10.6368,-55.881,-7.89515,-58.8929,-27.1987,-54.0891,-21.4125,-66.8824,-38.3142,-60.1099,-34.4162,-10.702,-2.23152,-6.91408,-0.000607404,-62.2218,-63.1958,-57.5078,-56.4043,-62.3031,-38.6456,-58.1185,-34.7875,-74.5159,-44.8622,-69.8544,-38.7299,-8.00469,11.2787,-2.57846,14.4855,-49.5734,-18.6252,-44.1979,-12.8438,-24.7354,-6.32494,-18.0774,-4.11442,-61.6931,-20.4569,-56.9517,-16.1116,-42.8063,9.97637,-40.0978,13.9082,-80.209,-28.8049,-75.5523,-24.5869,-33.1972,-75.92,-26.8667,-73.9909,-69.5754,-69.8381,-65.3476,-65.9996,-65.4667,-12.7432,-60.0635,-6.43244,-63.6046,-53.0174,-61.4871,-50.1653,-65.4306,-75.8234,-60.6065,-70.6299,-38.1518,-28.1565,-33.7655,-23.4758,-4.96004,14.4022,0.838036,19.7328,-50.8439,-66.0865,-45.621,-62.4932,14.504,-22.3284,19.4563,-18.1969,7.91022,-73.3535,12.227,-69.1387,-80.0812,-78.4821,-75.0537,-76.6115,-63.1552,-58.2525,-59.709,-55.4227,-45.7221,-37.7358,-39.3451,-35.0236,-55.5534,-6.56582,-50.6765,-3.2694,12.2464,9.33483,18.9189,13.9374,-25.7974,-9.95196,-22.448,-7.05185,-38.8676,-51.3339,-36.9551,-48.9678,-58.9373,-27.0534,-54.343,-22.3887,-0.648255,13.0581,5.05314,15.7572,-14.9851,6.76794,-10.3894,11.3974,-80.0238,-76.7457,-77.5432,-73.3092,-26.0633,-71.6124,-19.6316,-67.274,-67.7653,-16.7954,-63.6268,-10.093,-36.5524,5.73344,-31.7023,9.77134,-32.0519,-45.651,-26.2024,-41.1862,-68.3526,-75.0548,-66.156,-72.3285,-61.957,-1.29181,-57.3371,3.56485,-59.5074,-28.917,-53.2611,-26.0728,9.45249,-48.8961,13.2833,-46.0156,-32.9793,-43.3116,-28.1289,-41.3483,-60.1368,-21.7599,-55.3815,-19.3475,-39.0659,-27.5276,-34.7347,-24.6135,-74.9599,-66.4345,-72.682,-63.4741,-22.2667,-21.8562,-17.1186,-15.1747,-73.1103,-40.4456,-70.5851,-35.0323,-67.9795,-43.3845,-61.2494,-37.885,-49.3454,-79.5465,-47.3637,-76.3995,-43.928,-46.0278,-38.7178,-42.6511,-45.2026,-74.1622,-39.7594,-70.0075,3.99033,-19.8828,6.17902,-17.9776,1.90008,-51.4194,8.29692,-47.9445,13.0775,-13.6635,19.2035,-9.04996,-74.3403,1.05688,-71.4107,4.5608,-72.9517,-22.5259,-71.0045,-19.8684,-35.4701,-35.685,-31.7376,-31.3011,-62.8401,-55.9198,-60.6284,-52.0501,-24.3652,6.0187,-21.5328,12.2929,6.49884,-75.9968,11.5161,-70.1328,-43.1751,-27.2016,-39.774,-23.7583,-60.001,-71.7387,-58.0548,-68.9082,-54.5312,-3.49251,-51.5961,-0.661405,-13.4368,-67.6875,-9.98843,-62.0019,-36.695,-43.3652,-32.6195,-40.9034,-10.975,6.07439,-4.60575,8.61336,-15.6059,-1.73422,-10.0634,2.69482,-71.5269,1.43621,-67.8988,3.84076,-3.88587,-49.8066,0.675407,-43.2952,-40.0899,-71.5161,-35.1855,-67.4353,-49.8221,-41.6004,-46.0772,-36.7024,-54.9272,-41.3558,-49.5609,-38.173,-21.3663,-5.60116,-19.315,-2.56086,5.31885,-29.3947,7.36111,-22.9625,-63.4842,0.504509,-58.3872,6.08582,-45.8568,-40.3721,-40.5159,-35.8916,-32.1603,2.66714,-27.8545,5.37291,-37.673,-51.742,-32.978,-45.8288,5.07774,-40.3811,7.8633,-37.8893,9.26258,-77.2596,13.9685,-71.7796,-29.6646,-33.3578,-24.531,-27.0424,2.41465,5.51502,6.08982,8.56043,11.8671,-19.0552,13.9668,-17.223,-72.2392,-76.6588,-69.7073,-72.7112,-25.9755,3.06662,-22.6486,5.99423,6.56724,-70.6268,11.761,-67.805,-2.79761,-23.4703,1.31855,-17.0815,-51.5451,-63.4793,-45.6314,-58.0349,-63.3196,8.98575,-57.3689,13.0875,-47.0107,-22.4897,-40.2856,-19.3249,-13.8217,-16.919,-8.15177,-13.3109,-58.1302,-32.233,-52.1279,-25.5588,-65.3681,-28.5584,-63.2666,-24.6348,3.88755,-32.6618,7.11622,-26.2137,-60.4341,10.8656,-54.8036,16.3773,-6.86448,-72.6216,-1.93474,-69.4568,-58.0078,-72.5703,-51.6294,-70.5912,-15.4009,-17.976,-11.8304,-11.3121,4.0737,1.1163,10.0987,6.80982,-43.2378,-63.184,-36.6927,-57.9425,-16.8379,-69.7892,-12.7601,-66.3492,-19.9006,2.84542,-14.5658,9.58153,-48.4329,-10.6178,-43.4069,-7.51631,10.6592,1.21162,12.7391,3.13671,5.18169,-23.4133,8.22821,-21.4096,-29.0514,-18.4782,-23.1548,-12.1422,-50.8877,-59.7583,-46.4431,-53.2044,-5.31097,5.00897,-0.618526,11.0285,-72.5017,-27.5339,-69.5004,-21.1087,-47.211,-18.6517,-44.9319,-16.0451,-74.8949,-30.174,-72.4439,-27.3003,-65.9693,-47.9135,-61.8658,-44.0955,-58.0929,-1.24189,-52.7678,2.33827,-19.3199,-25.5732,-14.3714,-19.5868,-77.2439,-56.2629,-70.8738,-54.1375,-57.907,-65.244,-54.8786,-58.7381,-75.1778,-0.00512862,-68.9657,5.13672,3.11804,-41.9651,8.14164,-35.6636,-23.992,-76.0507,-20.0949,-70.5574,2.6347,-39.0519,5.87843,-32.4255,-36.1283,-17.4068,-31.4033,-14.2726,-34.2836,-70.2069,-28.5166,-63.7044,-45.8533,8.26172,-43.6824,12.5904,-53.6667,-12.6875,-50.1026,-10.7826,-49.742,-64.2708,-43.4949,-58.873,-4.0467,-19.435,-1.92138,-16.821,-64.6809,-7.06335,-60.7635,-4.56757,-40.3507,10.4906,-34.3747,17.1809,-53.844,2.21904,-47.6951,5.94014,-75.5601,10.4913,-72.6699,13.786,14.3759,0.421708,19.3846,5.21927,8.07587,-57.9869,13.7628,-53.4912,-42.4759,-72.4039,-38.5044,-68.0497,-18.0234,-31.8911,-16.0706,-28.7487,-9.90731,-21.809,-3.23312,-18.7025,-43.4819,-38.023,-40.4068,-33.1444,-67.0236,-70.4051,-60.6685,-68.0912,-60.2256,12.9247,-53.7741,16.7314,-5.19127,-15.8964,-1.38643,-9.65275,-55.6731,-7.26507,-52.7264,-1.58764,-23.7468,4.22745,-17.7103,10.3209,-75.9813,-44.1617,-72.6273,-40.0374,-59.4999,-18.4252,-54.6162,-14.8275,-9.5409,-69.8709,-7.5296,-67.8322,-68.6899,10.4075,-62.619,17.089,-52.5861,12.6375,-48.255,17.7548,4.64951,2.08455,11.2681,7.74862,9.62235,-42.6134,13.1751,-37.0087,-41.005,-10.8716,-38.6698,-7.4497,-41.3799,-39.6046,-34.9667,-34.525,-53.6123,-55.1873,-50.0881,-52.2216,2.71355,-1.21528,6.25204,0.778123,-22.4293,-18.1273,-20.2243,-13.5356,-10.3393,10.0633,-6.75885,14.2446,4.99764,-40.7567,10.2984,-34.5438,3.08799,-11.7068,8.61326,-5.2578,-69.5882,-54.4535,-64.0237,-49.4636,-33.9993,-4.87252,-27.7242,0.72671,-54.87,1.82087,-50.538,5.32602,-42.5075,-80.1777,-40.0653,-73.5483,-14.5135,-61.0808,-10.6474,-59.0301,-33.4073,-13.185,-26.6401,-6.89541,-78.9267,-47.6993,-74.4484,-44.1785,-16.4572,-78.1598,-11.3897,-72.7114,-10.4196,-73.1892,-7.92918,-69.3476,-15.8019,-14.2671,-11.7236,-11.2946,-67.2041,-38.8532,-64.7892,-34.1475,6.22974,-43.2089,9.5998,-38.8242,1.96959,-23.6774,8.24414,-17.5017,15.6177,3.95911,17.8788,7.48046,-16.264,-47.649,-10.4902,-44.7848,-27.9497,15.4043,-23.694,17.395,-23.3263,14.8384,-20.797,17.2731,-38.1825,-35.2775,-31.4914,-32.4206,-53.4409,-52.4351,-50.5811,-47.0072,-67.9845,-17.2464,-62.0552,-12.0541,-13.5525,-8.89478,-6.95162,-4.12982,-2.10842,-77.7134,1.1211,-73.2794,-39.758,-80.2861,-33.5362,-76.5236,-38.1717,-36.1949,-34.352,-32.56,-42.381,-55.6239,-38.3685,-52.4375,-79.6552,-48.6651,-77.5819,-42.2422,-78.9,-57.3217,-72.479,-51.2976,0.321331,5.84655,4.47879,10.9207,7.24351,-32.6487,13.5287,-27.8583,-15.486,-25.9233,-10.5212,-20.3435,-2.96492,-27.7774,0.2876,-23.974,-43.5687,-0.0793198,-39.6305,2.00301,-75.3623,-20.1131,-71.7732,-13.7351,-7.90854,4.15233,-3.96595,7.15449,-6.3958,-56.7729,-3.70448,-50.9359,-49.8008,-81.7027,-44.2777,-75.9629,12.1281,-31.038,18.088,-25.7929,-17.6021,-35.9423,-12.5976,-31.8942,11.7457,-17.2545,16.6686,-14.391,-32.9099,-64.242,-29.9765,-57.9085,-5.97849,-9.59422,-2.91468,-5.60014,-62.5393,9.40868,-60.3701,14.8582,-79.1918,10.2218,-74.6158,15.978,-32.8079,-68.9058,-26.7382,-64.1036,5.36042,-73.2553,11.7823,-69.8851,-66.1103,-58.7301,-62.0164,-51.9639,-39.6548,-44.7871,-35.9888,-39.8171,-20.7929,-43.0176,-15.0158,-40.4402,-77.3453,-57.1305,-71.2552,-51.6232,-5.70626,12.3058,-0.581762,14.3424,-31.4587,-7.46342,-28.5725,-1.39338,-55.1376,-8.10582,-51.9357,-5.59469,-58.3564,-5.08491,-51.6402,0.987328,4.51628,-12.8052,10.2035,-7.42681,-66.0478,11.6431,-63.6093,14.0273,-70.1278,-49.7149,-64.5355,-45.4431,-15.8263,-48.6003,-12.1856,-44.8939,-73.2202,-62.4416,-68.1322,-59.7313,-8.25528,-57.727,-1.58035,-54.9493,-75.1224,6.21028,-69.4535,9.64543,-29.6486,-63.4715,-24.7598,-60.2056,-52.092,-43.7414,-48.4824,-37.482,-3.84208,-5.45458,-0.567045,-2.83248,-1.54468,-16.055,3.92885,-11.6316,10.8767,7.40417,12.7706,14.1714,-22.2161,-75.6833,-17.0171,-69.3334,-37.8053,-67.7255,-35.5763,-60.9496,13.2813,-15.5675,16.2835,-12.9447,9.80941,14.4525,15.1533,19.3035,14.3473,-76.6882,18.9273,-72.0711,-3.02253,-56.3637,3.21731,-53.4894,-17.5073,-73.8777,-12.882,-71.3349,-77.0129,-66.8864,-74.4775,-62.8444,-74.9383,-40.6389,-71.8699,-36.5543,-40.2128,-53.7365,-34.3761,-49.3654,13.4297,-17.4009,19.8252,-12.9939,-73.7052,-31.8897,-69.5085,-27.7049,-3.70074,1.63635,3.00321,4.75337,-30.7158,-48.4666,-28.7807,-44.9456,-19.8611,-5.29219,-16.4376,-0.734493,-46.5283,-28.6541,-40.5974,-24.7948,-11.1849,-38.1314,-6.32393,-35.633,-15.4191,-60.6778,-9.32264,-54.8586,-5.86033,-69.0584,-1.21145,-65.2513,11.3644,-40.6247,14.9375,-38.5064,-77.4352,-38.9058,-73.1058,-32.6206,-44.7253,-6.30717,-38.0515,-3.99377,-39.3635,-65.0206,-35.053,-60.4812,-9.37461,-15.1527,-3.81207,-10.5099,-51.3128,-55.642,-45.6106,-52.9658,-36.2127,-46.112,-31.6292,-43.0178,-78.4853,12.8139,-74.357,15.5052,-24.4275,-30.2953,-19.8781,-28.4649,-50.6629,-6.68865,-44.343,-2.60669,-55.8606,-12.2661,-50.1984,-8.17272,-77.9671,10.5257,-74.7026,16.9266,-71.9692,-36.2295,-66.8674,-33.149,-57.1742,-41.1557,-54.2082,-39.3535,-70.1603,-72.5346,-67.7211,-68.2189,-15.0702,-14.9459,-9.0229,-12.5756,-60.3673,-68.5215,-56.3124,-66.1212,-14.9881,-49.6059,-11.2411,-44.4559,-22.0005,-27.8589,-18.41,-24.5635,-69.275,-28.6763,-64.4353,-26.2071,-53.6287,-30.5861,-49.5221,-26.4107,-49.9925,-58.0058,-45.0656,-54.174,-13.0634,2.05958,-6.31687,4.70161,-78.7645,-56.6662,-72.6848,-54.7094,-34.6777,-39.0728,-31.5387,-35.9529,9.52636,-10.4733,14.4994,-5.82129,-70.9412,-53.8099,-67.6165,-48.9922,-6.71388,-13.3603,-4.68655,-9.8953,6.65517,-47.5375,9.76784,-45.6389,-54.7597,10.2965,-48.2127,14.9213,-67.8301,-61.5646,-64.4995,-57.0672,-60.2354,-55.0606,-57.3233,-51.6019,-28.4336,-30.7106,-22.9915,-27.8294,-62.1031,-73.4514,-57.9013,-68.6584,-32.0872,-78.7821,-26.5074,-73.6452,-60.4691,-48.61,-55.5623,-45.6254,-49.9498,-0.0493094,-45.6459,6.07206,-14.7159,-59.4216,-9.80377,-56.0424,-60.2458,-57.8988,-55.4864,-55.6294,-70.7522,-23.3002,-65.9011,-18.9866,-72.4073,-28.9944,-66.3397,-22.9702,-27.6249,-65.5451,-25.4688,-62.6922,-17.4456,-71.3944,-13.976,-66.8642,-72.2275,1.04007,-66.6963,4.22405,-31.6178,-62.5806,-29.7595,-56.2176,-18.5118,-57.0399,-14.7634,-53.4632,-37.4795,-21.4934,-32.8819,-19.0123,-17.0697,-39.4811,-11.5943,-34.9104,-74.3991,-55.0676,-68.3202,-52.0627,-21.9482,7.79996,-19.3955,10.0349,-33.73,7.76508,-27.4286,10.2345,-32.8473,11.0273,-27.9583,13.3167,12.874,8.90618,16.8013,13.3989,9.50651,-67.4438,15.0411,-62.3816,-15.3761,-76.5402,-10.1499,-71.2515,-19.5857,9.49035,-13.3249,15.1025,-56.9303,-63.6292,-51.4577,-59.9706,7.46003,-63.6695,10.6996,-58.7355,-26.4323,-55.8223,-23.8263,-49.897,-66.6795,-16.2913,-63.2612,-9.77364,-8.90587,-22.9591,-3.05776,-17.0961,-35.4304,-5.21065,-29.6862,-2.86989,-47.9508,-70.68,-41.1814,-64.2918,-75.447,-74.0523,-72.1765,-67.6352,-45.9443,-24.3034,-42.2374,-20.6945,-19.1008,-54.9093,-17.2578,-51.2384,-76.299,-70.5941,-73.4339,-65.2606,-71.8922,-9.2407,-68.3692,-6.5961,-12.254,-29.4245,-10.0944,-24.1949,8.56991,-63.8159,15.1924,-57.8535,-65.3542,-76.1348,-62.9254,-73.3294};
 
@@ -23,7 +29,7 @@ int executeSpatialGridTest( const scalar (&aabb_data)[N] )
     return EXIT_FAILURE;
   }
   const unsigned num_aabbs{ N / 4 };
-  std::vector<AABB> aabbs{ num_aabbs };
+  std::vector<AABB<2>> aabbs{ num_aabbs };
   for( unsigned aabb_num = 0; aabb_num < num_aabbs; ++aabb_num )
   {
     aabbs[aabb_num].min() << aabb_data[ 4 * aabb_num +  0 ], aabb_data[ 4 * aabb_num +  1 ];
@@ -31,13 +37,18 @@ int executeSpatialGridTest( const scalar (&aabb_data)[N] )
     assert( ( aabbs[aabb_num].min() < aabbs[aabb_num].max() ).all() );
   }
 
-  std::set<std::pair<unsigned,unsigned>> spatial_grid_overlaps;
-  SpatialGridDetector::getPotentialOverlaps( aabbs, spatial_grid_overlaps );
+  SpatialGrid<2> spatial_grid;
+  std::vector<std::pair<unsigned,unsigned>> spatial_grid_overlaps;
+  spatial_grid.getPotentialOverlaps( aabbs, spatial_grid_overlaps );
 
-  std::set<std::pair<unsigned,unsigned>> all_pairs_overlaps;
-  SpatialGridDetector::getPotentialOverlapsAllPairs( aabbs, all_pairs_overlaps );
+  // Query a second time to exercise the storage retained from the first query
+  std::vector<std::pair<unsigned,unsigned>> spatial_grid_overlaps_reused;
+  spatial_grid.getPotentialOverlaps( aabbs, spatial_grid_overlaps_reused );
 
-  const bool active_sets_agree{ spatial_grid_overlaps == all_pairs_overlaps };
+  std::vector<std::pair<unsigned,unsigned>> all_pairs_overlaps;
+  SpatialGrid<2>::getPotentialOverlapsAllPairs( aabbs, all_pairs_overlaps );
+
+  const bool active_sets_agree{ spatial_grid_overlaps == all_pairs_overlaps && spatial_grid_overlaps_reused == all_pairs_overlaps };
 
   std::cout << "Num AABBs:               " << num_aabbs << std::endl;
   std::cout << "Collisions spatial grid: " << spatial_grid_overlaps.size() << std::endl;
@@ -52,6 +63,151 @@ int executeSpatialGridTest( const scalar (&aabb_data)[N] )
   return EXIT_FAILURE;
 }
 
+template<size_t N>
+int executeAABBTreeTest( const scalar (&aabb_data)[N] )
+{
+  if( N % 4 != 0 )
+  {
+    return EXIT_FAILURE;
+  }
+  const unsigned num_aabbs{ N / 4 };
+  std::vector<AABB<2>> aabbs{ num_aabbs };
+  for( unsigned aabb_num = 0; aabb_num < num_aabbs; ++aabb_num )
+  {
+    aabbs[aabb_num].min() << aabb_data[ 4 * aabb_num +  0 ], aabb_data[ 4 * aabb_num +  1 ];
+    aabbs[aabb_num].max() << aabb_data[ 4 * aabb_num +  2 ], aabb_data[ 4 * aabb_num +  3 ];
+    assert( ( aabbs[aabb_num].min() < aabbs[aabb_num].max() ).all() );
+  }
+
+  AABBTree<2> tree;
+  tree.build( aabbs );
+
+  // Cull against half planes and drums through the data set, in every direction
+  bool queries_agree{ true };
+  unsigned num_tree_hits{ 0 };
+  for( unsigned query_num = 0; query_num < 16; ++query_num )
+  {
+    const scalar theta{ 2.0 * PI<scalar> * scalar( query_num ) / 16.0 };
+    const Vector2s n{ std::cos( theta ), std::sin( theta ) };
+    const Vector2s x{ -30.0 + 2.0 * scalar( query_num ), -30.0 };
+    const scalar R{ 10.0 + 5.0 * scalar( query_num ) };
+
+    const auto plane_test = [&x,&n]( const Array2s& min, const Array2s& max ) { return CollisionDetectionUtilities::aabbTouchesHalfPlane<2>( min, max, x, n ); };
+    const auto drum_test = [&x,&R]( const Array2s& min, const Array2s& max ) { return CollisionDetectionUtilities::aabbReachesSphere<2>( min, max, x, R ); };
+
+    std::vector<unsigned> tree_hits;
+    tree.query( plane_test, tree_hits );
+    tree.query( drum_test, tree_hits );
+    num_tree_hits += unsigned( tree_hits.size() );
+
+    std::vector<unsigned> brute_force_hits;
+    for( unsigned aabb_num = 0; aabb_num < num_aabbs; ++aabb_num )
+    {
+      if( plane_test( aabbs[aabb_num].min(), aabbs[aabb_num].max() ) )
+      {
+        brute_force_hits.emplace_back( aabb_num );
+      }
+    }
+    for( unsigned aabb_num = 0; aabb_num < num_aabbs; ++aabb_num )
+    {
+      if( drum_test( aabbs[aabb_num].min(), aabbs[aabb_num].max() ) )
+      {
+        brute_force_hits.emplace_back( aabb_num );
+      }
+    }
+
+    queries_agree = queries_agree && tree_hits == brute_force_hits;
+  }
+
+  std::cout << "Num AABBs:          " << num_aabbs << std::endl;
+  std::cout << "Hits AABB tree:     " << num_tree_hits << std::endl;
+  std::cout << "Queries agree:      " << queries_agree << std::endl;
+
+  if( queries_agree )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+// Checks the overlaps against all pairs, and that the reported changes take the previous overlaps to the new ones
+static bool sweepAndPruneAgrees( const SweepAndPruneDetector<2>& sweep_and_prune, const std::vector<AABB<2>>& aabbs, const std::vector<std::pair<unsigned,unsigned>>& previous_overlaps )
+{
+  std::vector<std::pair<unsigned,unsigned>> all_pairs_overlaps;
+  SpatialGrid<2>::getPotentialOverlapsAllPairs( aabbs, all_pairs_overlaps );
+
+  std::vector<std::pair<unsigned,unsigned>> kept_overlaps;
+  std::set_difference( previous_overlaps.begin(), previous_overlaps.end(), sweep_and_prune.removedPairs().begin(), sweep_and_prune.removedPairs().end(), std::back_inserter( kept_overlaps ) );
+  std::vector<std::pair<unsigned,unsigned>> updated_overlaps;
+  std::merge( kept_overlaps.begin(), kept_overlaps.end(), sweep_and_prune.addedPairs().begin(), sweep_and_prune.addedPairs().end(), std::back_inserter( updated_overlaps ) );
+
+  return sweep_and_prune.overlaps() == all_pairs_overlaps && updated_overlaps == all_pairs_overlaps;
+}
+
+template<size_t N>
+int executeSweepAndPruneTest( const scalar (&aabb_data)[N] )
+{
+  if( N % 4 != 0 )
+  {
+    return EXIT_FAILURE;
+  }
+  const unsigned num_aabbs{ N / 4 };
+  std::vector<AABB<2>> aabbs{ num_aabbs };
+  for( unsigned aabb_num = 0; aabb_num < num_aabbs; ++aabb_num )
+  {
+    aabbs[aabb_num].min() << aabb_data[ 4 * aabb_num +  0 ], aabb_data[ 4 * aabb_num +  1 ];
+    aabbs[aabb_num].max() << aabb_data[ 4 * aabb_num +  2 ], aabb_data[ 4 * aabb_num +  3 ];
+    assert( ( aabbs[aabb_num].min() < aabbs[aabb_num].max() ).all() );
+  }
+
+  SweepAndPruneDetector<2> sweep_and_prune;
+  std::vector<std::pair<unsigned,unsigned>> previous_overlaps;
+  bool active_sets_agree{ true };
+  unsigned num_updates{ 0 };
+  const auto check_update{ [&]( const std::vector<AABB<2>>& current_aabbs )
+  {
+    sweep_and_prune.update( current_aabbs );
+    active_sets_agree = active_sets_agree && sweepAndPruneAgrees( sweep_and_prune, current_aabbs, previous_overlaps );
+    previous_overlaps = sweep_and_prune.overlaps();
+    ++num_updates;
+  } };
+
+  // Insert everything, then move the AABBs coherently over several steps
+  std::vector<AABB<2>> moving_aabbs{ aabbs };
+  check_update( moving_aabbs );
+  for( unsigned step = 0; step < 4; ++step )
+  {
+    for( unsigned aabb_num = 0; aabb_num < num_aabbs; ++aabb_num )
+    {
+      const Array2s delta{ 0.2 * std::sin( 0.7 * aabb_num + 0.3 * step ), 0.2 * std::cos( 1.3 * aabb_num + 0.2 * step ) };
+      moving_aabbs[aabb_num].min() += delta;
+      moving_aabbs[aabb_num].max() += delta;
+    }
+    check_update( moving_aabbs );
+  }
+
+  // Insert AABBs at the end
+  moving_aabbs.insert( moving_aabbs.end(), aabbs.begin(), aabbs.begin() + 8 );
+  check_update( moving_aabbs );
+
+  // Delete AABBs from the middle, which shifts the later indices
+  moving_aabbs.erase( moving_aabbs.begin() + num_aabbs / 3, moving_aabbs.begin() + num_aabbs / 2 );
+  check_update( moving_aabbs );
+
+  std::cout << "Num AABBs:               " << num_aabbs << std::endl;
+  std::cout << "Num updates:             " << num_updates << std::endl;
+  std::cout << "Collisions:              " << sweep_and_prune.overlaps().size() << std::endl;
+  std::cout << "Active sets agree:       " << active_sets_agree << std::endl;
+
+  if( active_sets_agree )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
 int main( int argc, char** argv )
 {
   if( argc != 2 )
@@ -72,6 +228,30 @@ int main( int argc, char** argv )
   {
     return executeSpatialGridTest( test_02_data );
   }
+  else if( std::string{ argv[1] } == "aabb_tree_00" )
+  {
+    return executeAABBTreeTest( test_00_data );
+  }
+  else if( std::string{ argv[1] } == "aabb_tree_01" )
+  {
+    return executeAABBTreeTest( test_01_data );
+  }
+  else if( std::string{ argv[1] } == "aabb_tree_02" )
+  {
+    return executeAABBTreeTest( test_02_data );
+  }
+  else if( std::string{ argv[1] } == "sweep_and_prune_00" )
+  {
+    return executeSweepAndPruneTest( test_00_data );
+  }
+  else if( std::string{ argv[1] } == "sweep_and_prune_01" )
+  {
+    return executeSweepAndPruneTest( test_01_data );
+  }
+  else if( std::string{ argv[1] } == "sweep_and_prune_02" )
+  {
+    return executeSweepAndPruneTest( test_02_data );
+  }
 
   std::cerr << "Invalid test specified: " << argv[1] << std::endl;
   return EXIT_FAILURE;
@@ -0,0 +1,202 @@
+// contact_batch_tests.cpp
+//
+// Breannan Smith
+// Last updated: 10/17/2026
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ball2d/Constraints/BallBallConstraint.h"
+#include "ball2d/Constraints/BallStaticDrumConstraint.h"
+#include "ball2d/Constraints/BallStaticPlaneConstraint.h"
+#include "ball2d/Constraints/KinematicKickBallBallConstraint.h"
+#include "ball2d/StaticGeometry/StaticPlane.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorUtilities.h"
+#include "scisim/Constraints/ContactBatch.h"
+#include "scisim/UnconstrainedMaps/FlowableSubsystem.h"
+
+// One contact of each kind that ball2d batches: ball-ball, ball-plane, ball-drum, and a ball-ball contact with a
+// kinematic kick
+struct ContactsProblem final
+{
+  // The plane constraint refers to the plane, so the plane lives with it
+  StaticPlane plane;
+  VectorXs q;
+  VectorXs v;
+  std::vector<std::unique_ptr<Constraint>> active_set;
+};
+
+static void initializeContactsProblem( ContactsProblem& problem )
+{
+  const scalar r{ 1.0 };
+  const unsigned num_balls{ 5 };
+  problem.q.resize( 2 * num_balls );
+  problem.v.resize( 2 * num_balls );
+  for( unsigned ball = 0; ball < num_balls; ++ball )
+  {
+    problem.q.segment<2>( 2 * ball ) << 2.5 * ball + 0.3 * std::sin( 1.3 * ball ), 1.0 + 0.2 * std::cos( 0.7 * ball );
+    problem.v.segment<2>( 2 * ball ) << 0.5 * std::cos( 2.3 * ball ), -1.0 + 0.3 * std::sin( 0.9 * ball );
+  }
+
+  problem.plane = StaticPlane{ Vector2s::Zero(), Vector2s{ 0.3, 1.0 }.normalized() };
+  problem.active_set.emplace_back( new BallBallConstraint{ 0, 1, problem.q, r, r, false } );
+  problem.active_set.emplace_back( new StaticPlaneConstraint{ 2, r, problem.plane, 0 } );
+  problem.active_set.emplace_back( new StaticDrumConstraint{ 3, problem.q, r, Vector2s{ 4.0, -2.0 }, 0 } );
+  problem.active_set.emplace_back( new KinematicKickBallBallConstraint{ 1, 4, problem.q.segment<2>( 2 ), problem.q.segment<2>( 8 ), r, r, Vector2s{ 0.6, -0.4 }, false } );
+}
+
+// Assembles N, the bases, and D one constraint at a time through the virtual Constraint interface
+static void assembleVirtually( const VectorXs& q, const VectorXs& v, const std::vector<std::unique_ptr<Constraint>>& active_set, SparseMatrixsc& N, MatrixXXsc& impact_bases, MatrixXXsc& contact_bases, SparseMatrixsc& D )
+{
+  const int ncons{ int( active_set.size() ) };
+  const int ndofs{ int( v.size() ) };
+  const FlowableSubsystem fsys;
+
+  N.resize( ndofs, ncons );
+  N.reserve( VectorXi::Constant( ncons, 2 ) );
+  impact_bases.resize( 2, ncons );
+  contact_bases.resize( 2, 2 * ncons );
+  for( int con = 0; con < ncons; ++con )
+  {
+    active_set[con]->evalgradg( q, con, N, fsys );
+    VectorXs normal;
+    active_set[con]->getWorldSpaceContactNormal( q, normal );
+    impact_bases.col( con ) = normal;
+    MatrixXXsc basis;
+    active_set[con]->computeBasis( q, v, basis );
+    contact_bases.block<2,2>( 0, 2 * con ) = basis;
+  }
+  N.makeCompressed();
+
+  D.resize( ndofs, ncons );
+  D.reserve( VectorXi::Constant( ncons, 2 ) );
+  for( int con = 0; con < ncons; ++con )
+  {
+    active_set[con]->computeGeneralizedFrictionGivenTangentSample( q, contact_bases.col( 2 * con + 1 ), unsigned( con ), D );
+  }
+  D.makeCompressed();
+}
+
+// The batch must assemble the same N, bases, and D as the virtual interface
+static int executeVirtualComparisonTest()
+{
+  ContactsProblem problem;
+  initializeContactsProblem( problem );
+  const unsigned ndofs{ unsigned( problem.v.size() ) };
+
+  SparseMatrixsc N_virtual;
+  MatrixXXsc impact_bases_virtual;
+  MatrixXXsc contact_bases_virtual;
+  SparseMatrixsc D_virtual;
+  assembleVirtually( problem.q, problem.v, problem.active_set, N_virtual, impact_bases_virtual, contact_bases_virtual, D_virtual );
+
+  ContactBatch batch;
+  const bool batched{ batch.build( problem.q, problem.active_set ) };
+  if( !batched )
+  {
+    std::cerr << "Failed to batch the contacts" << std::endl;
+    return EXIT_FAILURE;
+  }
+  SparseMatrixsc N;
+  batch.computeN( ndofs, N );
+  MatrixXXsc impact_bases;
+  batch.computeImpactBases( impact_bases );
+  MatrixXXsc contact_bases;
+  batch.computeContactBases( problem.v, contact_bases );
+  SparseMatrixsc D;
+  batch.computeD( ndofs, contact_bases, D );
+
+  const scalar N_difference{ MatrixXXsc{ N - N_virtual }.lpNorm<Eigen::Infinity>() };
+  const scalar impact_bases_difference{ ( impact_bases - impact_bases_virtual ).lpNorm<Eigen::Infinity>() };
+  const scalar contact_bases_difference{ ( contact_bases - contact_bases_virtual ).lpNorm<Eigen::Infinity>() };
+  const scalar D_difference{ MatrixXXsc{ D - D_virtual }.lpNorm<Eigen::Infinity>() };
+  const scalar max_difference{ std::max( std::max( N_difference, D_difference ), std::max( impact_bases_difference, contact_bases_difference ) ) };
+
+  std::cout << "N difference:               " << N_difference << std::endl;
+  std::cout << "Impact bases difference:    " << impact_bases_difference << std::endl;
+  std::cout << "Contact bases difference:   " << contact_bases_difference << std::endl;
+  std::cout << "D difference:               " << D_difference << std::endl;
+
+  if( N.nonZeros() == N_virtual.nonZeros() && D.nonZeros() == D_virtual.nonZeros() && max_difference <= 1.0e-14 )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+// Within a scope, every assembly of the scope's active set shares one batch, and other active sets are batched alone
+static int executeScopedBatchTest()
+{
+  ContactsProblem problem;
+  initializeContactsProblem( problem );
+  ContactsProblem other_problem;
+  initializeContactsProblem( other_problem );
+
+  SparseMatrixsc N_virtual;
+  MatrixXXsc impact_bases_virtual;
+  MatrixXXsc contact_bases_virtual;
+  SparseMatrixsc D_virtual;
+  assembleVirtually( problem.q, problem.v, problem.active_set, N_virtual, impact_bases_virtual, contact_bases_virtual, D_virtual );
+
+  bool shared{ false };
+  bool other_alone{ false };
+  scalar N_difference{ SCALAR_INFINITY };
+  {
+    const ScopedContactBatch contact_batch{ problem.q, problem.active_set };
+    ContactBatch first_local_batch;
+    const ContactBatch* const first{ ContactBatch::acquire( problem.q, problem.active_set, first_local_batch ) };
+    ContactBatch second_local_batch;
+    const ContactBatch* const second{ ContactBatch::acquire( problem.q, problem.active_set, second_local_batch ) };
+    shared = first != nullptr && first == second && first != &first_local_batch && second != &second_local_batch;
+
+    ContactBatch other_local_batch;
+    other_alone = ContactBatch::acquire( other_problem.q, other_problem.active_set, other_local_batch ) == &other_local_batch;
+
+    SparseMatrixsc N{ problem.v.rows(), long( problem.active_set.size() ) };
+    ImpactOperatorUtilities::computeN( FlowableSubsystem{}, problem.active_set, problem.q, N );
+    N_difference = MatrixXXsc{ N - N_virtual }.lpNorm<Eigen::Infinity>();
+  }
+
+  // Once the scope ends, the caller's batch is rebuilt
+  ContactBatch local_batch;
+  const bool released{ ContactBatch::acquire( problem.q, problem.active_set, local_batch ) == &local_batch };
+
+  std::cout << "Batch shared:               " << shared << std::endl;
+  std::cout << "Other batched alone:        " << other_alone << std::endl;
+  std::cout << "Batch released:             " << released << std::endl;
+  std::cout << "N difference:               " << N_difference << std::endl;
+
+  if( shared && other_alone && released && N_difference <= 1.0e-14 )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+int main( int argc, char** argv )
+{
+  if( argc != 2 )
+  {
+    std::cerr << "Usage: " << argv[0] << " test_name" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if( std::string{ argv[1] } == "virtual_comparison_00" )
+  {
+    return executeVirtualComparisonTest();
+  }
+  else if( std::string{ argv[1] } == "scoped_batch_00" )
+  {
+    return executeScopedBatchTest();
+  }
+
+  std::cerr << "Invalid test specified: " << argv[1] << std::endl;
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,202 @@
+// friction_residual_tests.cpp
+//
+// Breannan Smith
+// Last updated: 10/16/2026
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ball2d/Constraints/BallBallConstraint.h"
+#include "ball2d/Constraints/BallStaticPlaneConstraint.h"
+#include "ball2d/StaticGeometry/StaticPlane.h"
+#include "scisim/ConstrainedMaps/FrictionResidual.h"
+#include "scisim/ConstrainedMaps/Sobogus.h"
+#include "scisim/Constraints/ContactBatch.h"
+#include "scisim/Math/BlockDiagonalMass.h"
+
+// Two balls resting against each other and on a plane, with a frictionless contact between the balls
+struct BallsProblem final
+{
+  // The plane constraints refer to the plane, so the plane lives with them
+  StaticPlane plane;
+  VectorXs q0;
+  VectorXs v0;
+  SparseMatrixsc M;
+  SparseMatrixsc Minv;
+  std::vector<std::unique_ptr<Constraint>> active_set;
+  VectorXs mu;
+  VectorXs CoR;
+};
+
+static void initializeBallsProblem( BallsProblem& problem )
+{
+  const scalar r{ 1.0 };
+  const VectorXs masses{ ( VectorXs{ 2 } << 1.5, 0.75 ).finished() };
+  problem.q0.resize( 4 );
+  problem.q0 << 0.0, 1.0, 1.9, 0.98;
+  problem.v0.resize( 4 );
+  problem.v0 << 0.4, -0.7, -0.3, -0.2;
+
+  problem.M.resize( 4, 4 );
+  problem.Minv.resize( 4, 4 );
+  for( int dof = 0; dof < 4; ++dof )
+  {
+    problem.M.insert( dof, dof ) = masses( dof / 2 );
+    problem.Minv.insert( dof, dof ) = 1.0 / masses( dof / 2 );
+  }
+  problem.M.makeCompressed();
+  problem.Minv.makeCompressed();
+
+  problem.plane = StaticPlane{ Vector2s::Zero(), Vector2s{ 0.0, 1.0 } };
+  problem.active_set.emplace_back( new BallBallConstraint{ 0, 1, problem.q0, r, r, false } );
+  problem.active_set.emplace_back( new StaticPlaneConstraint{ 0, r, problem.plane, 0 } );
+  problem.active_set.emplace_back( new StaticPlaneConstraint{ 1, r, problem.plane, 0 } );
+
+  problem.mu.resize( 3 );
+  problem.mu << 0.0, 0.5, 0.3;
+  problem.CoR.resize( 3 );
+  problem.CoR << 0.5, 0.0, 1.0;
+}
+
+// Compares FrictionResidual with SobogusFrictionProblem::computeError for a set of impulses
+static bool residualsAgree( BallsProblem& problem, const VectorXs& alpha, const VectorXs& beta, scalar& max_relative_difference )
+{
+  const unsigned ncons{ unsigned( problem.active_set.size() ) };
+
+  ContactBatch batch;
+  if( !batch.build( problem.q0, problem.active_set ) )
+  {
+    std::cerr << "Failed to batch the contacts" << std::endl;
+    return false;
+  }
+  MatrixXXsc contact_bases;
+  batch.computeContactBases( problem.v0, contact_bases );
+  SparseMatrixsc N;
+  batch.computeN( unsigned( problem.v0.size() ), N );
+  SparseMatrixsc D;
+  batch.computeD( unsigned( problem.v0.size() ), contact_bases, D );
+  VectorXs nrel{ ncons };
+  VectorXs drel{ ncons };
+  Constraint::evalKinematicRelVelGivenBases( problem.q0, problem.v0, problem.active_set, contact_bases, nrel, drel );
+
+  FrictionResidual residual;
+  residual.initialize( N, problem.v0, problem.CoR, nrel, drel );
+  const scalar residual_error{ residual.evalError( BlockDiagonalMass{ problem.Minv, 1 }, N, D, problem.v0, problem.mu, alpha, beta ) };
+
+  SobogusFrictionProblem sobogus_problem{ SobogusSolverType::Balls2D };
+  VectorXs masses;
+  sobogus_problem.flattenMass( problem.M, masses );
+  sobogus_problem.initialize( problem.active_set, contact_bases, masses, problem.q0, problem.v0, problem.CoR, problem.mu, nrel, drel );
+  VectorXs r{ 2 * ncons };
+  for( unsigned con_idx = 0; con_idx < ncons; ++con_idx )
+  {
+    r.segment<2>( 2 * con_idx ) = alpha( con_idx ) * contact_bases.col( 2 * con_idx ) + beta( con_idx ) * contact_bases.col( 2 * con_idx + 1 );
+  }
+  const scalar sobogus_error{ sobogus_problem.computeError( r ) };
+
+  const scalar relative_difference{ std::fabs( residual_error - sobogus_error ) / std::max( scalar( 1.0 ), std::fabs( sobogus_error ) ) };
+  max_relative_difference = std::max( max_relative_difference, relative_difference );
+  return relative_difference <= 1.0e-10;
+}
+
+// Varies the impulses at every contact together and at each contact alone, so that each contact in turn, including
+// the frictionless one, determines the largest residual
+static int executeSobogusComparisonTest()
+{
+  BallsProblem problem;
+  initializeBallsProblem( problem );
+  const unsigned ncons{ unsigned( problem.active_set.size() ) };
+
+  bool all_agree{ true };
+  scalar max_relative_difference{ 0.0 };
+  unsigned num_cases{ 0 };
+  for( unsigned sample = 0; sample < 8; ++sample )
+  {
+    VectorXs alpha{ ncons };
+    VectorXs beta{ ncons };
+    for( unsigned con_idx = 0; con_idx < ncons; ++con_idx )
+    {
+      alpha( con_idx ) = std::fabs( std::sin( 1.3 * sample + 0.7 * con_idx ) );
+      beta( con_idx ) = 0.4 * std::cos( 0.9 * sample + 1.1 * con_idx );
+    }
+    all_agree = residualsAgree( problem, alpha, beta, max_relative_difference ) && all_agree;
+    ++num_cases;
+    for( unsigned con_idx = 0; con_idx < ncons; ++con_idx )
+    {
+      VectorXs alpha_single{ VectorXs::Zero( ncons ) };
+      VectorXs beta_single{ VectorXs::Zero( ncons ) };
+      alpha_single( con_idx ) = alpha( con_idx );
+      beta_single( con_idx ) = beta( con_idx );
+      all_agree = residualsAgree( problem, alpha_single, beta_single, max_relative_difference ) && all_agree;
+      ++num_cases;
+    }
+  }
+
+  std::cout << "Num cases:                  " << num_cases << std::endl;
+  std::cout << "Max relative difference:    " << max_relative_difference << std::endl;
+  std::cout << "Residuals agree:            " << all_agree << std::endl;
+
+  if( all_agree )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+// Without friction So-bogus scales the normal impulse away, leaving ( un - sqrt( |beta|^2 + un^2 ) )^2 + |beta|^2
+// independent of alpha; the residual must measure the same quantity
+static int executeFrictionlessTest()
+{
+  bool all_agree{ true };
+  scalar max_difference{ 0.0 };
+  for( unsigned sample = 0; sample < 16; ++sample )
+  {
+    const scalar alpha{ std::fabs( 2.0 * std::sin( 0.9 * sample ) ) };
+    const scalar un{ 1.5 * std::cos( 1.7 * sample ) };
+    const scalar beta{ sample % 2 == 0 ? 0.0 : 0.3 * std::sin( 2.3 * sample ) };
+    const scalar ut{ 0.8 * std::cos( 0.4 * sample ) };
+    const scalar fb{ un - std::sqrt( beta * beta + un * un ) };
+    const scalar expected{ fb * fb + beta * beta };
+    const scalar residual{ FrictionResidual::evalContactResidual( 0.0, alpha, &beta, un, &ut, 1 ) };
+    const scalar difference{ std::fabs( residual - expected ) };
+    max_difference = std::max( max_difference, difference );
+    all_agree = all_agree && difference <= 1.0e-14;
+  }
+
+  std::cout << "Max difference:             " << max_difference << std::endl;
+  std::cout << "Residuals agree:            " << all_agree << std::endl;
+
+  if( all_agree )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+int main( int argc, char** argv )
+{
+  if( argc != 2 )
+  {
+    std::cerr << "Usage: " << argv[0] << " test_name" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if( std::string{ argv[1] } == "sobogus_comparison_00" )
+  {
+    return executeSobogusComparisonTest();
+  }
+  else if( std::string{ argv[1] } == "frictionless_00" )
+  {
+    return executeFrictionlessTest();
+  }
+
+  std::cerr << "Invalid test specified: " << argv[1] << std::endl;
+  return EXIT_FAILURE;
+}
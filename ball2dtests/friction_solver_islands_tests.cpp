@@ -0,0 +1,233 @@
+// friction_solver_islands_tests.cpp
+//
+// Breannan Smith
+// Last updated: 10/17/2026
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ball2d/Constraints/BallBallConstraint.h"
+#include "ball2d/Constraints/BallStaticPlaneConstraint.h"
+#include "ball2d/StaticGeometry/StaticPlane.h"
+#include "scisim/ConstrainedMaps/FrictionMaps/MDPOperatorSparseActiveSet.h"
+#include "scisim/ConstrainedMaps/FrictionSolverIslands.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorPGS.h"
+#include "scisim/ConstrainedMaps/StaggeredProjections.h"
+#include "scisim/Constraints/ContactBatch.h"
+#include "scisim/Math/BlockDiagonalMass.h"
+#include "scisim/UnconstrainedMaps/FlowableSystem.h"
+
+// Balls of unit radius with two degrees of freedom each, unaffected by forces
+class Balls final : public FlowableSystem
+{
+
+public:
+
+  explicit Balls( const VectorXs& masses )
+  : m_M( 2 * masses.size(), 2 * masses.size() )
+  , m_Minv( 2 * masses.size(), 2 * masses.size() )
+  , m_M_blocks()
+  , m_Minv_blocks()
+  {
+    for( int dof = 0; dof < 2 * masses.size(); ++dof )
+    {
+      m_M.insert( dof, dof ) = masses( dof / 2 );
+      m_Minv.insert( dof, dof ) = 1.0 / masses( dof / 2 );
+    }
+    m_M.makeCompressed();
+    m_Minv.makeCompressed();
+    m_M_blocks.setFromSparse( m_M, 1 );
+    m_Minv_blocks.setFromSparse( m_Minv, 1 );
+  }
+
+  virtual ~Balls() override = default;
+
+  virtual int nqdofs() const override { return int( m_M.rows() ); }
+  virtual int nvdofs() const override { return int( m_M.rows() ); }
+  virtual unsigned numVelDoFsPerBody() const override { return 2; }
+  virtual unsigned ambientSpaceDimensions() const override { return 2; }
+  virtual bool isKinematicallyScripted( const int i ) const override { return false; }
+  virtual void computeForce( const VectorXs& q, const VectorXs& v, const scalar& t, VectorXs& F ) override { F.setZero(); }
+  virtual void zeroOutForcesOnFixedBodies( VectorXs& F ) const override {}
+  virtual void linearInertialConfigurationUpdate( const VectorXs& q0, const VectorXs& v0, const scalar& dt, VectorXs& q1 ) const override { q1 = q0 + dt * v0; }
+  virtual const SparseMatrixsc& M() const override { return m_M; }
+  virtual const SparseMatrixsc& Minv() const override { return m_Minv; }
+  virtual const SparseMatrixsc& M0() const override { return m_M; }
+  virtual const SparseMatrixsc& Minv0() const override { return m_Minv; }
+  virtual const BlockDiagonalMass& MBlocks() const override { return m_M_blocks; }
+  virtual const BlockDiagonalMass& MinvBlocks() const override { return m_Minv_blocks; }
+  virtual void computeMomentum( const VectorXs& v, VectorXs& p ) const override { p = m_M * v; }
+  virtual void computeAngularMomentum( const VectorXs& v, VectorXs& L ) const override { L.setZero(); }
+  virtual std::string name() const override { return "balls"; }
+
+private:
+
+  SparseMatrixsc m_M;
+  SparseMatrixsc m_Minv;
+  BlockDiagonalMass m_M_blocks;
+  BlockDiagonalMass m_Minv_blocks;
+
+};
+
+// Stacks of balls on a plane, far enough apart that each stack is its own island, with one free ball in between
+// that touches nothing. The stacks are listed out of order so that islands interleave in the active set.
+struct StacksProblem final
+{
+  // The plane constraints refer to the plane, so the plane lives with them
+  StaticPlane plane;
+  VectorXs masses;
+  VectorXs q0;
+  VectorXs v0;
+  std::vector<std::unique_ptr<Constraint>> active_set;
+  VectorXs mu;
+  VectorXs CoR;
+};
+
+static void initializeStacksProblem( StacksProblem& problem )
+{
+  const scalar r{ 1.0 };
+  const unsigned num_stacks{ 3 };
+  const unsigned stack_height{ 3 };
+  const unsigned num_balls{ num_stacks * stack_height + 1 };
+  const unsigned free_ball{ stack_height };
+
+  problem.masses.resize( num_balls );
+  problem.q0.resize( 2 * num_balls );
+  problem.v0.resize( 2 * num_balls );
+  for( unsigned ball = 0; ball < num_balls; ++ball )
+  {
+    problem.masses( ball ) = 1.0 + 0.25 * std::sin( 1.7 * ball );
+    problem.v0.segment<2>( 2 * ball ) << 0.5 * std::cos( 2.3 * ball ), -1.0 + 0.3 * std::sin( 0.9 * ball );
+  }
+  problem.q0.segment<2>( 2 * free_ball ) << -20.0, 5.0;
+
+  // Ball i of stack s rests slightly inside the one below it, and the stack leans to the side
+  std::vector<unsigned> stack_balls;
+  for( unsigned stack = 0; stack < num_stacks; ++stack )
+  {
+    for( unsigned level = 0; level < stack_height; ++level )
+    {
+      const unsigned ball{ stack * stack_height + level + ( stack * stack_height + level >= free_ball ? 1 : 0 ) };
+      stack_balls.emplace_back( ball );
+      problem.q0.segment<2>( 2 * ball ) << 10.0 * stack + 0.3 * level, 0.98 + 1.95 * level;
+    }
+  }
+
+  problem.plane = StaticPlane{ Vector2s::Zero(), Vector2s{ 0.0, 1.0 } };
+  for( unsigned stack = num_stacks; stack-- > 0; )
+  {
+    const unsigned* const balls{ &stack_balls[stack * stack_height] };
+    problem.active_set.emplace_back( new StaticPlaneConstraint{ balls[0], r, problem.plane, 0 } );
+    for( unsigned level = 1; level < stack_height; ++level )
+    {
+      problem.active_set.emplace_back( new BallBallConstraint{ balls[level - 1], balls[level], problem.q0, r, r, false } );
+    }
+  }
+
+  const unsigned ncons{ unsigned( problem.active_set.size() ) };
+  problem.mu.resize( ncons );
+  problem.CoR.resize( ncons );
+  for( unsigned con = 0; con < ncons; ++con )
+  {
+    problem.mu( con ) = 0.2 + 0.1 * con;
+    problem.CoR( con ) = con % 2 == 0 ? 0.0 : 0.5;
+  }
+}
+
+struct FrictionSolution final
+{
+  VectorXs f;
+  VectorXs alpha;
+  VectorXs beta;
+  VectorXs vout;
+  bool solve_succeeded;
+  scalar error;
+};
+
+static void solveStacksProblem( FrictionSolver& solver, StacksProblem& problem, FrictionSolution& solution )
+{
+  const Balls balls{ problem.masses };
+  const unsigned ncons{ unsigned( problem.active_set.size() ) };
+
+  ContactBatch batch;
+  batch.build( problem.q0, problem.active_set );
+  MatrixXXsc contact_bases;
+  batch.computeContactBases( problem.v0, contact_bases );
+
+  solution.f = VectorXs::Zero( problem.v0.size() );
+  solution.alpha = VectorXs::Zero( ncons );
+  solution.beta = VectorXs::Zero( ncons );
+  solution.vout.resize( problem.v0.size() );
+  solver.solve( 0, 0.01, balls, balls.M(), balls.Minv(), problem.CoR, problem.mu, problem.q0, problem.v0, problem.active_set, contact_bases, VectorXs{}, VectorXs{}, 10000, 1.0e-22, solution.f, solution.alpha, solution.beta, solution.vout, solution.solve_succeeded, solution.error );
+}
+
+// Solving each island alone must reproduce the solve of the whole system
+static int executeMonolithicComparisonTest()
+{
+  const StaggeredProjections solver{ false, false, LCPOperatorPGS{ 1.0e-14, 10000 }, MDPOperatorSparseActiveSet{ 1, 1.0e-14, 10000 } };
+
+  StacksProblem monolithic_problem;
+  initializeStacksProblem( monolithic_problem );
+  std::unique_ptr<FrictionSolver> monolithic_solver{ solver.clone() };
+  FrictionSolution monolithic;
+  solveStacksProblem( *monolithic_solver, monolithic_problem, monolithic );
+
+  StacksProblem islands_problem;
+  initializeStacksProblem( islands_problem );
+  FrictionSolverIslands islands_solver{ solver };
+  FrictionSolution islands;
+  solveStacksProblem( islands_solver, islands_problem, islands );
+
+  // The constraints must come back in their original order with their original bodies
+  bool constraints_restored{ true };
+  for( std::vector<std::unique_ptr<Constraint>>::size_type con = 0; con < islands_problem.active_set.size(); ++con )
+  {
+    std::pair<int,int> expected_bodies;
+    monolithic_problem.active_set[con]->getSimulatedBodyIndices( expected_bodies );
+    std::pair<int,int> bodies;
+    islands_problem.active_set[con]->getSimulatedBodyIndices( bodies );
+    constraints_restored = constraints_restored && bodies == expected_bodies;
+  }
+
+  const scalar alpha_difference{ ( islands.alpha - monolithic.alpha ).lpNorm<Eigen::Infinity>() };
+  const scalar beta_difference{ ( islands.beta - monolithic.beta ).lpNorm<Eigen::Infinity>() };
+  const scalar f_difference{ ( islands.f - monolithic.f ).lpNorm<Eigen::Infinity>() };
+  const scalar v_difference{ ( islands.vout - monolithic.vout ).lpNorm<Eigen::Infinity>() };
+  const scalar max_difference{ std::max( std::max( alpha_difference, beta_difference ), std::max( f_difference, v_difference ) ) };
+
+  std::cout << "Alpha difference:           " << alpha_difference << std::endl;
+  std::cout << "Beta difference:            " << beta_difference << std::endl;
+  std::cout << "Force difference:           " << f_difference << std::endl;
+  std::cout << "Velocity difference:        " << v_difference << std::endl;
+  std::cout << "Constraints restored:       " << constraints_restored << std::endl;
+  std::cout << "Solves succeeded:           " << ( monolithic.solve_succeeded && islands.solve_succeeded ) << std::endl;
+
+  if( constraints_restored && monolithic.solve_succeeded && islands.solve_succeeded && max_difference <= 1.0e-10 )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+int main( int argc, char** argv )
+{
+  if( argc != 2 )
+  {
+    std::cerr << "Usage: " << argv[0] << " test_name" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if( std::string{ argv[1] } == "monolithic_comparison_00" )
+  {
+    return executeMonolithicComparisonTest();
+  }
+
+  std::cerr << "Invalid test specified: " << argv[1] << std::endl;
+  return EXIT_FAILURE;
+}
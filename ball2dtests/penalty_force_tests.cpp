@@ -0,0 +1,190 @@
+// penalty_force_tests.cpp
+//
+// Breannan Smith
+// Last updated: 10/16/2026
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "ball2d/Forces/PenaltyForce.h"
+#include "scisim/StringUtilities.h"
+
+// Penalty force of every overlapping pair of balls, without a neighbor list
+static void computeBruteForcePenalty( const scalar& k, const scalar& power, const VectorXs& q, const VectorXs& r, scalar& U, VectorXs& F )
+{
+  U = 0.0;
+  F.setZero( q.size() );
+  for( int ball0 = 0; ball0 < r.size(); ++ball0 )
+  {
+    for( int ball1 = ball0 + 1; ball1 < r.size(); ++ball1 )
+    {
+      const Vector2s n{ q.segment<2>( 2 * ball1 ) - q.segment<2>( 2 * ball0 ) };
+      const scalar dist{ n.norm() };
+      const scalar delta{ dist - r( ball0 ) - r( ball1 ) };
+      if( delta >= 0.0 )
+      {
+        continue;
+      }
+      U += 0.5 * k * std::pow( -delta, power );
+      const Vector2s force{ 0.5 * k * power * std::pow( -delta, power - 1.0 ) * n / dist };
+      F.segment<2>( 2 * ball1 ) += force;
+      F.segment<2>( 2 * ball0 ) -= force;
+    }
+  }
+}
+
+// A loosely packed grid of balls with varied radii, so that some pairs overlap and others are just apart
+static void initializeBalls( const unsigned nballs, VectorXs& q, VectorXs& r )
+{
+  q.resize( 2 * nballs );
+  r.resize( nballs );
+  const unsigned balls_per_row{ 8 };
+  for( unsigned ball = 0; ball < nballs; ++ball )
+  {
+    q( 2 * ball + 0 ) = 1.0 * ( ball % balls_per_row ) + 0.1 * std::sin( 1.7 * ball );
+    q( 2 * ball + 1 ) = 1.0 * ( ball / balls_per_row ) + 0.1 * std::cos( 2.3 * ball );
+    r( ball ) = 0.45 + 0.1 * std::sin( 0.9 * ball );
+  }
+}
+
+static SparseMatrixsc identityMass( const unsigned ndofs )
+{
+  SparseMatrixsc M{ int( ndofs ), int( ndofs ) };
+  M.setIdentity();
+  return M;
+}
+
+// Moves the balls coherently over many small steps, with occasional large jumps that force the neighbor list to be
+// rebuilt, and compares the force and potential against all pairs at each step
+static int executeVerletListTest( const scalar& skin )
+{
+  const scalar k{ 100.0 };
+  const scalar power{ 2.5 };
+  const unsigned nballs{ 64 };
+  VectorXs q;
+  VectorXs r;
+  initializeBalls( nballs, q, r );
+  const VectorXs v{ VectorXs::Zero( q.size() ) };
+  const SparseMatrixsc M{ identityMass( unsigned( q.size() ) ) };
+
+  const PenaltyForce penalty_force{ k, power, skin };
+
+  scalar max_force_error{ 0.0 };
+  scalar max_potential_error{ 0.0 };
+  unsigned num_steps{ 0 };
+  unsigned num_jumps{ 0 };
+  for( unsigned step = 0; step < 40; ++step )
+  {
+    // Every tenth step moves the balls by more than half the skin
+    const scalar displacement{ step % 10 == 9 ? 0.6 * skin + 0.05 : 0.02 * skin };
+    if( step % 10 == 9 )
+    {
+      ++num_jumps;
+    }
+    for( unsigned ball = 0; ball < nballs; ++ball )
+    {
+      q( 2 * ball + 0 ) += displacement * std::sin( 0.7 * ball + 0.3 * step );
+      q( 2 * ball + 1 ) += displacement * std::cos( 1.3 * ball + 0.2 * step );
+    }
+
+    scalar U_reference;
+    VectorXs F_reference;
+    computeBruteForcePenalty( k, power, q, r, U_reference, F_reference );
+
+    VectorXs F{ VectorXs::Zero( q.size() ) };
+    penalty_force.computeForce( q, v, M, r, F );
+    const scalar U{ penalty_force.computePotential( q, M, r ) };
+
+    max_force_error = std::max( max_force_error, ( F - F_reference ).lpNorm<Eigen::Infinity>() );
+    max_potential_error = std::max( max_potential_error, std::fabs( U - U_reference ) );
+    ++num_steps;
+  }
+
+  const bool forces_agree{ max_force_error <= 1.0e-9 && max_potential_error <= 1.0e-9 };
+
+  std::cout << "Num balls:               " << nballs << std::endl;
+  std::cout << "Skin:                    " << skin << std::endl;
+  std::cout << "Num steps:               " << num_steps << std::endl;
+  std::cout << "Num rebuilding jumps:    " << num_jumps << std::endl;
+  std::cout << "Max force error:         " << max_force_error << std::endl;
+  std::cout << "Max potential error:     " << max_potential_error << std::endl;
+  std::cout << "Forces agree:            " << forces_agree << std::endl;
+
+  if( forces_agree )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+// Serializes a force, reads it back, and checks that the copy serializes identically and produces the same forces
+static int executeSerializationTest()
+{
+  const PenaltyForce penalty_force{ 100.0, 2.5, 0.3 };
+
+  std::stringstream stream;
+  penalty_force.serialize( stream );
+  const std::string serialized{ stream.str() };
+
+  const std::string force_name{ StringUtilities::deserialize( stream ) };
+  const PenaltyForce deserialized_force{ stream };
+
+  std::stringstream restream;
+  deserialized_force.serialize( restream );
+
+  VectorXs q;
+  VectorXs r;
+  initializeBalls( 32, q, r );
+  const VectorXs v{ VectorXs::Zero( q.size() ) };
+  const SparseMatrixsc M{ identityMass( unsigned( q.size() ) ) };
+  VectorXs F0{ VectorXs::Zero( q.size() ) };
+  penalty_force.computeForce( q, v, M, r, F0 );
+  VectorXs F1{ VectorXs::Zero( q.size() ) };
+  deserialized_force.computeForce( q, v, M, r, F1 );
+
+  const bool round_trip_agrees{ force_name == "hertzian_penalty" && restream.str() == serialized && F0 == F1 };
+
+  std::cout << "Force name:              " << force_name << std::endl;
+  std::cout << "Serialized bytes:        " << serialized.size() << std::endl;
+  std::cout << "Round trip agrees:       " << round_trip_agrees << std::endl;
+
+  if( round_trip_agrees )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+int main( int argc, char** argv )
+{
+  if( argc != 2 )
+  {
+    std::cerr << "Usage: " << argv[0] << " test_name" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if( std::string{ argv[1] } == "verlet_list_00" )
+  {
+    return executeVerletListTest( 0.0 );
+  }
+  else if( std::string{ argv[1] } == "verlet_list_01" )
+  {
+    return executeVerletListTest( 0.1 );
+  }
+  else if( std::string{ argv[1] } == "verlet_list_02" )
+  {
+    return executeVerletListTest( 0.5 );
+  }
+  else if( std::string{ argv[1] } == "serialization_00" )
+  {
+    return executeSerializationTest();
+  }
+
+  std::cerr << "Invalid test specified: " << argv[1] << std::endl;
+  return EXIT_FAILURE;
+}
@@ -36,6 +36,12 @@
 #include "scisim/ConstrainedMaps/FrictionSolver.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorAPGD.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorPI.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorPGS.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorSparseActiveSet.h"
+#include "scisim/ConstrainedMaps/FrictionMaps/MDPOperatorSparseActiveSet.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorComparison.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorIslands.h"
+#include "scisim/ConstrainedMaps/FrictionSolverIslands.h"
 #include "scisim/ConstrainedMaps/StaggeredProjections.h"
 #include "scisim/ConstrainedMaps/Sobogus.h"
 
@@ -673,6 +679,32 @@ static bool loadMaxIters( const rapidxml::xml_node<>& node, const std::string& s
   return true;
 }
 
+static bool loadPreconditioner( const rapidxml::xml_node<>& node, const std::string& solver_name, LCPOperatorPI::Preconditioner& preconditioner )
+{
+  // The preconditioner is optional, defaulting to incomplete Cholesky
+  const rapidxml::xml_attribute<>* const precon_nd{ node.first_attribute( "preconditioner" ) };
+  if( precon_nd == nullptr )
+  {
+    preconditioner = LCPOperatorPI::Preconditioner::IncompleteCholesky;
+    return true;
+  }
+  const std::string preconditioner_name{ precon_nd->value() };
+  if( preconditioner_name == "incomplete_cholesky" )
+  {
+    preconditioner = LCPOperatorPI::Preconditioner::IncompleteCholesky;
+  }
+  else if( preconditioner_name == "jacobi" )
+  {
+    preconditioner = LCPOperatorPI::Preconditioner::Jacobi;
+  }
+  else
+  {
+    std::cerr << "Invalid preconditioner for " << solver_name << " solver: " << preconditioner_name << ", must be incomplete_cholesky or jacobi" << std::endl;
+    return false;
+  }
+  return true;
+}
+
 static bool loadLCPSolver( const rapidxml::xml_node<>& node, std::unique_ptr<ImpactOperator>& impact_operator )
 {
   const rapidxml::xml_attribute<>* const nd{ node.first_attribute( "name" ) };
@@ -789,7 +821,39 @@ static bool loadLCPSolver( const rapidxml::xml_node<>& node, std::unique_ptr<Imp
     unsigned max_iters;
     if ( !loadMaxIters(node, solver_name, max_iters) )
       return false;
-    impact_operator.reset( new LCPOperatorPI{ tol, max_iters } );
+    LCPOperatorPI::Preconditioner preconditioner;
+    if ( !loadPreconditioner(node, solver_name, preconditioner) )
+      return false;
+    impact_operator.reset( new LCPOperatorPI{ tol, max_iters, preconditioner } );
+  }
+  else if( solver_name == "pgs" )
+  {
+    // Without a tolerance, projected Gauss-Seidel runs a fixed number of sweeps
+    scalar tol{ 0.0 };
+    if( node.first_attribute( "tol" ) != nullptr && !loadTolerance( node, solver_name, tol ) )
+    {
+      return false;
+    }
+    unsigned max_iters;
+    if( !loadMaxIters( node, solver_name, max_iters ) )
+    {
+      return false;
+    }
+    impact_operator.reset( new LCPOperatorPGS{ tol, max_iters } );
+  }
+  else if( solver_name == "sparse_active_set" )
+  {
+    scalar tol;
+    if( !loadTolerance( node, solver_name, tol ) )
+    {
+      return false;
+    }
+    unsigned max_iters;
+    if( !loadMaxIters( node, solver_name, max_iters ) )
+    {
+      return false;
+    }
+    impact_operator.reset( new LCPOperatorSparseActiveSet{ tol, max_iters } );
   }
   else
   {
@@ -906,6 +970,62 @@ static bool loadImpactOperatorNoCoR( const rapidxml::xml_node<>& node, std::uniq
 
     impact_operator.reset( new GRROperator{ *elastic_operator, *inelastic_operator } );
   }
+  else if( type == "compare" )
+  {
+    // Attempt to load the file that receives the per-operator results
+    std::string output_file_name;
+    {
+      const rapidxml::xml_attribute<>* const file_nd{ node.first_attribute( "output_file" ) };
+      if( file_nd == nullptr )
+      {
+        std::cerr << "Could not locate output_file for compare impact_operator" << std::endl;
+        return false;
+      }
+      output_file_name = file_nd->value();
+    }
+
+    // Load each operator to compare; the first operator's impulses are applied to the system
+    std::vector<std::unique_ptr<ImpactOperator>> operators;
+    for( const rapidxml::xml_node<>* operator_node = node.first_node( "operator" ); operator_node != nullptr; operator_node = operator_node->next_sibling( "operator" ) )
+    {
+      operators.emplace_back( nullptr );
+      if( !loadImpactOperatorNoCoR( *operator_node, operators.back() ) )
+      {
+        std::cerr << "Failed to load operator for compare impact_operator" << std::endl;
+        return false;
+      }
+    }
+    if( operators.empty() )
+    {
+      std::cerr << "Failed to locate operator for compare impact_operator" << std::endl;
+      return false;
+    }
+
+    impact_operator.reset( new ImpactOperatorComparison{ operators, output_file_name } );
+  }
+  else if( type == "islands" )
+  {
+    // Load the operator that solves each island
+    const rapidxml::xml_node<>* const operator_node{ node.first_node( "operator" ) };
+    if( operator_node == nullptr )
+    {
+      std::cerr << "Failed to locate operator for islands impact_operator" << std::endl;
+      return false;
+    }
+    std::unique_ptr<ImpactOperator> island_operator;
+    if( !loadImpactOperatorNoCoR( *operator_node, island_operator ) )
+    {
+      std::cerr << "Failed to load operator for islands impact_operator" << std::endl;
+      return false;
+    }
+    if( island_operator->indexesConstraints() )
+    {
+      std::cerr << "Error, islands impact_operator does not support operator " << island_operator->name() << ", which indexes constraints by column" << std::endl;
+      return false;
+    }
+
+    impact_operator.reset( new ImpactOperatorIslands{ *island_operator } );
+  }
   else
   {
     return false;
@@ -994,16 +1114,32 @@ static bool loadMDPOperator( const rapidxml::xml_node<>& node, std::unique_ptr<F
     return loadQLMDPOperator( node, friction_operator );
   }
   else
+  #endif
+  if( name == "sparse_active_set" )
+  {
+    scalar tol;
+    if( !loadTolerance( node, name, tol ) )
+    {
+      return false;
+    }
+    unsigned max_iters;
+    if( !loadMaxIters( node, name, max_iters ) )
+    {
+      return false;
+    }
+    friction_operator.reset( new MDPOperatorSparseActiveSet{ 1, tol, max_iters } );
+    return true;
+  }
+  else
   {
     std::cerr << "Error, invalid MDP operator name provided: " << name << std::endl;
-    std::cerr << "Valid names are: ql" << std::endl;
+    #ifdef QL_FOUND
+    std::cerr << "Valid names are: ql, sparse_active_set" << std::endl;
+    #else
+    std::cerr << "Valid names are: sparse_active_set" << std::endl;
+    #endif
     return false;
   }
-  #else
-  std::cerr << "Error, invalid MDP operator name provided: " << name << std::endl;
-  std::cerr << "MDP operator is not currently supported." << std::endl;
-  return false;
-  #endif
 }
 
 // Example:
@@ -1011,6 +1147,28 @@ static bool loadMDPOperator( const rapidxml::xml_node<>& node, std::unique_ptr<F
 //    <lcp_impact_solver name="ipopt" tol="1.0e-12" linear_solvers="ma97"/>
 //    <mdp_friction_solver name="ipopt" tol="1.0e-12" linear_solvers="ma97"/>
 //  </staggered_projections_friction_solver>
+// Wraps the friction solver so that independent islands of contacts are solved separately, if requested
+static bool loadFrictionSolverIslands( const rapidxml::xml_node<>& node, std::unique_ptr<FrictionSolver>& friction_solver )
+{
+  const rapidxml::xml_attribute<>* const islands_nd{ node.first_attribute( "islands" ) };
+  if( islands_nd == nullptr )
+  {
+    return true;
+  }
+  bool islands;
+  if( !StringUtilities::extractFromString( std::string{ islands_nd->value() }, islands ) )
+  {
+    std::cerr << "Failed to parse islands attribute, value must be a boolean" << std::endl;
+    return false;
+  }
+  if( islands )
+  {
+    assert( friction_solver != nullptr );
+    friction_solver.reset( new FrictionSolverIslands{ *friction_solver } );
+  }
+  return true;
+}
+
 static bool loadStaggeredProjectionsFrictionSolver( const rapidxml::xml_node<>& node, scalar& mu, scalar& CoR, std::unique_ptr<FrictionSolver>& friction_solver, std::unique_ptr<ImpactFrictionMap>& if_map )
 {
   // Friction solver setup
@@ -1499,12 +1657,51 @@ static bool loadPenaltyForce( const rapidxml::xml_node<>& node, std::vector<std:
       }
     }
 
-    forces.emplace_back( new PenaltyForce{ stiffness, potential_power } );
+    // Optional neighbor list skin; zero rebuilds the list every evaluation
+    scalar skin{ 0.0 };
+    {
+      const rapidxml::xml_attribute<>* skin_attrib{ nd->first_attribute( "skin" ) };
+      if( skin_attrib )
+      {
+        if( !StringUtilities::extractFromString( skin_attrib->value(), skin ) || skin < 0.0 )
+        {
+          std::cerr << "Failed to load skin attribute for penalty. Value must be a non-negative scalar." << std::endl;
+          return false;
+        }
+      }
+    }
+
+    forces.emplace_back( new PenaltyForce{ stiffness, potential_power, skin } );
   }
   
   return true;
 }
 
+static bool loadBroadPhase( const rapidxml::xml_node<>& node, BroadPhase& broad_phase )
+{
+  const rapidxml::xml_attribute<>* type_attrib{ node.first_attribute( "type" ) };
+  if( type_attrib == nullptr )
+  {
+    std::cerr << "Failed to locate type attribute for broad_phase." << std::endl;
+    return false;
+  }
+  const std::string type_string{ type_attrib->value() };
+  if( type_string == "spatial_grid" )
+  {
+    broad_phase = BroadPhase::SPATIAL_GRID;
+  }
+  else if( type_string == "sweep_and_prune" )
+  {
+    broad_phase = BroadPhase::SWEEP_AND_PRUNE;
+  }
+  else
+  {
+    std::cerr << "Invalid broad_phase type specified. Valid options are: spatial_grid, sweep_and_prune." << std::endl;
+    return false;
+  }
+  return true;
+}
+
 static bool loadSimulationState( const rapidxml::xml_node<>& root_node, const std::string& file_name, std::string& scripting_callback_name, Ball2DState& state, std::unique_ptr<UnconstrainedMap>& integrator, std::string& dt_string, Rational<std::intmax_t>& dt, scalar& end_time, std::unique_ptr<ImpactOperator>& impact_operator, std::unique_ptr<ImpactMap>& impact_map, scalar& CoR, std::unique_ptr<FrictionSolver>& friction_solver, scalar& mu, std::unique_ptr<ImpactFrictionMap>& if_map )
 {
   std::vector<Ball2D> balls;
@@ -1592,6 +1789,11 @@ static bool loadSimulationState( const rapidxml::xml_node<>& root_node, const st
       std::cerr << "Failed to load staggered_projections_friction_solver in xml scene file: " << file_name << std::endl;
       return false;
     }
+    if( !loadFrictionSolverIslands( *root_node.first_node( "staggered_projections_friction_solver" ), friction_solver ) )
+    {
+      std::cerr << "Failed to load islands for staggered_projections_friction_solver in xml scene file: " << file_name << std::endl;
+      return false;
+    }
   }
 
   // Load a Sobogus friction solver, if present
@@ -1612,6 +1814,11 @@ static bool loadSimulationState( const rapidxml::xml_node<>& root_node, const st
       std::cerr << "Failed to load sobogus_friction_solver in xml scene file: " << file_name << std::endl;
       return false;
     }
+    if( !loadFrictionSolverIslands( *root_node.first_node( "sobogus_friction_solver" ), friction_solver ) )
+    {
+      std::cerr << "Failed to load islands for sobogus_friction_solver in xml scene file: " << file_name << std::endl;
+      return false;
+    }
   }
 
   // TODO: GRR friction solver goes here
@@ -1669,6 +1876,18 @@ static bool loadSimulationState( const rapidxml::xml_node<>& root_node, const st
   swap( planar_portals, state.planarPortals() );
   swap( forces, state.forces() );
 
+  // Attempt to load the broad phase, if present
+  if( root_node.first_node( "broad_phase" ) != nullptr )
+  {
+    BroadPhase broad_phase;
+    if( !loadBroadPhase( *root_node.first_node( "broad_phase" ), broad_phase ) )
+    {
+      std::cerr << "Failed to load broad_phase in xml scene file: " << file_name << std::endl;
+      return false;
+    }
+    state.setBroadPhase( broad_phase );
+  }
+
   return true;
 }
 
@@ -0,0 +1,334 @@
+// Replays impact LCPs captured with the -c/--capture_lcps option of the command line interfaces through each
+// available impact operator and prints the wall clock time, iteration count, and min-map residual of every
+// solve as CSV.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include <getopt.h>
+
+#include "scisim/Constraints/Constraint.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/CapturedLCP.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/GaussSeidelOperator.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorUtilities.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorAPGD.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorPGS.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorPI.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/MinMapImpact.h"
+#include "scisim/Math/DelassusOperator.h"
+#include "scisim/StringUtilities.h"
+
+#ifdef QL_FOUND
+#include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorQL.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorQLVP.h"
+#endif
+
+#ifdef IPOPT_FOUND
+#include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorIpopt.h"
+#endif
+
+// Stand in for the constraint behind one column of a captured N, used by pairwise operators that resolve
+// impacts one constraint at a time
+class ReplayConstraint final : public Constraint
+{
+
+public:
+
+  ReplayConstraint( const VectorXs& n, const VectorXs& Minv_n, const scalar& nrel, const std::string& name )
+  : m_n( n )
+  , m_Minv_n( Minv_n )
+  , m_nrel( nrel )
+  , m_name( name )
+  {
+    assert( m_n.size() == m_Minv_n.size() );
+  }
+
+  virtual ~ReplayConstraint() override = default;
+
+  virtual scalar evalNdotV( const VectorXs& q, const VectorXs& v ) const override
+  {
+    return m_n.dot( v ) + m_nrel;
+  }
+
+  virtual void resolveImpact( const scalar& CoR, const SparseMatrixsc& M, const scalar& ndotv, VectorXs& vout, scalar& alpha ) const override
+  {
+    assert( ndotv < 0.0 );
+    alpha = - ( 1.0 + CoR ) * ndotv / m_n.dot( m_Minv_n );
+    vout += alpha * m_Minv_n;
+  }
+
+  virtual int impactStencilSize() const override
+  {
+    return int( m_n.size() );
+  }
+
+  virtual bool conservesTranslationalMomentum() const override
+  {
+    return false;
+  }
+
+  virtual bool conservesAngularMomentumUnderImpact() const override
+  {
+    return false;
+  }
+
+  virtual bool conservesAngularMomentumUnderImpactAndFriction() const override
+  {
+    return false;
+  }
+
+  virtual std::string name() const override
+  {
+    return m_name;
+  }
+
+private:
+
+  virtual VectorXs computeKinematicRelativeVelocity( const VectorXs& q, const VectorXs& v ) const override
+  {
+    std::cerr << "ReplayConstraint::computeKinematicRelativeVelocity not supported" << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
+
+  const VectorXs m_n;
+  const VectorXs m_Minv_n;
+  const scalar m_nrel;
+  const std::string m_name;
+
+};
+
+static void printUsage( const std::string& executable_name )
+{
+  std::cout << "Usage: " << executable_name << " capture_directory [options]" << std::endl;
+  std::cout << "Options are:" << std::endl;
+  std::cout << "   -h/--help                : prints this help message and exits" << std::endl;
+  std::cout << "   -t/--tol scalar          : termination tolerance of the iterative operators, default 1.0e-9" << std::endl;
+  std::cout << "   -m/--max_iters integer   : maximum iterations of the iterative operators, default 5000" << std::endl;
+  std::cout << "   -v/--v_tol scalar        : velocity tolerance of the Gauss-Seidel operator, default 1.0e-9" << std::endl;
+  std::cout << "   -w/--warm_start bool     : starts each solve from the captured initial iterate, default 1" << std::endl;
+}
+
+static bool parseCommandLineOptions( int* argc, char*** argv, bool& help_mode_enabled, scalar& tol, unsigned& max_iters, scalar& v_tol, bool& warm_start )
+{
+  const struct option long_options[] =
+  {
+    { "help", no_argument, nullptr, 'h' },
+    { "tol", required_argument, nullptr, 't' },
+    { "max_iters", required_argument, nullptr, 'm' },
+    { "v_tol", required_argument, nullptr, 'v' },
+    { "warm_start", required_argument, nullptr, 'w' },
+    { nullptr, 0, nullptr, 0 }
+  };
+
+  while( true )
+  {
+    int option_index = 0;
+    const int c{ getopt_long( *argc, *argv, "ht:m:v:w:", long_options, &option_index ) };
+    if( c == -1 )
+    {
+      break;
+    }
+    switch( c )
+    {
+      case 'h':
+      {
+        help_mode_enabled = true;
+        break;
+      }
+      case 't':
+      {
+        if( !StringUtilities::extractFromString( optarg, tol ) || tol < 0.0 )
+        {
+          std::cerr << "Failed to read value for argument for -t/--tol. Value must be a non-negative scalar." << std::endl;
+          return false;
+        }
+        break;
+      }
+      case 'm':
+      {
+        if( !StringUtilities::extractFromString( optarg, max_iters ) || max_iters == 0 )
+        {
+          std::cerr << "Failed to read value for argument for -m/--max_iters. Value must be a positive integer." << std::endl;
+          return false;
+        }
+        break;
+      }
+      case 'v':
+      {
+        if( !StringUtilities::extractFromString( optarg, v_tol ) || v_tol < 0.0 )
+        {
+          std::cerr << "Failed to read value for argument for -v/--v_tol. Value must be a non-negative scalar." << std::endl;
+          return false;
+        }
+        break;
+      }
+      case 'w':
+      {
+        if( !StringUtilities::extractFromString( optarg, warm_start ) )
+        {
+          std::cerr << "Failed to read value for argument for -w/--warm_start. Value must be a boolean." << std::endl;
+          return false;
+        }
+        break;
+      }
+      case '?':
+      {
+        return false;
+      }
+      default:
+      {
+        std::cerr << "This is a bug in the command line parser. Please file a report." << std::endl;
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+// Captured problems, in the order they were solved
+static bool listCapturedProblems( const std::string& directory, std::vector<std::string>& file_names )
+{
+  DIR* const dir{ opendir( directory.c_str() ) };
+  if( dir == nullptr )
+  {
+    std::cerr << "Failed to open capture directory: " << directory << std::endl;
+    return false;
+  }
+  while( const dirent* const entry = readdir( dir ) )
+  {
+    const std::string file_name{ entry->d_name };
+    if( file_name.size() > 8 && file_name.compare( 0, 4, "lcp_" ) == 0 && file_name.compare( file_name.size() - 4, 4, ".bin" ) == 0 )
+    {
+      file_names.emplace_back( directory + "/" + file_name );
+    }
+  }
+  closedir( dir );
+  std::sort( file_names.begin(), file_names.end() );
+  return true;
+}
+
+static void createReplayConstraints( const CapturedLCP& lcp, const DelassusOperator& Q, std::vector<std::unique_ptr<Constraint>>& cons )
+{
+  cons.clear();
+  const SparseMatrixsc& MinvN{ Q.MinvN() };
+  for( int col = 0; col < lcp.N.cols(); ++col )
+  {
+    const VectorXs n{ lcp.N.col( col ) };
+    const VectorXs Minv_n{ MinvN.col( col ) };
+    const std::string name{ std::vector<std::string>::size_type( col ) < lcp.constraint_names.size() ? lcp.constraint_names[col] : "replay" };
+    cons.emplace_back( new ReplayConstraint{ n, Minv_n, lcp.nrel( col ), name } );
+  }
+}
+
+static void createOperators( const scalar& tol, const unsigned max_iters, const scalar& v_tol, std::vector<std::unique_ptr<ImpactOperator>>& operators )
+{
+  #ifdef QL_FOUND
+  operators.emplace_back( new LCPOperatorQL{ tol } );
+  operators.emplace_back( new LCPOperatorQLVP{ tol } );
+  #endif
+  operators.emplace_back( new LCPOperatorAPGD{ tol, max_iters } );
+  #ifdef IPOPT_FOUND
+  operators.emplace_back( new LCPOperatorIpopt{ { "ma97", "ma57", "mumps", "ma27", "ma86" }, tol } );
+  #endif
+  operators.emplace_back( new LCPOperatorPI{ tol, max_iters } );
+  operators.emplace_back( new LCPOperatorPGS{ tol, max_iters } );
+  operators.emplace_back( new GaussSeidelOperator{ v_tol } );
+}
+
+int main( int argc, char** argv )
+{
+  bool help_mode_enabled{ false };
+  scalar tol{ 1.0e-9 };
+  unsigned max_iters{ 5000 };
+  scalar v_tol{ 1.0e-9 };
+  bool warm_start{ true };
+
+  if( !parseCommandLineOptions( &argc, &argv, help_mode_enabled, tol, max_iters, v_tol, warm_start ) )
+  {
+    return EXIT_FAILURE;
+  }
+
+  if( help_mode_enabled )
+  {
+    printUsage( argv[0] );
+    return EXIT_SUCCESS;
+  }
+
+  if( argc != optind + 1 )
+  {
+    std::cerr << "Invalid arguments. Must provide a single capture directory." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::string> file_names;
+  if( !listCapturedProblems( argv[optind], file_names ) )
+  {
+    return EXIT_FAILURE;
+  }
+  if( file_names.empty() )
+  {
+    std::cerr << "No captured problems found in: " << argv[optind] << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::unique_ptr<ImpactOperator>> operators;
+  createOperators( tol, max_iters, v_tol, operators );
+
+  std::cout << "file,iteration,operator,constraints,seconds,iterations,residual" << std::endl;
+
+  std::vector<std::unique_ptr<Constraint>> cons;
+  VectorXs b;
+  VectorXs alpha;
+  VectorXs Qalpha;
+  for( const std::string& file_name : file_names )
+  {
+    std::ifstream input_stream{ file_name, std::ios::binary };
+    if( !input_stream.is_open() )
+    {
+      std::cerr << "Failed to open captured problem: " << file_name << std::endl;
+      return EXIT_FAILURE;
+    }
+    const CapturedLCP lcp{ input_stream };
+
+    const DelassusOperator Q{ lcp.N, lcp.Minv };
+    createReplayConstraints( lcp, Q, cons );
+    ImpactOperatorUtilities::computeLCPQPLinearTerm( lcp.N, lcp.nrel, lcp.CoR, lcp.v0, lcp.v0, b );
+    Qalpha.resize( b.size() );
+
+    for( const std::unique_ptr<ImpactOperator>& impact_operator : operators )
+    {
+      // Pairwise operators accumulate impulses and always start from zero
+      if( warm_start && impact_operator->name() != "gauss_seidel" )
+      {
+        alpha = lcp.alpha0;
+      }
+      else
+      {
+        alpha = VectorXs::Zero( lcp.alpha0.size() );
+      }
+
+      const std::chrono::steady_clock::time_point start{ std::chrono::steady_clock::now() };
+      impact_operator->flow( cons, lcp.M, lcp.Minv, lcp.q0, lcp.v0, lcp.v0, lcp.N, Q, lcp.nrel, lcp.CoR, alpha );
+      const std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+      Q.multiply( alpha, Qalpha );
+      const scalar residual{ MinMapImpact{}( alpha, Qalpha + b ) };
+
+      std::cout << file_name << ',' << lcp.iteration << ',' << impact_operator->name() << ',' << alpha.size() << ',' << elapsed.count() << ',';
+      if( impact_operator->reportsSolveIterations() )
+      {
+        std::cout << impact_operator->lastSolveIterations();
+      }
+      std::cout << ',' << residual << '\n';
+    }
+  }
+  std::cout.flush();
+
+  return EXIT_SUCCESS;
+}
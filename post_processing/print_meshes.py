@@ -24,23 +24,24 @@ def printPaddedArray(A):
 
 try:
     with h5py.File(hdf5_file_name, 'r') as h5_file:
-        sim_state = rb3d_processing.DiscreteState(h5_file)
-
-    print 'Git hash:', sim_state.git_hash
-    print 'Iteration:', sim_state.iteration
-    print 'Timestep:', sim_state.timestep
-    print 'Time:', sim_state.time
-    for idx, (x, R, vel, omega, M, I, kinematic, mesh_name) in enumerate(sim_state.meshBodies()):
-        print 'Body:', idx
-        print '  x:', x
-        print '  R:',
-        printPaddedArray(R)
-        print '  v:', vel
-        print '  omega:', omega
-        print '  M:', M
-        print '  I:',
-        printPaddedArray(I)
-        print '  fixed:', kinematic
-        print '  mesh_name:', mesh_name
+        sim_states = [rb3d_processing.DiscreteState(frame) for frame in rb3d_processing.frames(h5_file)]
+
+    for sim_state in sim_states:
+        print 'Git hash:', sim_state.git_hash
+        print 'Iteration:', sim_state.iteration
+        print 'Timestep:', sim_state.timestep
+        print 'Time:', sim_state.time
+        for idx, (x, R, vel, omega, M, I, kinematic, mesh_name) in enumerate(sim_state.meshBodies()):
+            print 'Body:', idx
+            print '  x:', x
+            print '  R:',
+            printPaddedArray(R)
+            print '  v:', vel
+            print '  omega:', omega
+            print '  M:', M
+            print '  I:',
+            printPaddedArray(I)
+            print '  fixed:', kinematic
+            print '  mesh_name:', mesh_name
 except IOError as io_exception:
     sys.exit(str(io_exception))
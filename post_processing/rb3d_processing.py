@@ -15,6 +15,35 @@ def matrixIsRotation(R):
     return True
 
 
+class TimeSeriesFrame(object):
+    '''One frame of a file saved with the single file option, presented like a file saved for that frame alone.'''
+    def __init__(self, h5_file, frame):
+        self.h5_file = h5_file
+        self.frame = frame
+
+    def __contains__(self, key):
+        return key in self.h5_file
+
+    def __getitem__(self, key):
+        shape_key = key + '_shape'
+        if shape_key not in self.h5_file:
+            # Written once, with the first frame
+            return self.h5_file[key]
+        shapes = self.h5_file[shape_key][:].reshape(-1, 2)
+        sizes = shapes[:, 0] * shapes[:, 1]
+        begin = numpy.sum(sizes[:self.frame])
+        return self.h5_file[key][begin:begin + sizes[self.frame]].reshape(shapes[self.frame])
+
+
+def frames(h5_file):
+    '''Iterates over the frames of a file, which holds one frame or, if saved with the single file option, all of them.'''
+    if 'time_shape' not in h5_file:
+        yield h5_file
+        return
+    for frame in range(h5_file['time_shape'].shape[0] / 2):
+        yield TimeSeriesFrame(h5_file, frame)
+
+
 class DiscreteState(object):
     '''A container for the state of a 3D rigid body simulation.'''
     def __init__(self, h5_file):
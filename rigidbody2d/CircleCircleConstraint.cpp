@@ -5,6 +5,8 @@
 
 #include "CircleCircleConstraint.h"
 
+#include "scisim/Constraints/ContactBatch.h"
+
 #include "scisim/Math/MathUtilities.h"
 
 bool CircleCircleConstraint::isActive( const Vector2s& x0, const Vector2s& x1, const scalar& r0, const scalar& r1 )
@@ -47,6 +49,16 @@ void CircleCircleConstraint::evalgradg( const VectorXs& q, const int col, Sparse
   G.insert( 3 * m_idx1 + 1, col ) = -m_n.y();
 }
 
+bool CircleCircleConstraint::addToContactBatch( const VectorXs& q, ContactBatch& batch ) const
+{
+  assert( q.size() % 3 == 0 );
+  // Point of contact relative to each body's center of mass
+  const Vector2s r0{ m_p - q.segment<2>( 3 * m_idx0 ) };
+  const Vector2s r1{ m_p - q.segment<2>( 3 * m_idx1 ) };
+  batch.addContact( ContactBatch::Kind::Sphere, int( 3 * m_idx0 ), int( 3 * m_idx0 + 2 ), r0, int( 3 * m_idx1 ), int( 3 * m_idx1 + 2 ), r1, m_n, Vector2s::Zero() );
+  return true;
+}
+
 void CircleCircleConstraint::computeGeneralizedFrictionGivenTangentSample( const VectorXs& q, const VectorXs& t, const unsigned column, SparseMatrixsc& D ) const
 {
   assert( column < unsigned( D.cols() ) ); assert( q.size() % 3 == 0 );
@@ -1,12 +1,14 @@
 #include "RigidBody2DSim.h"
 
 #include "scisim/CollisionDetection/CollisionDetectionUtilities.h"
+#include "scisim/CollisionDetection/SpatialGrid.h"
 #include "scisim/UnconstrainedMaps/UnconstrainedMap.h"
 #include "scisim/Math/MathUtilities.h"
 #include "scisim/Math/Rational.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/ImpactMap.h"
 #include "scisim/ConstrainedMaps/ImpactFrictionMap.h"
 #include "scisim/Utilities.h"
+#include "scisim/Timer/Profiler.h"
 
 #include "CircleBoxTools.h"
 #include "BoxBoxTools.h"
@@ -19,15 +21,16 @@
 #include "TeleportedCircleCircleConstraint.h"
 #include "KinematicKickCircleCircleConstraint.h"
 #include "KinematicObjectCircleConstraint.h"
-#include "SpatialGrid.h"
 #include "StateOutput.h"
 #include "PythonScripting.h"
 
 #ifdef USE_HDF5
 #include "scisim/HDF5File.h"
+#include "scisim/HDF5TimeSeries.h"
 #endif
 
 #include <iostream>
+#include <set>
 
 RigidBody2DState& RigidBody2DSim::state()
 {
@@ -148,6 +151,16 @@ const SparseMatrixsc& RigidBody2DSim::Minv0() const
   return m_state.Minv();
 }
 
+const BlockDiagonalMass& RigidBody2DSim::MBlocks() const
+{
+  return m_state.MBlocks();
+}
+
+const BlockDiagonalMass& RigidBody2DSim::MinvBlocks() const
+{
+  return m_state.MinvBlocks();
+}
+
 void RigidBody2DSim::computeMomentum( const VectorXs& v, VectorXs& p ) const
 {
   p = Vector2s::Zero();
@@ -201,7 +214,7 @@ void RigidBody2DSim::boxBoxNarrowPhaseCollision( const unsigned idx0, const unsi
   // ... but constraint construction is at q0 to conserve angular momentum
   for( const Vector2s& point : points )
   {
-    active_set.emplace_back( new BodyBodyConstraint{ idx0, idx1, point, n, q0 } );
+    active_set.emplace_back( new( constraintArena() ) BodyBodyConstraint{ idx0, idx1, point, n, q0 } );
   }
 }
 
@@ -228,11 +241,11 @@ void RigidBody2DSim::boxCircleNarrowPhaseCollision( const unsigned idx_crcl, con
     {
       if( idx_crcl < idx_box )
       {
-        active_set.emplace_back( new BodyBodyConstraint{ idx_crcl, idx_box, p, n, q0 } );
+        active_set.emplace_back( new( constraintArena() ) BodyBodyConstraint{ idx_crcl, idx_box, p, n, q0 } );
       }
       else
       {
-        active_set.emplace_back( new BodyBodyConstraint{ idx_box, idx_crcl, p, -n, q0 } );
+        active_set.emplace_back( new( constraintArena() ) BodyBodyConstraint{ idx_box, idx_crcl, p, -n, q0 } );
       }
     }
     else
@@ -240,7 +253,7 @@ void RigidBody2DSim::boxCircleNarrowPhaseCollision( const unsigned idx_crcl, con
       const Vector2s x{ q0.segment<2>( 3 * idx_box ) };
       const Vector2s vel{ v.segment<2>( 3 * idx_box ) };
       const scalar omega{ v( 3 * idx_box + 2 ) };
-      active_set.emplace_back( new KinematicObjectCircleConstraint{ idx_crcl, circle.r(), n, idx_box, x, vel, omega } );
+      active_set.emplace_back( new( constraintArena() ) KinematicObjectCircleConstraint{ idx_crcl, circle.r(), n, idx_box, x, vel, omega } );
     }
   }
 }
@@ -300,13 +313,13 @@ void RigidBody2DSim::dispatchNarrowPhaseCollision( unsigned idx0, unsigned idx1,
             if( !isKinematicallyScripted( idx1 ) )
             {
               const Vector2s p{ q0a + ( ra / ( ra + rb ) ) * ( q0b - q0a ) };
-              active_set.emplace_back( new CircleCircleConstraint{ idx0, idx1, n, p, ra, rb } );
+              active_set.emplace_back( new( constraintArena() ) CircleCircleConstraint{ idx0, idx1, n, p, ra, rb } );
             }
             else
             {
               const Vector2s vel{ v.segment<2>( 3 * idx1 ) };
               const scalar omega{ v( 3 * idx1 + 2 ) };
-              active_set.emplace_back( new KinematicObjectCircleConstraint{ idx0, ra, n, idx1, q0b, vel, omega } );
+              active_set.emplace_back( new( constraintArena() ) KinematicObjectCircleConstraint{ idx0, ra, n, idx1, q0b, vel, omega } );
             }
           }
           break;
@@ -559,7 +572,7 @@ void RigidBody2DSim::dispatchTeleportedNarrowPhaseCollision( const TeleportedCol
             if( CircleCircleConstraint::isActive( x0_t1, x1_t1, circle_geo0.r(), circle_geo1.r() ) )
             {
               // Creation of constraints at q0 to preserve angular momentum
-              active_set.emplace_back( new TeleportedCircleCircleConstraint{ teleported_collision.bodyIndex0(), teleported_collision.bodyIndex1(), x0_t0, x1_t0, circle_geo0.r(), circle_geo1.r(), delta0_t0, delta1_t0, circle_geo0.r(), circle_geo1.r() } );
+              active_set.emplace_back( new( constraintArena() ) TeleportedCircleCircleConstraint{ teleported_collision.bodyIndex0(), teleported_collision.bodyIndex1(), x0_t0, x1_t0, circle_geo0.r(), circle_geo1.r(), delta0_t0, delta1_t0, circle_geo0.r(), circle_geo1.r() } );
             }
             break;
           }
@@ -614,7 +627,7 @@ void RigidBody2DSim::dispatchTeleportedNarrowPhaseCollision( const TeleportedCol
             if( CircleCircleConstraint::isActive( x0_t1, x1_t1, circle_geo0.r(), circle_geo1.r() ) )
             {
               // Creation of constraints at q0 to preserve angular momentum
-              active_set.emplace_back( new KinematicKickCircleCircleConstraint{ teleported_collision.bodyIndex0(), teleported_collision.bodyIndex1(), x0_t0, x1_t0, circle_geo0.r(), circle_geo1.r(), kinematic_kick } );
+              active_set.emplace_back( new( constraintArena() ) KinematicKickCircleCircleConstraint{ teleported_collision.bodyIndex0(), teleported_collision.bodyIndex1(), x0_t0, x1_t0, circle_geo0.r(), circle_geo1.r(), kinematic_kick } );
             }
             break;
           }
@@ -644,48 +657,88 @@ void RigidBody2DSim::computeBodyPlaneActiveSetAllPairs( const VectorXs& q0, cons
   // Check all body-plane pairs
   for( unsigned plane_idx = 0; plane_idx < m_state.planes().size(); ++plane_idx )
   {
-    const RigidBody2DStaticPlane& plane{ m_state.planes()[plane_idx] };
     for( unsigned bdy_idx = 0; bdy_idx < nbodies; ++bdy_idx )
     {
-      // Skip kinematically scripted bodies
-      if( isKinematicallyScripted( bdy_idx ) )
+      computeBodyPlaneActiveSet( plane_idx, bdy_idx, q1, active_set );
+    }
+  }
+}
+
+// Same constraints, in the same order, as computeBodyPlaneActiveSetAllPairs
+void RigidBody2DSim::computeBodyPlaneActiveSetAABBTree( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set )
+{
+  assert( q0.size() % 3 == 0 ); assert( q0.size() == q1.size() );
+
+  if( m_state.planes().empty() )
+  {
+    return;
+  }
+
+  // Bound each body at the end of the step
+  {
+    SCISIM_PROFILE_SCOPE( ProfilePhase::BROAD_PHASE );
+    const unsigned nbodies{ static_cast<unsigned>( q0.size() / 3 ) };
+    m_body_aabbs.resize( nbodies );
+    for( unsigned bdy_idx = 0; bdy_idx < nbodies; ++bdy_idx )
+    {
+      m_state.bodyGeometry( bdy_idx )->computeAABB( q1.segment<2>( 3 * bdy_idx ), q1( 3 * bdy_idx + 2 ), m_body_aabbs[bdy_idx].min(), m_body_aabbs[bdy_idx].max() );
+    }
+    m_body_tree.build( m_body_aabbs );
+  }
+
+  for( unsigned plane_idx = 0; plane_idx < m_state.planes().size(); ++plane_idx )
+  {
+    const RigidBody2DStaticPlane& plane{ m_state.planes()[plane_idx] };
+    // Only bodies that touch the half plane can be active
+    m_static_candidates.clear();
+    m_body_tree.query( [&plane]( const Array2s& min, const Array2s& max ) { return CollisionDetectionUtilities::aabbTouchesHalfPlane<2>( min, max, plane.x(), plane.n() ); }, m_static_candidates );
+    for( const unsigned bdy_idx : m_static_candidates )
+    {
+      computeBodyPlaneActiveSet( plane_idx, bdy_idx, q1, active_set );
+    }
+  }
+}
+
+void RigidBody2DSim::computeBodyPlaneActiveSet( const unsigned plane_idx, const unsigned bdy_idx, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const
+{
+  // Skip kinematically scripted bodies
+  if( isKinematicallyScripted( bdy_idx ) )
+  {
+    return;
+  }
+
+  const RigidBody2DStaticPlane& plane{ m_state.planes()[plane_idx] };
+  switch( m_state.geometry()[ m_state.geometryIndices()( bdy_idx ) ]->type() )
+  {
+    case RigidBody2DGeometryType::CIRCLE:
+    {
+      const CircleGeometry& circle_geo{ static_cast<CircleGeometry&>( *m_state.geometry()[ m_state.geometryIndices()( bdy_idx ) ] ) };
+      if( StaticPlaneCircleConstraint::isActive( q1.segment<2>( 3 * bdy_idx ), circle_geo.r(), plane ) )
       {
-        continue;
+        active_set.emplace_back( new( constraintArena() ) StaticPlaneCircleConstraint{ bdy_idx, plane_idx, circle_geo.r(), plane } );
       }
+      break;
+    }
+    case RigidBody2DGeometryType::BOX:
+    {
+      // TODO: Make this faster, if needed
+      const BoxGeometry& box_geo{ static_cast<BoxGeometry&>( *m_state.geometry()[ m_state.geometryIndices()( bdy_idx ) ] ) };
 
-      switch( m_state.geometry()[ m_state.geometryIndices()( bdy_idx ) ]->type() )
+      const Vector2s x{ q1.segment<2>( 3 * bdy_idx ) };
+      const Eigen::Rotation2D<scalar> R{ q1( 3 * bdy_idx + 2 ) };
+      const Array2s r{ box_geo.r() };
+
+      // Check each vertex of the box
+      for( int i = -1; i < 2; i += 2 )
       {
-        case RigidBody2DGeometryType::CIRCLE:
-        {
-          const CircleGeometry& circle_geo{ static_cast<CircleGeometry&>( *m_state.geometry()[ m_state.geometryIndices()( bdy_idx ) ] ) };
-          if( StaticPlaneCircleConstraint::isActive( q1.segment<2>( 3 * bdy_idx ), circle_geo.r(), plane ) )
-          {
-            active_set.emplace_back( new StaticPlaneCircleConstraint{ bdy_idx, plane_idx, circle_geo.r(), plane } );
-          }
-          break;
-        }
-        case RigidBody2DGeometryType::BOX:
+        for( int j = -1; j < 2; j += 2 )
         {
-          // TODO: Make this faster, if needed
-          const BoxGeometry& box_geo{ static_cast<BoxGeometry&>( *m_state.geometry()[ m_state.geometryIndices()( bdy_idx ) ] ) };
-
-          const Vector2s x{ q1.segment<2>( 3 * bdy_idx ) };
-          const Eigen::Rotation2D<scalar> R{ q1( 3 * bdy_idx + 2 ) };
-          const Array2s r{ box_geo.r() };
-
-          // Check each vertex of the box
-          for( int i = -1; i < 2; i += 2 )
+          const Vector2s body_space_arm{ ( Array2s{ i, j } * r ).matrix() };
+          const Vector2s transformed_vertex{ x + R * body_space_arm };
+          const scalar dist{ plane.n().dot( transformed_vertex - plane.x() ) };
+          if( dist <= 0.0 )
           {
-            for( int j = -1; j < 2; j += 2 )
-            {
-              const Vector2s body_space_arm{ ( Array2s{ i, j } * r ).matrix() };
-              const Vector2s transformed_vertex{ x + R * body_space_arm };
-              const scalar dist{ plane.n().dot( transformed_vertex - plane.x() ) };
-              if( dist <= 0.0 )
-              {
-                active_set.emplace_back( new StaticPlaneBodyConstraint{ bdy_idx, body_space_arm, plane, plane_idx } );
-              }
-            }
+            active_set.emplace_back( new( constraintArena() ) StaticPlaneBodyConstraint{ bdy_idx, body_space_arm, plane, plane_idx } );
           }
         }
       }
@@ -698,6 +751,10 @@ void RigidBody2DSim::computeActiveSet( const VectorXs& q0, const VectorXs& q1, c
   assert( q0.size() % 3 == 0 ); assert( q0.size() == q1.size() );
 
   active_set.clear();
+  SCISIM_PROFILE_SCOPE( ProfilePhase::NARROW_PHASE );
+
+  // Recycle the storage of the previous step's constraints
+  constraintArena().reset();
 
   // Detect body-body collisions
   if( m_state.planarPortals().empty() )
@@ -709,8 +766,10 @@ void RigidBody2DSim::computeActiveSet( const VectorXs& q0, const VectorXs& q1, c
     computeBodyBodyActiveSetSpatialGridWithPortals( q0, q1, v, active_set );
   }
 
-  // Check all body-plane pairs
-  computeBodyPlaneActiveSetAllPairs( q0, q1, active_set );
+  // Cull bodies against the static planes with a tree over the bodies
+  computeBodyPlaneActiveSetAABBTree( q0, q1, active_set );
+
+  SCISIM_PROFILE_COUNT( ProfileCounter::CONTACTS, active_set.size() );
 }
 
 void RigidBody2DSim::computeImpactBases( const VectorXs& q, const std::vector<std::unique_ptr<Constraint>>& active_set, MatrixXXsc& impact_bases ) const
@@ -874,19 +933,37 @@ void RigidBody2DSim::enforcePeriodicBoundaryConditions( VectorXs& q, VectorXs& v
   }
 }
 
-void RigidBody2DSim::computeBodyBodyActiveSetSpatialGridWithPortals( const VectorXs& q0, const VectorXs& q1, const VectorXs& v, std::vector<std::unique_ptr<Constraint>>& active_set ) const
+void RigidBody2DSim::computePossibleOverlaps( const std::vector<AABB<2>>& aabbs )
+{
+  SCISIM_PROFILE_SCOPE( ProfilePhase::BROAD_PHASE );
+
+  switch( m_state.broadPhase() )
+  {
+    case BroadPhase::SPATIAL_GRID:
+    {
+      m_spatial_grid.getPotentialOverlaps( aabbs, m_possible_overlaps );
+      break;
+    }
+    case BroadPhase::SWEEP_AND_PRUNE:
+    {
+      m_sweep_and_prune.update( aabbs );
+      m_possible_overlaps = m_sweep_and_prune.overlaps();
+      break;
+    }
+  }
+}
+
+void RigidBody2DSim::computeBodyBodyActiveSetSpatialGridWithPortals( const VectorXs& q0, const VectorXs& q1, const VectorXs& v, std::vector<std::unique_ptr<Constraint>>& active_set )
 {
   assert( q0.size() % 3 == 0 ); assert( q0.size() == q1.size() );
 
   const unsigned nbodies{ static_cast<unsigned>( q0.size() / 3 ) };
 
-  // Candidate bodies that might overlap
-  std::set<std::pair<unsigned,unsigned>> possible_overlaps;
   // Map from teleported AABB indices and body and portal indices
   std::map<unsigned,TeleportedBody> teleported_aabb_body_indices;
   {
     // Compute an AABB for each body
-    std::vector<AABB> aabbs;
+    std::vector<AABB<2>> aabbs;
     aabbs.reserve( nbodies );
     for( unsigned bdy_idx = 0; bdy_idx < nbodies; ++bdy_idx )
     {
@@ -925,7 +1002,7 @@ void RigidBody2DSim::computeBodyBodyActiveSetSpatialGridWithPortals( const Vecto
     }
 
     // Determine which bodies possibly overlap
-    SpatialGrid::getPotentialOverlaps( aabbs, possible_overlaps );
+    computePossibleOverlaps( aabbs );
   }
 
   std::set<TeleportedCollision> teleported_collisions;
@@ -935,7 +1012,7 @@ void RigidBody2DSim::computeBodyBodyActiveSetSpatialGridWithPortals( const Vecto
   #endif
 
   // Create constraints for bodies that actually overlap
-  for( const auto& possible_overlap_pair : possible_overlaps )
+  for( const auto& possible_overlap_pair : m_possible_overlaps )
   {
     const bool first_teleported{ possible_overlap_pair.first >= nbodies };
     const bool second_teleported{ possible_overlap_pair.second >= nbodies };
@@ -1003,7 +1080,7 @@ void RigidBody2DSim::computeBodyBodyActiveSetSpatialGridWithPortals( const Vecto
       }
     }
   }
-  possible_overlaps.clear();
+  m_possible_overlaps.clear();
   teleported_aabb_body_indices.clear();
 
   #ifndef NDEBUG
@@ -1063,17 +1140,15 @@ void RigidBody2DSim::computeBodyBodyActiveSetSpatialGridWithPortals( const Vecto
   //#endif
 }
 
-void RigidBody2DSim::computeBodyBodyActiveSetSpatialGrid( const VectorXs& q0, const VectorXs& q1, const VectorXs& v, std::vector<std::unique_ptr<Constraint>>& active_set ) const
+void RigidBody2DSim::computeBodyBodyActiveSetSpatialGrid( const VectorXs& q0, const VectorXs& q1, const VectorXs& v, std::vector<std::unique_ptr<Constraint>>& active_set )
 {
   assert( q0.size() % 3 == 0 ); assert( q0.size() == q1.size() );
 
   const unsigned nbodies{ static_cast<unsigned>( q0.size() / 3 ) };
 
-  // Candidate bodies that might overlap
-  std::set<std::pair<unsigned,unsigned>> possible_overlaps;
   {
     // Compute an AABB for each body
-    std::vector<AABB> aabbs;
+    std::vector<AABB<2>> aabbs;
     aabbs.reserve( nbodies );
     for( unsigned bdy_idx = 0; bdy_idx < nbodies; ++bdy_idx )
     {
@@ -1085,11 +1160,11 @@ void RigidBody2DSim::computeBodyBodyActiveSetSpatialGrid( const VectorXs& q0, co
     assert( aabbs.size() == nbodies );
 
     // Determine which bodies possibly overlap
-    SpatialGrid::getPotentialOverlaps( aabbs, possible_overlaps );
+    computePossibleOverlaps( aabbs );
   }
 
   // Create constraints for bodies that actually overlap
-  for( const auto& possible_overlap_pair : possible_overlaps )
+  for( const auto& possible_overlap_pair : m_possible_overlaps )
   {
     assert( possible_overlap_pair.first < nbodies );
     assert( possible_overlap_pair.second < nbodies );
@@ -1108,20 +1183,25 @@ void RigidBody2DSim::writeBinaryState( HDF5File& output_file ) const
   // Output the velocity
   output_file.write( "v", m_state.v() );
   // Output the mass
+  output_file.write( "m", massVector() );
+  output_file.write( "kinematically_scripted", kinematicallyScriptedFlags() );
+  writeBinaryGeometry( output_file );
+}
+
+void RigidBody2DSim::writeBinaryState( HDF5TimeSeries& output_series ) const
+{
+  output_series.append( "q", m_state.q() );
+  output_series.append( "v", m_state.v() );
+  output_series.append( "m", massVector() );
+  output_series.append( "kinematically_scripted", kinematicallyScriptedFlags() );
+  if( output_series.numFrames() == 1 )
   {
-    // Assemble the mass into a single flat vector like q, v, and r
-    assert( unsigned(m_state.M().nonZeros()) == 3 * m_state.nbodies() );
-    const VectorXs m{ Eigen::Map<const VectorXs>{ &m_state.M().data().value(0), m_state.q().size() } };
-    output_file.write( "m", m );
-  }
-  {
-    VectorXu fixed{ numBodies() };
-    for( int body_index = 0; body_index < fixed.size(); ++body_index )
-    {
-      fixed( body_index ) = isKinematicallyScripted( body_index ) ? 1 : 0;
-    }
-    output_file.write( "kinematically_scripted", fixed );
+    writeBinaryGeometry( output_series.file() );
   }
+}
+
+void RigidBody2DSim::writeBinaryGeometry( HDF5File& output_file ) const
+{
   // Output the simulated geometry
   RigidBody2DStateOutput::writeGeometryIndices( m_state.geometry(), m_state.geometryIndices(), "geometry", output_file );
   RigidBody2DStateOutput::writeGeometry( m_state.geometry(), "geometry", output_file );
@@ -1135,6 +1215,23 @@ void RigidBody2DSim::writeBinaryState( HDF5File& output_file ) const
     RigidBody2DStateOutput::writePlanarPortals( m_state.planarPortals(), "static_geometry", output_file );
   }
 }
+
+VectorXs RigidBody2DSim::massVector() const
+{
+  // Assemble the mass into a single flat vector like q, v, and r
+  assert( unsigned(m_state.M().nonZeros()) == 3 * m_state.nbodies() );
+  return Eigen::Map<const VectorXs>{ m_state.M().data().valuePtr(), m_state.q().size() };
+}
+
+VectorXu RigidBody2DSim::kinematicallyScriptedFlags() const
+{
+  VectorXu fixed{ numBodies() };
+  for( int body_index = 0; body_index < fixed.size(); ++body_index )
+  {
+    fixed( body_index ) = isKinematicallyScripted( body_index ) ? 1 : 0;
+  }
+  return fixed;
+}
 #endif
 
 void RigidBody2DSim::serialize( std::ostream& output_stream ) const
@@ -5,6 +5,9 @@
 #include "rigidbody2d/RigidBody2DState.h"
 
 #include "scisim/Constraints/ConstrainedSystem.h"
+#include "scisim/CollisionDetection/AABBTree.h"
+#include "scisim/CollisionDetection/SpatialGrid.h"
+#include "scisim/CollisionDetection/SweepAndPruneDetector.h"
 #include "ConstraintCache.h"
 
 class UnconstrainedMap;
@@ -19,6 +22,7 @@ template<typename T> class Rational;
 
 #ifdef USE_HDF5
 class HDF5File;
+class HDF5TimeSeries;
 #endif
 
 class RigidBody2DSim final : private FlowableSystem, private ConstrainedSystem
@@ -60,6 +64,8 @@ public:
   virtual const SparseMatrixsc& Minv() const override;
   virtual const SparseMatrixsc& M0() const override;
   virtual const SparseMatrixsc& Minv0() const override;
+  virtual const BlockDiagonalMass& MBlocks() const override;
+  virtual const BlockDiagonalMass& MinvBlocks() const override;
 
   virtual void computeMomentum( const VectorXs& v, VectorXs& p ) const override;
   virtual void computeAngularMomentum( const VectorXs& v, VectorXs& L ) const override;
@@ -87,6 +93,8 @@ public:
 
   #ifdef USE_HDF5
   void writeBinaryState( HDF5File& output_file ) const;
+  // Appends the state to a time series; geometry is written with the first frame only
+  void writeBinaryState( HDF5TimeSeries& output_series ) const;
   #endif
 
   void serialize( std::ostream& output_stream ) const;
@@ -98,6 +106,12 @@ public:
 
 private:
 
+  #ifdef USE_HDF5
+  void writeBinaryGeometry( HDF5File& output_file ) const;
+  VectorXs massVector() const;
+  VectorXu kinematicallyScriptedFlags() const;
+  #endif
+
   // TODO: Most of these methods don't need to be methods...
 
   void updatePeriodicBoundaryConditionsStartOfStep( const unsigned next_iteration, const scalar& dt );
@@ -107,9 +121,13 @@ private:
   void dispatchTeleportedNarrowPhaseCollision( const TeleportedCollision& teleported_collision, const std::unique_ptr<RigidBody2DGeometry>& geo0, const std::unique_ptr<RigidBody2DGeometry>& geo1, const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
   bool teleportedCollisionIsActive( const TeleportedCollision& teleported_collision, const std::unique_ptr<RigidBody2DGeometry>& geo0, const std::unique_ptr<RigidBody2DGeometry>& geo1, const VectorXs& q ) const;
 
-  void computeBodyBodyActiveSetSpatialGrid( const VectorXs& q0, const VectorXs& q1, const VectorXs& v, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
-  void computeBodyBodyActiveSetSpatialGridWithPortals( const VectorXs& q0, const VectorXs& q1, const VectorXs& v, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
+  // Fills m_possible_overlaps using the state's broad phase
+  void computePossibleOverlaps( const std::vector<AABB<2>>& aabbs );
+  void computeBodyBodyActiveSetSpatialGrid( const VectorXs& q0, const VectorXs& q1, const VectorXs& v, std::vector<std::unique_ptr<Constraint>>& active_set );
+  void computeBodyBodyActiveSetSpatialGridWithPortals( const VectorXs& q0, const VectorXs& q1, const VectorXs& v, std::vector<std::unique_ptr<Constraint>>& active_set );
   void computeBodyPlaneActiveSetAllPairs( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
+  void computeBodyPlaneActiveSetAABBTree( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set );
+  void computeBodyPlaneActiveSet( const unsigned plane_idx, const unsigned bdy_idx, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
 
   void boxBoxNarrowPhaseCollision( const unsigned idx0, const unsigned idx1, const BoxGeometry& box0, const BoxGeometry& box1, const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
   void boxCircleNarrowPhaseCollision( const unsigned idx0, const unsigned idx1, const CircleGeometry& circle, const BoxGeometry& box, const VectorXs& q0, const VectorXs& q1, const VectorXs& v, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
@@ -118,6 +136,14 @@ private:
   RigidBody2DState m_state;
   ConstraintCache m_constraint_cache;
 
+  // Broad phase storage, retained across timesteps to avoid reallocation
+  SpatialGrid<2> m_spatial_grid;
+  SweepAndPruneDetector<2> m_sweep_and_prune;
+  std::vector<std::pair<unsigned,unsigned>> m_possible_overlaps;
+  std::vector<AABB<2>> m_body_aabbs;
+  AABBTree<2> m_body_tree;
+  std::vector<unsigned> m_static_candidates;
+
 };
 
 #endif
@@ -84,6 +84,8 @@ RigidBody2DState::RigidBody2DState( const VectorXs& q, const VectorXs& v, const
 , m_v( v )
 , m_M( generateM( m ) )
 , m_Minv( generateMinv( m ) )
+, m_M_blocks( m_M, 1 )
+, m_Minv_blocks( m_Minv, 1 )
 , m_fixed( fixed )
 , m_geometry_indices( geometry_indices )
 , m_geometry( Utilities::clone( geometry ) )
@@ -101,12 +103,15 @@ RigidBody2DState::RigidBody2DState( const RigidBody2DState& rhs )
 , m_v( rhs.m_v )
 , m_M( rhs.m_M )
 , m_Minv( rhs.m_Minv )
+, m_M_blocks( rhs.m_M_blocks )
+, m_Minv_blocks( rhs.m_Minv_blocks )
 , m_fixed( rhs.m_fixed )
 , m_geometry_indices( rhs.m_geometry_indices )
 , m_geometry( Utilities::clone( rhs.m_geometry ) )
 , m_forces( Utilities::clone( rhs.m_forces ) )
 , m_planes( rhs.m_planes )
 , m_planar_portals( rhs.m_planar_portals )
+, m_broad_phase( rhs.m_broad_phase )
 {
   #ifndef NDEBUG
   checkStateConsistency();
@@ -162,6 +167,22 @@ const SparseMatrixsc& RigidBody2DState::Minv() const
   return m_Minv;
 }
 
+const BlockDiagonalMass& RigidBody2DState::MBlocks() const
+{
+  return m_M_blocks;
+}
+
+const BlockDiagonalMass& RigidBody2DState::MinvBlocks() const
+{
+  return m_Minv_blocks;
+}
+
+void RigidBody2DState::updateMassBlocks()
+{
+  m_M_blocks.setFromSparse( m_M, 1 );
+  m_Minv_blocks.setFromSparse( m_Minv, 1 );
+}
+
 const scalar& RigidBody2DState::m( const unsigned bdy_idx ) const
 {
   assert( bdy_idx < m_q.size() / 3 );
@@ -254,6 +275,7 @@ void RigidBody2DState::addBody( const Vector2s& x, const scalar& theta, const Ve
     Minv.finalize();
     m_Minv.swap( Minv );
   }
+  updateMassBlocks();
 
   #ifndef NDEBUG
   checkStateConsistency();
@@ -340,6 +362,7 @@ void RigidBody2DState::removeBodies( const Eigen::Ref<const VectorXu>& indices )
     Minv.makeCompressed();
     m_Minv.swap( Minv );
   }
+  updateMassBlocks();
 
   #ifndef NDEBUG
   checkStateConsistency();
@@ -458,6 +481,16 @@ const std::vector<PlanarPortal>& RigidBody2DState::planarPortals() const
   return m_planar_portals;
 }
 
+void RigidBody2DState::setBroadPhase( const BroadPhase& broad_phase )
+{
+  m_broad_phase = broad_phase;
+}
+
+BroadPhase RigidBody2DState::broadPhase() const
+{
+  return m_broad_phase;
+}
+
 Array4s RigidBody2DState::computeBoundingBox() const
 {
   const unsigned nbodies{ static_cast<unsigned>( m_q.size() / 3 ) };
@@ -495,6 +528,7 @@ void RigidBody2DState::serialize( std::ostream& output_stream ) const
   Utilities::serialize( m_forces, output_stream );
   Utilities::serialize( m_planes, output_stream );
   Utilities::serialize( m_planar_portals, output_stream );
+  Utilities::serialize( m_broad_phase, output_stream );
 }
 
 static void deserializeGeo( std::istream& input_stream, std::vector<std::unique_ptr<RigidBody2DGeometry>>& geo )
@@ -547,10 +581,12 @@ void RigidBody2DState::deserialize( std::istream& input_stream )
   m_v = MathUtilities::deserialize<VectorXs>( input_stream );
   MathUtilities::deserialize( m_M, input_stream );
   MathUtilities::deserialize( m_Minv, input_stream );
+  updateMassBlocks();
   m_fixed = Utilities::deserialize<std::vector<bool>>( input_stream );
   m_geometry_indices = MathUtilities::deserialize<VectorXu>( input_stream );
   deserializeGeo( input_stream, m_geometry );
   deserializeForces( input_stream, m_forces );
   m_planes = Utilities::deserialize<std::vector<RigidBody2DStaticPlane>>( input_stream );
   m_planar_portals = Utilities::deserialize<std::vector<PlanarPortal>>( input_stream );
+  m_broad_phase = Utilities::deserialize<BroadPhase>( input_stream );
 }
@@ -7,6 +7,8 @@
 #define RIGID_BODY_2D_STATE
 
 #include "scisim/Math/MathDefines.h"
+#include "scisim/Math/BlockDiagonalMass.h"
+#include "scisim/CollisionDetection/BroadPhase.h"
 #include "RigidBody2DGeometry.h"
 #include "RigidBody2DForce.h"
 #include "RigidBody2DStaticPlane.h"
@@ -39,6 +41,10 @@ public:
 
   const SparseMatrixsc& Minv() const;
 
+  // M and Minv are diagonal, so their blocks are 1x1
+  const BlockDiagonalMass& MBlocks() const;
+  const BlockDiagonalMass& MinvBlocks() const;
+
   const scalar& m( const unsigned bdy_idx ) const;
   const scalar& I( const unsigned bdy_idx ) const;
 
@@ -74,6 +80,10 @@ public:
   std::vector<PlanarPortal>& planarPortals();
   const std::vector<PlanarPortal>& planarPortals() const;
 
+  // Broad phase used for body-body collision detection
+  void setBroadPhase( const BroadPhase& broad_phase );
+  BroadPhase broadPhase() const;
+
   // Computes a bounding box around the system
   Array4s computeBoundingBox() const;
 
@@ -87,18 +97,23 @@ private:
   void checkStateConsistency();
   #endif
 
+  void updateMassBlocks();
+
   // Format: x0, y0, theta0, x1, y1, theta1, ...
   VectorXs m_q;
   // Format: vx0, vy0, omega0, vx1, vy1, omega1, ...
   VectorXs m_v;
   SparseMatrixsc m_M;
   SparseMatrixsc m_Minv;
+  BlockDiagonalMass m_M_blocks;
+  BlockDiagonalMass m_Minv_blocks;
   std::vector<bool> m_fixed;
   VectorXu m_geometry_indices;
   std::vector<std::unique_ptr<RigidBody2DGeometry>> m_geometry;
   std::vector<std::unique_ptr<RigidBody2DForce>> m_forces;
   std::vector<RigidBody2DStaticPlane> m_planes;
   std::vector<PlanarPortal> m_planar_portals;
+  BroadPhase m_broad_phase = BroadPhase::SPATIAL_GRID;
 
 };
 
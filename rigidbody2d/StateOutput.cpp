@@ -113,7 +113,7 @@ static void writeCircleGeometry( const std::vector<std::unique_ptr<RigidBody2DGe
   const HDFGID grp_id{ output_file.findOrCreateGroup( group ) };
 
   // Create an HDF5 dataset
-  const HDFDID data_set{ H5Dcreate2( grp_id, "circles", struct_tid, data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
+  const HDFDID data_set{ H5Dcreate2( grp_id, "circles", output_file.storageType( struct_tid ), data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
   if( data_set < 0 )
   {
     throw std::string{ "Failed to create HDF dataset for circle geometry" };
@@ -202,7 +202,7 @@ static void writeBoxGeometry( const std::vector<std::unique_ptr<RigidBody2DGeome
   const HDFGID grp_id{ output_file.findOrCreateGroup( group ) };
 
   // Create an HDF5 dataset
-  const HDFDID data_set{ H5Dcreate2( grp_id, "boxes", struct_tid, data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
+  const HDFDID data_set{ H5Dcreate2( grp_id, "boxes", output_file.storageType( struct_tid ), data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
   if( data_set < 0 )
   {
     throw std::string{ "Failed to create HDF dataset for box geometry" };
@@ -328,7 +328,7 @@ void RigidBody2DStateOutput::writeStaticPlanes( const std::vector<RigidBody2DSta
   const HDFGID grp_id{ output_file.findOrCreateGroup( group ) };
 
   // Create an HDF5 dataset
-  const HDFDID data_set{ H5Dcreate2( grp_id, "static_planes", struct_tid, data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
+  const HDFDID data_set{ H5Dcreate2( grp_id, "static_planes", output_file.storageType( struct_tid ), data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
   if( data_set < 0 )
   {
     throw std::string{ "Failed to create HDF dataset for static planes" };
@@ -468,7 +468,7 @@ void RigidBody2DStateOutput::writePlanarPortals( const std::vector<PlanarPortal>
   const HDFGID grp_id{ output_file.findOrCreateGroup( group ) };
 
   // Create an HDF5 dataset
-  const HDFDID data_set{ H5Dcreate2( grp_id, "planar_portals", struct_tid, data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
+  const HDFDID data_set{ H5Dcreate2( grp_id, "planar_portals", output_file.storageType( struct_tid ), data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
   if( data_set < 0 )
   {
     throw std::string{ "Failed to create HDF dataset for planar portals" };
@@ -6,8 +6,6 @@
 #ifndef RIGID_BODY_2D_STATE_OUTPUT_H
 #define RIGID_BODY_2D_STATE_OUTPUT_H
 
-// TODO: Template on float/double type, add cmake option to dump contents as float
-
 #include <vector>
 #include <iosfwd>
 #include <memory>
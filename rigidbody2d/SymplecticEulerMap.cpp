@@ -6,6 +6,7 @@
 #include "SymplecticEulerMap.h"
 
 #include "scisim/UnconstrainedMaps/FlowableSystem.h"
+#include "scisim/Math/BlockDiagonalMass.h"
 
 SymplecticEulerMap::SymplecticEulerMap( std::istream& input_stream )
 {
@@ -31,7 +32,8 @@ void SymplecticEulerMap::flow( const VectorXs& q0, const VectorXs& v0, FlowableS
   }
 
   // Velocity update
-  v1 = v0 + dt * fsys.Minv() * q1;
+  fsys.MinvBlocks().multiply( q1, v1 );
+  v1 = v0 + dt * v1;
 
   // Position update
   q1 = q0 + dt * v1;
@@ -6,6 +6,7 @@
 #include "VerletMap.h"
 
 #include "scisim/UnconstrainedMaps/FlowableSystem.h"
+#include "scisim/Math/BlockDiagonalMass.h"
 
 VerletMap::VerletMap( std::istream& input_stream )
 {
@@ -41,7 +42,9 @@ void VerletMap::flow( const VectorXs& q0, const VectorXs& v0, FlowableSystem& fs
   zeroForcesOnKinematicBodies( fsys, F );
 
   // v1/2 = v0 + (1/2) h a0
-  v1 = v0 + 0.5 * dt * fsys.Minv() * F;
+  VectorXs a{ N };
+  fsys.MinvBlocks().multiply( F, a );
+  v1 = v0 + 0.5 * dt * a;
 
   // q1 = q0 + h v0 + (1/2) h^2 a0
   q1 = q0 + dt * v1;
@@ -51,7 +54,8 @@ void VerletMap::flow( const VectorXs& q0, const VectorXs& v0, FlowableSystem& fs
   zeroForcesOnKinematicBodies( fsys, F );
 
   // v1 = v0 + (1/2) h ( a0 + a1 )
-  v1 += 0.5 * dt * fsys.Minv() * F;
+  fsys.MinvBlocks().multiply( F, a );
+  v1 += 0.5 * dt * a;
 }
 
 std::string VerletMap::name() const
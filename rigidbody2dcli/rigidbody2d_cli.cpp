@@ -7,6 +7,8 @@
 #include <iomanip>
 #include <fstream>
 #include <getopt.h>
+#include <mutex>
+#include <sstream>
 
 #include "scisim/Math/MathDefines.h"
 #include "scisim/Math/MathUtilities.h"
@@ -15,6 +17,7 @@
 #include "scisim/CompileDefinitions.h"
 #include "scisim/ConstrainedMaps/ImpactFrictionMap.h"
 #include "scisim/Timer/TimeUtils.h"
+#include "scisim/Timer/Profiler.h"
 #include "scisim/ConstrainedMaps/ConstrainedMapUtilities.h"
 #include "scisim/UnconstrainedMaps/UnconstrainedMap.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/ImpactMap.h"
@@ -22,6 +25,7 @@
 #include "scisim/ConstrainedMaps/FrictionSolver.h"
 #include "scisim/Utilities.h"
 #include "scisim/PythonTools.h"
+#include "scisim/AsyncWriter.h"
 
 #include "rigidbody2d/RigidBody2DSim.h"
 #include "rigidbody2d/RigidBody2DUtilities.h"
@@ -31,6 +35,7 @@
 
 #ifdef USE_HDF5
 #include "scisim/HDF5File.h"
+#include "scisim/HDF5TimeSeries.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/ImpactSolution.h"
 #endif
 
@@ -50,6 +55,11 @@ static PythonScripting g_scripting;
 #ifdef USE_HDF5
 static std::string g_output_dir_name;
 static bool g_output_forces{ false };
+// Deflate level of the single output file holding every frame, or negative to save each frame to its own file
+static int g_single_file_compression{ -1 };
+static HDF5TimeSeries g_time_series;
+// Precision at which floating point simulation data are saved
+static HDF5FloatPrecision g_output_precision{ HDF5FloatPrecision::DOUBLE };
 #endif
 // Number of timesteps between saves
 static unsigned g_steps_per_save{ 0 };
@@ -61,6 +71,18 @@ static unsigned g_save_number_width{ 0 };
 static bool g_serialize_snapshots{ false };
 static bool g_overwrite_snapshots{ true };
 
+// Directory that receives the LCP of each impact solve, if set
+static std::string g_lcp_capture_dir_name;
+
+// Writes output on a background thread when given a nonzero queue depth
+static AsyncWriter g_output_writer;
+
+#ifdef USE_PROFILING
+// Destination of the per step timings and counters, if profiling
+static std::string g_profile_file_name;
+static std::ofstream g_profile_stream;
+#endif
+
 // Magic number to print in front of binary output to aid in debugging
 static constexpr unsigned MAGIC_BINARY_NUMBER{ 1337 };
 
@@ -154,8 +176,84 @@ static std::string generateSimulationTimeString()
 }
 
 #ifdef USE_HDF5
+// With asynchronous output, files are built in memory and written to disk by the writer thread
+static HDF5AccessType outputAccessType()
+{
+  return g_output_writer.threaded() ? HDF5AccessType::IN_MEMORY : HDF5AccessType::READ_WRITE;
+}
+
+static void submitFileImage( const std::string& file_name, std::string file_image )
+{
+  if( g_output_writer.threaded() )
+  {
+    g_output_writer.submit( [file_name, file_image = std::move( file_image )]{ AsyncWriter::writeFile( file_name, file_image ); } );
+  }
+}
+
+static int appendState()
+{
+  const std::string output_file_name{ g_output_dir_name + "/config.h5" };
+
+  // Print a status message with the simulation time and output number
+  std::cout << "Saving state at time " << generateSimulationTimeString() << " to " << output_file_name << " frame " << g_output_frame;
+  std::cout << "        " << TimeUtils::currentTime() << std::endl;
+
+  try
+  {
+    HDF5TimeSeries::PendingFrame frame;
+    {
+      // With asynchronous output only the first frame, which opens the file and writes static data, calls into HDF5
+      // on this thread; later frames are copied and appended by the writer thread
+      std::unique_lock<std::mutex> hdf5_lock{ HDF5File::libraryMutex(), std::defer_lock };
+      if( !g_time_series.is_open() )
+      {
+        hdf5_lock.lock();
+        // A resumed simulation discards frames saved after its snapshot
+        g_time_series.open( output_file_name, unsigned( g_single_file_compression ), g_output_frame != 0, g_output_frame, g_output_precision );
+        g_time_series.deferAppends( g_output_writer.threaded() );
+      }
+      // Save the iteration and time step and time
+      g_time_series.beginFrame( g_iteration, scalar( g_dt ) * g_iteration, scalar( g_dt ) );
+      if( g_time_series.numFrames() == 1 )
+      {
+        g_time_series.file().write( "git_hash", CompileDefinitions::GitSHA1 );
+        g_time_series.file().write( "float_precision", HDF5File::floatPrecisionName( g_output_precision ) );
+      }
+      // Write out the simulation data
+      g_sim.writeBinaryState( g_time_series );
+      if( g_output_writer.threaded() )
+      {
+        frame = g_time_series.takePendingFrame();
+      }
+      else
+      {
+        g_time_series.flush();
+      }
+    }
+    if( g_output_writer.threaded() )
+    {
+      g_output_writer.submit( [frame = std::move( frame )]
+      {
+        const std::lock_guard<std::mutex> hdf5_lock{ HDF5File::libraryMutex() };
+        g_time_series.writePendingFrame( frame );
+      } );
+    }
+  }
+  catch( const std::string& error )
+  {
+    std::cerr << error << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
 static int saveState()
 {
+  if( g_single_file_compression >= 0 )
+  {
+    return appendState();
+  }
+
   // Generate a base filename
   const std::string output_file_name{ generateOutputConfigurationDataFileName( "config", "h5" ) };
 
@@ -166,17 +264,29 @@ static int saveState()
   // Save the simulation state
   try
   {
-    HDF5File output_file{ output_file_name, HDF5AccessType::READ_WRITE };
-    // Save the iteration and time step and time
-    output_file.write( "timestep", scalar( g_dt ) );
-    output_file.write( "iteration", g_iteration );
-    output_file.write( "time", scalar( g_dt ) * g_iteration );
-    // Save out the git hash
-    output_file.write( "git_hash", CompileDefinitions::GitSHA1 );
-    // Save the real time
-    //output_file.writeString( "/run_stats", "real_time", TimeUtils::currentTime() );
-    // Write out the simulation data
-    g_sim.writeBinaryState( output_file );
+    std::string file_image;
+    {
+      const std::lock_guard<std::mutex> hdf5_lock{ HDF5File::libraryMutex() };
+      HDF5File output_file{ output_file_name, outputAccessType() };
+      // Save the iteration and time step and time
+      output_file.write( "timestep", scalar( g_dt ) );
+      output_file.write( "iteration", g_iteration );
+      output_file.write( "time", scalar( g_dt ) * g_iteration );
+      // Save out the git hash
+      output_file.write( "git_hash", CompileDefinitions::GitSHA1 );
+      output_file.write( "float_precision", HDF5File::floatPrecisionName( g_output_precision ) );
+      // The header above is always saved at full precision
+      output_file.setFloatPrecision( g_output_precision );
+      // Save the real time
+      //output_file.writeString( "/run_stats", "real_time", TimeUtils::currentTime() );
+      // Write out the simulation data
+      g_sim.writeBinaryState( output_file );
+      if( g_output_writer.threaded() )
+      {
+        file_image = output_file.image();
+      }
+    }
+    submitFileImage( output_file_name, std::move( file_image ) );
   }
   catch( const std::string& error )
   {
@@ -196,9 +306,15 @@ static int serializeSystem()
   std::cout << "Serializing: " << generateSimulationTimeString() << " to " << serialized_file_name;
   std::cout << "        " << TimeUtils::currentTime() << std::endl;
 
-  // Attempt to open the output file
-  std::ofstream serial_stream( serialized_file_name, std::ios::binary );
-  if( !serial_stream.is_open() )
+  // With asynchronous output the snapshot is serialized to memory and written to disk by the writer thread
+  std::ostringstream serial_buffer;
+  std::ofstream serial_file;
+  if( !g_output_writer.threaded() )
+  {
+    serial_file.open( serialized_file_name, std::ios::binary );
+  }
+  std::ostream& serial_stream{ g_output_writer.threaded() ? static_cast<std::ostream&>( serial_buffer ) : serial_file };
+  if( !g_output_writer.threaded() && !serial_file.is_open() )
   {
     std::cerr << "Failed to open serialization file: " << serialized_file_name << std::endl;
     std::cerr << "Exiting." << std::endl;
@@ -230,6 +346,8 @@ static int serializeSystem()
   #ifdef USE_HDF5
   StringUtilities::serialize( g_output_dir_name, serial_stream );
   Utilities::serialize( g_output_forces, serial_stream );
+  Utilities::serialize( g_single_file_compression, serial_stream );
+  Utilities::serialize( g_output_precision == HDF5FloatPrecision::SINGLE, serial_stream );
   #endif
   Utilities::serialize( g_steps_per_save, serial_stream );
   Utilities::serialize( g_output_frame, serial_stream );
@@ -238,6 +356,19 @@ static int serializeSystem()
   Utilities::serialize( g_serialize_snapshots, serial_stream );
   Utilities::serialize( g_overwrite_snapshots, serial_stream );
 
+  if( g_output_writer.threaded() )
+  {
+    try
+    {
+      g_output_writer.submit( [serialized_file_name, serial_data = serial_buffer.str()]{ AsyncWriter::writeFile( serialized_file_name, serial_data ); } );
+    }
+    catch( const std::string& error )
+    {
+      std::cerr << error << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
   return EXIT_SUCCESS;
 }
 
@@ -295,6 +426,8 @@ static int deserializeSystem( const std::string& file_name )
   #ifdef USE_HDF5
   g_output_dir_name = StringUtilities::deserialize( serial_stream );
   g_output_forces = Utilities::deserialize<bool>( serial_stream );
+  g_single_file_compression = Utilities::deserialize<int>( serial_stream );
+  g_output_precision = Utilities::deserialize<bool>( serial_stream ) ? HDF5FloatPrecision::SINGLE : HDF5FloatPrecision::DOUBLE;
   #endif
   g_steps_per_save = Utilities::deserialize<unsigned>( serial_stream );
   g_output_frame = Utilities::deserialize<unsigned>( serial_stream );
@@ -308,6 +441,7 @@ static int deserializeSystem( const std::string& file_name )
 
 static int exportConfigurationData()
 {
+  SCISIM_PROFILE_SCOPE( ProfilePhase::OUTPUT );
   assert( g_steps_per_save != 0 );
   if( g_iteration % g_steps_per_save == 0 )
   {
@@ -340,38 +474,59 @@ static std::string generateOutputConstraintForceDataFileName()
   ss << g_output_dir_name << "/forces_" << std::setfill('0') << std::setw( g_save_number_width ) << g_output_frame - 1 << ".h5";
   return ss.str();
 }
-#endif
 
-static int stepSystem()
+static int saveForces( ImpactSolution& impact_solution )
 {
-  const unsigned next_iter{ g_iteration + 1 };
-
-  #ifdef USE_HDF5
-  HDF5File force_file;
-  assert( g_steps_per_save != 0 );
-  if( g_output_forces && g_iteration % g_steps_per_save == 0 )
+  SCISIM_PROFILE_SCOPE( ProfilePhase::OUTPUT );
+  assert( !g_output_dir_name.empty() );
+  const std::string constraint_force_file_name{ generateOutputConstraintForceDataFileName() };
+  std::cout << "Saving forces at time " << generateSimulationTimeString() << " to " << constraint_force_file_name << std::endl;
+  try
   {
-    assert( !g_output_dir_name.empty() );
-    const std::string constraint_force_file_name{ generateOutputConstraintForceDataFileName() };
-    std::cout << "Saving forces at time " << generateSimulationTimeString() << " to " << constraint_force_file_name << std::endl;
-    try
+    std::string file_image;
     {
-      force_file.open( constraint_force_file_name, HDF5AccessType::READ_WRITE );
+      const std::lock_guard<std::mutex> hdf5_lock{ HDF5File::libraryMutex() };
+      HDF5File force_file{ constraint_force_file_name, outputAccessType() };
       // Save the iteration and time step and time
       force_file.write( "timestep", scalar( g_dt ) );
       force_file.write( "iteration", g_iteration );
       force_file.write( "time", scalar( g_dt ) * g_iteration );
       // Save out the git hash
       force_file.write( "git_hash", CompileDefinitions::GitSHA1 );
+      force_file.write( "float_precision", HDF5File::floatPrecisionName( g_output_precision ) );
+      // The header above is always saved at full precision
+      force_file.setFloatPrecision( g_output_precision );
       // Save the real time
       //force_file.writeString( "/run_stats", "real_time", TimeUtils::currentTime() );
+      impact_solution.writeSolution( force_file );
+      if( g_output_writer.threaded() )
+      {
+        file_image = force_file.image();
+      }
     }
-    catch( const std::string& error )
-    {
-      std::cerr << error << std::endl;
-      return EXIT_FAILURE;
-    }
+    submitFileImage( constraint_force_file_name, std::move( file_image ) );
   }
+  catch( const std::string& error )
+  {
+    std::cerr << error << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+#endif
+
+static int stepSystem()
+{
+  const unsigned next_iter{ g_iteration + 1 };
+  #ifdef USE_PROFILING
+  const ProfiledStep profiled_step{ next_iter };
+  #endif
+
+  #ifdef USE_HDF5
+  // Impulses applied in this step are saved with the last saved configuration
+  assert( g_steps_per_save != 0 );
+  const bool save_forces{ g_output_forces && g_iteration % g_steps_per_save == 0 };
+  ImpactSolution impact_solution;
   #endif
 
   if( g_unconstrained_map == nullptr && g_impact_operator == nullptr && g_impact_map == nullptr && g_friction_solver == nullptr && g_impact_friction_map == nullptr )
@@ -386,34 +541,19 @@ static int stepSystem()
   {
     assert( g_impact_map != nullptr );
     #ifdef USE_HDF5
-    ImpactSolution impact_solution;
-    if( force_file.is_open() )
+    if( save_forces )
     {
       g_impact_map->exportForcesNextStep( impact_solution );
     }
     #endif
     g_sim.flow( g_scripting, next_iter, g_dt, *g_unconstrained_map, *g_impact_operator, g_CoR, *g_impact_map );
-    #ifdef USE_HDF5
-    if( force_file.is_open() )
-    {
-      try
-      {
-        impact_solution.writeSolution( force_file );
-      }
-      catch( const std::string& error )
-      {
-        std::cerr << error << std::endl;
-        return EXIT_FAILURE;
-      }
-    }
-    #endif
   }
   else if( g_unconstrained_map != nullptr && g_impact_operator == nullptr && g_impact_map == nullptr && g_friction_solver != nullptr && g_impact_friction_map != nullptr )
   {
     #ifdef USE_HDF5
-    if( force_file.is_open() )
+    if( save_forces )
     {
-      g_impact_friction_map->exportForcesNextStep( force_file );
+      g_impact_friction_map->exportForcesNextStep( impact_solution );
     }
     #endif
     g_sim.flow( g_scripting, next_iter, g_dt, *g_unconstrained_map, g_CoR, g_mu, *g_friction_solver, *g_impact_friction_map );
@@ -424,13 +564,31 @@ static int stepSystem()
     return EXIT_FAILURE;
   }
 
+  #ifdef USE_HDF5
+  if( save_forces && saveForces( impact_solution ) == EXIT_FAILURE )
+  {
+    return EXIT_FAILURE;
+  }
+  #endif
+
   ++g_iteration;
 
   return exportConfigurationData();
 }
 
-static int executeSimLoop()
+static int runSimLoop()
 {
+  if( !g_lcp_capture_dir_name.empty() )
+  {
+    // Only the impact map captures problems; impact-friction maps solve a different problem
+    if( g_impact_map == nullptr )
+    {
+      std::cerr << "Error, -c/--capture_lcps requires a scene with an impact operator and no friction. Exiting." << std::endl;
+      return EXIT_FAILURE;
+    }
+    g_impact_map->captureProblems( g_lcp_capture_dir_name );
+  }
+
   if( exportConfigurationData() == EXIT_FAILURE )
   {
     return EXIT_FAILURE;
@@ -466,6 +624,28 @@ static int executeSimLoop()
   }
 }
 
+static int executeSimLoop()
+{
+  const int status{ runSimLoop() };
+  // Wait for the writer thread to save the remaining output
+  try
+  {
+    g_output_writer.finish();
+  }
+  catch( const std::string& error )
+  {
+    std::cerr << error << std::endl;
+    return EXIT_FAILURE;
+  }
+  #ifdef USE_PROFILING
+  if( Profiler::enabled() )
+  {
+    Profiler::writeSummary( std::cout );
+  }
+  #endif
+  return status;
+}
+
 static void printUsage( const std::string& executable_name )
 {
   std::cout << "Usage: " << executable_name << " xml_scene_file_name [options]" << std::endl;
@@ -476,9 +656,16 @@ static void printUsage( const std::string& executable_name )
   #ifdef USE_HDF5
   std::cout << "   -i/--impulses            : saves impulses in addition to configuration if an output directory is set" << std::endl;
   std::cout << "   -o/--output_dir dir      : saves simulation state to the given directory" << std::endl;
+  std::cout << "   -z/--single_file level   : saves all frames to config.h5 in the output directory instead of one file per frame, compressed with the given deflate level from 0 (none) to 9" << std::endl;
+  std::cout << "   -p/--precision type      : saves floating point state and forces as single or double precision; defaults to double" << std::endl;
   #endif
   std::cout << "   -f/--frequency integer   : rate at which to save simulation data, in Hz; ignored if no output directory specified" << std::endl;
+  std::cout << "   -c/--capture_lcps dir    : saves the LCP of each impact solve to the given directory for replay with lcp_bench; requires a scene without friction" << std::endl;
   std::cout << "   -s/--serialize_snapshots bool : save a bit identical, resumable snapshot; if 0 overwrites the snapshot each timestep, if 1 saves a new snapshot for each timestep" << std::endl;
+  std::cout << "   -a/--async_output depth  : saves output on a background thread while the simulation continues, blocking once depth frames wait to be written; 2 gives triple buffering" << std::endl;
+  #ifdef USE_PROFILING
+  std::cout << "   -t/--profile file        : saves the time of each phase of each timestep and counts of contacts, islands, and solver iterations to the given file as csv, or as json lines if the file name ends in .json, and prints a summary at exit" << std::endl;
+  #endif
 }
 
 static bool parseCommandLineOptions( int* argc, char*** argv, bool& help_mode_enabled, scalar& end_time_override, unsigned& output_frequency, std::string& serialized_file_name )
@@ -492,18 +679,29 @@ static bool parseCommandLineOptions( int* argc, char*** argv, bool& help_mode_en
     #ifdef USE_HDF5
     { "impulses", no_argument, nullptr, 'i' },
     { "output_dir", required_argument, nullptr, 'o' },
+    { "single_file", required_argument, nullptr, 'z' },
+    { "precision", required_argument, nullptr, 'p' },
     #endif
     { "frequency", required_argument, nullptr, 'f' },
+    { "capture_lcps", required_argument, nullptr, 'c' },
+    { "async_output", required_argument, nullptr, 'a' },
+    #ifdef USE_PROFILING
+    { "profile", required_argument, nullptr, 't' },
+    #endif
     { nullptr, 0, nullptr, 0 }
   };
 
   while( true )
   {
     int option_index = 0;
-    #ifdef USE_HDF5
-    constexpr char command_line_options[]{ "his:r:e:o:f:" };
+    #if defined( USE_HDF5 ) && defined( USE_PROFILING )
+    constexpr char command_line_options[]{ "his:r:e:o:f:c:z:p:a:t:" };
+    #elif defined( USE_HDF5 )
+    constexpr char command_line_options[]{ "his:r:e:o:f:c:z:p:a:" };
+    #elif defined( USE_PROFILING )
+    constexpr char command_line_options[]{ "hs:r:e:f:c:a:t:" };
     #else
-    constexpr char command_line_options[]{ "hs:r:e:f:" };
+    constexpr char command_line_options[]{ "hs:r:e:f:c:a:" };
     #endif
     const int c{ getopt_long( *argc, *argv, command_line_options, long_options, &option_index ) };
     if( c == -1 )
@@ -558,6 +756,33 @@ static bool parseCommandLineOptions( int* argc, char*** argv, bool& help_mode_en
         g_output_dir_name = optarg;
         break;
       }
+      case 'z':
+      {
+        if( !StringUtilities::extractFromString( optarg, g_single_file_compression ) || g_single_file_compression < 0 || g_single_file_compression > 9 )
+        {
+          std::cerr << "Failed to read value for argument for -z/--single_file. Value must be an integer between 0 and 9." << std::endl;
+          return false;
+        }
+        break;
+      }
+      case 'p':
+      {
+        const std::string precision{ optarg };
+        if( precision == HDF5File::floatPrecisionName( HDF5FloatPrecision::SINGLE ) )
+        {
+          g_output_precision = HDF5FloatPrecision::SINGLE;
+        }
+        else if( precision == HDF5File::floatPrecisionName( HDF5FloatPrecision::DOUBLE ) )
+        {
+          g_output_precision = HDF5FloatPrecision::DOUBLE;
+        }
+        else
+        {
+          std::cerr << "Failed to read value for argument for -p/--precision. Value must be single or double." << std::endl;
+          return false;
+        }
+        break;
+      }
       #endif
       case 'f':
       {
@@ -568,6 +793,29 @@ static bool parseCommandLineOptions( int* argc, char*** argv, bool& help_mode_en
         }
         break;
       }
+      case 'c':
+      {
+        g_lcp_capture_dir_name = optarg;
+        break;
+      }
+      case 'a':
+      {
+        unsigned output_queue_depth;
+        if( !StringUtilities::extractFromString( optarg, output_queue_depth ) )
+        {
+          std::cerr << "Failed to read value for argument for -a/--async_output. Value must be an unsigned integer." << std::endl;
+          return false;
+        }
+        g_output_writer.setMaxPending( output_queue_depth );
+        break;
+      }
+      #ifdef USE_PROFILING
+      case 't':
+      {
+        g_profile_file_name = optarg;
+        break;
+      }
+      #endif
       case '?':
       {
         return false;
@@ -618,6 +866,27 @@ int main( int argc, char** argv )
     std::cerr << "Impulse output requires an output directory." << std::endl;
     return EXIT_FAILURE;
   }
+  if( g_single_file_compression >= 0 && g_output_dir_name.empty() )
+  {
+    std::cerr << "Single file output requires an output directory." << std::endl;
+    return EXIT_FAILURE;
+  }
+  #endif
+
+  #ifdef USE_PROFILING
+  if( !g_profile_file_name.empty() )
+  {
+    g_profile_stream.open( g_profile_file_name );
+    if( !g_profile_stream.is_open() )
+    {
+      std::cerr << "Failed to open profile file " << g_profile_file_name << "." << std::endl;
+      return EXIT_FAILURE;
+    }
+    std::string profile_base_name;
+    std::string profile_extension;
+    StringUtilities::splitAtLastCharacterOccurence( g_profile_file_name, profile_base_name, profile_extension, '.' );
+    Profiler::enable( &g_profile_stream, profile_extension == "json" ? ProfileFormat::JSON : ProfileFormat::CSV );
+  }
   #endif
 
   #ifdef USE_PYTHON
@@ -5,7 +5,9 @@
 
 #include "BodyBodyConstraint.h"
 
-#include "FrictionUtilities.h"
+#include "scisim/Constraints/ContactBatch.h"
+
+#include "scisim/Constraints/FrictionUtilities.h"
 
 #ifndef NDEBUG
 #include "scisim/Math/MathUtilities.h"
@@ -60,6 +62,14 @@ void BodyBodyConstraint::evalgradg( const VectorXs& q, const int col, SparseMatr
   }
 }
 
+bool BodyBodyConstraint::addToContactBatch( const VectorXs& q, ContactBatch& batch ) const
+{
+  assert( q.size() % 12 == 0 );
+  const unsigned nbodies{ static_cast<unsigned>( q.size() / 12 ) };
+  batch.addContact( ContactBatch::Kind::Body, int( 3 * m_idx0 ), int( 3 * ( nbodies + m_idx0 ) ), m_r0, int( 3 * m_idx1 ), int( 3 * ( nbodies + m_idx1 ) ), m_r1, m_n, Vector3s::Zero() );
+  return true;
+}
+
 void BodyBodyConstraint::computeGeneralizedFrictionDisk( const VectorXs& q, const VectorXs& v, const int start_column, const int num_samples, SparseMatrixsc& D, VectorXs& drel ) const
 {
   assert( start_column >= 0 );
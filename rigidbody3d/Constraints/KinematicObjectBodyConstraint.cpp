@@ -5,7 +5,8 @@
 
 #include "KinematicObjectBodyConstraint.h"
 
-#include "FrictionUtilities.h"
+#include "scisim/Constraints/ContactBatch.h"
+#include "scisim/Constraints/FrictionUtilities.h"
 
 #ifndef NDEBUG
 #include "scisim/Math/MathUtilities.h"
@@ -47,6 +48,15 @@ void KinematicObjectBodyConstraint::evalgradg( const VectorXs& q, const int col,
   G.insert( 3 * ( m_bdy_idx + nbodies ) + 2, col ) = ntilde.z();
 }
 
+bool KinematicObjectBodyConstraint::addToContactBatch( const VectorXs& q, ContactBatch& batch ) const
+{
+  assert( q.size() % 12 == 0 );
+  const unsigned nbodies{ static_cast<unsigned>( q.size() / 12 ) };
+  // No kinematic contribution, as in computeKinematicRelativeVelocity
+  batch.addContact( ContactBatch::Kind::Body, int( 3 * m_bdy_idx ), int( 3 * ( nbodies + m_bdy_idx ) ), m_r, -1, -1, Vector3s::Zero(), m_n, Vector3s::Zero() );
+  return true;
+}
+
 void KinematicObjectBodyConstraint::computeGeneralizedFrictionGivenTangentSample( const VectorXs& q, const VectorXs& t, const unsigned column, SparseMatrixsc& D ) const
 {
   assert( column < unsigned( D.cols() ) );
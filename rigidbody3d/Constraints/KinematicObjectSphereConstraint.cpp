@@ -1,6 +1,7 @@
 #include "KinematicObjectSphereConstraint.h"
 
-#include "FrictionUtilities.h"
+#include "scisim/Constraints/ContactBatch.h"
+#include "scisim/Constraints/FrictionUtilities.h"
 #ifndef NDEBUG
 #include "scisim/Math/MathUtilities.h"
 #endif
@@ -37,6 +38,16 @@ void KinematicObjectSphereConstraint::evalgradg( const VectorXs& q, const int co
   G.insert( 3 * m_sphere_idx + 2, col ) = m_n.z();
 }
 
+bool KinematicObjectSphereConstraint::addToContactBatch( const VectorXs& q, ContactBatch& batch ) const
+{
+  assert( q.size() % 12 == 0 );
+  const unsigned nbodies{ static_cast<unsigned>( q.size() / 12 ) };
+  const Vector3s r{ - m_r * m_n };
+  // No kinematic contribution, as in computeKinematicRelativeVelocity
+  batch.addContact( ContactBatch::Kind::Sphere, int( 3 * m_sphere_idx ), int( 3 * ( nbodies + m_sphere_idx ) ), r, -1, -1, Vector3s::Zero(), m_n, Vector3s::Zero() );
+  return true;
+}
+
 void KinematicObjectSphereConstraint::computeGeneralizedFrictionGivenTangentSample( const VectorXs& q, const VectorXs& t, const unsigned column, SparseMatrixsc& D ) const
 {
   assert( column < unsigned( D.cols() ) );
@@ -7,61 +7,64 @@
 
 #include "rigidbody3d/Geometry/RigidBodyTriangleMesh.h"
 
-void MeshMeshUtilities::computeActiveSet( const Vector3s& cm0, const Matrix33sr& R0, const RigidBodyTriangleMesh& mesh0,
-                                          const Vector3s& cm1, const Matrix33sr& R1, const RigidBodyTriangleMesh& mesh1,
-                                          std::vector<Vector3s>& p, std::vector<Vector3s>& n )
+// Tests the surface samples of mesh_a against the distance field of mesh_b. Only samples inside the bounds of
+// mesh_b's grid, found with mesh_a's sample tree, are transformed and interpolated. Contacts are appended in the
+// tree's spatial order with normals pointing from mesh_b towards mesh_a, times normal_sign.
+static void computeSampleActiveSet( const Vector3s& cm_a, const Matrix33sr& R_a, const RigidBodyTriangleMesh& mesh_a,
+                                    const Vector3s& cm_b, const Matrix33sr& R_b, const RigidBodyTriangleMesh& mesh_b,
+                                    const scalar& normal_sign, std::vector<Vector3s>& p, std::vector<Vector3s>& n )
 {
-  // mesh0 against mesh1
+  const Matrix3Xsc& samples_a{ mesh_a.samples() };
+  // Transformation to take points in mesh_a to mesh_b
+  const Matrix3s R_ab{ R_b.transpose() * R_a };
+  const Vector3s x_ab{ R_b.transpose() * ( cm_a - cm_b ) };
+
+  // Bound mesh_b's grid in mesh_a's frame, padded slightly so that rounding can not drop samples on its faces
+  std::vector<unsigned> candidates;
   {
-    const Matrix3Xsc& samples0{ mesh0.samples() };
-    // Transformation to take points in mesh0 to mesh1
-    const Matrix3s R01{ R1.transpose() * R0 };
-    const Vector3s x01{ R1.transpose() * ( cm0 - cm1 ) };
-    // For each surface sample of mesh0
-    for( int smp_num = 0; smp_num < samples0.cols(); ++smp_num )
-    {
-      // Transform mesh0's sample into mesh1's frame
-      const Vector3s x{ R01 * samples0.col( smp_num ) + x01 };
-      // Determine if a collision occurs
-      Vector3s normal;
-      const bool collision_occurs{ mesh1.detectCollision( x, normal ) };
-      // Cache out the world space collision point and normal if a collision happens
-      if( collision_occurs )
-      {
-        assert( fabs( normal.norm() - 1.0 ) <= 1.0e-6 );
-        assert( ( R1 * x + cm1 - R0 * samples0.col( smp_num ) - cm0 ).lpNorm<Eigen::Infinity>() <= 1.0e-6 );
-        // Transform the contact point and normal from mesh1's frame to world space
-        p.emplace_back( R1 * x + cm1 );
-        n.emplace_back( R1 * normal );
-      }
-    }
+    const Vector3s grid_center{ 0.5 * ( mesh_b.gridOrigin() + mesh_b.gridEnd() ) };
+    const Vector3s grid_half_extents{ 0.5 * ( mesh_b.gridEnd() - mesh_b.gridOrigin() ) };
+    const Array3s center{ R_ab.transpose() * ( grid_center - x_ab ) };
+    Array3s half_extents{ R_ab.transpose().cwiseAbs() * grid_half_extents };
+    half_extents += 1.0e-6 * half_extents.maxCoeff();
+    mesh_a.samplesInBox( center - half_extents, center + half_extents, candidates );
+  }
+  if( candidates.empty() )
+  {
+    return;
   }
 
-  // mesh1 against mesh0
+  // Transform the candidate samples into mesh_b's frame
+  Matrix3Xsc x{ 3, Matrix3Xsc::Index( candidates.size() ) };
+  for( std::vector<unsigned>::size_type cnd_num = 0; cnd_num < candidates.size(); ++cnd_num )
   {
-    const Matrix3Xsc& samples1{ mesh1.samples() };
-    // Transformation to take points in mesh1 to mesh0
-    const Matrix3s R10{ R0.transpose() * R1 };
-    const Vector3s x10{ R0.transpose() * ( cm1 - cm0 ) };
-    // For each surface sample of mesh1
-    for( int smp_num = 0; smp_num < samples1.cols(); ++smp_num )
-    {
-      // Transform mesh1's sample into mesh0's frame
-      const Vector3s x{ R10 * samples1.col( smp_num ) + x10 };
-      // Determine if a collision occurs
-      Vector3s normal;
-      const bool collision_occurs{ mesh0.detectCollision( x, normal ) };
-      // Cache out the world space collision point and normal if a collision happens
-      if( collision_occurs )
-      {
-        assert( fabs( normal.norm() - 1.0 ) <= 1.0e-6 );
-        assert( ( R0 * x + cm0 - R1 * samples1.col( smp_num ) - cm1 ).lpNorm<Eigen::Infinity>() <= 1.0e-6 );
-        // Transform the contact point and normal back to world space
-        p.emplace_back( R0 * x + cm0 );
-        n.emplace_back( - R0 * normal );
-      }
-    }
+    x.col( Matrix3Xsc::Index( cnd_num ) ) = R_ab * samples_a.col( candidates[cnd_num] ) + x_ab;
   }
+
+  // Determine which samples collide
+  std::vector<unsigned> colliding;
+  std::vector<Vector3s> normals;
+  mesh_b.detectCollisions( x, colliding, normals );
+  assert( colliding.size() == normals.size() );
+
+  // Cache out the world space collision points and normals
+  for( std::vector<unsigned>::size_type col_num = 0; col_num < colliding.size(); ++col_num )
+  {
+    assert( fabs( normals[col_num].norm() - 1.0 ) <= 1.0e-6 );
+    assert( ( R_b * x.col( colliding[col_num] ) + cm_b - R_a * samples_a.col( candidates[colliding[col_num]] ) - cm_a ).lpNorm<Eigen::Infinity>() <= 1.0e-6 );
+    p.emplace_back( R_b * x.col( colliding[col_num] ) + cm_b );
+    n.emplace_back( normal_sign * ( R_b * normals[col_num] ) );
+  }
+}
+
+void MeshMeshUtilities::computeActiveSet( const Vector3s& cm0, const Matrix33sr& R0, const RigidBodyTriangleMesh& mesh0,
+                                          const Vector3s& cm1, const Matrix33sr& R1, const RigidBodyTriangleMesh& mesh1,
+                                          std::vector<Vector3s>& p, std::vector<Vector3s>& n )
+{
+  // mesh0 against mesh1
+  computeSampleActiveSet( cm0, R0, mesh0, cm1, R1, mesh1, 1.0, p, n );
+  // mesh1 against mesh0
+  computeSampleActiveSet( cm1, R1, mesh1, cm0, R0, mesh0, -1.0, p, n );
 }
 
 void MeshMeshUtilities::computeMeshHalfPlaneActiveSet( const Vector3s& cm, const Matrix33sr& R, const RigidBodyTriangleMesh& mesh,
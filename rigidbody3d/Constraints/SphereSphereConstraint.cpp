@@ -1,6 +1,8 @@
 #include "SphereSphereConstraint.h"
 
-#include "FrictionUtilities.h"
+#include "scisim/Constraints/ContactBatch.h"
+
+#include "scisim/Constraints/FrictionUtilities.h"
 
 #ifndef NDEBUG
 #include "scisim/Math/MathUtilities.h"
@@ -85,6 +87,17 @@ void SphereSphereConstraint::evalgradg( const VectorXs& q, const int col, Sparse
   G.insert( 3 * m_idx1 + 2, col ) = -m_n.z();
 }
 
+bool SphereSphereConstraint::addToContactBatch( const VectorXs& q, ContactBatch& batch ) const
+{
+  assert( q.size() % 12 == 0 );
+  const unsigned nbodies{ static_cast<unsigned>( q.size() / 12 ) };
+  // Point of contact relative to each body's center of mass
+  const Vector3s r0{ m_p - q.segment<3>( 3 * m_idx0 ) };
+  const Vector3s r1{ m_p - q.segment<3>( 3 * m_idx1 ) };
+  batch.addContact( ContactBatch::Kind::Sphere, int( 3 * m_idx0 ), int( 3 * ( nbodies + m_idx0 ) ), r0, int( 3 * m_idx1 ), int( 3 * ( nbodies + m_idx1 ) ), r1, m_n, Vector3s::Zero() );
+  return true;
+}
+
 void SphereSphereConstraint::computeGeneralizedFrictionDisk( const VectorXs& q, const VectorXs& v, const int start_column, const int num_samples, SparseMatrixsc& D, VectorXs& drel ) const
 {
   assert( start_column >= 0 );
@@ -7,7 +7,7 @@
 
 #include "scisim/Math/MathUtilities.h"
 #include "rigidbody3d/StaticGeometry/StaticCylinder.h"
-#include "FrictionUtilities.h"
+#include "scisim/Constraints/FrictionUtilities.h"
 
 #include <iostream>
 
@@ -1,6 +1,6 @@
 #include "StaticCylinderSphereConstraint.h"
 
-#include "FrictionUtilities.h"
+#include "scisim/Constraints/FrictionUtilities.h"
 #include "rigidbody3d/StaticGeometry/StaticCylinder.h"
 
 #ifndef NDEBUG
@@ -5,7 +5,9 @@
 
 #include "StaticPlaneBodyConstraint.h"
 
-#include "FrictionUtilities.h"
+#include "scisim/Constraints/ContactBatch.h"
+
+#include "scisim/Constraints/FrictionUtilities.h"
 
 #ifndef NDEBUG
 #include "scisim/Math/MathUtilities.h"
@@ -72,6 +74,14 @@ void StaticPlaneBodyConstraint::evalgradg( const VectorXs& q, const int col, Spa
   }
 }
 
+bool StaticPlaneBodyConstraint::addToContactBatch( const VectorXs& q, ContactBatch& batch ) const
+{
+  assert( q.size() % 12 == 0 );
+  const unsigned nbodies{ static_cast<unsigned>( q.size() / 12 ) };
+  batch.addContact( ContactBatch::Kind::Body, int( 3 * m_idx_body ), int( 3 * ( nbodies + m_idx_body ) ), m_r, -1, -1, Vector3s::Zero(), m_n, Vector3s::Zero() );
+  return true;
+}
+
 void StaticPlaneBodyConstraint::computeGeneralizedFrictionDisk( const VectorXs& q, const VectorXs& v, const int start_column, const int num_samples, SparseMatrixsc& D, VectorXs& drel ) const
 {
   assert( start_column >= 0 );
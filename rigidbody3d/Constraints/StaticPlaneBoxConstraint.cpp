@@ -5,7 +5,7 @@
 
 #include "StaticPlaneBoxConstraint.h"
 
-#include "FrictionUtilities.h"
+#include "scisim/Constraints/FrictionUtilities.h"
 
 #ifndef NDEBUG
 #include "scisim/Math/MathUtilities.h"
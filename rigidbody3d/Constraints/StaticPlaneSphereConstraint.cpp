@@ -1,6 +1,8 @@
 #include "StaticPlaneSphereConstraint.h"
 
-#include "FrictionUtilities.h"
+#include "scisim/Constraints/ContactBatch.h"
+
+#include "scisim/Constraints/FrictionUtilities.h"
 
 #include "rigidbody3d/StaticGeometry/StaticPlane.h"
 
@@ -77,6 +79,15 @@ void StaticPlaneSphereConstraint::evalgradg( const VectorXs& q, const int col, S
   G.insert( 3 * m_sphere_idx + 2, col ) = n.z();
 }
 
+bool StaticPlaneSphereConstraint::addToContactBatch( const VectorXs& q, ContactBatch& batch ) const
+{
+  assert( q.size() % 12 == 0 );
+  const unsigned nbodies{ static_cast<unsigned>( q.size() / 12 ) };
+  const Vector3s r_sphere{ - m_r * m_plane.n() };
+  batch.addContact( ContactBatch::Kind::Sphere, int( 3 * m_sphere_idx ), int( 3 * ( nbodies + m_sphere_idx ) ), r_sphere, -1, -1, Vector3s::Zero(), m_plane.n(), computePlaneCollisionPointVelocity( q ) );
+  return true;
+}
+
 // This method and the smooth version share the second half of code. Abstract that out.
 void StaticPlaneSphereConstraint::computeGeneralizedFrictionDisk( const VectorXs& q, const VectorXs& v, const int start_column, const int num_samples, SparseMatrixsc& D, VectorXs& drel ) const
 {
@@ -12,12 +12,16 @@
 #include "scisim/HDF5File.h"
 #endif
 
+#include <array>
 #include <iostream>
 
+// Number of points interpolated together by detectCollisions
+static constexpr int s_batch_size{ 64 };
+
 // TODO: Make value return versions of HDF5 readMatrix
 // TODO: Call the HDF5 version from the thing below
 
-RigidBodyTriangleMesh::RigidBodyTriangleMesh( const std::string& input_file_name )
+RigidBodyTriangleMesh::RigidBodyTriangleMesh( const std::string& input_file_name, const SDFStorageOptions& sdf_options )
 : m_input_file_name( input_file_name )
 , m_verts()
 , m_faces()
@@ -27,11 +31,14 @@ RigidBodyTriangleMesh::RigidBodyTriangleMesh( const std::string& input_file_name
 , m_R()
 , m_samples()
 , m_convex_hull_samples()
+, m_sample_tree()
 , m_cell_delta()
 , m_grid_dimensions()
 , m_grid_origin()
 , m_signed_distance()
 , m_grid_end()
+, m_sdf_options( sdf_options )
+, m_compact_sdf()
 {
   #ifdef USE_HDF5
   HDF5File mesh_file( input_file_name, HDF5AccessType::READ_ONLY );
@@ -81,6 +88,7 @@ RigidBodyTriangleMesh::RigidBodyTriangleMesh( const std::string& input_file_name
 
   // Load the surface samples
   m_samples = mesh_file.read<Matrix3Xsc>( "surface_samples/samples" );
+  buildSampleTree();
 
   // Load the convex hull samples
   m_convex_hull_samples = mesh_file.read<Matrix3Xsc>( "convex_hull/vertices" );
@@ -91,11 +99,28 @@ RigidBodyTriangleMesh::RigidBodyTriangleMesh( const std::string& input_file_name
   m_grid_dimensions = mesh_file.read<Vector3u>( "sdf/grid_dimensions" );
   assert( ( m_grid_dimensions.array() >= 1 ).all() );
   m_grid_origin = mesh_file.read<Vector3s>( "sdf/grid_origin" );
-  m_signed_distance = mesh_file.read<VectorXs>( "sdf/signed_distance" );
-  if( !m_signed_distance.array().unaryExpr( []( const scalar& v ) { return std::isfinite( v ); } ).all() )
+  const auto load_signed_distance = [&mesh_file,&input_file_name]()
+  {
+    VectorXs signed_distance{ mesh_file.read<VectorXs>( "sdf/signed_distance" ) };
+    if( !signed_distance.array().unaryExpr( []( const scalar& v ) { return std::isfinite( v ); } ).all() )
+    {
+      std::cerr << "Error, signed distance field for " << input_file_name << " is not finite. Please check the settings used to prcoess the mesh. Exiting." << std::endl;
+      std::exit( EXIT_FAILURE );
+    }
+    return signed_distance;
+  };
+  if( !m_sdf_options.compact )
+  {
+    m_signed_distance = load_signed_distance();
+  }
+  else if( m_sdf_options.cache_directory.empty() )
+  {
+    m_compact_sdf = std::make_shared<const SignedDistanceField>( m_grid_dimensions, load_signed_distance(), m_sdf_options.precision, m_sdf_options.band );
+  }
+  else
   {
-    std::cerr << "Error, signed distance field for " << input_file_name << " is not finite. Please check the settings used to prcoess the mesh. Exiting." << std::endl;
-    std::exit( EXIT_FAILURE );
+    // The dense field is only read if the cache does not hold this mesh yet
+    m_compact_sdf = SignedDistanceField::loadCached( m_sdf_options.cache_directory, input_file_name, m_grid_dimensions, m_sdf_options.precision, m_sdf_options.band, load_signed_distance );
   }
 
   // For convienience, cache the opposite corner of the grid to the origin
@@ -116,12 +141,16 @@ RigidBodyTriangleMesh::RigidBodyTriangleMesh( std::istream& input_stream )
 , m_R( MathUtilities::deserialize<Matrix3s>( input_stream ) )
 , m_samples( MathUtilities::deserialize<Matrix3Xsc>( input_stream ) )
 , m_convex_hull_samples( MathUtilities::deserialize<Matrix3Xsc>( input_stream ) )
+, m_sample_tree()
 , m_cell_delta( MathUtilities::deserialize<Vector3s>( input_stream ) )
 , m_grid_dimensions( MathUtilities::deserialize<Vector3u>( input_stream ) )
 , m_grid_origin( MathUtilities::deserialize<Vector3s>( input_stream ) )
-, m_signed_distance( MathUtilities::deserialize<VectorXs>( input_stream ) )
+, m_signed_distance()
 , m_grid_end( MathUtilities::deserialize<Vector3s>( input_stream ) )
+, m_sdf_options()
+, m_compact_sdf()
 {
+  deserializeSignedDistance( input_stream );
   assert( ( m_faces.array() < unsigned( m_verts.cols() ) ).all() );
   // Verify that each vertex is part of a face
   #ifndef NDEBUG
@@ -157,6 +186,41 @@ RigidBodyTriangleMesh::RigidBodyTriangleMesh( std::istream& input_stream )
   #endif
   assert( ( m_cell_delta.array() > 0.0 ).all() );
   assert( ( m_grid_dimensions.array() >= 1 ).all() );
+  buildSampleTree();
+}
+
+void RigidBodyTriangleMesh::deserializeSignedDistance( std::istream& input_stream )
+{
+  m_sdf_options.compact = Utilities::deserialize<bool>( input_stream );
+  m_sdf_options.precision = Utilities::deserialize<SDFPrecision>( input_stream );
+  m_sdf_options.band = Utilities::deserialize<scalar>( input_stream );
+  m_sdf_options.cache_directory = StringUtilities::deserialize( input_stream );
+  if( !m_sdf_options.compact )
+  {
+    m_signed_distance = MathUtilities::deserialize<VectorXs>( input_stream );
+    return;
+  }
+  // Cached fields are stored by reference to the cache file
+  const bool cached{ Utilities::deserialize<bool>( input_stream ) };
+  if( cached )
+  {
+    m_compact_sdf = std::make_shared<const SignedDistanceField>( StringUtilities::deserialize( input_stream ) );
+  }
+  else
+  {
+    m_compact_sdf = std::make_shared<const SignedDistanceField>( input_stream );
+  }
+}
+
+void RigidBodyTriangleMesh::buildSampleTree()
+{
+  std::vector<AABB<3>> sample_aabbs( std::vector<AABB<3>>::size_type( m_samples.cols() ) );
+  for( int smp_num = 0; smp_num < m_samples.cols(); ++smp_num )
+  {
+    sample_aabbs[smp_num].min() = m_samples.col( smp_num ).array();
+    sample_aabbs[smp_num].max() = m_samples.col( smp_num ).array();
+  }
+  m_sample_tree.build( sample_aabbs );
 }
 
 RigidBodyGeometryType RigidBodyTriangleMesh::getType() const
@@ -176,11 +240,14 @@ std::unique_ptr<RigidBodyGeometry> RigidBodyTriangleMesh::clone() const
   otherMesh->m_R = m_R;
   otherMesh->m_samples = m_samples;
   otherMesh->m_convex_hull_samples = m_convex_hull_samples;
+  otherMesh->m_sample_tree = m_sample_tree;
   otherMesh->m_cell_delta = m_cell_delta;
   otherMesh->m_grid_dimensions = m_grid_dimensions;
   otherMesh->m_grid_origin = m_grid_origin;
   otherMesh->m_signed_distance = m_signed_distance;
   otherMesh->m_grid_end = m_grid_end;
+  otherMesh->m_sdf_options = m_sdf_options;
+  otherMesh->m_compact_sdf = m_compact_sdf;
   return std::unique_ptr<RigidBodyGeometry>{ otherMesh };
 }
 
@@ -227,8 +294,27 @@ void RigidBodyTriangleMesh::serialize( std::ostream& output_stream ) const
   MathUtilities::serialize( m_cell_delta, output_stream );
   MathUtilities::serialize( m_grid_dimensions, output_stream );
   MathUtilities::serialize( m_grid_origin, output_stream );
-  MathUtilities::serialize( m_signed_distance, output_stream );
   MathUtilities::serialize( m_grid_end, output_stream );
+  Utilities::serialize( m_sdf_options.compact, output_stream );
+  Utilities::serialize( m_sdf_options.precision, output_stream );
+  Utilities::serialize( m_sdf_options.band, output_stream );
+  StringUtilities::serialize( m_sdf_options.cache_directory, output_stream );
+  if( !m_sdf_options.compact )
+  {
+    MathUtilities::serialize( m_signed_distance, output_stream );
+    return;
+  }
+  assert( m_compact_sdf != nullptr );
+  const bool cached{ !m_compact_sdf->fileName().empty() };
+  Utilities::serialize( cached, output_stream );
+  if( cached )
+  {
+    StringUtilities::serialize( m_compact_sdf->fileName(), output_stream );
+  }
+  else
+  {
+    m_compact_sdf->serialize( output_stream );
+  }
 }
 
 scalar RigidBodyTriangleMesh::volume() const
@@ -266,11 +352,53 @@ const Matrix3Xsc& RigidBodyTriangleMesh::samples() const
   return m_samples;
 }
 
-const scalar& RigidBodyTriangleMesh::v( const unsigned i, const unsigned j, const unsigned k ) const
+const Vector3s& RigidBodyTriangleMesh::gridOrigin() const
 {
-  assert( i < m_grid_dimensions.x() ); assert( j < m_grid_dimensions.y() ); assert( k < m_grid_dimensions.z() );
-  assert( ( k * m_grid_dimensions.y() + j ) * m_grid_dimensions.x() + i < m_signed_distance.size() );
-  return m_signed_distance( ( k * m_grid_dimensions.y() + j ) * m_grid_dimensions.x() + i );
+  return m_grid_origin;
+}
+
+const Vector3s& RigidBodyTriangleMesh::gridEnd() const
+{
+  return m_grid_end;
+}
+
+const SDFStorageOptions& RigidBodyTriangleMesh::sdfStorageOptions() const
+{
+  return m_sdf_options;
+}
+
+void RigidBodyTriangleMesh::samplesInBox( const Array3s& min, const Array3s& max, std::vector<unsigned>& samples ) const
+{
+  m_sample_tree.queryUnordered( [&min,&max]( const Array3s& node_min, const Array3s& node_max )
+    {
+      return ( node_min <= max ).all() && ( node_max >= min ).all();
+    },
+    [&min,&max]( const Array3s& node_min, const Array3s& node_max )
+    {
+      return ( node_min >= min ).all() && ( node_max <= max ).all();
+    }, samples );
+}
+
+void RigidBodyTriangleMesh::cellCorners( const Array3u& cell, std::array<scalar,8>& corners ) const
+{
+  assert( ( cell + 1 < m_grid_dimensions.array() ).all() );
+  if( m_compact_sdf != nullptr )
+  {
+    m_compact_sdf->cellCorners( cell, corners );
+    return;
+  }
+  const unsigned stride_y{ m_grid_dimensions.x() };
+  const unsigned stride_z{ m_grid_dimensions.x() * m_grid_dimensions.y() };
+  const unsigned base{ cell.z() * stride_z + cell.y() * stride_y + cell.x() };
+  assert( base + stride_z + stride_y + 1 < m_signed_distance.size() );
+  corners[0] = m_signed_distance( base );
+  corners[1] = m_signed_distance( base + 1 );
+  corners[2] = m_signed_distance( base + stride_y );
+  corners[3] = m_signed_distance( base + stride_y + 1 );
+  corners[4] = m_signed_distance( base + stride_z );
+  corners[5] = m_signed_distance( base + stride_z + 1 );
+  corners[6] = m_signed_distance( base + stride_z + stride_y );
+  corners[7] = m_signed_distance( base + stride_z + stride_y + 1 );
 }
 
 bool RigidBodyTriangleMesh::detectCollision( const Vector3s& x, Vector3s& n ) const
@@ -299,14 +427,16 @@ bool RigidBodyTriangleMesh::detectCollision( const Vector3s& x, Vector3s& n ) co
   const Vector3s bci{ Vector3s::Ones() - bc };
 
   // Grab the value of the distance field at each grid point
-  const scalar v000{ v( indices.x(),     indices.y(),     indices.z() ) };
-  const scalar v100{ v( indices.x() + 1, indices.y(),     indices.z() ) };
-  const scalar v010{ v( indices.x(),     indices.y() + 1, indices.z() ) };
-  const scalar v110{ v( indices.x() + 1, indices.y() + 1, indices.z() ) };
-  const scalar v001{ v( indices.x(),     indices.y(),     indices.z() + 1 ) };
-  const scalar v101{ v( indices.x() + 1, indices.y(),     indices.z() + 1 ) };
-  const scalar v011{ v( indices.x(),     indices.y() + 1, indices.z() + 1 ) };
-  const scalar v111{ v( indices.x() + 1, indices.y() + 1, indices.z() + 1 ) };
+  std::array<scalar,8> corners;
+  cellCorners( indices, corners );
+  const scalar v000{ corners[0] };
+  const scalar v100{ corners[1] };
+  const scalar v010{ corners[2] };
+  const scalar v110{ corners[3] };
+  const scalar v001{ corners[4] };
+  const scalar v101{ corners[5] };
+  const scalar v011{ corners[6] };
+  const scalar v111{ corners[7] };
 
   const scalar dist{ bci.z() * ( bci.y() * ( bci.x() * v000 + bc.x() * v100 ) + bc.y() * ( bci.x() * v010 + bc.x() * v110 ) ) +
                       bc.z() * ( bci.y() * ( bci.x() * v001 + bc.x() * v101 ) + bc.y() * ( bci.x() * v011 + bc.x() * v111 ) ) };
@@ -333,3 +463,80 @@ bool RigidBodyTriangleMesh::detectCollision( const Vector3s& x, Vector3s& n ) co
 
   return true;
 }
+
+void RigidBodyTriangleMesh::detectCollisions( const Matrix3Xsc& x, std::vector<unsigned>& colliding, std::vector<Vector3s>& normals ) const
+{
+  // Structure of arrays storage for a batch, fixed in size so that it lives on the stack of the calling thread
+  std::array<unsigned,s_batch_size> point_indices;
+  // Coordinates of each point within its cell
+  std::array<std::array<scalar,s_batch_size>,3> bc;
+  // Distance field at the cell corners, in the order v000, v100, v010, v110, v001, v101, v011, v111
+  std::array<std::array<scalar,s_batch_size>,8> corners;
+  std::array<scalar,s_batch_size> dist;
+  std::array<scalar,8> point_corners;
+
+  int point{ 0 };
+  while( point < x.cols() )
+  {
+    // Gather the cell coordinates and corner values of the next batch of points inside the grid
+    int batch_size{ 0 };
+    for( ; point < x.cols() && batch_size < s_batch_size; ++point )
+    {
+      if( ( x.col( point ).array() < m_grid_origin.array() ).any() || ( x.col( point ).array() > m_grid_end.array() ).any() )
+      {
+        continue;
+      }
+      // Points on the far faces of the grid are interpolated in the last cell
+      const Array3u indices{ ( ( x.col( point ) - m_grid_origin ).array() / m_cell_delta.array() ).unaryExpr( [](const scalar& y) { return floor(y); } ).cast<unsigned>().min( m_grid_dimensions.array() - 2 ) };
+      const Array3s point_bc{ ( x.col( point ).array() - ( m_grid_origin.array() + indices.cast<scalar>().array() * m_cell_delta.array() ) ) / m_cell_delta.array() };
+      bc[0][batch_size] = point_bc.x();
+      bc[1][batch_size] = point_bc.y();
+      bc[2][batch_size] = point_bc.z();
+      cellCorners( indices, point_corners );
+      for( unsigned corner = 0; corner < 8; ++corner )
+      {
+        corners[corner][batch_size] = point_corners[corner];
+      }
+      point_indices[batch_size++] = unsigned( point );
+    }
+
+    // Interpolate the batch with a loop free of dependencies and branches, so that it vectorizes
+    for( int batch_idx = 0; batch_idx < batch_size; ++batch_idx )
+    {
+      const scalar bx{ bc[0][batch_idx] };
+      const scalar by{ bc[1][batch_idx] };
+      const scalar bz{ bc[2][batch_idx] };
+      dist[batch_idx] = ( 1.0 - bz ) * ( ( 1.0 - by ) * ( ( 1.0 - bx ) * corners[0][batch_idx] + bx * corners[1][batch_idx] ) + by * ( ( 1.0 - bx ) * corners[2][batch_idx] + bx * corners[3][batch_idx] ) ) +
+                                bz   * ( ( 1.0 - by ) * ( ( 1.0 - bx ) * corners[4][batch_idx] + bx * corners[5][batch_idx] ) + by * ( ( 1.0 - bx ) * corners[6][batch_idx] + bx * corners[7][batch_idx] ) );
+    }
+
+    // Collisions are rare, so their normals are computed one at a time
+    for( int batch_idx = 0; batch_idx < batch_size; ++batch_idx )
+    {
+      if( dist[batch_idx] > 0.0 )
+      {
+        continue;
+      }
+      const Array3s b{ bc[0][batch_idx], bc[1][batch_idx], bc[2][batch_idx] };
+      const Array3s bi{ 1.0 - b };
+      std::array<scalar,8> c;
+      for( unsigned corner = 0; corner < 8; ++corner )
+      {
+        c[corner] = corners[corner][batch_idx];
+      }
+      // Gradient of trilinear interpolation
+      Vector3s n;
+      n.x() = bi.z() * ( bi.y() * ( c[1] - c[0] ) + b.y() * ( c[3] - c[2] ) )
+             + b.z() * ( bi.y() * ( c[5] - c[4] ) + b.y() * ( c[7] - c[6] ) );
+      n.y() = bi.z() * ( bi.x() * ( c[2] - c[0] ) + b.x() * ( c[3] - c[1] ) )
+             + b.z() * ( bi.x() * ( c[6] - c[4] ) + b.x() * ( c[7] - c[5] ) );
+      n.z() = bi.y() * ( bi.x() * ( c[4] - c[0] ) + b.x() * ( c[5] - c[1] ) )
+             + b.y() * ( bi.x() * ( c[6] - c[2] ) + b.x() * ( c[7] - c[3] ) );
+      n.array() /= m_cell_delta.array();
+      n.normalize();
+      assert( std::fabs( n.norm() - 1.0 ) <= 1.0e-6 );
+      colliding.emplace_back( point_indices[batch_idx] );
+      normals.emplace_back( n );
+    }
+  }
+}
@@ -3,6 +3,13 @@
 
 #include "RigidBodyGeometry.h"
 
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "scisim/CollisionDetection/AABBTree.h"
+#include "SignedDistanceField.h"
+
 class RigidBodyTriangleMesh final : public RigidBodyGeometry
 {
 
@@ -14,7 +21,7 @@ public:
   #ifndef USE_HDF5
   [[noreturn]]
   #endif
-  explicit RigidBodyTriangleMesh( const std::string& input_file_name );
+  RigidBodyTriangleMesh( const std::string& input_file_name, const SDFStorageOptions& sdf_options );
 
   explicit RigidBodyTriangleMesh( std::istream& input_stream );
   virtual ~RigidBodyTriangleMesh() override = default;
@@ -49,9 +56,26 @@ public:
   // is expressed in the local frame
   bool detectCollision( const Vector3s& x, Vector3s& n ) const;
 
+  // Batched detectCollision: appends the index and normal of each column of x that lies inside the distance field
+  void detectCollisions( const Matrix3Xsc& x, std::vector<unsigned>& colliding, std::vector<Vector3s>& normals ) const;
+
+  // Appends the indices of the surface samples that lie in the given local frame box, grouped spatially
+  void samplesInBox( const Array3s& min, const Array3s& max, std::vector<unsigned>& samples ) const;
+
+  // Corners of the signed distance field grid in the local frame
+  const Vector3s& gridOrigin() const;
+  const Vector3s& gridEnd() const;
+
+  const SDFStorageOptions& sdfStorageOptions() const;
+
 private:
 
-  const scalar& v( const unsigned i, const unsigned j, const unsigned k ) const;
+  // Values of the distance field at the corners of a cell, in the order v000, v100, v010, v110, v001, v101, v011, v111
+  void cellCorners( const Array3u& cell, std::array<scalar,8>& corners ) const;
+
+  void deserializeSignedDistance( std::istream& input_stream );
+
+  void buildSampleTree();
 
   RigidBodyTriangleMesh() = default;
 
@@ -68,14 +92,21 @@ private:
 
   Matrix3Xsc m_samples;
   Matrix3Xsc m_convex_hull_samples;
+  // Hierarchy over the surface samples, derived from m_samples
+  AABBTree<3> m_sample_tree;
 
   Vector3s m_cell_delta;
   Vector3u m_grid_dimensions;
   Vector3s m_grid_origin;
+  // Dense field, empty when the compact field is used
   VectorXs m_signed_distance;
   // Derivable from the above quantities, just stored for convienience
   Vector3s m_grid_end;
 
+  SDFStorageOptions m_sdf_options;
+  // Compact field, shared between clones as it is never modified
+  std::shared_ptr<const SignedDistanceField> m_compact_sdf;
+
 };
 
 #endif
@@ -0,0 +1,614 @@
+#include "SignedDistanceField.h"
+
+#include "scisim/Utilities.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+#ifndef _WIN32
+#include <climits>
+#include <cstdlib>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// Cells along each edge of a brick
+static constexpr unsigned s_brick_cells{ 7 };
+// Nodes along each edge of a brick; nodes on shared faces are duplicated so that a cell never straddles two bricks
+static constexpr unsigned s_brick_nodes{ s_brick_cells + 1 };
+static constexpr unsigned s_brick_size{ s_brick_nodes * s_brick_nodes * s_brick_nodes };
+// Largest finite half precision value
+static constexpr scalar s_half_max{ 65504.0 };
+
+struct SignedDistanceField::Header
+{
+  char magic[8];
+  std::uint32_t precision;
+  std::uint32_t grid_dimensions[3];
+  std::uint32_t brick_dimensions[3];
+  std::uint32_t num_value_bricks;
+  std::uint32_t num_plane_bricks;
+  std::uint32_t padding;
+  double band;
+};
+
+static constexpr char s_magic[8]{ 'S', 'C', 'I', 'S', 'D', 'F', '0', '1' };
+
+static std::size_t alignTo8( const std::size_t offset )
+{
+  return ( offset + 7 ) & ~std::size_t( 7 );
+}
+
+static std::size_t valueSize( const SDFPrecision precision )
+{
+  switch( precision )
+  {
+    case SDFPrecision::DOUBLE:
+    {
+      return sizeof( double );
+    }
+    case SDFPrecision::SINGLE:
+    {
+      return sizeof( float );
+    }
+    case SDFPrecision::HALF:
+    {
+      return sizeof( std::uint16_t );
+    }
+  }
+  std::cerr << "Invalid signed distance field precision. Exiting." << std::endl;
+  std::exit( EXIT_FAILURE );
+}
+
+static std::string precisionName( const SDFPrecision precision )
+{
+  switch( precision )
+  {
+    case SDFPrecision::DOUBLE:
+    {
+      return "double";
+    }
+    case SDFPrecision::SINGLE:
+    {
+      return "single";
+    }
+    case SDFPrecision::HALF:
+    {
+      return "half";
+    }
+  }
+  std::cerr << "Invalid signed distance field precision. Exiting." << std::endl;
+  std::exit( EXIT_FAILURE );
+}
+
+// IEEE 754 binary16 conversions, rounding to nearest even
+static std::uint16_t floatToHalf( const float value )
+{
+  std::uint32_t bits;
+  std::memcpy( &bits, &value, sizeof( bits ) );
+  const std::uint32_t sign{ ( bits >> 16 ) & 0x8000u };
+  const int exponent{ int( ( bits >> 23 ) & 0xffu ) - 127 + 15 };
+  std::uint32_t mantissa{ bits & 0x7fffffu };
+  if( exponent >= 31 )
+  {
+    return std::uint16_t( sign | 0x7c00u );
+  }
+  if( exponent <= 0 )
+  {
+    if( exponent < -10 )
+    {
+      return std::uint16_t( sign );
+    }
+    mantissa |= 0x800000u;
+    const unsigned shift{ unsigned( 14 - exponent ) };
+    std::uint32_t half{ mantissa >> shift };
+    const std::uint32_t remainder{ mantissa & ( ( 1u << shift ) - 1 ) };
+    const std::uint32_t halfway{ 1u << ( shift - 1 ) };
+    if( remainder > halfway || ( remainder == halfway && ( half & 1u ) ) )
+    {
+      ++half;
+    }
+    return std::uint16_t( sign | half );
+  }
+  // A carry out of the mantissa correctly increments the exponent
+  std::uint32_t half{ sign | ( std::uint32_t( exponent ) << 10 ) | ( mantissa >> 13 ) };
+  const std::uint32_t remainder{ mantissa & 0x1fffu };
+  if( remainder > 0x1000u || ( remainder == 0x1000u && ( half & 1u ) ) )
+  {
+    ++half;
+  }
+  return std::uint16_t( half );
+}
+
+static float halfToFloat( const std::uint16_t half )
+{
+  const std::uint32_t sign{ std::uint32_t( half & 0x8000u ) << 16 };
+  std::uint32_t exponent{ ( half >> 10 ) & 0x1fu };
+  std::uint32_t mantissa{ half & 0x3ffu };
+  std::uint32_t bits;
+  if( exponent == 0 )
+  {
+    if( mantissa == 0 )
+    {
+      bits = sign;
+    }
+    else
+    {
+      // Renormalize the subnormal
+      exponent = 127 - 15 + 1;
+      while( ( mantissa & 0x400u ) == 0 )
+      {
+        mantissa <<= 1;
+        --exponent;
+      }
+      mantissa &= 0x3ffu;
+      bits = sign | ( exponent << 23 ) | ( mantissa << 13 );
+    }
+  }
+  else if( exponent == 31 )
+  {
+    bits = sign | 0x7f800000u | ( mantissa << 13 );
+  }
+  else
+  {
+    bits = sign | ( ( exponent + 127 - 15 ) << 23 ) | ( mantissa << 13 );
+  }
+  float value;
+  std::memcpy( &value, &bits, sizeof( value ) );
+  return value;
+}
+
+template<typename T>
+static scalar toScalar( const T& value )
+{
+  return scalar( value );
+}
+
+template<>
+scalar toScalar<std::uint16_t>( const std::uint16_t& value )
+{
+  return scalar( halfToFloat( value ) );
+}
+
+static void storeValue( const SDFPrecision precision, const scalar& value, char* const destination )
+{
+  switch( precision )
+  {
+    case SDFPrecision::DOUBLE:
+    {
+      const double stored{ value };
+      std::memcpy( destination, &stored, sizeof( stored ) );
+      break;
+    }
+    case SDFPrecision::SINGLE:
+    {
+      const float stored{ float( value ) };
+      std::memcpy( destination, &stored, sizeof( stored ) );
+      break;
+    }
+    case SDFPrecision::HALF:
+    {
+      const std::uint16_t stored{ floatToHalf( float( value ) ) };
+      std::memcpy( destination, &stored, sizeof( stored ) );
+      break;
+    }
+  }
+}
+
+SignedDistanceField::SignedDistanceField( const Vector3u& grid_dimensions, const VectorXs& signed_distance, const SDFPrecision precision, const scalar& band )
+: m_buffer()
+, m_mapping( nullptr )
+, m_file_name()
+, m_data( nullptr )
+, m_size( 0 )
+, m_header( nullptr )
+, m_bricks( nullptr )
+, m_planes( nullptr )
+, m_values( nullptr )
+{
+  assert( ( grid_dimensions.array() >= 2 ).all() );
+  assert( signed_distance.size() == grid_dimensions.x() * grid_dimensions.y() * grid_dimensions.z() );
+  assert( band >= 0.0 );
+
+  if( precision == SDFPrecision::HALF && signed_distance.lpNorm<Eigen::Infinity>() > s_half_max )
+  {
+    std::cerr << "Error, signed distance field exceeds the range of half precision storage. Exiting." << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
+
+  const Array3u brick_dimensions{ ( grid_dimensions.array() - 1 + s_brick_cells - 1 ) / s_brick_cells };
+  const unsigned num_bricks{ brick_dimensions.prod() };
+
+  // Gather each brick's nodes, clamping to the grid, and decide whether it is kept or replaced by a plane
+  std::vector<std::int32_t> bricks( num_bricks );
+  std::vector<double> planes;
+  std::vector<scalar> values;
+  std::array<scalar,s_brick_size> nodes;
+  for( unsigned bk = 0; bk < brick_dimensions.z(); ++bk )
+  {
+    for( unsigned bj = 0; bj < brick_dimensions.y(); ++bj )
+    {
+      for( unsigned bi = 0; bi < brick_dimensions.x(); ++bi )
+      {
+        // Normal equations of the least squares plane over the nodes inside the grid
+        Matrix4s AtA{ Matrix4s::Zero() };
+        Vector4s Atb{ Vector4s::Zero() };
+        bool far{ true };
+        for( unsigned k = 0; k < s_brick_nodes; ++k )
+        {
+          for( unsigned j = 0; j < s_brick_nodes; ++j )
+          {
+            for( unsigned i = 0; i < s_brick_nodes; ++i )
+            {
+              const Array3u local{ i, j, k };
+              const Array3u global{ ( Array3u{ bi, bj, bk } * s_brick_cells + local ).min( grid_dimensions.array() - 1 ) };
+              const scalar value{ signed_distance( ( global.z() * grid_dimensions.y() + global.y() ) * grid_dimensions.x() + global.x() ) };
+              nodes[( k * s_brick_nodes + j ) * s_brick_nodes + i] = value;
+              far = far && std::fabs( value ) >= band && ( value > 0.0 ) == ( nodes[0] > 0.0 );
+              if( ( global == Array3u{ bi, bj, bk } * s_brick_cells + local ).all() )
+              {
+                const Vector4s row{ 1.0, scalar( i ) - 0.5 * s_brick_cells, scalar( j ) - 0.5 * s_brick_cells, scalar( k ) - 0.5 * s_brick_cells };
+                AtA += row * row.transpose();
+                Atb += value * row;
+              }
+            }
+          }
+        }
+        const unsigned brick{ ( bk * brick_dimensions.y() + bj ) * brick_dimensions.x() + bi };
+        Vector4s plane;
+        if( far )
+        {
+          // Bricks have at least two nodes inside the grid along each axis, so the fit is well posed
+          plane = AtA.ldlt().solve( Atb );
+          // The plane is extremal at the brick's corners. Keep the brick if the plane anywhere in it comes within
+          // band of the surface or crosses it, so that the plane never reports a contact the field does not have.
+          const scalar half_range{ 0.5 * s_brick_cells * plane.segment<3>( 1 ).lpNorm<1>() };
+          far = nodes[0] > 0.0 ? plane( 0 ) - half_range >= band : plane( 0 ) + half_range <= -band;
+        }
+        if( far )
+        {
+          bricks[brick] = -1 - std::int32_t( planes.size() / 4 );
+          planes.insert( planes.end(), plane.data(), plane.data() + 4 );
+        }
+        else
+        {
+          bricks[brick] = std::int32_t( values.size() / s_brick_size );
+          values.insert( values.end(), nodes.begin(), nodes.end() );
+        }
+      }
+    }
+  }
+
+  // Lay out the header, brick table, planes, and values
+  const std::size_t bricks_offset{ alignTo8( sizeof( Header ) ) };
+  const std::size_t planes_offset{ alignTo8( bricks_offset + bricks.size() * sizeof( std::int32_t ) ) };
+  const std::size_t values_offset{ alignTo8( planes_offset + planes.size() * sizeof( double ) ) };
+  m_buffer.resize( values_offset + values.size() * valueSize( precision ) );
+
+  Header header;
+  std::memcpy( header.magic, s_magic, sizeof( s_magic ) );
+  header.precision = std::uint32_t( precision );
+  for( unsigned axis = 0; axis < 3; ++axis )
+  {
+    header.grid_dimensions[axis] = grid_dimensions( axis );
+    header.brick_dimensions[axis] = brick_dimensions( axis );
+  }
+  header.num_value_bricks = std::uint32_t( values.size() / s_brick_size );
+  header.num_plane_bricks = std::uint32_t( planes.size() / 4 );
+  header.padding = 0;
+  header.band = band;
+  std::memcpy( m_buffer.data(), &header, sizeof( header ) );
+  std::memcpy( m_buffer.data() + bricks_offset, bricks.data(), bricks.size() * sizeof( std::int32_t ) );
+  std::memcpy( m_buffer.data() + planes_offset, planes.data(), planes.size() * sizeof( double ) );
+  for( std::vector<scalar>::size_type value_idx = 0; value_idx < values.size(); ++value_idx )
+  {
+    storeValue( precision, values[value_idx], m_buffer.data() + values_offset + value_idx * valueSize( precision ) );
+  }
+
+  setData( m_buffer.data(), m_buffer.size() );
+}
+
+SignedDistanceField::SignedDistanceField( const std::string& file_name )
+: m_buffer()
+, m_mapping( nullptr )
+, m_file_name( file_name )
+, m_data( nullptr )
+, m_size( 0 )
+, m_header( nullptr )
+, m_bricks( nullptr )
+, m_planes( nullptr )
+, m_values( nullptr )
+{
+  #ifndef _WIN32
+  const int file_descriptor{ open( file_name.c_str(), O_RDONLY ) };
+  if( file_descriptor == -1 )
+  {
+    std::cerr << "Error, failed to open signed distance field " << file_name << ". Exiting." << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
+  struct stat file_status;
+  if( fstat( file_descriptor, &file_status ) != 0 || file_status.st_size < off_t( sizeof( Header ) ) )
+  {
+    std::cerr << "Error, failed to read signed distance field " << file_name << ". Exiting." << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
+  // Read only shared mappings of the same file are backed by the same pages in every process
+  m_mapping = mmap( nullptr, std::size_t( file_status.st_size ), PROT_READ, MAP_SHARED, file_descriptor, 0 );
+  close( file_descriptor );
+  if( m_mapping == MAP_FAILED )
+  {
+    std::cerr << "Error, failed to memory map signed distance field " << file_name << ". Exiting." << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
+  setData( static_cast<const char*>( m_mapping ), std::size_t( file_status.st_size ) );
+  #else
+  std::ifstream input_file{ file_name, std::ios::binary | std::ios::ate };
+  if( !input_file.is_open() )
+  {
+    std::cerr << "Error, failed to open signed distance field " << file_name << ". Exiting." << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
+  m_buffer.resize( std::size_t( input_file.tellg() ) );
+  input_file.seekg( 0 );
+  input_file.read( m_buffer.data(), std::streamsize( m_buffer.size() ) );
+  setData( m_buffer.data(), m_buffer.size() );
+  #endif
+}
+
+SignedDistanceField::SignedDistanceField( std::istream& input_stream )
+: m_buffer( Utilities::deserialize<std::vector<char>>( input_stream ) )
+, m_mapping( nullptr )
+, m_file_name()
+, m_data( nullptr )
+, m_size( 0 )
+, m_header( nullptr )
+, m_bricks( nullptr )
+, m_planes( nullptr )
+, m_values( nullptr )
+{
+  setData( m_buffer.data(), m_buffer.size() );
+}
+
+SignedDistanceField::~SignedDistanceField()
+{
+  #ifndef _WIN32
+  if( m_mapping != nullptr )
+  {
+    munmap( m_mapping, m_size );
+  }
+  #endif
+}
+
+void SignedDistanceField::setData( const char* const data, const std::size_t size )
+{
+  m_data = data;
+  m_size = size;
+  m_header = reinterpret_cast<const Header*>( data );
+  if( size < sizeof( Header ) || !validHeader( *m_header ) )
+  {
+    std::cerr << "Error, invalid signed distance field data. Exiting." << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
+  if( dataSize( *m_header ) != size )
+  {
+    std::cerr << "Error, truncated signed distance field data. Exiting." << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
+  const std::size_t num_bricks{ std::size_t( m_header->brick_dimensions[0] ) * m_header->brick_dimensions[1] * m_header->brick_dimensions[2] };
+  const std::size_t bricks_offset{ alignTo8( sizeof( Header ) ) };
+  const std::size_t planes_offset{ alignTo8( bricks_offset + num_bricks * sizeof( std::int32_t ) ) };
+  const std::size_t values_offset{ alignTo8( planes_offset + 4 * m_header->num_plane_bricks * sizeof( double ) ) };
+  m_bricks = reinterpret_cast<const std::int32_t*>( data + bricks_offset );
+  m_planes = reinterpret_cast<const double*>( data + planes_offset );
+  m_values = data + values_offset;
+}
+
+bool SignedDistanceField::validHeader( const Header& header )
+{
+  return std::memcmp( header.magic, s_magic, sizeof( s_magic ) ) == 0 && header.precision <= std::uint32_t( SDFPrecision::HALF );
+}
+
+std::size_t SignedDistanceField::dataSize( const Header& header )
+{
+  const std::size_t num_bricks{ std::size_t( header.brick_dimensions[0] ) * header.brick_dimensions[1] * header.brick_dimensions[2] };
+  const std::size_t bricks_offset{ alignTo8( sizeof( Header ) ) };
+  const std::size_t planes_offset{ alignTo8( bricks_offset + num_bricks * sizeof( std::int32_t ) ) };
+  const std::size_t values_offset{ alignTo8( planes_offset + 4 * header.num_plane_bricks * sizeof( double ) ) };
+  return values_offset + header.num_value_bricks * s_brick_size * valueSize( SDFPrecision( header.precision ) );
+}
+
+bool SignedDistanceField::validFile( const std::string& file_name )
+{
+  std::ifstream input_file{ file_name, std::ios::binary | std::ios::ate };
+  if( !input_file.is_open() )
+  {
+    return false;
+  }
+  const std::streamoff file_size{ input_file.tellg() };
+  if( file_size < std::streamoff( sizeof( Header ) ) )
+  {
+    return false;
+  }
+  Header header;
+  input_file.seekg( 0 );
+  input_file.read( reinterpret_cast<char*>( &header ), sizeof( header ) );
+  return input_file.good() && validHeader( header ) && dataSize( header ) == std::size_t( file_size );
+}
+
+// FNV-1a hash of the path, size, and modification time of a file, which identify its contents without reading them
+static std::uint64_t hashFileMetadata( const std::string& file_name )
+{
+  struct stat file_status;
+  if( stat( file_name.c_str(), &file_status ) != 0 )
+  {
+    std::cerr << "Error, failed to stat " << file_name << ". Exiting." << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
+  std::stringstream metadata_stream;
+  #ifndef _WIN32
+  // The same file reached through different relative paths shares one entry
+  char resolved_path[PATH_MAX];
+  metadata_stream << ( realpath( file_name.c_str(), resolved_path ) != nullptr ? std::string{ resolved_path } : file_name );
+  #else
+  metadata_stream << file_name;
+  #endif
+  metadata_stream << '\n' << file_status.st_size << '\n' << file_status.st_mtime;
+  const std::string metadata{ metadata_stream.str() };
+
+  std::uint64_t hash{ 14695981039346656037ULL };
+  for( const char byte : metadata )
+  {
+    hash ^= std::uint64_t( static_cast<unsigned char>( byte ) );
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+std::shared_ptr<const SignedDistanceField> SignedDistanceField::loadCached( const std::string& cache_directory, const std::string& mesh_file_name, const Vector3u& grid_dimensions, const SDFPrecision precision, const scalar& band, const std::function<VectorXs()>& load_signed_distance )
+{
+  // Key the cache by everything the stored field depends on
+  std::string cache_file_name;
+  {
+    std::uint64_t band_bits;
+    std::memcpy( &band_bits, &band, sizeof( band_bits ) );
+    std::stringstream name_stream;
+    name_stream << cache_directory << '/' << std::hex << std::setfill( '0' ) << std::setw( 16 ) << hashFileMetadata( mesh_file_name ) << '_' << precisionName( precision ) << '_' << std::setw( 16 ) << band_bits << ".sdf";
+    cache_file_name = name_stream.str();
+  }
+
+  if( std::ifstream{ cache_file_name }.good() )
+  {
+    // A damaged or partially copied entry is rebuilt like a missing one
+    if( !validFile( cache_file_name ) )
+    {
+      std::cerr << "Warning, signed distance field cache " << cache_file_name << " is invalid or truncated, rebuilding it." << std::endl;
+    }
+    else
+    {
+      std::shared_ptr<const SignedDistanceField> field{ std::make_shared<const SignedDistanceField>( cache_file_name ) };
+      if( field->gridDimensions() == grid_dimensions && field->precision() == precision )
+      {
+        return field;
+      }
+      std::cerr << "Warning, signed distance field cache " << cache_file_name << " does not match " << mesh_file_name << ", rebuilding it." << std::endl;
+    }
+  }
+
+  const SignedDistanceField built_field{ grid_dimensions, load_signed_distance(), precision, band };
+  // Write to a temporary file and rename it, so that concurrent processes only ever map complete fields
+  std::string temporary_file_name{ cache_file_name + ".tmp" };
+  #ifndef _WIN32
+  temporary_file_name += "." + std::to_string( getpid() );
+  #endif
+  built_field.write( temporary_file_name );
+  if( std::rename( temporary_file_name.c_str(), cache_file_name.c_str() ) != 0 )
+  {
+    std::cerr << "Error, failed to move " << temporary_file_name << " to " << cache_file_name << ". Exiting." << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
+  return std::make_shared<const SignedDistanceField>( cache_file_name );
+}
+
+void SignedDistanceField::write( const std::string& file_name ) const
+{
+  std::ofstream output_file{ file_name, std::ios::binary };
+  if( !output_file.is_open() )
+  {
+    std::cerr << "Error, failed to open " << file_name << " to write a signed distance field. Exiting." << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
+  output_file.write( m_data, std::streamsize( m_size ) );
+  if( !output_file.good() )
+  {
+    std::cerr << "Error, failed to write signed distance field " << file_name << ". Exiting." << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
+}
+
+void SignedDistanceField::serialize( std::ostream& output_stream ) const
+{
+  assert( output_stream.good() );
+  Utilities::serialize( std::vector<char>( m_data, m_data + m_size ), output_stream );
+}
+
+template<typename T>
+void SignedDistanceField::cellCorners( const Array3u& cell, std::array<scalar,8>& corners ) const
+{
+  const Array3u brick_index{ cell / s_brick_cells };
+  const Array3u local{ cell - brick_index * s_brick_cells };
+  assert( ( brick_index < Array3u{ m_header->brick_dimensions[0], m_header->brick_dimensions[1], m_header->brick_dimensions[2] } ).all() );
+  const std::int32_t brick{ m_bricks[( brick_index.z() * m_header->brick_dimensions[1] + brick_index.y() ) * m_header->brick_dimensions[0] + brick_index.x()] };
+
+  if( brick >= 0 )
+  {
+    const T* const values{ static_cast<const T*>( m_values ) + std::size_t( brick ) * s_brick_size + ( local.z() * s_brick_nodes + local.y() ) * s_brick_nodes + local.x() };
+    static constexpr std::array<unsigned,8> offsets{ { 0, 1, s_brick_nodes, s_brick_nodes + 1, s_brick_nodes * s_brick_nodes, s_brick_nodes * s_brick_nodes + 1, s_brick_nodes * s_brick_nodes + s_brick_nodes, s_brick_nodes * s_brick_nodes + s_brick_nodes + 1 } };
+    for( unsigned corner = 0; corner < 8; ++corner )
+    {
+      corners[corner] = toScalar( values[offsets[corner]] );
+    }
+    return;
+  }
+
+  const double* const plane{ m_planes + 4 * std::size_t( -1 - brick ) };
+  const Array3s x0{ local.cast<scalar>() - 0.5 * s_brick_cells };
+  for( unsigned corner = 0; corner < 8; ++corner )
+  {
+    corners[corner] = plane[0] + plane[1] * ( x0.x() + scalar( corner & 1 ) ) + plane[2] * ( x0.y() + scalar( ( corner >> 1 ) & 1 ) ) + plane[3] * ( x0.z() + scalar( ( corner >> 2 ) & 1 ) );
+  }
+}
+
+void SignedDistanceField::cellCorners( const Array3u& cell, std::array<scalar,8>& corners ) const
+{
+  switch( precision() )
+  {
+    case SDFPrecision::DOUBLE:
+    {
+      cellCorners<double>( cell, corners );
+      break;
+    }
+    case SDFPrecision::SINGLE:
+    {
+      cellCorners<float>( cell, corners );
+      break;
+    }
+    case SDFPrecision::HALF:
+    {
+      cellCorners<std::uint16_t>( cell, corners );
+      break;
+    }
+  }
+}
+
+Vector3u SignedDistanceField::gridDimensions() const
+{
+  return Vector3u{ m_header->grid_dimensions[0], m_header->grid_dimensions[1], m_header->grid_dimensions[2] };
+}
+
+SDFPrecision SignedDistanceField::precision() const
+{
+  return SDFPrecision( m_header->precision );
+}
+
+scalar SignedDistanceField::band() const
+{
+  return m_header->band;
+}
+
+const std::string& SignedDistanceField::fileName() const
+{
+  return m_file_name;
+}
+
+std::size_t SignedDistanceField::bytes() const
+{
+  return m_size;
+}
@@ -0,0 +1,110 @@
+#ifndef SIGNED_DISTANCE_FIELD_H
+#define SIGNED_DISTANCE_FIELD_H
+
+#include "scisim/Math/MathDefines.h"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+enum class SDFPrecision : std::uint32_t
+{
+  DOUBLE,
+  SINGLE,
+  HALF
+};
+
+// How a triangle mesh stores its signed distance field. By default the dense double precision grid of the mesh file
+// is held on the heap.
+struct SDFStorageOptions
+{
+  // Store the field as a SignedDistanceField
+  bool compact{ false };
+  SDFPrecision precision{ SDFPrecision::DOUBLE };
+  // Bricks with every node at least this far from the surface are replaced by a plane
+  scalar band{ SCALAR_INFINITY };
+  // If not empty, compact fields are memory mapped from this directory, keyed by the path, size, and modification time
+  // of the mesh file
+  std::string cache_directory;
+};
+
+// Signed distance field on a regular grid, stored as bricks of 7x7x7 cells. Bricks near the surface keep their nodal
+// values at the chosen precision. Bricks whose nodes all lie at least band from the surface are replaced by their
+// least squares plane, provided that the plane stays at least band from zero with the brick's sign over the whole
+// brick, so the field keeps its sign and still gives normals to deeply penetrating points. The field is held in one
+// flat buffer, so it can be written to disk and memory mapped back by several processes that then share its pages.
+class SignedDistanceField final
+{
+
+public:
+
+  // Builds the field from nodal values ordered with x fastest, then y, then z
+  SignedDistanceField( const Vector3u& grid_dimensions, const VectorXs& signed_distance, const SDFPrecision precision, const scalar& band );
+  // Memory maps a field saved with write
+  explicit SignedDistanceField( const std::string& file_name );
+  explicit SignedDistanceField( std::istream& input_stream );
+  ~SignedDistanceField();
+
+  SignedDistanceField( const SignedDistanceField& ) = delete;
+  SignedDistanceField& operator=( const SignedDistanceField& ) = delete;
+
+  // Maps the field of mesh_file_name from cache_directory. On a miss, or if the cached file is damaged, the field is
+  // built from the values returned by load_signed_distance and written to the cache first.
+  static std::shared_ptr<const SignedDistanceField> loadCached( const std::string& cache_directory, const std::string& mesh_file_name, const Vector3u& grid_dimensions, const SDFPrecision precision, const scalar& band, const std::function<VectorXs()>& load_signed_distance );
+
+  void write( const std::string& file_name ) const;
+
+  void serialize( std::ostream& output_stream ) const;
+
+  // Values at the corners of a cell, in the order v000, v100, v010, v110, v001, v101, v011, v111
+  void cellCorners( const Array3u& cell, std::array<scalar,8>& corners ) const;
+
+  Vector3u gridDimensions() const;
+
+  SDFPrecision precision() const;
+
+  scalar band() const;
+
+  // Name of the mapped file, empty if the field is held in memory
+  const std::string& fileName() const;
+
+  // Size of the field's storage in bytes
+  std::size_t bytes() const;
+
+private:
+
+  struct Header;
+
+  void setData( const char* const data, const std::size_t size );
+
+  static bool validHeader( const Header& header );
+  // Size of the data described by header
+  static std::size_t dataSize( const Header& header );
+  // Whether file_name holds a complete field, checked from its header and size
+  static bool validFile( const std::string& file_name );
+
+  template<typename T>
+  void cellCorners( const Array3u& cell, std::array<scalar,8>& corners ) const;
+
+  // Storage when the field is held in memory
+  std::vector<char> m_buffer;
+  // Mapping when the field is memory mapped
+  void* m_mapping;
+  std::string m_file_name;
+
+  const char* m_data;
+  std::size_t m_size;
+  const Header* m_header;
+  // Index of each brick's nodal values, or minus one minus the index of its plane
+  const std::int32_t* m_bricks;
+  // Value at the brick center and gradient in units of nodes, for each plane brick
+  const double* m_planes;
+  const void* m_values;
+
+};
+
+#endif
@@ -1,11 +1,17 @@
 #include "RigidBody3DSim.h"
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <set>
 
 #include "scisim/UnconstrainedMaps/UnconstrainedMap.h"
 #include "scisim/ConstrainedMaps/ImpactFrictionMap.h"
+#include "scisim/CollisionDetection/CollisionDetectionUtilities.h"
+#include "scisim/Constraints/ContactBatch.h"
 #include "scisim/Utilities.h"
 #include "scisim/Math/Rational.h"
+#include "scisim/Timer/Profiler.h"
 #include "Forces/Force.h"
 #include "Geometry/RigidBodyBox.h"
 #include "Geometry/RigidBodySphere.h"
@@ -27,15 +33,42 @@
 #include "Constraints/CollisionUtilities.h"
 #include "StaticGeometry/StaticCylinder.h"
 #include "UnconstrainedMaps/IntegrationTools.h"
-#include "SpatialGridDetector.h"
 #include "Portals/PlanarPortal.h"
 #include "StateOutput.h"
 #include "PythonScripting.h"
 
 #ifdef USE_HDF5
 #include "scisim/HDF5File.h"
+#include "scisim/HDF5TimeSeries.h"
 #endif
 
+// Number of consecutive work items assigned to a thread at once by the parallel collision detection loops
+static constexpr unsigned s_collision_chunk_size{ 64 };
+
+// Calls func( item, constraints ) for each item in [0, num_items), in parallel when OpenMP is enabled, and appends the
+// generated constraints to active_set in item order. Each chunk of items writes to its own buffer, so the resulting
+// active set is identical to a serial evaluation regardless of the number of threads.
+template<typename Function>
+static void generateConstraintsInParallel( const unsigned num_items, Function func, std::vector<std::unique_ptr<Constraint>>& active_set )
+{
+  const unsigned num_chunks{ ( num_items + s_collision_chunk_size - 1 ) / s_collision_chunk_size };
+  std::vector<std::vector<std::unique_ptr<Constraint>>> chunk_constraints( num_chunks );
+  #pragma omp parallel for schedule( dynamic )
+  for( unsigned chunk = 0; chunk < num_chunks; ++chunk )
+  {
+    const unsigned chunk_end{ std::min( num_items, ( chunk + 1 ) * s_collision_chunk_size ) };
+    for( unsigned item = chunk * s_collision_chunk_size; item < chunk_end; ++item )
+    {
+      func( item, chunk_constraints[chunk] );
+    }
+  }
+  // Merge the buffers in a deterministic order
+  for( std::vector<std::unique_ptr<Constraint>>& constraints : chunk_constraints )
+  {
+    std::move( constraints.begin(), constraints.end(), std::back_inserter( active_set ) );
+  }
+}
+
 const RigidBody3DState& RigidBody3DSim::getState() const
 {
   return m_sim_state;
@@ -218,6 +251,16 @@ const SparseMatrixsc& RigidBody3DSim::Minv0() const
   return m_sim_state.Minv0();
 }
 
+const BlockDiagonalMass& RigidBody3DSim::MBlocks() const
+{
+  return m_sim_state.MBlocks();
+}
+
+const BlockDiagonalMass& RigidBody3DSim::MinvBlocks() const
+{
+  return m_sim_state.MinvBlocks();
+}
+
 void RigidBody3DSim::computeMomentum( const VectorXs& v, VectorXs& p ) const
 {
   p = Vector3s::Zero();
@@ -251,18 +294,33 @@ void RigidBody3DSim::computeActiveSet( const VectorXs& q0, const VectorXs& qp, c
 {
   assert( q0.size() == qp.size() );
   assert( active_set.empty() );
+  SCISIM_PROFILE_SCOPE( ProfilePhase::NARROW_PHASE );
+
+  // Recycle the storage of the previous step's constraints
+  constraintArena().reset();
 
   // Detect body-body collisions
   computeActiveSetBodyBodySpatialGrid( q0, qp, active_set );
 
-  // Detect body-plane collisions
-  computeBodyPlaneActiveSetAllPairs( q0, qp, active_set );
-  // Detect body-cylinder collisions
-  computeBodyCylinderActiveSetAllPairs( q0, qp, active_set );
+  // Detect body-plane and body-cylinder collisions
+  computeBodyStaticActiveSetAABBTree( q0, qp, active_set );
+
+  SCISIM_PROFILE_COUNT( ProfileCounter::CONTACTS, active_set.size() );
 }
 
 void RigidBody3DSim::computeImpactBases( const VectorXs& q, const std::vector<std::unique_ptr<Constraint>>& active_set, MatrixXXsc& impact_bases ) const
 {
+  if( !active_set.empty() )
+  {
+    ContactBatch local_batch;
+    const ContactBatch* const batch{ ContactBatch::acquire( q, active_set, local_batch ) };
+    if( batch != nullptr )
+    {
+      batch->computeImpactBases( impact_bases );
+      return;
+    }
+  }
+
   const unsigned ncols{ static_cast<unsigned>( active_set.size() ) };
   impact_bases.resize( 3, ncols );
   for( unsigned col_num = 0; col_num < ncols; ++col_num )
@@ -276,6 +334,17 @@ void RigidBody3DSim::computeImpactBases( const VectorXs& q, const std::vector<st
 
 void RigidBody3DSim::computeContactBases( const VectorXs& q, const VectorXs& v, const std::vector<std::unique_ptr<Constraint>>& active_set, MatrixXXsc& contact_bases ) const
 {
+  if( !active_set.empty() )
+  {
+    ContactBatch local_batch;
+    const ContactBatch* const batch{ ContactBatch::acquire( q, active_set, local_batch ) };
+    if( batch != nullptr )
+    {
+      batch->computeContactBases( v, contact_bases );
+      return;
+    }
+  }
+
   const unsigned ncols{ static_cast<unsigned>( active_set.size() ) };
   contact_bases.resize( 3, 3 * ncols );
   for( unsigned col_num = 0; col_num < ncols; ++col_num )
@@ -681,14 +750,14 @@ void RigidBody3DSim::boxBoxNarrowPhaseCollision( const unsigned first_body, cons
   {
     for( const Vector3s& point : points )
     {
-      active_set.emplace_back( new BodyBodyConstraint{ first_body, second_body, point, n, q0 } );
+      active_set.emplace_back( new( constraintArena() ) BodyBodyConstraint{ first_body, second_body, point, n, q0 } );
     }
   }
   else
   {
     for( const Vector3s& point : points )
     {
-      active_set.emplace_back( new KinematicObjectBodyConstraint{ first_body, second_body, point, n, q0 } );
+      active_set.emplace_back( new( constraintArena() ) KinematicObjectBodyConstraint{ first_body, second_body, point, n, q0 } );
     }
   }
 }
@@ -807,13 +876,13 @@ void RigidBody3DSim::sphereSphereNarrowPhaseCollision( const unsigned first_body
     {
       // Compute the contact point in q0
       const Vector3s p{ q0.segment<3>( 3 * first_body ) + ( sphere0.r() / ( sphere0.r() + sphere1.r() ) ) * ( q0.segment<3>( 3 * second_body ) - q0.segment<3>( 3 * first_body ) ) };
-      active_set.emplace_back( new SphereSphereConstraint{ first_body, second_body, n, p, sphere0.r(), sphere1.r() } );
+      active_set.emplace_back( new( constraintArena() ) SphereSphereConstraint{ first_body, second_body, n, p, sphere0.r(), sphere1.r() } );
     }
     else
     {
       assert( ( q0.segment<3>( 3 * second_body ).array() == q1.segment<3>( 3 * second_body ).array() ).all() );
       assert( ( q0.segment<9>( q0.size() / 4 + 9 * second_body ).array() == q1.segment<9>( q0.size() / 4 + 9 * second_body ).array() ).all() );
-      active_set.emplace_back( new KinematicSphereSphereConstraint{ first_body, sphere0.r(), n, second_body, q0.segment<3>( 3 * second_body ), Vector3s::Zero(), Vector3s::Zero(), sphere1.r() } );
+      active_set.emplace_back( new( constraintArena() ) KinematicSphereSphereConstraint{ first_body, sphere0.r(), n, second_body, q0.segment<3>( 3 * second_body ), Vector3s::Zero(), Vector3s::Zero(), sphere1.r() } );
     }
   }
 }
@@ -836,7 +905,7 @@ void RigidBody3DSim::stapleStapleNarrowPhaseCollision( const unsigned first_body
     assert( p.size() == n.size() );
     for( std::vector<Vector3s>::size_type i = 0; i < p.size(); ++i )
     {
-      active_set.emplace_back( new BodyBodyConstraint{ first_body, second_body, p[i], n[i], q0 } );
+      active_set.emplace_back( new( constraintArena() ) BodyBodyConstraint{ first_body, second_body, p[i], n[i], q0 } );
     }
   }
 }
@@ -863,14 +932,14 @@ void RigidBody3DSim::meshMeshNarrowPhaseCollision( const unsigned first_body, co
   {
     for( std::vector<Vector3s>::size_type i = 0; i < p.size(); i++ )
     {
-      active_set.emplace_back( new BodyBodyConstraint{ first_body, second_body, p[i], n[i], q0 } );
+      active_set.emplace_back( new( constraintArena() ) BodyBodyConstraint{ first_body, second_body, p[i], n[i], q0 } );
     }
   }
   else
   {
     for( std::vector<Vector3s>::size_type i = 0; i < p.size(); i++ )
     {
-      active_set.emplace_back( new KinematicObjectBodyConstraint{ first_body, second_body, p[i], n[i], q0 } );
+      active_set.emplace_back( new( constraintArena() ) KinematicObjectBodyConstraint{ first_body, second_body, p[i], n[i], q0 } );
     }
   }
 }
@@ -1054,10 +1123,12 @@ bool RigidBody3DSim::collisionIsActive( const unsigned first_body, const unsigne
 }
 
 
-void RigidBody3DSim::generateAABBs( std::vector<AABB>& aabbs, const VectorXs& q )
+void RigidBody3DSim::generateAABBs( std::vector<AABB<3>>& aabbs, const VectorXs& q )
 {
-  aabbs.resize( m_sim_state.nbodies() );
-  for( unsigned body = 0; body < m_sim_state.nbodies(); ++body )
+  const unsigned nbodies{ m_sim_state.nbodies() };
+  aabbs.resize( nbodies );
+  #pragma omp parallel for
+  for( unsigned body = 0; body < nbodies; ++body )
   {
     const Vector3s cm{ q.segment<3>( 3 * body ) };
     const Matrix33sr R{ Eigen::Map<const Matrix33sr>{ q.segment<9>( 3 * m_sim_state.nbodies() + 9 * body ).data() } };
@@ -1068,6 +1139,26 @@ void RigidBody3DSim::generateAABBs( std::vector<AABB>& aabbs, const VectorXs& q
   }
 }
 
+void RigidBody3DSim::computePossibleOverlaps( const std::vector<AABB<3>>& aabbs )
+{
+  SCISIM_PROFILE_SCOPE( ProfilePhase::BROAD_PHASE );
+
+  switch( m_sim_state.broadPhase() )
+  {
+    case BroadPhase::SPATIAL_GRID:
+    {
+      m_spatial_grid.getPotentialOverlaps( aabbs, m_possible_overlaps );
+      break;
+    }
+    case BroadPhase::SWEEP_AND_PRUNE:
+    {
+      m_sweep_and_prune.update( aabbs );
+      m_possible_overlaps = m_sweep_and_prune.overlaps();
+      break;
+    }
+  }
+}
+
 // TODO: Move as much of this code into helper methods as possible
 void RigidBody3DSim::computeActiveSetBodyBodySpatialGrid( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set )
 {
@@ -1076,13 +1167,11 @@ void RigidBody3DSim::computeActiveSetBodyBodySpatialGrid( const VectorXs& q0, co
 
   const unsigned nbodies{ m_sim_state.nbodies() };
   
-  // Candidate bodies that might overlap
-  std::set<std::pair<unsigned,unsigned>> possible_overlaps;
   // Map from teleported AABB indices and body and portal indices
   std::map<unsigned,TeleportedBody> teleported_aabb_body_indices;
   {
     // Compute an AABB for each body
-    std::vector<AABB> aabbs;
+    std::vector<AABB<3>> aabbs;
     generateAABBs( aabbs, q1 );
     assert( aabbs.size() == nbodies );
 
@@ -1103,7 +1192,7 @@ void RigidBody3DSim::computeActiveSetBodyBodySpatialGrid( const VectorXs& q0, co
           m_sim_state.planarPortal( prtl_idx ).teleportPoint( q1.segment<3>( 3 * bdy_idx ), intersecting_plane_index, x_out );
 
           // Compute an AABB for the teleported body
-          AABB new_aabb;
+          AABB<3> new_aabb;
           const Matrix33sr R{ Eigen::Map<const Matrix33sr>{ q1.segment<9>( 3 * m_sim_state.nbodies() + 9 * bdy_idx ).data() } };
           assert( ( R * R.transpose() - Matrix33sr::Identity() ).lpNorm<Eigen::Infinity>() <= 1.0e-6 );
           assert( fabs( R.determinant() - 1.0 ) <= 1.0e-6 );
@@ -1115,7 +1204,7 @@ void RigidBody3DSim::computeActiveSetBodyBodySpatialGrid( const VectorXs& q0, co
     }
 
     // Determine which bodies possibly overlap
-    SpatialGridDetector::getPotentialOverlaps( aabbs, possible_overlaps );
+    computePossibleOverlaps( aabbs );
   }
 
   std::set<TeleportedCollision> teleported_collisions;
@@ -1124,23 +1213,32 @@ void RigidBody3DSim::computeActiveSetBodyBodySpatialGrid( const VectorXs& q0, co
   std::vector<std::pair<unsigned,unsigned>> duplicate_indices;
   #endif
 
-  // Create constraints for bodies that actually overlap
-  for( const auto& possible_overlap_pair : possible_overlaps )
-  {
-    const bool first_teleported{ possible_overlap_pair.first >= nbodies };
-    const bool second_teleported{ possible_overlap_pair.second >= nbodies };
-
-    // If neither ball in the current collision was teleported
-    if( !first_teleported && !second_teleported )
+  // Run narrow phase on pairs of bodies that were not teleported. Their constraints enter the active set in
+  // possible overlap order, ahead of all teleported constraints, which are generated below in TeleportedCollision order.
+  generateConstraintsInParallel( static_cast<unsigned>( m_possible_overlaps.size() ),
+    [this,nbodies,&q0,&q1]( const unsigned pair_idx, std::vector<std::unique_ptr<Constraint>>& constraints )
     {
+      const std::pair<unsigned,unsigned>& possible_overlap_pair{ m_possible_overlaps[pair_idx] };
+      if( possible_overlap_pair.first >= nbodies || possible_overlap_pair.second >= nbodies )
+      {
+        return;
+      }
       if( isKinematicallyScripted( possible_overlap_pair.first ) && isKinematicallyScripted( possible_overlap_pair.second ) )
       {
-        continue;
+        return;
       }
-      dispatchNarrowPhaseCollision( possible_overlap_pair.first, possible_overlap_pair.second, q0, q1, active_set );
-    }
-    // If at least one of the balls was teleported
-    else
+      dispatchNarrowPhaseCollision( possible_overlap_pair.first, possible_overlap_pair.second, q0, q1, constraints );
+    },
+    active_set );
+
+  // Determine which teleported pairs of bodies actually overlap
+  for( const auto& possible_overlap_pair : m_possible_overlaps )
+  {
+    const bool first_teleported{ possible_overlap_pair.first >= nbodies };
+    const bool second_teleported{ possible_overlap_pair.second >= nbodies };
+
+    // If at least one of the bodies was teleported
+    if( first_teleported || second_teleported )
     {
       unsigned bdy_idx_0{ possible_overlap_pair.first };
       unsigned bdy_idx_1{ possible_overlap_pair.second };
@@ -1197,7 +1295,7 @@ void RigidBody3DSim::computeActiveSetBodyBodySpatialGrid( const VectorXs& q0, co
       }
     }
   }
-  possible_overlaps.clear();
+  m_possible_overlaps.clear();
   teleported_aabb_body_indices.clear();
 
   #ifndef NDEBUG
@@ -1377,17 +1475,17 @@ void RigidBody3DSim::generateTeleportedCollision( const VectorXs& q, const Telep
   {
     // Creation of constraints at q0 to preserve angular momentum
     const Vector3s n{ ( x1 - x0 ).normalized() };
-    active_set.emplace_back( new KinematicObjectSphereConstraint{ idx1, r1, n, idx0, x0, Vector3s::Zero(), Vector3s::Zero() } );
+    active_set.emplace_back( new( constraintArena() ) KinematicObjectSphereConstraint{ idx1, r1, n, idx0, x0, Vector3s::Zero(), Vector3s::Zero() } );
   }
   else if( !isKinematicallyScripted( idx0 ) && isKinematicallyScripted( idx1 ) )
   {
     // Creation of constraints at q0 to preserve angular momentum
     const Vector3s n{ ( x0 - x1 ).normalized() };
-    active_set.emplace_back( new KinematicObjectSphereConstraint{ idx0, r0, n, idx1, x1, Vector3s::Zero(), Vector3s::Zero() } );
+    active_set.emplace_back( new( constraintArena() ) KinematicObjectSphereConstraint{ idx0, r0, n, idx1, x1, Vector3s::Zero(), Vector3s::Zero() } );
   }
   else if( !isKinematicallyScripted( idx0 ) && !isKinematicallyScripted( idx1 ) )
   {
-    active_set.emplace_back( new TeleportedSphereSphereConstraint{ idx0, idx1, x0, x1, r0, r1 } );
+    active_set.emplace_back( new( constraintArena() ) TeleportedSphereSphereConstraint{ idx0, idx1, x0, x1, r0, r1 } );
   }
   else
   {
@@ -1410,95 +1508,161 @@ void RigidBody3DSim::generateTeleportedCollision( const VectorXs& q, const Telep
 //  }
 //}
 
-// TODO: Move all of the ugly code bits in here into their own functions
 void RigidBody3DSim::computeBodyPlaneActiveSetAllPairs( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const
 {
   assert( q0.size() == q1.size() );
   assert( q0.size() == 12 * m_sim_state.nbodies() );
 
-  // Check all plane-body pairs
-  for( std::vector<StaticPlane>::size_type plane = 0; plane < m_sim_state.staticPlanes().size(); ++plane )
+  // Check all plane-body pairs, ordered by plane and then by body
+  const unsigned nbodies{ m_sim_state.nbodies() };
+  const unsigned num_pairs{ static_cast<unsigned>( m_sim_state.staticPlanes().size() ) * nbodies };
+  generateConstraintsInParallel( num_pairs,
+    [this,nbodies,&q0,&q1]( const unsigned pair_idx, std::vector<std::unique_ptr<Constraint>>& constraints )
+    {
+      computeBodyPlaneActiveSet( pair_idx / nbodies, pair_idx % nbodies, q0, q1, constraints );
+    },
+    active_set );
+}
+
+void RigidBody3DSim::computeBodyStaticActiveSetAABBTree( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set )
+{
+  assert( q0.size() == q1.size() );
+  assert( q0.size() == 12 * m_sim_state.nbodies() );
+
+  if( m_sim_state.staticPlanes().empty() && m_sim_state.staticCylinders().empty() )
+  {
+    return;
+  }
+
+  // Bound each body at the end of the step
+  {
+    SCISIM_PROFILE_SCOPE( ProfilePhase::BROAD_PHASE );
+    generateAABBs( m_body_aabbs, q1 );
+    m_body_tree.build( m_body_aabbs );
+  }
+
+  // Only bodies that touch a half plane can be active with it
+  m_static_pairs.clear();
+  for( unsigned plane = 0; plane < unsigned( m_sim_state.staticPlanes().size() ); ++plane )
   {
-    for( unsigned body = 0; body < m_sim_state.nbodies(); ++body )
+    const Vector3s x{ m_sim_state.staticPlanes()[plane].x() };
+    const Vector3s n{ m_sim_state.staticPlanes()[plane].n() };
+    m_static_candidates.clear();
+    m_body_tree.query( [&x,&n]( const Array3s& min, const Array3s& max ) { return CollisionDetectionUtilities::aabbTouchesHalfPlane<3>( min, max, x, n ); }, m_static_candidates );
+    for( const unsigned body : m_static_candidates )
     {
-      // Skip kinematically scripted bodies
-      if( isKinematicallyScripted( body ) )
-      {
-        continue;
-      }
+      m_static_pairs.emplace_back( plane, body );
+    }
+  }
+  generateConstraintsInParallel( static_cast<unsigned>( m_static_pairs.size() ),
+    [this,&q0,&q1]( const unsigned pair_idx, std::vector<std::unique_ptr<Constraint>>& constraints )
+    {
+      computeBodyPlaneActiveSet( m_static_pairs[pair_idx].first, m_static_pairs[pair_idx].second, q0, q1, constraints );
+    },
+    active_set );
+
+  // Only bodies that reach the wall of a cylinder can be active with it
+  m_static_pairs.clear();
+  for( unsigned cyl = 0; cyl < unsigned( m_sim_state.staticCylinders().size() ); ++cyl )
+  {
+    const StaticCylinder& cylinder{ m_sim_state.staticCylinder( cyl ) };
+    m_static_candidates.clear();
+    m_body_tree.query( [&cylinder]( const Array3s& min, const Array3s& max ) { return CollisionDetectionUtilities::aabbReachesCylinder( min, max, cylinder.x(), cylinder.axis(), cylinder.r() ); }, m_static_candidates );
+    for( const unsigned body : m_static_candidates )
+    {
+      m_static_pairs.emplace_back( cyl, body );
+    }
+  }
+  generateConstraintsInParallel( static_cast<unsigned>( m_static_pairs.size() ),
+    [this,&q0,&q1]( const unsigned pair_idx, std::vector<std::unique_ptr<Constraint>>& constraints )
+    {
+      computeBodyCylinderActiveSet( m_static_pairs[pair_idx].first, m_static_pairs[pair_idx].second, q0, q1, constraints );
+    },
+    active_set );
+}
 
-      if( m_sim_state.getGeometryOfBody(body).getType() == RigidBodyGeometryType::BOX )
-      {
-        const RigidBodyBox& box{ static_cast<const RigidBodyBox&>( m_sim_state.getGeometryOfBody( body ) ) };
-        const Matrix33sr R{ Eigen::Map<const Matrix33sr>( q1.segment<9>( 3 * m_sim_state.nbodies() + 9 * body ).data() ) };
-        std::vector<short> active_corners;
-        const bool box_plane_happens{ StaticPlaneBoxConstraint::isActive( m_sim_state.staticPlanes()[plane].x(), m_sim_state.staticPlanes()[plane].n(), q1.segment<3>( 3 * body ), R, box.halfWidths(), active_corners ) };
-        if( box_plane_happens )
-        {
-          assert( !active_corners.empty() );
-          for( std::vector<short>::size_type i = 0; i < active_corners.size(); ++i )
-          {
-            active_set.emplace_back( new StaticPlaneBoxConstraint{ body, active_corners[i], m_sim_state.staticPlanes()[plane].n(), box.halfWidths(), q0, static_cast<unsigned>( plane ) } );
-          }
-        }
-      }
-      else if( m_sim_state.getGeometryOfBody(body).getType() == RigidBodyGeometryType::SPHERE )
-      {
-        const RigidBodySphere& sphere{ static_cast<const RigidBodySphere&>( m_sim_state.getGeometryOfBody( body ) ) };
-        if( StaticPlaneSphereConstraint::isActive( m_sim_state.staticPlanes()[plane].x(), m_sim_state.staticPlanes()[plane].n(), q1.segment<3>( 3 * body ), sphere.r() ) )
-        {
-          active_set.emplace_back( new StaticPlaneSphereConstraint{ body, sphere.r(), m_sim_state.staticPlane( plane ), static_cast<unsigned>( plane ) } );
-        }
-      }
-      else if( m_sim_state.getGeometryOfBody(body).getType() == RigidBodyGeometryType::STAPLE )
-      {
-        const RigidBodyStaple& staple{ static_cast<const RigidBodyStaple&>( m_sim_state.getGeometryOfBody( body ) ) };
-        const Matrix33sr R{ Eigen::Map<const Matrix33sr>{ q1.segment<9>( 3 * m_sim_state.nbodies() + 9 * body ).data() } };
-        std::vector<int> points;
-        StapleStapleUtilities::computeStapleHalfPlaneActiveSet( q1.segment<3>( 3 * body ), R, staple, m_sim_state.staticPlanes()[plane].x(), m_sim_state.staticPlanes()[plane].n(), points );
-        assert( points.size() <= 4 );
-        std::cerr << "This code is buggy. It is confusing the rotation at q0 and q1. Fix up like I did below." << std::endl;
-        std::exit( EXIT_FAILURE );
-        //for( std::vector<int>::size_type i = 0; i < points.size(); ++i )
-        //{
-        //  assert( points[i] >= 0 ); assert( points[i] <= 4 );
-        //  std::cerr << "This code is buggy. It is confusing the rotation at q0 and q1. Fix up like I did below." << std::endl;
-        //  std::exit( EXIT_FAILURE );
-        //  // Compute the point of the collision
-        //  const Vector3s point = q0.segment<3>( 3 * body ) + R * staple.points()[points[i]] - staple.r() * m_sim_state.staticPlanes()[plane].n();
-        //  // Create a constraint
-        //  active_set.push_back( std::unique_ptr<Constraint>( new StaticPlaneBodyConstraint( body, point, m_sim_state.staticPlane(plane).n(), q0, plane ) ) );
-        //}
-      }
-      else if( m_sim_state.getGeometryOfBody(body).getType() == RigidBodyGeometryType::TRIANGLE_MESH )
+// TODO: Move all of the ugly code bits in here into their own functions
+void RigidBody3DSim::computeBodyPlaneActiveSet( const unsigned plane, const unsigned body, const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const
+{
+  assert( plane < m_sim_state.staticPlanes().size() );
+  assert( body < m_sim_state.nbodies() );
+
+  // Skip kinematically scripted bodies
+  if( isKinematicallyScripted( body ) )
+  {
+    return;
+  }
+
+  if( m_sim_state.getGeometryOfBody(body).getType() == RigidBodyGeometryType::BOX )
+  {
+    const RigidBodyBox& box{ static_cast<const RigidBodyBox&>( m_sim_state.getGeometryOfBody( body ) ) };
+    const Matrix33sr R{ Eigen::Map<const Matrix33sr>( q1.segment<9>( 3 * m_sim_state.nbodies() + 9 * body ).data() ) };
+    std::vector<short> active_corners;
+    const bool box_plane_happens{ StaticPlaneBoxConstraint::isActive( m_sim_state.staticPlanes()[plane].x(), m_sim_state.staticPlanes()[plane].n(), q1.segment<3>( 3 * body ), R, box.halfWidths(), active_corners ) };
+    if( box_plane_happens )
+    {
+      assert( !active_corners.empty() );
+      for( std::vector<short>::size_type i = 0; i < active_corners.size(); ++i )
       {
-        const RigidBodyTriangleMesh& mesh{ static_cast<const RigidBodyTriangleMesh&>( m_sim_state.getGeometryOfBody( body ) ) };
-        // Determine which vertices of the mesh collide with the half plane
-        std::vector<unsigned> colliding_convex_hull_vertices;
-        {
-          const Vector3s cm1{ q1.segment<3>( 3 * body ) };
-          const Matrix33sr R1{ Eigen::Map<const Matrix33sr>{ q1.segment<9>( 3 * m_sim_state.nbodies() + 9 * body ).data() } };
-          MeshMeshUtilities::computeMeshHalfPlaneActiveSet( cm1, R1, mesh, m_sim_state.staticPlanes()[plane].x(), m_sim_state.staticPlanes()[plane].n(), colliding_convex_hull_vertices );
-        }
-        // Create constraints for each vertex
-        {
-          const Vector3s cm0{ q0.segment<3>( 3 * body ) };
-          const Matrix33sr R0{ Eigen::Map<const Matrix33sr>{ q0.segment<9>( 3 * m_sim_state.nbodies() + 9 * body ).data() } };
-          for( std::vector<unsigned>::size_type vrt_idx = 0; vrt_idx < colliding_convex_hull_vertices.size(); ++vrt_idx )
-          {
-            // Compute the point of the collision
-            const Vector3s point{ cm0 + R0 * mesh.convexHullVertices().col( colliding_convex_hull_vertices[vrt_idx] ) };
-            active_set.emplace_back( new StaticPlaneBodyConstraint{ body, point, m_sim_state.staticPlane(plane).n(), q0, static_cast<unsigned>( plane ) } );
-          }
-        }
+        active_set.emplace_back( new( constraintArena() ) StaticPlaneBoxConstraint{ body, active_corners[i], m_sim_state.staticPlanes()[plane].n(), box.halfWidths(), q0, static_cast<unsigned>( plane ) } );
       }
-      else
+    }
+  }
+  else if( m_sim_state.getGeometryOfBody(body).getType() == RigidBodyGeometryType::SPHERE )
+  {
+    const RigidBodySphere& sphere{ static_cast<const RigidBodySphere&>( m_sim_state.getGeometryOfBody( body ) ) };
+    if( StaticPlaneSphereConstraint::isActive( m_sim_state.staticPlanes()[plane].x(), m_sim_state.staticPlanes()[plane].n(), q1.segment<3>( 3 * body ), sphere.r() ) )
+    {
+      active_set.emplace_back( new( constraintArena() ) StaticPlaneSphereConstraint{ body, sphere.r(), m_sim_state.staticPlane( plane ), static_cast<unsigned>( plane ) } );
+    }
+  }
+  else if( m_sim_state.getGeometryOfBody(body).getType() == RigidBodyGeometryType::STAPLE )
+  {
+    const RigidBodyStaple& staple{ static_cast<const RigidBodyStaple&>( m_sim_state.getGeometryOfBody( body ) ) };
+    const Matrix33sr R{ Eigen::Map<const Matrix33sr>{ q1.segment<9>( 3 * m_sim_state.nbodies() + 9 * body ).data() } };
+    std::vector<int> points;
+    StapleStapleUtilities::computeStapleHalfPlaneActiveSet( q1.segment<3>( 3 * body ), R, staple, m_sim_state.staticPlanes()[plane].x(), m_sim_state.staticPlanes()[plane].n(), points );
+    assert( points.size() <= 4 );
+    std::cerr << "This code is buggy. It is confusing the rotation at q0 and q1. Fix up like I did below." << std::endl;
+    std::exit( EXIT_FAILURE );
+    //for( std::vector<int>::size_type i = 0; i < points.size(); ++i )
+    //{
+    //  assert( points[i] >= 0 ); assert( points[i] <= 4 );
+    //  std::cerr << "This code is buggy. It is confusing the rotation at q0 and q1. Fix up like I did below." << std::endl;
+    //  std::exit( EXIT_FAILURE );
+    //  // Compute the point of the collision
+    //  const Vector3s point = q0.segment<3>( 3 * body ) + R * staple.points()[points[i]] - staple.r() * m_sim_state.staticPlanes()[plane].n();
+    //  // Create a constraint
+    //  active_set.push_back( std::unique_ptr<Constraint>( new StaticPlaneBodyConstraint( body, point, m_sim_state.staticPlane(plane).n(), q0, plane ) ) );
+    //}
+  }
+  else if( m_sim_state.getGeometryOfBody(body).getType() == RigidBodyGeometryType::TRIANGLE_MESH )
+  {
+    const RigidBodyTriangleMesh& mesh{ static_cast<const RigidBodyTriangleMesh&>( m_sim_state.getGeometryOfBody( body ) ) };
+    // Determine which vertices of the mesh collide with the half plane
+    std::vector<unsigned> colliding_convex_hull_vertices;
+    {
+      const Vector3s cm1{ q1.segment<3>( 3 * body ) };
+      const Matrix33sr R1{ Eigen::Map<const Matrix33sr>{ q1.segment<9>( 3 * m_sim_state.nbodies() + 9 * body ).data() } };
+      MeshMeshUtilities::computeMeshHalfPlaneActiveSet( cm1, R1, mesh, m_sim_state.staticPlanes()[plane].x(), m_sim_state.staticPlanes()[plane].n(), colliding_convex_hull_vertices );
+    }
+    // Create constraints for each vertex
+    {
+      const Vector3s cm0{ q0.segment<3>( 3 * body ) };
+      const Matrix33sr R0{ Eigen::Map<const Matrix33sr>{ q0.segment<9>( 3 * m_sim_state.nbodies() + 9 * body ).data() } };
+      for( std::vector<unsigned>::size_type vrt_idx = 0; vrt_idx < colliding_convex_hull_vertices.size(); ++vrt_idx )
       {
-        std::cerr << "Collision between static planes and " << m_sim_state.getGeometryOfBody(body).name() << " not supported. Exiting." << std::endl;
-        std::exit( EXIT_FAILURE );
+        // Compute the point of the collision
+        const Vector3s point{ cm0 + R0 * mesh.convexHullVertices().col( colliding_convex_hull_vertices[vrt_idx] ) };
+        active_set.emplace_back( new( constraintArena() ) StaticPlaneBodyConstraint{ body, point, m_sim_state.staticPlane(plane).n(), q0, static_cast<unsigned>( plane ) } );
       }
     }
   }
+  else
+  {
+    std::cerr << "Collision between static planes and " << m_sim_state.getGeometryOfBody(body).name() << " not supported. Exiting." << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
 }
 
 void RigidBody3DSim::computeBodyCylinderActiveSetAllPairs( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const
@@ -1506,58 +1670,67 @@ void RigidBody3DSim::computeBodyCylinderActiveSetAllPairs( const VectorXs& q0, c
   assert( q0.size() == q1.size() );
   assert( q0.size() == 12 * m_sim_state.nbodies() );
 
-  // Check all cylinder-body pairs
-  for( std::vector<StaticCylinder>::size_type cyl = 0; cyl < m_sim_state.staticCylinders().size(); ++cyl )
-  {
-    for( unsigned body = 0; body < m_sim_state.nbodies(); ++body )
+  // Check all cylinder-body pairs, ordered by cylinder and then by body
+  const unsigned nbodies{ m_sim_state.nbodies() };
+  const unsigned num_pairs{ static_cast<unsigned>( m_sim_state.staticCylinders().size() ) * nbodies };
+  generateConstraintsInParallel( num_pairs,
+    [this,nbodies,&q0,&q1]( const unsigned pair_idx, std::vector<std::unique_ptr<Constraint>>& constraints )
     {
-      // Skip kinematically scripted bodies
-      if( isKinematicallyScripted( body ) )
-      {
-        continue;
-      }
+      computeBodyCylinderActiveSet( pair_idx / nbodies, pair_idx % nbodies, q0, q1, constraints );
+    },
+    active_set );
+}
 
-      if( m_sim_state.getGeometryOfBody(body).getType() == RigidBodyGeometryType::SPHERE )
-      {
-        const RigidBodySphere& sphere{ static_cast<const RigidBodySphere&>( m_sim_state.getGeometryOfBody( body ) ) };
-        if( StaticCylinderSphereConstraint::isActive( m_sim_state.staticCylinder(cyl).x(), m_sim_state.staticCylinder(cyl).axis(), m_sim_state.staticCylinder(cyl).r(), q1.segment<3>( 3 * body ), sphere.r() ) )
-        {
-          active_set.emplace_back( new StaticCylinderSphereConstraint{ body, sphere.r(), m_sim_state.staticCylinder(cyl), static_cast<unsigned>( cyl ) } );
-        }
-      }
-      else if( m_sim_state.getGeometryOfBody(body).getType() == RigidBodyGeometryType::TRIANGLE_MESH )
-      {
-        const RigidBodyTriangleMesh& mesh{ static_cast<const RigidBodyTriangleMesh&>( m_sim_state.getGeometryOfBody( body ) ) };
-        // Determine which vertices of the mesh collide with the cylinder
-        std::vector<unsigned> colliding_convex_hull_vertices;
-        {
-          const Vector3s cm1{ q1.segment<3>( 3 * body ) };
-          const Matrix33sr R1{ Eigen::Map<const Matrix33sr>{ q1.segment<9>( 3 * m_sim_state.nbodies() + 9 * body ).data() } };
-          MeshMeshUtilities::computeMeshCylinderActiveSet( cm1, R1, mesh, m_sim_state.staticCylinder(cyl).x(), m_sim_state.staticCylinder(cyl).axis(), m_sim_state.staticCylinder(cyl).r(), colliding_convex_hull_vertices );
-        }
-        // Create constraints for each vertex
-        {
-          const Vector3s cm0{ q0.segment<3>( 3 * body ) };
-          const Matrix33sr R0{ Eigen::Map<const Matrix33sr>{ q0.segment<9>( 3 * m_sim_state.nbodies() + 9 * body ).data() } };
-          for( std::vector<unsigned>::size_type vrt_idx = 0; vrt_idx < colliding_convex_hull_vertices.size(); ++vrt_idx )
-          {
-            // Compute the point of the collision
-            const Vector3s point{ cm0 + R0 * mesh.convexHullVertices().col( colliding_convex_hull_vertices[vrt_idx] ) };
-            active_set.emplace_back( new StaticCylinderBodyConstraint{ body, point, m_sim_state.staticCylinder(cyl), static_cast<unsigned>( cyl ), q0 } );
-          }
-        }
-      }
-      else
+void RigidBody3DSim::computeBodyCylinderActiveSet( const unsigned cyl, const unsigned body, const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const
+{
+  assert( cyl < m_sim_state.staticCylinders().size() );
+  assert( body < m_sim_state.nbodies() );
+
+  // Skip kinematically scripted bodies
+  if( isKinematicallyScripted( body ) )
+  {
+    return;
+  }
+
+  if( m_sim_state.getGeometryOfBody(body).getType() == RigidBodyGeometryType::SPHERE )
+  {
+    const RigidBodySphere& sphere{ static_cast<const RigidBodySphere&>( m_sim_state.getGeometryOfBody( body ) ) };
+    if( StaticCylinderSphereConstraint::isActive( m_sim_state.staticCylinder(cyl).x(), m_sim_state.staticCylinder(cyl).axis(), m_sim_state.staticCylinder(cyl).r(), q1.segment<3>( 3 * body ), sphere.r() ) )
+    {
+      active_set.emplace_back( new( constraintArena() ) StaticCylinderSphereConstraint{ body, sphere.r(), m_sim_state.staticCylinder(cyl), static_cast<unsigned>( cyl ) } );
+    }
+  }
+  else if( m_sim_state.getGeometryOfBody(body).getType() == RigidBodyGeometryType::TRIANGLE_MESH )
+  {
+    const RigidBodyTriangleMesh& mesh{ static_cast<const RigidBodyTriangleMesh&>( m_sim_state.getGeometryOfBody( body ) ) };
+    // Determine which vertices of the mesh collide with the cylinder
+    std::vector<unsigned> colliding_convex_hull_vertices;
+    {
+      const Vector3s cm1{ q1.segment<3>( 3 * body ) };
+      const Matrix33sr R1{ Eigen::Map<const Matrix33sr>{ q1.segment<9>( 3 * m_sim_state.nbodies() + 9 * body ).data() } };
+      MeshMeshUtilities::computeMeshCylinderActiveSet( cm1, R1, mesh, m_sim_state.staticCylinder(cyl).x(), m_sim_state.staticCylinder(cyl).axis(), m_sim_state.staticCylinder(cyl).r(), colliding_convex_hull_vertices );
+    }
+    // Create constraints for each vertex
+    {
+      const Vector3s cm0{ q0.segment<3>( 3 * body ) };
+      const Matrix33sr R0{ Eigen::Map<const Matrix33sr>{ q0.segment<9>( 3 * m_sim_state.nbodies() + 9 * body ).data() } };
+      for( std::vector<unsigned>::size_type vrt_idx = 0; vrt_idx < colliding_convex_hull_vertices.size(); ++vrt_idx )
       {
-        std::cerr << "Collision between static cylinders and " << m_sim_state.getGeometryOfBody(body).name() << " not supported. Exiting." << std::endl;
-        std::exit( EXIT_FAILURE );
+        // Compute the point of the collision
+        const Vector3s point{ cm0 + R0 * mesh.convexHullVertices().col( colliding_convex_hull_vertices[vrt_idx] ) };
+        active_set.emplace_back( new( constraintArena() ) StaticCylinderBodyConstraint{ body, point, m_sim_state.staticCylinder(cyl), static_cast<unsigned>( cyl ), q0 } );
       }
     }
   }
+  else
+  {
+    std::cerr << "Collision between static cylinders and " << m_sim_state.getGeometryOfBody(body).name() << " not supported. Exiting." << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
 }
 
 #ifdef USE_HDF5
-void RigidBody3DSim::writeBinaryState( HDF5File& output_file ) const
+void RigidBody3DSim::writeBinaryGeometry( HDF5File& output_file ) const
 {
   // Output the simulated geometry
   StateOutput::writeGeometryIndices( m_sim_state.geometry(), m_sim_state.indices(), "geometry", output_file );
@@ -1571,6 +1744,21 @@ void RigidBody3DSim::writeBinaryState( HDF5File& output_file ) const
   {
     StateOutput::writeStaticCylinders( m_sim_state.staticCylinders(), "static_geometry", output_file );
   }
+}
+
+VectorXu RigidBody3DSim::kinematicallyScriptedFlags() const
+{
+  VectorXu fixed{ m_sim_state.nbodies() };
+  for( unsigned body_index = 0; body_index < m_sim_state.nbodies(); ++body_index )
+  {
+    fixed( body_index ) = m_sim_state.isKinematicallyScripted( body_index ) ? 1 : 0;
+  }
+  return fixed;
+}
+
+void RigidBody3DSim::writeBinaryState( HDF5File& output_file ) const
+{
+  writeBinaryGeometry( output_file );
   // Write out the state of each body
   output_file.write( "state/q", m_sim_state.q() );
   output_file.write( "state/v", m_sim_state.v() );
@@ -1578,14 +1766,19 @@ void RigidBody3DSim::writeBinaryState( HDF5File& output_file ) const
     const Eigen::Map<const VectorXs> M0(m_sim_state.M0().valuePtr(), m_sim_state.M0().nonZeros());
     output_file.write( "state/M0", M0 );
   }
+  output_file.write( "state/kinematically_scripted", kinematicallyScriptedFlags() );
+}
+
+void RigidBody3DSim::writeBinaryState( HDF5TimeSeries& output_series ) const
+{
+  if( output_series.numFrames() == 1 )
   {
-    VectorXu fixed{ m_sim_state.nbodies() };
-    for( unsigned body_index = 0; body_index < m_sim_state.nbodies(); ++body_index )
-    {
-      fixed( body_index ) = m_sim_state.isKinematicallyScripted( body_index ) ? 1 : 0;
-    }
-    output_file.write( "state/kinematically_scripted", fixed );
+    writeBinaryGeometry( output_series.file() );
   }
+  output_series.append( "state/q", m_sim_state.q() );
+  output_series.append( "state/v", m_sim_state.v() );
+  output_series.append( "state/M0", Eigen::Map<const VectorXs>{ m_sim_state.M0().valuePtr(), m_sim_state.M0().nonZeros() } );
+  output_series.append( "state/kinematically_scripted", kinematicallyScriptedFlags() );
 }
 #endif
 
@@ -1605,6 +1798,34 @@ void RigidBody3DSim::deserialize( std::istream& input_stream )
   m_constraint_cache.deserialize( input_stream );
 }
 
+void RigidBody3DSim::serializeStatic( std::ostream& output_stream ) const
+{
+  assert( output_stream.good() );
+  m_sim_state.serializeStatic( output_stream );
+}
+
+void RigidBody3DSim::deserializeStatic( std::istream& input_stream )
+{
+  assert( input_stream.good() );
+  m_sim_state.deserializeStatic( input_stream );
+}
+
+void RigidBody3DSim::serializeDynamic( std::ostream& output_stream ) const
+{
+  assert( output_stream.good() );
+  m_sim_state.serializeDynamic( output_stream );
+  // Nothing to serialize for m_impact_map
+  m_constraint_cache.serialize( output_stream );
+}
+
+void RigidBody3DSim::deserializeDynamic( std::istream& input_stream )
+{
+  assert( input_stream.good() );
+  m_sim_state.deserializeDynamic( input_stream );
+  // Nothing to deserialize for m_impact_map
+  m_constraint_cache.deserialize( input_stream );
+}
+
 ImpactMap& RigidBody3DSim::impactMap()
 {
   return m_impact_map;
@@ -10,6 +10,9 @@
 #include "scisim/UnconstrainedMaps/FlowableSystem.h"
 #include "scisim/Constraints/ConstrainedSystem.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/ImpactMap.h"
+#include "scisim/CollisionDetection/AABBTree.h"
+#include "scisim/CollisionDetection/SpatialGrid.h"
+#include "scisim/CollisionDetection/SweepAndPruneDetector.h"
 
 #include "RigidBody3DState.h"
 #include "ConstraintCache.h"
@@ -21,7 +24,6 @@ class RigidBodyBox;
 class RigidBodySphere;
 class RigidBodyStaple;
 class RigidBodyTriangleMesh;
-class AABB;
 class TeleportedCollision;
 class FrictionSolver;
 class PythonScripting;
@@ -29,6 +31,7 @@ template<typename T> class Rational;
 
 #ifdef USE_HDF5
 class HDF5File;
+class HDF5TimeSeries;
 #endif
 
 class RigidBody3DSim final : private FlowableSystem, private ConstrainedSystem
@@ -79,6 +82,8 @@ public:
   virtual const SparseMatrixsc& Minv() const override;
   virtual const SparseMatrixsc& M0() const override;
   virtual const SparseMatrixsc& Minv0() const override;
+  virtual const BlockDiagonalMass& MBlocks() const override;
+  virtual const BlockDiagonalMass& MinvBlocks() const override;
 
   virtual void computeMomentum( const VectorXs& v, VectorXs& p ) const override;
   virtual void computeAngularMomentum( const VectorXs& v, VectorXs& L ) const override;
@@ -112,15 +117,29 @@ public:
 
   #ifdef USE_HDF5
   void writeBinaryState( HDF5File& output_file ) const;
+  // Appends the state to a time series; geometry is written with the first frame only
+  void writeBinaryState( HDF5TimeSeries& output_series ) const;
   #endif
 
   void serialize( std::ostream& output_stream ) const;
   void deserialize( std::istream& input_stream );
 
+  // Incremental snapshots save the static part of the state once and only the dynamic part, including the warm start
+  // cache, with each snapshot; deserializing both parts, in order, restores the same state as deserialize
+  void serializeStatic( std::ostream& output_stream ) const;
+  void deserializeStatic( std::istream& input_stream );
+  void serializeDynamic( std::ostream& output_stream ) const;
+  void deserializeDynamic( std::istream& input_stream );
+
   ImpactMap& impactMap();
 
 private:
 
+  #ifdef USE_HDF5
+  void writeBinaryGeometry( HDF5File& output_file ) const;
+  VectorXu kinematicallyScriptedFlags() const;
+  #endif
+
   void enforcePeriodicBoundaryConditions();
   void runBoundaryExitTreatment() const;
   void treatSimulationBoundary();
@@ -133,22 +152,40 @@ private:
   void dispatchNarrowPhaseCollision( const unsigned first_body, const unsigned second_body, const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
   bool collisionIsActive( const unsigned first_body, const unsigned second_body, const VectorXs& q0, const VectorXs& q1 ) const;
 
-  void generateAABBs( std::vector<AABB>& aabbs, const VectorXs& q );
+  void generateAABBs( std::vector<AABB<3>>& aabbs, const VectorXs& q );
 
   bool teleportedCollisionHappens( const VectorXs& q, const TeleportedCollision& teleported_collision ) const;
   void getTeleportedCollisionCenters( const VectorXs& q, const TeleportedCollision& teleported_collision, Vector3s& x0, Vector3s& x1 ) const;
   void generateTeleportedCollision( const VectorXs& q, const TeleportedCollision& teleported_collision, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
 
+  // Fills m_possible_overlaps using the state's broad phase
+  void computePossibleOverlaps( const std::vector<AABB<3>>& aabbs );
   void computeActiveSetBodyBodySpatialGrid( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set );
   //void computeActiveSetBodyBodyAllPairs( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
 
   void computeBodyPlaneActiveSetAllPairs( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
   void computeBodyCylinderActiveSetAllPairs( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
 
+  // Same constraints, in the same order, as the all pairs versions, testing only bodies whose bounds reach the geometry
+  void computeBodyStaticActiveSetAABBTree( const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set );
+
+  void computeBodyPlaneActiveSet( const unsigned plane, const unsigned body, const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
+  void computeBodyCylinderActiveSet( const unsigned cyl, const unsigned body, const VectorXs& q0, const VectorXs& q1, std::vector<std::unique_ptr<Constraint>>& active_set ) const;
+
   RigidBody3DState m_sim_state;
   ImpactMap m_impact_map;
   ConstraintCache m_constraint_cache;
 
+  // Broad phase storage, retained across timesteps to avoid reallocation
+  SpatialGrid<3> m_spatial_grid;
+  SweepAndPruneDetector<3> m_sweep_and_prune;
+  std::vector<std::pair<unsigned,unsigned>> m_possible_overlaps;
+  std::vector<AABB<3>> m_body_aabbs;
+  AABBTree<3> m_body_tree;
+  std::vector<unsigned> m_static_candidates;
+  // Pairs of static object and body that passed the tree query
+  std::vector<std::pair<unsigned,unsigned>> m_static_pairs;
+
 };
 
 #endif
@@ -27,6 +27,8 @@ RigidBody3DState::RigidBody3DState()
 , m_Minv0()
 , m_M()
 , m_Minv()
+, m_M_blocks()
+, m_Minv_blocks()
 , m_fixed()
 , m_geometry()
 , m_geometry_indices()
@@ -47,6 +49,8 @@ RigidBody3DState::RigidBody3DState( const RigidBody3DState& other )
 , m_Minv0( other.m_Minv0 )
 , m_M( other.m_M )
 , m_Minv( other.m_Minv )
+, m_M_blocks( other.m_M_blocks )
+, m_Minv_blocks( other.m_Minv_blocks )
 , m_fixed( other.m_fixed )
 , m_geometry( Utilities::clone( other.m_geometry ) )
 , m_geometry_indices( other.m_geometry_indices )
@@ -57,6 +61,7 @@ RigidBody3DState::RigidBody3DState( const RigidBody3DState& other )
 , m_boundary_behavior( other.m_boundary_behavior )
 , m_boundary_min( other.m_boundary_min )
 , m_boundary_max( other.m_boundary_max )
+, m_broad_phase( other.m_broad_phase )
 {}
 
 RigidBody3DState& RigidBody3DState::operator=( const RigidBody3DState& other )
@@ -294,6 +299,7 @@ void RigidBody3DState::setState( const std::vector<Vector3s>& X, const std::vect
     m_M = formWorldSpaceMassMatrix( M, I0, R );
     m_Minv = formWorldSpaceInverseMassMatrix( M, I0, R );
   }
+  updateMassBlocks();
 
   assert( MathUtilities::isIdentity( m_M0 * m_Minv0, 1.0e-9 ) );
   assert( MathUtilities::isIdentity( m_M * m_Minv, 1.0e-9 ) );
@@ -377,6 +383,16 @@ const SparseMatrixsc& RigidBody3DState::Minv() const
   return m_Minv;
 }
 
+const BlockDiagonalMass& RigidBody3DState::MBlocks() const
+{
+  return m_M_blocks;
+}
+
+const BlockDiagonalMass& RigidBody3DState::MinvBlocks() const
+{
+  return m_Minv_blocks;
+}
+
 const std::vector<bool>& RigidBody3DState::fixed() const
 {
   return m_fixed;
@@ -457,10 +473,19 @@ void RigidBody3DState::updateMandMinv()
       assert( Iinv.determinant() > 0.0 );
     }
   }
+  updateMassBlocks();
 
   assert( MathUtilities::isIdentity( m_M * m_Minv, 1.0e-9 ) );
 }
 
+void RigidBody3DState::updateMassBlocks()
+{
+  // Translational dofs precede rotational dofs and each body's mass fills three diagonal entries, so every 3x3
+  // diagonal block of M holds either a scaled identity or an inertia tensor
+  m_M_blocks.setFromSparse( m_M, 3 );
+  m_Minv_blocks.setFromSparse( m_Minv, 3 );
+}
+
 std::vector<std::unique_ptr<Force>>& RigidBody3DState::forces()
 {
   return m_forces;
@@ -582,27 +607,51 @@ const Vector3s& RigidBody3DState::boundaryMax() const
   return m_boundary_max;
 }
 
+void RigidBody3DState::setBroadPhase( const BroadPhase& broad_phase )
+{
+  m_broad_phase = broad_phase;
+}
+
+BroadPhase RigidBody3DState::broadPhase() const
+{
+  return m_broad_phase;
+}
+
 void RigidBody3DState::serialize( std::ostream& output_stream ) const
+{
+  assert( output_stream.good() );
+  serializeStatic( output_stream );
+  serializeDynamic( output_stream );
+}
+
+void RigidBody3DState::serializeStatic( std::ostream& output_stream ) const
 {
   assert( output_stream.good() );
 
   Utilities::serialize( m_nbodies, output_stream );
-  MathUtilities::serialize( m_q, output_stream );
-  MathUtilities::serialize( m_v, output_stream );
   MathUtilities::serialize( m_M0, output_stream );
   MathUtilities::serialize( m_Minv0, output_stream );
-  MathUtilities::serialize( m_M, output_stream );
-  MathUtilities::serialize( m_Minv, output_stream );
   Utilities::serialize( m_fixed, output_stream );
   Utilities::serialize( m_geometry, output_stream );
   Utilities::serialize( m_geometry_indices, output_stream );
+  Utilities::serialize( m_boundary_behavior, output_stream );
+  MathUtilities::serialize( m_boundary_min, output_stream );
+  MathUtilities::serialize( m_boundary_max, output_stream );
+  Utilities::serialize( m_broad_phase, output_stream );
+}
+
+void RigidBody3DState::serializeDynamic( std::ostream& output_stream ) const
+{
+  assert( output_stream.good() );
+
+  MathUtilities::serialize( m_q, output_stream );
+  MathUtilities::serialize( m_v, output_stream );
+  MathUtilities::serialize( m_M, output_stream );
+  MathUtilities::serialize( m_Minv, output_stream );
   Utilities::serialize( m_forces, output_stream );
   Utilities::serialize( m_static_planes, output_stream );
   Utilities::serialize( m_static_cylinders, output_stream );
   Utilities::serialize( m_planar_portals, output_stream );
-  Utilities::serialize( m_boundary_behavior, output_stream );
-  MathUtilities::serialize( m_boundary_min, output_stream );
-  MathUtilities::serialize( m_boundary_max, output_stream );
 }
 
 static std::vector<std::unique_ptr<RigidBodyGeometry>> deserializeGeometry( std::istream& input_stream )
@@ -657,23 +706,37 @@ static std::vector<std::unique_ptr<Force>> deserializeForces( std::istream& inpu
 }
 
 void RigidBody3DState::deserialize( std::istream& input_stream )
+{
+  assert( input_stream.good() );
+  deserializeStatic( input_stream );
+  deserializeDynamic( input_stream );
+}
+
+void RigidBody3DState::deserializeStatic( std::istream& input_stream )
 {
   assert( input_stream.good() );
   m_nbodies = Utilities::deserialize<unsigned>( input_stream );
-  m_q = MathUtilities::deserialize<VectorXs>( input_stream );
-  m_v = MathUtilities::deserialize<VectorXs>( input_stream );
   MathUtilities::deserialize( m_M0, input_stream );
   MathUtilities::deserialize( m_Minv0, input_stream );
-  MathUtilities::deserialize( m_M, input_stream );
-  MathUtilities::deserialize( m_Minv, input_stream );
   m_fixed = Utilities::deserialize<std::vector<bool>>( input_stream );
   m_geometry = deserializeGeometry( input_stream );
   m_geometry_indices = Utilities::deserialize<std::vector<unsigned>>( input_stream );
+  m_boundary_behavior = Utilities::deserialize<SimBoundaryBehavior>( input_stream );
+  m_boundary_min = MathUtilities::deserialize<Vector3s>( input_stream );
+  m_boundary_max = MathUtilities::deserialize<Vector3s>( input_stream );
+  m_broad_phase = Utilities::deserialize<BroadPhase>( input_stream );
+}
+
+void RigidBody3DState::deserializeDynamic( std::istream& input_stream )
+{
+  assert( input_stream.good() );
+  m_q = MathUtilities::deserialize<VectorXs>( input_stream );
+  m_v = MathUtilities::deserialize<VectorXs>( input_stream );
+  MathUtilities::deserialize( m_M, input_stream );
+  MathUtilities::deserialize( m_Minv, input_stream );
+  updateMassBlocks();
   m_forces = deserializeForces( input_stream );
   m_static_planes = Utilities::deserialize<std::vector<StaticPlane>>( input_stream );
   m_static_cylinders = Utilities::deserialize<std::vector<StaticCylinder>>( input_stream );
   m_planar_portals = Utilities::deserialize<std::vector<PlanarPortal>>( input_stream );
-  m_boundary_behavior = Utilities::deserialize<SimBoundaryBehavior>( input_stream );
-  m_boundary_min = MathUtilities::deserialize<Vector3s>( input_stream );
-  m_boundary_max = MathUtilities::deserialize<Vector3s>( input_stream );
 }
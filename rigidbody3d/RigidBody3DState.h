@@ -4,6 +4,8 @@
 #include <memory>
 
 #include "scisim/Math/MathDefines.h"
+#include "scisim/Math/BlockDiagonalMass.h"
+#include "scisim/CollisionDetection/BroadPhase.h"
 #include "Portals/PlanarPortal.h"
 #include "StaticGeometry/StaticCylinder.h"
 #include "Forces/Force.h"
@@ -55,6 +57,10 @@ public:
   SparseMatrixsc& Minv();
   const SparseMatrixsc& Minv() const;
 
+  // M and Minv as 3x3 blocks: the masses of the translational dofs and the world space inertia tensors
+  const BlockDiagonalMass& MBlocks() const;
+  const BlockDiagonalMass& MinvBlocks() const;
+
   const std::vector<bool>& fixed() const;
 
   bool isKinematicallyScripted( const unsigned bdy_idx ) const;
@@ -107,11 +113,24 @@ public:
   const Vector3s& boundaryMin() const;
   const Vector3s& boundaryMax() const;
 
+  // Broad phase used for body-body collision detection
+  void setBroadPhase( const BroadPhase& broad_phase );
+  BroadPhase broadPhase() const;
+
   void serialize( std::ostream& output_stream ) const;
   void deserialize( std::istream& input_stream );
 
+  // Static data (geometry, masses in the body frame, boundaries) are fixed once the state is set, while dynamic data
+  // (configuration, velocity, forces, scripted static geometry) change as the simulation runs. serialize writes both.
+  void serializeStatic( std::ostream& output_stream ) const;
+  void deserializeStatic( std::istream& input_stream );
+  void serializeDynamic( std::ostream& output_stream ) const;
+  void deserializeDynamic( std::istream& input_stream );
+
 private:
 
+  void updateMassBlocks();
+
   unsigned m_nbodies;
   VectorXs m_q;
   VectorXs m_v;
@@ -119,6 +138,8 @@ private:
   SparseMatrixsc m_Minv0;
   SparseMatrixsc m_M;
   SparseMatrixsc m_Minv;
+  BlockDiagonalMass m_M_blocks;
+  BlockDiagonalMass m_Minv_blocks;
   std::vector<bool> m_fixed;
   std::vector<std::unique_ptr<RigidBodyGeometry>> m_geometry;
   std::vector<unsigned> m_geometry_indices;
@@ -131,6 +152,8 @@ private:
   Vector3s m_boundary_min;
   Vector3s m_boundary_max;
 
+  BroadPhase m_broad_phase = BroadPhase::SPATIAL_GRID;
+
 };
 
 #endif
@@ -117,7 +117,7 @@ static void writeBoxGeometry( const std::vector<std::unique_ptr<RigidBodyGeometr
   const HDFGID grp_id{ output_file.findOrCreateGroup( group ) };
 
   // Create an HDF5 dataset
-  const HDFDID data_set{ H5Dcreate2( grp_id, "boxes", struct_tid, data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
+  const HDFDID data_set{ H5Dcreate2( grp_id, "boxes", output_file.storageType( struct_tid ), data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
   if( data_set < 0 )
   {
     throw std::string{ "Failed to create HDF dataset for box geometry" };
@@ -180,7 +180,7 @@ static void writeSphereGeometry( const std::vector<std::unique_ptr<RigidBodyGeom
   const HDFGID grp_id{ output_file.findOrCreateGroup( group ) };
 
   // Create an HDF5 dataset
-  const HDFDID data_set{ H5Dcreate2( grp_id, "spheres", struct_tid, data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
+  const HDFDID data_set{ H5Dcreate2( grp_id, "spheres", output_file.storageType( struct_tid ), data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
   if( data_set < 0 )
   {
     throw std::string{ "Failed to create HDF dataset for sphere geometry" };
@@ -258,7 +258,7 @@ static void writeMeshGeometry( const std::vector<std::unique_ptr<RigidBodyGeomet
   const HDFGID grp_id{ output_file.findOrCreateGroup( group ) };
 
   // Create an HDF5 dataset
-  const HDFDID data_set{ H5Dcreate2( grp_id, "meshes", struct_tid, data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
+  const HDFDID data_set{ H5Dcreate2( grp_id, "meshes", output_file.storageType( struct_tid ), data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
   if( data_set < 0 )
   {
     throw std::string{ "Failed to create HDF dataset for mesh geometry" };
@@ -413,7 +413,7 @@ void StateOutput::writeStaticPlanes( const std::vector<StaticPlane>& static_plan
   const HDFGID grp_id{ output_file.findOrCreateGroup( group ) };
 
   // Create an HDF5 dataset
-  const HDFDID data_set{ H5Dcreate2( grp_id, "static_planes", struct_tid, data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
+  const HDFDID data_set{ H5Dcreate2( grp_id, "static_planes", output_file.storageType( struct_tid ), data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
   if( data_set < 0 )
   {
     throw std::string{ "Failed to create HDF dataset for static planes" };
@@ -535,7 +535,7 @@ void StateOutput::writeStaticCylinders( const std::vector<StaticCylinder>& stati
   const HDFGID grp_id{ output_file.findOrCreateGroup( group ) };
 
   // Create an HDF5 dataset
-  const HDFDID data_set{ H5Dcreate2( grp_id, "static_cylinders", struct_tid, data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
+  const HDFDID data_set{ H5Dcreate2( grp_id, "static_cylinders", output_file.storageType( struct_tid ), data_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
   if( data_set < 0 )
   {
     throw std::string{ "Failed to create HDF dataset for static cylinders" };
@@ -6,8 +6,6 @@
 #ifndef STATE_OUTPUT_H
 #define STATE_OUTPUT_H
 
-// TODO: Template on float/double type, add cmake option to dump contents as different numerical type than the type used internally
-
 #include <vector>
 #include <iosfwd>
 #include <memory>
@@ -6,6 +6,7 @@
 #include "DMVMap.h"
 
 #include "scisim/UnconstrainedMaps/FlowableSystem.h"
+#include "scisim/Math/BlockDiagonalMass.h"
 
 #include <iostream>
 
@@ -127,7 +128,7 @@ void DMVMap::flow( const VectorXs& q0, const VectorXs& v0, FlowableSystem& fsys,
   const unsigned nbodies{ static_cast<unsigned>( q0.size() / 12 ) };
 
   q1 = q0;
-  v1 = fsys.M() * v0; // A bit of a misnomer as this actually stores momentum for most of this function
+  fsys.MBlocks().multiply( v0, v1 ); // A bit of a misnomer as this actually stores momentum for most of this function
 
   // Compute start force
   VectorXs F{ v0.size() };
@@ -146,7 +147,9 @@ void DMVMap::flow( const VectorXs& q0, const VectorXs& v0, FlowableSystem& fsys,
   }
 
   // Linear position update
-  const VectorXs q_update{ dt * v0 + 0.5 * dt * dt * fsys.Minv() * F };
+  VectorXs Minv_F{ v0.size() };
+  fsys.MinvBlocks().multiply( F, Minv_F );
+  const VectorXs q_update{ dt * v0 + 0.5 * dt * dt * Minv_F };
   for( unsigned bdy_idx = 0; bdy_idx < nbodies; ++bdy_idx )
   {
     if( fsys.isKinematicallyScripted( bdy_idx ) )
@@ -6,6 +6,7 @@
 #include "ExponentialEulerMap.h"
 
 #include "scisim/UnconstrainedMaps/FlowableSystem.h"
+#include "scisim/Math/BlockDiagonalMass.h"
 
 ExponentialEulerMap::~ExponentialEulerMap()
 {}
@@ -71,9 +72,10 @@ void ExponentialEulerMap::flow( const VectorXs& q0, const VectorXs& v0, Flowable
   }
 
   // Compute the acceleartion at ( q0, v0 )
+  VectorXs F{ v0.size() };
+  fsys.computeForce( q0, v0, next_time, F );
   VectorXs A{ v0.size() };
-  fsys.computeForce( q0, v0, next_time, A );
-  A = fsys.Minv() * A;
+  fsys.MinvBlocks().multiply( F, A );
 
   // For each body
   for( unsigned i = 0; i < nbodies; ++i )
@@ -0,0 +1,192 @@
+// contact_batch_tests.cpp
+//
+// Breannan Smith
+// Last updated: 10/17/2026
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rigidbody3d/RigidBody3DState.h"
+#include "rigidbody3d/Constraints/BodyBodyConstraint.h"
+#include "rigidbody3d/Constraints/KinematicObjectBodyConstraint.h"
+#include "rigidbody3d/Constraints/KinematicObjectSphereConstraint.h"
+#include "rigidbody3d/Constraints/SphereSphereConstraint.h"
+#include "rigidbody3d/Constraints/StaticPlaneBodyConstraint.h"
+#include "rigidbody3d/Constraints/StaticPlaneSphereConstraint.h"
+#include "rigidbody3d/Geometry/RigidBodySphere.h"
+#include "rigidbody3d/StaticGeometry/StaticPlane.h"
+#include "scisim/Constraints/ContactBatch.h"
+#include "scisim/UnconstrainedMaps/FlowableSubsystem.h"
+
+// One contact of each kind that rigidbody3d batches: sphere-sphere, body-body, sphere-plane against a moving plane,
+// body-plane, and sphere and body contacts with kinematic objects
+struct ContactsProblem final
+{
+  // The plane constraint refers to the plane, so the plane lives with it
+  StaticPlane plane{ Vector3s::Zero(), Vector3s{ 0.1, 1.0, -0.2 }.normalized() };
+  RigidBody3DState state;
+  VectorXs v;
+  std::vector<std::unique_ptr<Constraint>> active_set;
+};
+
+static void initializeContactsProblem( ContactsProblem& problem )
+{
+  std::vector<std::unique_ptr<RigidBodyGeometry>> geometry;
+  geometry.emplace_back( new RigidBodySphere{ 1.0 } );
+
+  const unsigned num_bodies{ 8 };
+  const std::vector<unsigned> geometry_indices( num_bodies, 0 );
+  const std::vector<bool> fixed( num_bodies, false );
+  std::vector<Vector3s> xs;
+  std::vector<Vector3s> vs;
+  std::vector<Vector3s> omegas;
+  std::vector<scalar> Ms;
+  std::vector<VectorXs> Rs;
+  std::vector<Vector3s> I0s;
+  for( unsigned body = 0; body < num_bodies; ++body )
+  {
+    xs.emplace_back( 2.5 * body, 1.0 + 0.2 * std::sin( 1.3 * body ), 0.3 * std::cos( 0.7 * body ) );
+    vs.emplace_back( 0.4 * std::cos( 2.3 * body ), -0.7 + 0.2 * std::sin( 0.9 * body ), 0.1 * body );
+    omegas.emplace_back( 0.5 * std::sin( 1.1 * body ), -0.3 * std::cos( 0.4 * body ), 0.8 - 0.1 * body );
+    scalar M;
+    Vector3s CM;
+    Vector3s I;
+    Matrix33sr R;
+    geometry[0]->computeMassAndInertia( 1.0 + 0.1 * scalar( body ), M, CM, I, R );
+    Ms.emplace_back( M );
+    Rs.emplace_back( Eigen::Map<const VectorXs>{ R.data(), 9 } );
+    I0s.emplace_back( I );
+  }
+  problem.state.setState( xs, vs, Ms, Rs, omegas, I0s, fixed, geometry_indices, geometry );
+  problem.v = problem.state.v();
+  const VectorXs& q{ problem.state.q() };
+
+  problem.plane.v() = Vector3s{ 0.3, 0.05, -0.2 };
+  problem.plane.omega() = Vector3s{ 0.1, 0.4, -0.3 };
+
+  const Vector3s n01{ ( xs[0] - xs[1] ).normalized() };
+  problem.active_set.emplace_back( new SphereSphereConstraint{ 0, 1, n01, xs[0] + 0.5 * ( xs[1] - xs[0] ), 1.0, 1.0 } );
+  problem.active_set.emplace_back( new BodyBodyConstraint{ 2, 3, Vector3s{ 6.2, 1.4, 0.1 }, Vector3s{ -0.9, 0.3, 0.2 }.normalized(), q } );
+  problem.active_set.emplace_back( new StaticPlaneSphereConstraint{ 4, 1.0, problem.plane, 0 } );
+  problem.active_set.emplace_back( new StaticPlaneBodyConstraint{ 5, Vector3s{ 12.3, 0.1, 0.4 }, problem.plane.n(), q, 0 } );
+  problem.active_set.emplace_back( new KinematicObjectSphereConstraint{ 6, 1.0, Vector3s{ 0.2, 0.9, 0.4 }.normalized(), 7, xs[7], Vector3s::Zero(), Vector3s::Zero() } );
+  problem.active_set.emplace_back( new KinematicObjectBodyConstraint{ 7, 6, Vector3s{ 17.1, 1.6, -0.3 }, Vector3s{ 0.7, -0.1, 0.5 }.normalized(), q } );
+  // A contact whose relative velocity lies along the normal, so the tangents come from the normal alone
+  problem.v.segment<3>( 3 * num_bodies ).setZero();
+  problem.v.segment<3>( 0 ) = problem.v.segment<3>( 3 ) + 0.4 * n01;
+  problem.v.segment<3>( 3 * ( num_bodies + 1 ) ).setZero();
+}
+
+// Assembles N, the bases, and D one constraint at a time through the virtual Constraint interface
+static void assembleVirtually( const VectorXs& q, const VectorXs& v, const std::vector<std::unique_ptr<Constraint>>& active_set, SparseMatrixsc& N, MatrixXXsc& impact_bases, MatrixXXsc& contact_bases, SparseMatrixsc& D )
+{
+  const int ncons{ int( active_set.size() ) };
+  const int ndofs{ int( v.size() ) };
+  const FlowableSubsystem fsys;
+
+  N.resize( ndofs, ncons );
+  VectorXi impact_nonzeros{ ncons };
+  VectorXi friction_nonzeros{ 2 * ncons };
+  for( int con = 0; con < ncons; ++con )
+  {
+    impact_nonzeros( con ) = active_set[con]->impactStencilSize();
+    friction_nonzeros.segment<2>( 2 * con ).setConstant( active_set[con]->frictionStencilSize() );
+  }
+  N.reserve( impact_nonzeros );
+  impact_bases.resize( 3, ncons );
+  contact_bases.resize( 3, 3 * ncons );
+  for( int con = 0; con < ncons; ++con )
+  {
+    active_set[con]->evalgradg( q, con, N, fsys );
+    VectorXs normal;
+    active_set[con]->getWorldSpaceContactNormal( q, normal );
+    impact_bases.col( con ) = normal;
+    MatrixXXsc basis;
+    active_set[con]->computeBasis( q, v, basis );
+    contact_bases.block<3,3>( 0, 3 * con ) = basis;
+  }
+  N.makeCompressed();
+
+  D.resize( ndofs, 2 * ncons );
+  D.reserve( friction_nonzeros );
+  for( int con = 0; con < ncons; ++con )
+  {
+    for( int sample = 0; sample < 2; ++sample )
+    {
+      active_set[con]->computeGeneralizedFrictionGivenTangentSample( q, contact_bases.col( 3 * con + sample + 1 ), unsigned( 2 * con + sample ), D );
+    }
+  }
+  D.makeCompressed();
+}
+
+// The batch must assemble the same N, bases, and D as the virtual interface
+static int executeVirtualComparisonTest()
+{
+  ContactsProblem problem;
+  initializeContactsProblem( problem );
+  const VectorXs& q{ problem.state.q() };
+  const unsigned ndofs{ unsigned( problem.v.size() ) };
+
+  SparseMatrixsc N_virtual;
+  MatrixXXsc impact_bases_virtual;
+  MatrixXXsc contact_bases_virtual;
+  SparseMatrixsc D_virtual;
+  assembleVirtually( q, problem.v, problem.active_set, N_virtual, impact_bases_virtual, contact_bases_virtual, D_virtual );
+
+  ContactBatch batch;
+  const bool batched{ batch.build( q, problem.active_set ) };
+  if( !batched )
+  {
+    std::cerr << "Failed to batch the contacts" << std::endl;
+    return EXIT_FAILURE;
+  }
+  SparseMatrixsc N;
+  batch.computeN( ndofs, N );
+  MatrixXXsc impact_bases;
+  batch.computeImpactBases( impact_bases );
+  MatrixXXsc contact_bases;
+  batch.computeContactBases( problem.v, contact_bases );
+  SparseMatrixsc D;
+  batch.computeD( ndofs, contact_bases, D );
+
+  // Both paths evaluate the same expressions, so only the order of floating point operations may differ
+  const scalar N_difference{ MatrixXXsc{ N - N_virtual }.lpNorm<Eigen::Infinity>() };
+  const scalar impact_bases_difference{ ( impact_bases - impact_bases_virtual ).lpNorm<Eigen::Infinity>() };
+  const scalar contact_bases_difference{ ( contact_bases - contact_bases_virtual ).lpNorm<Eigen::Infinity>() };
+  const scalar D_difference{ MatrixXXsc{ D - D_virtual }.lpNorm<Eigen::Infinity>() };
+  const scalar max_difference{ std::max( std::max( N_difference, D_difference ), std::max( impact_bases_difference, contact_bases_difference ) ) };
+
+  std::cout << "N difference:               " << N_difference << std::endl;
+  std::cout << "Impact bases difference:    " << impact_bases_difference << std::endl;
+  std::cout << "Contact bases difference:   " << contact_bases_difference << std::endl;
+  std::cout << "D difference:               " << D_difference << std::endl;
+
+  if( max_difference <= 1.0e-12 )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+int main( int argc, char** argv )
+{
+  if( argc != 2 )
+  {
+    std::cerr << "Usage: " << argv[0] << " test_name" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if( std::string{ argv[1] } == "virtual_comparison_00" )
+  {
+    return executeVirtualComparisonTest();
+  }
+
+  std::cerr << "Invalid test specified: " << argv[1] << std::endl;
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,179 @@
+// friction_residual_tests.cpp
+//
+// Breannan Smith
+// Last updated: 10/16/2026
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rigidbody3d/RigidBody3DState.h"
+#include "rigidbody3d/Constraints/SphereSphereConstraint.h"
+#include "rigidbody3d/Constraints/StaticPlaneSphereConstraint.h"
+#include "rigidbody3d/Geometry/RigidBodySphere.h"
+#include "rigidbody3d/StaticGeometry/StaticPlane.h"
+#include "scisim/ConstrainedMaps/FrictionResidual.h"
+#include "scisim/ConstrainedMaps/Sobogus.h"
+#include "scisim/Constraints/ContactBatch.h"
+#include "scisim/Math/BlockDiagonalMass.h"
+
+// Two spinning spheres resting against each other and on a plane, with a frictionless contact between the spheres
+struct SpheresProblem final
+{
+  // The plane constraints refer to the plane, so the plane lives with them
+  StaticPlane plane{ Vector3s::Zero(), Vector3s{ 0.0, 1.0, 0.0 } };
+  RigidBody3DState state;
+  VectorXs v0;
+  std::vector<std::unique_ptr<Constraint>> active_set;
+  VectorXs mu;
+  VectorXs CoR;
+};
+
+static void initializeSpheresProblem( SpheresProblem& problem )
+{
+  std::vector<std::unique_ptr<RigidBodyGeometry>> geometry;
+  geometry.emplace_back( new RigidBodySphere{ 1.0 } );
+
+  const std::vector<unsigned> geometry_indices{ 0, 0 };
+  const std::vector<Vector3s> xs{ Vector3s{ 0.0, 1.0, 0.0 }, Vector3s{ 1.9, 0.98, 0.1 } };
+  const std::vector<Vector3s> vs{ Vector3s{ 0.4, -0.7, 0.1 }, Vector3s{ -0.3, -0.2, 0.25 } };
+  const std::vector<Vector3s> omegas{ Vector3s{ 0.5, -0.3, 0.8 }, Vector3s{ -0.6, 0.2, 0.1 } };
+  const std::vector<bool> fixed{ false, false };
+
+  std::vector<scalar> Ms;
+  std::vector<VectorXs> Rs;
+  std::vector<Vector3s> I0s;
+  for( std::vector<unsigned>::size_type body = 0; body < geometry_indices.size(); ++body )
+  {
+    scalar M;
+    Vector3s CM;
+    Vector3s I;
+    Matrix33sr R;
+    geometry[geometry_indices[body]]->computeMassAndInertia( 1.0 + scalar( body ), M, CM, I, R );
+    Ms.emplace_back( M );
+    Rs.emplace_back( Eigen::Map<const VectorXs>{ R.data(), 9 } );
+    I0s.emplace_back( I );
+  }
+  problem.state.setState( xs, vs, Ms, Rs, omegas, I0s, fixed, geometry_indices, geometry );
+  problem.v0 = problem.state.v();
+
+  const Vector3s x0{ xs[0] };
+  const Vector3s x1{ xs[1] };
+  problem.active_set.emplace_back( new SphereSphereConstraint{ 0, 1, ( x0 - x1 ).normalized(), x0 + 0.5 * ( x1 - x0 ), 1.0, 1.0 } );
+  problem.active_set.emplace_back( new StaticPlaneSphereConstraint{ 0, 1.0, problem.plane, 0 } );
+  problem.active_set.emplace_back( new StaticPlaneSphereConstraint{ 1, 1.0, problem.plane, 0 } );
+
+  problem.mu.resize( 3 );
+  problem.mu << 0.0, 0.5, 0.3;
+  problem.CoR.resize( 3 );
+  problem.CoR << 0.5, 0.0, 1.0;
+}
+
+// Compares FrictionResidual with SobogusFrictionProblem::computeError for a set of impulses
+static bool residualsAgree( SpheresProblem& problem, const VectorXs& alpha, const VectorXs& beta, scalar& max_relative_difference )
+{
+  const unsigned ncons{ unsigned( problem.active_set.size() ) };
+  const VectorXs& q0{ problem.state.q() };
+
+  ContactBatch batch;
+  if( !batch.build( q0, problem.active_set ) )
+  {
+    std::cerr << "Failed to batch the contacts" << std::endl;
+    return false;
+  }
+  MatrixXXsc contact_bases;
+  batch.computeContactBases( problem.v0, contact_bases );
+  SparseMatrixsc N;
+  batch.computeN( unsigned( problem.v0.size() ), N );
+  SparseMatrixsc D;
+  batch.computeD( unsigned( problem.v0.size() ), contact_bases, D );
+  VectorXs nrel{ ncons };
+  VectorXs drel{ 2 * ncons };
+  Constraint::evalKinematicRelVelGivenBases( q0, problem.v0, problem.active_set, contact_bases, nrel, drel );
+
+  FrictionResidual residual;
+  residual.initialize( N, problem.v0, problem.CoR, nrel, drel );
+  const scalar residual_error{ residual.evalError( BlockDiagonalMass{ problem.state.Minv(), 3 }, N, D, problem.v0, problem.mu, alpha, beta ) };
+
+  SobogusFrictionProblem sobogus_problem{ SobogusSolverType::RigidBodies3D };
+  VectorXs masses;
+  sobogus_problem.flattenMass( problem.state.M(), masses );
+  sobogus_problem.initialize( problem.active_set, contact_bases, masses, q0, problem.v0, problem.CoR, problem.mu, nrel, drel );
+  VectorXs r{ 3 * ncons };
+  for( unsigned con_idx = 0; con_idx < ncons; ++con_idx )
+  {
+    r.segment<3>( 3 * con_idx ) = alpha( con_idx ) * contact_bases.col( 3 * con_idx ) + beta( 2 * con_idx ) * contact_bases.col( 3 * con_idx + 1 ) + beta( 2 * con_idx + 1 ) * contact_bases.col( 3 * con_idx + 2 );
+  }
+  const scalar sobogus_error{ sobogus_problem.computeError( r ) };
+
+  const scalar relative_difference{ std::fabs( residual_error - sobogus_error ) / std::max( scalar( 1.0 ), std::fabs( sobogus_error ) ) };
+  max_relative_difference = std::max( max_relative_difference, relative_difference );
+  return relative_difference <= 1.0e-10;
+}
+
+// Varies the impulses at every contact together and at each contact alone, so that each contact in turn, including
+// the frictionless one, determines the largest residual
+static int executeSobogusComparisonTest()
+{
+  SpheresProblem problem;
+  initializeSpheresProblem( problem );
+  const unsigned ncons{ unsigned( problem.active_set.size() ) };
+
+  bool all_agree{ true };
+  scalar max_relative_difference{ 0.0 };
+  unsigned num_cases{ 0 };
+  for( unsigned sample = 0; sample < 8; ++sample )
+  {
+    VectorXs alpha{ ncons };
+    VectorXs beta{ 2 * ncons };
+    for( unsigned con_idx = 0; con_idx < ncons; ++con_idx )
+    {
+      alpha( con_idx ) = std::fabs( std::sin( 1.3 * sample + 0.7 * con_idx ) );
+      beta( 2 * con_idx ) = 0.4 * std::cos( 0.9 * sample + 1.1 * con_idx );
+      beta( 2 * con_idx + 1 ) = 0.3 * std::sin( 2.1 * sample + 0.5 * con_idx );
+    }
+    all_agree = residualsAgree( problem, alpha, beta, max_relative_difference ) && all_agree;
+    ++num_cases;
+    for( unsigned con_idx = 0; con_idx < ncons; ++con_idx )
+    {
+      VectorXs alpha_single{ VectorXs::Zero( ncons ) };
+      VectorXs beta_single{ VectorXs::Zero( 2 * ncons ) };
+      alpha_single( con_idx ) = alpha( con_idx );
+      beta_single.segment<2>( 2 * con_idx ) = beta.segment<2>( 2 * con_idx );
+      all_agree = residualsAgree( problem, alpha_single, beta_single, max_relative_difference ) && all_agree;
+      ++num_cases;
+    }
+  }
+
+  std::cout << "Num cases:                  " << num_cases << std::endl;
+  std::cout << "Max relative difference:    " << max_relative_difference << std::endl;
+  std::cout << "Residuals agree:            " << all_agree << std::endl;
+
+  if( all_agree )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+int main( int argc, char** argv )
+{
+  if( argc != 2 )
+  {
+    std::cerr << "Usage: " << argv[0] << " test_name" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if( std::string{ argv[1] } == "sobogus_comparison_00" )
+  {
+    return executeSobogusComparisonTest();
+  }
+
+  std::cerr << "Invalid test specified: " << argv[1] << std::endl;
+  return EXIT_FAILURE;
+}
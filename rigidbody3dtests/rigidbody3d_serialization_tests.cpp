@@ -0,0 +1,194 @@
+// rigidbody3d_serialization_tests.cpp
+//
+// Breannan Smith
+// Last updated: 10/17/2026
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "rigidbody3d/PythonScripting.h"
+#include "rigidbody3d/RigidBody3DSim.h"
+#include "rigidbody3d/Forces/NearEarthGravityForce.h"
+#include "rigidbody3d/Geometry/RigidBodyBox.h"
+#include "rigidbody3d/Geometry/RigidBodySphere.h"
+#include "rigidbody3d/StaticGeometry/StaticCylinder.h"
+#include "rigidbody3d/StaticGeometry/StaticPlane.h"
+#include "rigidbody3d/UnconstrainedMaps/DMVMap.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorPGS.h"
+#include "scisim/Math/Rational.h"
+
+// A sphere, a rotated box, and a fixed box over a plane and inside a cylinder, under gravity
+static void initializeScene( RigidBody3DSim& sim )
+{
+  std::vector<std::unique_ptr<RigidBodyGeometry>> geometry;
+  geometry.emplace_back( new RigidBodySphere{ 0.5 } );
+  geometry.emplace_back( new RigidBodyBox{ Vector3s{ 0.5, 0.25, 1.0 } } );
+
+  const std::vector<unsigned> geometry_indices{ 0, 1, 1 };
+  const std::vector<Vector3s> x0s{ Vector3s{ 0.0, 1.0, 0.0 }, Vector3s{ 1.5, 2.0, -0.5 }, Vector3s{ -2.0, 0.25, 0.0 } };
+  const std::vector<Vector3s> rotation_vectors{ Vector3s::Zero(), Vector3s{ 0.3, -0.2, 0.7 }, Vector3s::Zero() };
+  const std::vector<bool> fixed{ false, false, true };
+
+  std::vector<Vector3s> xs;
+  std::vector<Vector3s> vs;
+  std::vector<scalar> Ms;
+  std::vector<VectorXs> Rs;
+  std::vector<Vector3s> omegas;
+  std::vector<Vector3s> I0s;
+  for( std::vector<unsigned>::size_type body = 0; body < geometry_indices.size(); ++body )
+  {
+    scalar M;
+    Vector3s CM;
+    Vector3s I;
+    Matrix33sr R;
+    geometry[geometry_indices[body]]->computeMassAndInertia( 1.0 + scalar( body ), M, CM, I, R );
+    if( rotation_vectors[body].norm() != 0.0 )
+    {
+      R = Eigen::AngleAxis<scalar>( rotation_vectors[body].norm(), rotation_vectors[body].normalized() ).matrix() * R;
+    }
+    xs.emplace_back( x0s[body] + CM );
+    vs.emplace_back( fixed[body] ? Vector3s::Zero() : Vector3s{ 0.1 * scalar( body ), -0.2, 0.3 } );
+    Ms.emplace_back( M );
+    Rs.emplace_back( Eigen::Map<const VectorXs>{ R.data(), 9 } );
+    omegas.emplace_back( fixed[body] ? Vector3s::Zero() : Vector3s{ 0.5, 0.1 * scalar( body ), -0.4 } );
+    I0s.emplace_back( I );
+  }
+
+  RigidBody3DState& state{ sim.getState() };
+  state.setState( xs, vs, Ms, Rs, omegas, I0s, fixed, geometry_indices, geometry );
+  state.addForce( NearEarthGravityForce{ Vector3s{ 0.0, -9.81, 0.0 } } );
+  state.addStaticPlane( StaticPlane{ Vector3s::Zero(), Vector3s{ 0.0, 1.0, 0.0 } } );
+  state.addStaticCylinder( StaticCylinder{ Vector3s::Zero(), Vector3s{ 0.0, 1.0, 0.0 }, 5.0 } );
+}
+
+static std::string serializeSim( const RigidBody3DSim& sim )
+{
+  std::ostringstream stream;
+  sim.serialize( stream );
+  return stream.str();
+}
+
+// Steps the simulation with the same integrator and impact operator as every other run of the test, so that two
+// simulations in the same state step to bit-identical states
+static void stepSim( RigidBody3DSim& sim, const unsigned first_iteration, const unsigned num_steps )
+{
+  PythonScripting call_back;
+  DMVMap umap;
+  LCPOperatorPGS imap{ 1.0e-12, 1000 };
+  const Rational<std::intmax_t> dt{ 1, 100 };
+  for( unsigned iteration = first_iteration; iteration < first_iteration + num_steps; ++iteration )
+  {
+    sim.flow( call_back, iteration, dt, umap, imap, 0.5 );
+  }
+}
+
+// Steps the original and the resumed simulation past the snapshot; the resumed run must track the uninterrupted one
+// exactly
+static bool resumedStepsMatch( RigidBody3DSim& sim, RigidBody3DSim& resumed_sim, const unsigned first_iteration )
+{
+  const unsigned num_steps{ 100 };
+  stepSim( sim, first_iteration, num_steps );
+  stepSim( resumed_sim, first_iteration, num_steps );
+  const RigidBody3DState& state{ sim.getState() };
+  const RigidBody3DState& resumed_state{ resumed_sim.getState() };
+  return state.q() == resumed_state.q() && state.v() == resumed_state.v();
+}
+
+// A delta snapshot resumes from the static data and the dynamic data written separately; the resumed simulation
+// must serialize to the same bytes as the original and step as the original does
+static int testDeltaResume()
+{
+  RigidBody3DSim sim;
+  initializeScene( sim );
+  const unsigned steps_before_snapshot{ 50 };
+  stepSim( sim, 1, steps_before_snapshot );
+  const std::string full_data{ serializeSim( sim ) };
+
+  std::ostringstream static_stream;
+  sim.serializeStatic( static_stream );
+  std::ostringstream dynamic_stream;
+  sim.serializeDynamic( dynamic_stream );
+
+  RigidBody3DSim resumed_sim;
+  {
+    std::istringstream static_input{ static_stream.str() };
+    resumed_sim.deserializeStatic( static_input );
+    std::istringstream dynamic_input{ dynamic_stream.str() };
+    resumed_sim.deserializeDynamic( dynamic_input );
+  }
+  const std::string resumed_data{ serializeSim( resumed_sim ) };
+
+  // A full snapshot holds the static data followed by the dynamic data
+  const bool split_matches{ static_stream.str() + dynamic_stream.str() == full_data };
+  const bool resume_matches{ resumed_data == full_data };
+  const bool steps_match{ resumedStepsMatch( sim, resumed_sim, steps_before_snapshot + 1 ) };
+
+  std::cout << "Static bytes:     " << static_stream.str().size() << std::endl;
+  std::cout << "Dynamic bytes:    " << dynamic_stream.str().size() << std::endl;
+  std::cout << "Full bytes:       " << full_data.size() << std::endl;
+  std::cout << "Split matches:    " << split_matches << std::endl;
+  std::cout << "Resume matches:   " << resume_matches << std::endl;
+  std::cout << "Steps match:      " << steps_match << std::endl;
+
+  if( split_matches && resume_matches && steps_match )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+// A full snapshot resumes to a simulation that serializes to the same bytes and steps as the original does
+static int testFullResume()
+{
+  RigidBody3DSim sim;
+  initializeScene( sim );
+  const unsigned steps_before_snapshot{ 50 };
+  stepSim( sim, 1, steps_before_snapshot );
+  const std::string full_data{ serializeSim( sim ) };
+
+  RigidBody3DSim resumed_sim;
+  {
+    std::istringstream input{ full_data };
+    resumed_sim.deserialize( input );
+  }
+  const bool resume_matches{ serializeSim( resumed_sim ) == full_data };
+  const bool steps_match{ resumedStepsMatch( sim, resumed_sim, steps_before_snapshot + 1 ) };
+
+  std::cout << "Full bytes:       " << full_data.size() << std::endl;
+  std::cout << "Resume matches:   " << resume_matches << std::endl;
+  std::cout << "Steps match:      " << steps_match << std::endl;
+
+  if( resume_matches && steps_match )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+int main( int argc, char** argv )
+{
+  if( argc != 2 )
+  {
+    std::cerr << "Usage: " << argv[0] << " test_name" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if( std::string{ argv[1] } == "delta_resume" )
+  {
+    return testDeltaResume();
+  }
+  else if( std::string{ argv[1] } == "full_resume" )
+  {
+    return testFullResume();
+  }
+
+  std::cerr << "Invalid test specified: " << argv[1] << std::endl;
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,218 @@
+// signed_distance_field_tests.cpp
+//
+// Breannan Smith
+// Last updated: 10/17/2026
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include "rigidbody3d/Geometry/SignedDistanceField.h"
+
+// Values of a field that is far from the surface everywhere except in a thin slab, but whose least squares plane over
+// the first column of bricks dips through zero
+static VectorXs steepFarField( const Vector3u& grid_dimensions )
+{
+  VectorXs signed_distance{ grid_dimensions.prod() };
+  for( unsigned k = 0; k < grid_dimensions.z(); ++k )
+  {
+    for( unsigned j = 0; j < grid_dimensions.y(); ++j )
+    {
+      for( unsigned i = 0; i < grid_dimensions.x(); ++i )
+      {
+        const scalar value{ 1.05 + 10.0 * std::max( 0.0, 2.0 - scalar( i ) ) - ( k > 15 ? 30.0 : 0.0 ) };
+        signed_distance( ( k * grid_dimensions.y() + j ) * grid_dimensions.x() + i ) = value;
+      }
+    }
+  }
+  return signed_distance;
+}
+
+// Checks that every cell corner of the compact field has the sign of the dense field, and that corners that are at
+// least band from the surface in the dense field stay at least band from it
+static int testPlaneSign( const SDFPrecision precision )
+{
+  const Vector3u grid_dimensions{ 22, 22, 22 };
+  const scalar band{ 1.0 };
+  const VectorXs signed_distance{ steepFarField( grid_dimensions ) };
+  const SignedDistanceField field{ grid_dimensions, signed_distance, precision, band };
+
+  unsigned num_sign_errors{ 0 };
+  unsigned num_band_errors{ 0 };
+  std::array<scalar,8> corners;
+  for( unsigned k = 0; k + 1 < grid_dimensions.z(); ++k )
+  {
+    for( unsigned j = 0; j + 1 < grid_dimensions.y(); ++j )
+    {
+      for( unsigned i = 0; i + 1 < grid_dimensions.x(); ++i )
+      {
+        field.cellCorners( Array3u{ i, j, k }, corners );
+        for( unsigned corner = 0; corner < 8; ++corner )
+        {
+          const Array3u node{ i + ( corner & 1 ), j + ( ( corner >> 1 ) & 1 ), k + ( ( corner >> 2 ) & 1 ) };
+          const scalar value{ signed_distance( ( node.z() * grid_dimensions.y() + node.y() ) * grid_dimensions.x() + node.x() ) };
+          if( ( value > 0.0 ) != ( corners[corner] > 0.0 ) )
+          {
+            ++num_sign_errors;
+          }
+          // Half precision rounds values near the band by up to a part in a thousand
+          if( std::fabs( value ) >= band && std::fabs( corners[corner] ) < band * ( 1.0 - 1.0e-3 ) )
+          {
+            ++num_band_errors;
+          }
+        }
+      }
+    }
+  }
+
+  std::cout << "Bytes:        " << field.bytes() << std::endl;
+  std::cout << "Sign errors:  " << num_sign_errors << std::endl;
+  std::cout << "Band errors:  " << num_band_errors << std::endl;
+
+  if( num_sign_errors == 0 && num_band_errors == 0 )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+// Whether two fields hold the same value at every cell corner
+static bool sameCorners( const SignedDistanceField& field0, const SignedDistanceField& field1 )
+{
+  const Vector3u grid_dimensions{ field0.gridDimensions() };
+  if( field1.gridDimensions() != grid_dimensions )
+  {
+    return false;
+  }
+  std::array<scalar,8> corners0;
+  std::array<scalar,8> corners1;
+  for( unsigned k = 0; k + 1 < grid_dimensions.z(); ++k )
+  {
+    for( unsigned j = 0; j + 1 < grid_dimensions.y(); ++j )
+    {
+      for( unsigned i = 0; i + 1 < grid_dimensions.x(); ++i )
+      {
+        field0.cellCorners( Array3u{ i, j, k }, corners0 );
+        field1.cellCorners( Array3u{ i, j, k }, corners1 );
+        if( corners0 != corners1 )
+        {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// A cached field is mapped without loading the dense values again, and a damaged cache entry is rebuilt rather than
+// ending the run
+static int testCacheRebuild()
+{
+  const Vector3u grid_dimensions{ 22, 22, 22 };
+  const scalar band{ 1.0 };
+  const SignedDistanceField reference_field{ grid_dimensions, steepFarField( grid_dimensions ), SDFPrecision::SINGLE, band };
+
+  // The cache is keyed by the mesh file's metadata only, so any file stands in for the mesh
+  const std::string mesh_file_name{ "signed_distance_field_tests_mesh.h5" };
+  std::ofstream{ mesh_file_name } << "mesh";
+
+  unsigned num_loads{ 0 };
+  const auto load_signed_distance = [&grid_dimensions,&num_loads]()
+  {
+    ++num_loads;
+    return steepFarField( grid_dimensions );
+  };
+  const auto load_cached = [&]()
+  {
+    return SignedDistanceField::loadCached( ".", mesh_file_name, grid_dimensions, SDFPrecision::SINGLE, band, load_signed_distance );
+  };
+
+  std::string cache_file_name;
+  bool fields_match{ true };
+  {
+    const std::shared_ptr<const SignedDistanceField> field{ load_cached() };
+    cache_file_name = field->fileName();
+    fields_match = fields_match && sameCorners( *field, reference_field );
+  }
+  {
+    const std::shared_ptr<const SignedDistanceField> field{ load_cached() };
+    fields_match = fields_match && sameCorners( *field, reference_field );
+  }
+  const bool cache_hit{ num_loads == 1 };
+
+  // Truncate the entry
+  {
+    std::ifstream input_file{ cache_file_name, std::ios::binary };
+    std::string data{ std::istreambuf_iterator<char>{ input_file }, std::istreambuf_iterator<char>{} };
+    input_file.close();
+    std::ofstream{ cache_file_name, std::ios::binary | std::ios::trunc }.write( data.data(), std::streamsize( data.size() / 2 ) );
+  }
+  {
+    const std::shared_ptr<const SignedDistanceField> field{ load_cached() };
+    fields_match = fields_match && sameCorners( *field, reference_field );
+  }
+  const bool truncated_rebuilt{ num_loads == 2 };
+
+  // Overwrite the magic number of a complete entry
+  {
+    std::fstream file{ cache_file_name, std::ios::binary | std::ios::in | std::ios::out };
+    file.write( "XXXXXXXX", 8 );
+  }
+  {
+    const std::shared_ptr<const SignedDistanceField> field{ load_cached() };
+    fields_match = fields_match && sameCorners( *field, reference_field );
+  }
+  const bool invalid_rebuilt{ num_loads == 3 };
+
+  std::remove( cache_file_name.c_str() );
+  std::remove( mesh_file_name.c_str() );
+
+  std::cout << "Cache hit:          " << cache_hit << std::endl;
+  std::cout << "Truncated rebuilt:  " << truncated_rebuilt << std::endl;
+  std::cout << "Invalid rebuilt:    " << invalid_rebuilt << std::endl;
+  std::cout << "Fields match:       " << fields_match << std::endl;
+
+  if( cache_hit && truncated_rebuilt && invalid_rebuilt && fields_match )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+int main( int argc, char** argv )
+{
+  if( argc != 2 )
+  {
+    std::cerr << "Usage: " << argv[0] << " test_name" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if( std::string{ argv[1] } == "plane_sign_double" )
+  {
+    return testPlaneSign( SDFPrecision::DOUBLE );
+  }
+  else if( std::string{ argv[1] } == "plane_sign_single" )
+  {
+    return testPlaneSign( SDFPrecision::SINGLE );
+  }
+  else if( std::string{ argv[1] } == "plane_sign_half" )
+  {
+    return testPlaneSign( SDFPrecision::HALF );
+  }
+  else if( std::string{ argv[1] } == "cache_rebuild" )
+  {
+    return testCacheRebuild();
+  }
+
+  std::cerr << "Invalid test specified: " << argv[1] << std::endl;
+  return EXIT_FAILURE;
+}
@@ -17,6 +17,12 @@
 #include "scisim/ConstrainedMaps/ImpactMaps/GROperator.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/GRROperator.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorPI.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorPGS.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorSparseActiveSet.h"
+#include "scisim/ConstrainedMaps/FrictionMaps/MDPOperatorSparseActiveSet.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorComparison.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorIslands.h"
+#include "scisim/ConstrainedMaps/FrictionSolverIslands.h"
 #include "scisim/ConstrainedMaps/GeometricImpactFrictionMap.h"
 #include "scisim/ConstrainedMaps/StabilizedImpactFrictionMap.h"
 #include "scisim/ConstrainedMaps/SymplecticEulerImpactFrictionMap.h"
@@ -256,9 +262,47 @@ static bool loadSimState( const rapidxml::xml_node<>& node, RigidBody3DState& si
         }
         mesh_file_name = attrib->value();
       }
+      // Optional compact storage of the signed distance field
+      SDFStorageOptions sdf_options;
+      if( nd->first_attribute( "sdf_precision" ) )
+      {
+        const std::string precision{ nd->first_attribute( "sdf_precision" )->value() };
+        if( precision == "double" )
+        {
+          sdf_options.precision = SDFPrecision::DOUBLE;
+        }
+        else if( precision == "single" )
+        {
+          sdf_options.precision = SDFPrecision::SINGLE;
+        }
+        else if( precision == "half" )
+        {
+          sdf_options.precision = SDFPrecision::HALF;
+        }
+        else
+        {
+          std::cerr << "Failed to parse sdf_precision attribute for mesh geometry, must be one of double, single, or half" << std::endl;
+          return false;
+        }
+        sdf_options.compact = true;
+      }
+      if( nd->first_attribute( "sdf_band" ) )
+      {
+        if( !StringUtilities::extractFromString( nd->first_attribute( "sdf_band" )->value(), sdf_options.band ) || sdf_options.band < 0.0 )
+        {
+          std::cerr << "Failed to parse sdf_band attribute for mesh geometry, must provide a non-negative scalar" << std::endl;
+          return false;
+        }
+        sdf_options.compact = true;
+      }
+      if( nd->first_attribute( "sdf_cache" ) )
+      {
+        sdf_options.cache_directory = nd->first_attribute( "sdf_cache" )->value();
+        sdf_options.compact = true;
+      }
       try
       {
-        geometry.emplace_back( new RigidBodyTriangleMesh{ mesh_file_name } );
+        geometry.emplace_back( new RigidBodyTriangleMesh{ mesh_file_name, sdf_options } );
       }
       catch( const std::string& error )
       {
@@ -1242,6 +1286,32 @@ static bool loadMaxIters( const rapidxml::xml_node<>& node, const std::string& s
   return true;
 }
 
+static bool loadPreconditioner( const rapidxml::xml_node<>& node, const std::string& solver_name, LCPOperatorPI::Preconditioner& preconditioner )
+{
+  // The preconditioner is optional, defaulting to incomplete Cholesky
+  const rapidxml::xml_attribute<>* const precon_nd{ node.first_attribute( "preconditioner" ) };
+  if( precon_nd == nullptr )
+  {
+    preconditioner = LCPOperatorPI::Preconditioner::IncompleteCholesky;
+    return true;
+  }
+  const std::string preconditioner_name{ precon_nd->value() };
+  if( preconditioner_name == "incomplete_cholesky" )
+  {
+    preconditioner = LCPOperatorPI::Preconditioner::IncompleteCholesky;
+  }
+  else if( preconditioner_name == "jacobi" )
+  {
+    preconditioner = LCPOperatorPI::Preconditioner::Jacobi;
+  }
+  else
+  {
+    std::cerr << "Invalid preconditioner for " << solver_name << " solver: " << preconditioner_name << ", must be incomplete_cholesky or jacobi" << std::endl;
+    return false;
+  }
+  return true;
+}
+
 static bool loadLCPSolver( const rapidxml::xml_node<>& node, std::unique_ptr<ImpactOperator>& impact_operator )
 {
   const rapidxml::xml_attribute<>* const nd{ node.first_attribute( "name" ) };
@@ -1258,8 +1328,39 @@ static bool loadLCPSolver( const rapidxml::xml_node<>& node, std::unique_ptr<Imp
     scalar tol;
     unsigned max_iters;
     if (!loadTolerance(node, solver_name, tol)) return false;
+    LCPOperatorPI::Preconditioner preconditioner;
     if (!loadMaxIters(node, solver_name, max_iters)) return false;
-    impact_operator.reset(new LCPOperatorPI {tol, max_iters});
+    if (!loadPreconditioner(node, solver_name, preconditioner)) return false;
+    impact_operator.reset(new LCPOperatorPI {tol, max_iters, preconditioner});
+  }
+  else if( solver_name == "pgs" )
+  {
+    // Without a tolerance, projected Gauss-Seidel runs a fixed number of sweeps
+    scalar tol{ 0.0 };
+    if( node.first_attribute( "tol" ) != nullptr && !loadTolerance( node, solver_name, tol ) )
+    {
+      return false;
+    }
+    unsigned max_iters;
+    if( !loadMaxIters( node, solver_name, max_iters ) )
+    {
+      return false;
+    }
+    impact_operator.reset( new LCPOperatorPGS{ tol, max_iters } );
+  }
+  else if( solver_name == "sparse_active_set" )
+  {
+    scalar tol;
+    if( !loadTolerance( node, solver_name, tol ) )
+    {
+      return false;
+    }
+    unsigned max_iters;
+    if( !loadMaxIters( node, solver_name, max_iters ) )
+    {
+      return false;
+    }
+    impact_operator.reset( new LCPOperatorSparseActiveSet{ tol, max_iters } );
   }
   #ifdef QL_FOUND
   else if( solver_name == "ql_vp" )
@@ -1462,6 +1563,62 @@ static bool loadImpactOperatorNoCoR( const rapidxml::xml_node<>& node, std::uniq
 
     impact_operator.reset( new GRROperator{ *elastic_operator, *inelastic_operator } );
   }
+  else if( type == "compare" )
+  {
+    // Attempt to load the file that receives the per-operator results
+    std::string output_file_name;
+    {
+      const rapidxml::xml_attribute<>* const file_nd{ node.first_attribute( "output_file" ) };
+      if( file_nd == nullptr )
+      {
+        std::cerr << "Could not locate output_file for compare impact_operator" << std::endl;
+        return false;
+      }
+      output_file_name = file_nd->value();
+    }
+
+    // Load each operator to compare; the first operator's impulses are applied to the system
+    std::vector<std::unique_ptr<ImpactOperator>> operators;
+    for( const rapidxml::xml_node<>* operator_node = node.first_node( "operator" ); operator_node != nullptr; operator_node = operator_node->next_sibling( "operator" ) )
+    {
+      operators.emplace_back( nullptr );
+      if( !loadImpactOperatorNoCoR( *operator_node, operators.back() ) )
+      {
+        std::cerr << "Failed to load operator for compare impact_operator" << std::endl;
+        return false;
+      }
+    }
+    if( operators.empty() )
+    {
+      std::cerr << "Failed to locate operator for compare impact_operator" << std::endl;
+      return false;
+    }
+
+    impact_operator.reset( new ImpactOperatorComparison{ operators, output_file_name } );
+  }
+  else if( type == "islands" )
+  {
+    // Load the operator that solves each island
+    const rapidxml::xml_node<>* const operator_node{ node.first_node( "operator" ) };
+    if( operator_node == nullptr )
+    {
+      std::cerr << "Failed to locate operator for islands impact_operator" << std::endl;
+      return false;
+    }
+    std::unique_ptr<ImpactOperator> island_operator;
+    if( !loadImpactOperatorNoCoR( *operator_node, island_operator ) )
+    {
+      std::cerr << "Failed to load operator for islands impact_operator" << std::endl;
+      return false;
+    }
+    if( island_operator->indexesConstraints() )
+    {
+      std::cerr << "Error, islands impact_operator does not support operator " << island_operator->name() << ", which indexes constraints by column" << std::endl;
+      return false;
+    }
+
+    impact_operator.reset( new ImpactOperatorIslands{ *island_operator } );
+  }
   else
   {
     return false;
@@ -1504,8 +1661,23 @@ static bool loadSmoothFrictionOperatorNoMu( const rapidxml::xml_node<>& node, st
     solver_name = attrib_nd->value();
   }
 
+  if( solver_name == "sparse_active_set" )
+  {
+    scalar tol;
+    if( !loadTolerance( node, solver_name, tol ) )
+    {
+      return false;
+    }
+    unsigned max_iters;
+    if( !loadMaxIters( node, solver_name, max_iters ) )
+    {
+      return false;
+    }
+    // Two friction impulses per contact, kept in the friction disk
+    friction_operator.reset( new MDPOperatorSparseActiveSet{ 2, tol, max_iters } );
+  }
   #ifdef IPOPT_FOUND
-  if( solver_name == "ipopt" )
+  else if( solver_name == "ipopt" )
   {
     // Attempt to read the desired linear solvers
     std::vector<std::string> linear_solvers;
@@ -1556,6 +1728,7 @@ static bool loadSmoothFrictionOperatorNoMu( const rapidxml::xml_node<>& node, st
 
     friction_operator.reset( new SmoothMDPOperatorIpopt{ linear_solvers, con_tol } );
   }
+  #endif
   else
   {
     std::cerr << "Error, invalid smooth friction solver: " << solver_name << std::endl;
@@ -1563,10 +1736,6 @@ static bool loadSmoothFrictionOperatorNoMu( const rapidxml::xml_node<>& node, st
   }
 
   return true;
-  #else
-  std::cerr << "Error, invalid smooth friction solver: " << solver_name << std::endl;
-  return false;
-  #endif
 }
 
 // Example:
@@ -1574,6 +1743,28 @@ static bool loadSmoothFrictionOperatorNoMu( const rapidxml::xml_node<>& node, st
 //    <lcp_impact_solver name="ipopt" tol="1.0e-12" linear_solvers="ma97"/>
 //    <mdp_friction_solver name="ipopt" tol="1.0e-12" linear_solvers="ma97"/>
 //  </staggered_projections_friction_solver>
+// Wraps the friction solver so that independent islands of contacts are solved separately, if requested
+static bool loadFrictionSolverIslands( const rapidxml::xml_node<>& node, std::unique_ptr<FrictionSolver>& friction_solver )
+{
+  const rapidxml::xml_attribute<>* const islands_nd{ node.first_attribute( "islands" ) };
+  if( islands_nd == nullptr )
+  {
+    return true;
+  }
+  bool islands;
+  if( !StringUtilities::extractFromString( std::string{ islands_nd->value() }, islands ) )
+  {
+    std::cerr << "Failed to parse islands attribute, value must be a boolean" << std::endl;
+    return false;
+  }
+  if( islands )
+  {
+    assert( friction_solver != nullptr );
+    friction_solver.reset( new FrictionSolverIslands{ *friction_solver } );
+  }
+  return true;
+}
+
 static bool loadStaggeredProjectionsFrictionSolver( const rapidxml::xml_node<>& node, scalar& mu, scalar& CoR, std::unique_ptr<FrictionSolver>& friction_solver, std::unique_ptr<ImpactFrictionMap>& if_map )
 {
   // Friction solver setup
@@ -2233,6 +2424,31 @@ static bool loadSimulationBoundary( const rapidxml::xml_node<>& node, RigidBody3
 
 // TODO: Do some kind of boost-optional thing to grab const refs to nodes, but not have to do first_node twice
 
+static bool loadBroadPhase( const rapidxml::xml_node<>& node, BroadPhase& broad_phase )
+{
+  const rapidxml::xml_attribute<>* type_attrib{ node.first_attribute( "type" ) };
+  if( type_attrib == nullptr )
+  {
+    std::cerr << "Failed to locate type attribute for broad_phase." << std::endl;
+    return false;
+  }
+  const std::string type_string{ type_attrib->value() };
+  if( type_string == "spatial_grid" )
+  {
+    broad_phase = BroadPhase::SPATIAL_GRID;
+  }
+  else if( type_string == "sweep_and_prune" )
+  {
+    broad_phase = BroadPhase::SWEEP_AND_PRUNE;
+  }
+  else
+  {
+    std::cerr << "Invalid broad_phase type specified. Valid options are: spatial_grid, sweep_and_prune." << std::endl;
+    return false;
+  }
+  return true;
+}
+
 bool RigidBody3DSceneParser::parseXMLSceneFile( const std::string& file_name, std::string& scripting_callback, RigidBody3DState& sim_state, std::unique_ptr<UnconstrainedMap>& unconstrained_map, std::string& dt_string, Rational<std::intmax_t>& dt, scalar& end_time, std::unique_ptr<ImpactOperator>& impact_operator, scalar& CoR, std::unique_ptr<FrictionSolver>& friction_solver, scalar& mu, std::unique_ptr<ImpactFrictionMap>& if_map, RenderingState& rendering_state )
 {
   // Attempt to load the xml document
@@ -2340,6 +2556,11 @@ bool RigidBody3DSceneParser::parseXMLSceneFile( const std::string& file_name, st
       std::cerr << "Failed to load staggered_projections_friction_solver in xml scene file: " << file_name << std::endl;
       return false;
     }
+    if( !loadFrictionSolverIslands( *root_node.first_node( "staggered_projections_friction_solver" ), friction_solver ) )
+    {
+      std::cerr << "Failed to load islands for staggered_projections_friction_solver in xml scene file: " << file_name << std::endl;
+      return false;
+    }
   }
 
   // Load a Sobogus friction solver, if present
@@ -2360,6 +2581,11 @@ bool RigidBody3DSceneParser::parseXMLSceneFile( const std::string& file_name, st
       std::cerr << "Failed to load sobogus_friction_solver in xml scene file: " << file_name << std::endl;
       return false;
     }
+    if( !loadFrictionSolverIslands( *root_node.first_node( "sobogus_friction_solver" ), friction_solver ) )
+    {
+      std::cerr << "Failed to load islands for sobogus_friction_solver in xml scene file: " << file_name << std::endl;
+      return false;
+    }
   }
 
   // Load a GRR friction solver, if present
@@ -2380,6 +2606,11 @@ bool RigidBody3DSceneParser::parseXMLSceneFile( const std::string& file_name, st
       std::cerr << "Failed to load grr_friction_solver in xml scene file: " << file_name << std::endl;
       return false;
     }
+    if( !loadFrictionSolverIslands( *root_node.first_node( "grr_friction_solver" ), friction_solver ) )
+    {
+      std::cerr << "Failed to load islands for grr_friction_solver in xml scene file: " << file_name << std::endl;
+      return false;
+    }
   }
 
   // Load simulation bounds, if present
@@ -2434,5 +2665,17 @@ bool RigidBody3DSceneParser::parseXMLSceneFile( const std::string& file_name, st
     return false;
   }
 
+  // Attempt to load the broad phase, if present
+  if( root_node.first_node( "broad_phase" ) != nullptr )
+  {
+    BroadPhase broad_phase;
+    if( !loadBroadPhase( *root_node.first_node( "broad_phase" ), broad_phase ) )
+    {
+      std::cerr << "Failed to load broad_phase in xml scene file: " << file_name << std::endl;
+      return false;
+    }
+    sim_state.setBroadPhase( broad_phase );
+  }
+
   return true;
 }
@@ -49,7 +49,38 @@ bool XMLExporter::saveToXMLFile( const std::string& file_name, const RigidBody3D
       case RigidBodyGeometryType::TRIANGLE_MESH:
       {
         const RigidBodyTriangleMesh& tri_mesh{ static_cast<RigidBodyTriangleMesh&>( *geo.get() ) };
-        xml_file << "  <geometry type=\"mesh\" filename=\"" << tri_mesh.inputFileName() << "\"/>" << std::endl;
+        xml_file << "  <geometry type=\"mesh\" filename=\"" << tri_mesh.inputFileName() << "\"";
+        const SDFStorageOptions& sdf_options{ tri_mesh.sdfStorageOptions() };
+        if( sdf_options.compact )
+        {
+          switch( sdf_options.precision )
+          {
+            case SDFPrecision::DOUBLE:
+            {
+              xml_file << " sdf_precision=\"double\"";
+              break;
+            }
+            case SDFPrecision::SINGLE:
+            {
+              xml_file << " sdf_precision=\"single\"";
+              break;
+            }
+            case SDFPrecision::HALF:
+            {
+              xml_file << " sdf_precision=\"half\"";
+              break;
+            }
+          }
+          if( sdf_options.band != SCALAR_INFINITY )
+          {
+            xml_file << " sdf_band=\"" << sdf_options.band << "\"";
+          }
+          if( !sdf_options.cache_directory.empty() )
+          {
+            xml_file << " sdf_cache=\"" << sdf_options.cache_directory << "\"";
+          }
+        }
+        xml_file << "/>" << std::endl;
         break;
       }
     }
@@ -0,0 +1,154 @@
+#include "AsyncWriter.h"
+
+#include <cassert>
+#include <exception>
+#include <fstream>
+#include <iostream>
+
+AsyncWriter::AsyncWriter( const unsigned max_pending )
+: m_max_pending( max_pending )
+, m_mutex()
+, m_job_queued()
+, m_job_done()
+, m_jobs()
+, m_stop( false )
+, m_failed( false )
+, m_error()
+, m_thread()
+{}
+
+AsyncWriter::~AsyncWriter()
+{
+  if( !m_thread.joinable() )
+  {
+    return;
+  }
+  // Write out whatever is still queued before shutting down
+  {
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    m_stop = true;
+  }
+  m_job_queued.notify_one();
+  m_thread.join();
+  if( m_failed )
+  {
+    std::cerr << "Asynchronous output failed: " << m_error << std::endl;
+  }
+}
+
+void AsyncWriter::setMaxPending( const unsigned max_pending )
+{
+  assert( !m_thread.joinable() );
+  m_max_pending = max_pending;
+}
+
+bool AsyncWriter::threaded() const
+{
+  return m_max_pending != 0;
+}
+
+void AsyncWriter::submit( std::function<void()> job )
+{
+  if( !threaded() )
+  {
+    job();
+    return;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock{ m_mutex };
+    m_job_done.wait( lock, [this]{ return m_failed || m_jobs.size() < m_max_pending; } );
+    throwIfFailed();
+    m_jobs.emplace_back( std::move( job ) );
+  }
+  if( !m_thread.joinable() )
+  {
+    m_thread = std::thread{ &AsyncWriter::run, this };
+  }
+  m_job_queued.notify_one();
+}
+
+void AsyncWriter::finish()
+{
+  if( !m_thread.joinable() )
+  {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    m_stop = true;
+  }
+  m_job_queued.notify_one();
+  m_thread.join();
+  m_stop = false;
+  throwIfFailed();
+}
+
+void AsyncWriter::writeFile( const std::string& file_name, const std::string& contents )
+{
+  std::ofstream output_stream{ file_name, std::ios::binary | std::ios::trunc };
+  if( !output_stream.is_open() )
+  {
+    throw std::string{ "Failed to open file: " } + file_name;
+  }
+  output_stream.write( contents.data(), std::streamsize( contents.size() ) );
+  output_stream.close();
+  if( !output_stream )
+  {
+    throw std::string{ "Failed to write file: " } + file_name;
+  }
+}
+
+void AsyncWriter::run()
+{
+  while( true )
+  {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock{ m_mutex };
+      m_job_queued.wait( lock, [this]{ return m_stop || !m_jobs.empty(); } );
+      if( m_jobs.empty() )
+      {
+        return;
+      }
+      job = std::move( m_jobs.front() );
+      m_jobs.pop_front();
+    }
+
+    std::string error;
+    bool failed{ false };
+    try
+    {
+      job();
+    }
+    catch( const std::string& job_error )
+    {
+      error = job_error;
+      failed = true;
+    }
+    catch( const std::exception& job_error )
+    {
+      error = job_error.what();
+      failed = true;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock{ m_mutex };
+      if( failed )
+      {
+        m_failed = true;
+        m_error = error;
+        m_jobs.clear();
+      }
+    }
+    m_job_done.notify_all();
+  }
+}
+
+void AsyncWriter::throwIfFailed() const
+{
+  if( m_failed )
+  {
+    throw m_error;
+  }
+}
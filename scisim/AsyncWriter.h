@@ -0,0 +1,62 @@
+#ifndef ASYNC_WRITER_H
+#define ASYNC_WRITER_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Runs output jobs in submission order on a dedicated thread, so a simulation can keep stepping while earlier frames
+// are written to disk. Jobs must own copies of the data they write. At most max_pending jobs wait behind the one being
+// written; submitting to a full queue blocks until the writer catches up. Jobs report errors by throwing a
+// std::string. After a job fails the remaining jobs are discarded and the error is rethrown to the submitting thread.
+class AsyncWriter final
+{
+
+public:
+
+  // With a max_pending of zero no thread is started and every job runs in submit
+  explicit AsyncWriter( const unsigned max_pending = 0 );
+  ~AsyncWriter();
+
+  AsyncWriter( const AsyncWriter& ) = delete;
+  AsyncWriter& operator=( const AsyncWriter& ) = delete;
+
+  // Must be called before the first job is submitted
+  void setMaxPending( const unsigned max_pending );
+
+  // True if jobs run on the writer thread
+  bool threaded() const;
+
+  // Queues a job, blocking while the queue is full; throws the error of an earlier failed job
+  void submit( std::function<void()> job );
+
+  // Blocks until every submitted job has run; throws the error of the first failed job
+  void finish();
+
+  // Writes contents to file_name, replacing any existing file
+  static void writeFile( const std::string& file_name, const std::string& contents );
+
+private:
+
+  void run();
+
+  void throwIfFailed() const;
+
+  unsigned m_max_pending;
+  std::mutex m_mutex;
+  // Signaled when a job is queued or the writer is stopped
+  std::condition_variable m_job_queued;
+  // Signaled when a job has run
+  std::condition_variable m_job_done;
+  std::deque<std::function<void()>> m_jobs;
+  bool m_stop;
+  bool m_failed;
+  std::string m_error;
+  std::thread m_thread;
+
+};
+
+#endif
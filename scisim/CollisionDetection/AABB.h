@@ -0,0 +1,56 @@
+#ifndef AABB_H
+#define AABB_H
+
+#include "scisim/Math/MathDefines.h"
+
+// Axis aligned bounding box in N dimensions
+template<int N>
+class AABB final
+{
+
+public:
+
+  using ArrayNs = Eigen::Array<scalar,N,1>;
+
+  AABB() = default;
+
+  AABB( const ArrayNs& min, const ArrayNs& max )
+  : m_min( min )
+  , m_max( max )
+  {
+    assert( ( m_min < m_max ).all() );
+  }
+
+  bool overlaps( const AABB& other ) const
+  {
+    // Temporary sanity check: internal code shouldn't compare an AABB to itself
+    assert( &other != this );
+
+    // Attempt to find a separating axis
+    if( ( this->max() < other.min() ).any() )
+    {
+      return false;
+    }
+    if( ( other.max() < this->min() ).any() )
+    {
+      return false;
+    }
+
+    // If no separating axis exists, the AABBs overlap
+    return true;
+  }
+
+  inline ArrayNs& min() { return m_min; }
+  inline ArrayNs& max() { return m_max; }
+
+  inline const ArrayNs& min() const { return m_min; }
+  inline const ArrayNs& max() const { return m_max; }
+
+private:
+
+  ArrayNs m_min;
+  ArrayNs m_max;
+
+};
+
+#endif
@@ -0,0 +1,79 @@
+#include "AABBTree.h"
+
+// Number of AABBs below which a node is not split further
+static constexpr unsigned s_leaf_size{ 8 };
+
+template<int N>
+void AABBTree<N>::build( const std::vector<AABB<N>>& aabbs )
+{
+  m_nodes.clear();
+  m_entries.resize( aabbs.size() );
+  m_entry_aabbs.resize( aabbs.size() );
+  if( aabbs.empty() )
+  {
+    return;
+  }
+  for( unsigned entry = 0; entry < unsigned( aabbs.size() ); ++entry )
+  {
+    m_entries[entry] = entry;
+  }
+
+  m_nodes.resize( 1 );
+  buildNode( 0, 0, unsigned( aabbs.size() ), aabbs );
+
+  for( unsigned entry = 0; entry < unsigned( aabbs.size() ); ++entry )
+  {
+    m_entry_aabbs[entry] = aabbs[m_entries[entry]];
+  }
+}
+
+template<int N>
+void AABBTree<N>::buildNode( const unsigned node_index, const unsigned first, const unsigned count, const std::vector<AABB<N>>& aabbs )
+{
+  assert( node_index < m_nodes.size() );
+  assert( count > 0 );
+
+  ArrayNs min{ ArrayNs::Constant( SCALAR_INFINITY ) };
+  ArrayNs max{ ArrayNs::Constant( -SCALAR_INFINITY ) };
+  ArrayNs centroid_min{ ArrayNs::Constant( SCALAR_INFINITY ) };
+  ArrayNs centroid_max{ ArrayNs::Constant( -SCALAR_INFINITY ) };
+  for( unsigned entry = first; entry < first + count; ++entry )
+  {
+    const AABB<N>& aabb{ aabbs[m_entries[entry]] };
+    min = min.min( aabb.min() );
+    max = max.max( aabb.max() );
+    const ArrayNs centroid{ 0.5 * ( aabb.min() + aabb.max() ) };
+    centroid_min = centroid_min.min( centroid );
+    centroid_max = centroid_max.max( centroid );
+  }
+  m_nodes[node_index].min = min;
+  m_nodes[node_index].max = max;
+  m_nodes[node_index].first = first;
+  m_nodes[node_index].count = count;
+
+  if( count <= s_leaf_size )
+  {
+    m_nodes[node_index].children = 0;
+    return;
+  }
+
+  // Split at the median centroid along the axis of largest centroid extent
+  int axis;
+  ( centroid_max - centroid_min ).maxCoeff( &axis );
+  const unsigned half{ count / 2 };
+  std::nth_element( m_entries.begin() + first, m_entries.begin() + first + half, m_entries.begin() + first + count,
+    [&aabbs,axis]( const unsigned a, const unsigned b )
+    {
+      return aabbs[a].min()( axis ) + aabbs[a].max()( axis ) < aabbs[b].min()( axis ) + aabbs[b].max()( axis );
+    } );
+
+  // Children are allocated together so that they are stored next to each other
+  const unsigned children{ unsigned( m_nodes.size() ) };
+  m_nodes[node_index].children = children;
+  m_nodes.resize( m_nodes.size() + 2 );
+  buildNode( children, first, half, aabbs );
+  buildNode( children + 1, first + half, count - half, aabbs );
+}
+
+template class AABBTree<2>;
+template class AABBTree<3>;
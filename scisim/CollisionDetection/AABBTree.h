@@ -0,0 +1,108 @@
+#ifndef AABB_TREE_H
+#define AABB_TREE_H
+
+#include "AABB.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+// Bounding volume hierarchy over a set of AABBs, built top down by median splits. Used to cull bodies against
+// static geometry that has no bounded extent, such as half planes and drums: the geometry is tested against the
+// bounds of each node and only the bodies in nodes that pass are returned. The node storage is retained between
+// builds, so a tree held across timesteps stops allocating once it has grown to the size of the scene.
+template<int N>
+class AABBTree final
+{
+
+public:
+
+  using ArrayNs = Eigen::Array<scalar,N,1>;
+
+  void build( const std::vector<AABB<N>>& aabbs );
+
+  // Appends to indices, in increasing order, every AABB for which test( min, max ) holds. The test must be
+  // conservative: if it holds for an AABB it must hold for every AABB that contains it.
+  template<typename Test>
+  void query( const Test& test, std::vector<unsigned>& indices ) const;
+
+  // As query, but the indices are appended in the order they are stored in the tree, which keeps spatially nearby
+  // AABBs together. Nodes for which contains( min, max ) holds are appended whole, without testing their contents.
+  template<typename Test, typename Contains>
+  void queryUnordered( const Test& test, const Contains& contains, std::vector<unsigned>& indices ) const;
+
+private:
+
+  struct Node
+  {
+    ArrayNs min;
+    ArrayNs max;
+    // Nodes cover m_entries[first, first + count); leaves have children == 0 and internal nodes have children
+    // children and children + 1
+    unsigned first;
+    unsigned count;
+    unsigned children;
+  };
+
+  void buildNode( const unsigned node_index, const unsigned first, const unsigned count, const std::vector<AABB<N>>& aabbs );
+
+  std::vector<Node> m_nodes;
+  // Indices of the AABBs, grouped by leaf
+  std::vector<unsigned> m_entries;
+  // The AABB of each entry, in the order of m_entries
+  std::vector<AABB<N>> m_entry_aabbs;
+
+};
+
+template<int N>
+template<typename Test>
+void AABBTree<N>::query( const Test& test, std::vector<unsigned>& indices ) const
+{
+  const std::vector<unsigned>::size_type first_index{ indices.size() };
+  queryUnordered( test, []( const ArrayNs&, const ArrayNs& ) { return false; }, indices );
+  std::sort( indices.begin() + first_index, indices.end() );
+}
+
+template<int N>
+template<typename Test, typename Contains>
+void AABBTree<N>::queryUnordered( const Test& test, const Contains& contains, std::vector<unsigned>& indices ) const
+{
+  if( m_nodes.empty() )
+  {
+    return;
+  }
+
+  // Median splits bound the depth by the log of the number of leaves
+  std::array<unsigned,64> stack;
+  unsigned stack_size{ 0 };
+  stack[stack_size++] = 0;
+  while( stack_size != 0 )
+  {
+    const Node& node{ m_nodes[stack[--stack_size]] };
+    if( !test( node.min, node.max ) )
+    {
+      continue;
+    }
+    if( contains( node.min, node.max ) )
+    {
+      indices.insert( indices.end(), m_entries.begin() + node.first, m_entries.begin() + node.first + node.count );
+      continue;
+    }
+    if( node.children != 0 )
+    {
+      assert( stack_size + 2 <= stack.size() );
+      stack[stack_size++] = node.children + 1;
+      stack[stack_size++] = node.children;
+      continue;
+    }
+    for( unsigned entry = node.first; entry < node.first + node.count; ++entry )
+    {
+      if( test( m_entry_aabbs[entry].min(), m_entry_aabbs[entry].max() ) )
+      {
+        indices.emplace_back( m_entries[entry] );
+      }
+    }
+  }
+}
+
+#endif
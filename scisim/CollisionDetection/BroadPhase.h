@@ -0,0 +1,13 @@
+#ifndef BROAD_PHASE_H
+#define BROAD_PHASE_H
+
+// Broad phase used to find the pairs of bodies passed to narrow phase collision detection
+enum class BroadPhase
+{
+  // Uniform grid rebuilt from scratch every step
+  SPATIAL_GRID,
+  // Incremental sweep and prune with a persistent set of overlapping pairs
+  SWEEP_AND_PRUNE
+};
+
+#endif
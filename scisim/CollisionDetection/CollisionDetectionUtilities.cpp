@@ -1,5 +1,7 @@
 #include "CollisionDetectionUtilities.h"
 
+#include <algorithm>
+
 Vector3s CollisionDetectionUtilities::computeCCDQuadraticCoeffs( const Vector2s& q0a, const Vector2s& q1a, const scalar& ra, const Vector2s& q0b, const Vector2s& q1b, const scalar& rb )
 {
   Vector3s coeffs;
@@ -124,3 +126,17 @@ std::pair<bool,scalar> CollisionDetectionUtilities::ballBallCCDCollisionHappens(
 {
   return ballBallCCDCollisionHappens( computeCCDQuadraticCoeffs( q0a, q1a, ra, q0b, q1b, rb ) );
 }
+
+bool CollisionDetectionUtilities::aabbReachesCylinder( const Array3s& min, const Array3s& max, const Vector3s& x, const Vector3s& axis, const scalar& r )
+{
+  assert( ( min <= max ).all() );
+  assert( fabs( axis.norm() - 1.0 ) <= 1.0e-6 );
+  scalar max_squared_distance{ 0.0 };
+  for( unsigned corner = 0; corner < 8; ++corner )
+  {
+    const Vector3s p{ corner & 1 ? max.x() : min.x(), corner & 2 ? max.y() : min.y(), corner & 4 ? max.z() : min.z() };
+    const Vector3s d{ p - x - axis.dot( p - x ) * axis };
+    max_squared_distance = std::max( max_squared_distance, d.squaredNorm() );
+  }
+  return std::sqrt( max_squared_distance ) >= r - 1.0e-6;
+}
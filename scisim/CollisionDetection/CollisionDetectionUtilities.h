@@ -13,6 +13,28 @@ namespace CollisionDetectionUtilities
 
   // Given the radii and start and end of step positions of 2 balls, returns true and the first collision time (scaled to [0,1]) if a collision occurs, or false if no collsion occurs.
   std::pair<bool,scalar> ballBallCCDCollisionHappens( const Vector2s& q0a, const Vector2s& q1a, const scalar& ra, const Vector2s& q0b, const Vector2s& q1b, const scalar& rb );
+
+  // Returns true if some point of the box [min,max] lies on or behind the plane through x with unit normal n. The
+  // corner of the box furthest behind the plane is selected per axis, so the test is branch free.
+  template<int N>
+  bool aabbTouchesHalfPlane( const Eigen::Array<scalar,N,1>& min, const Eigen::Array<scalar,N,1>& max, const Eigen::Matrix<scalar,N,1>& x, const Eigen::Matrix<scalar,N,1>& n )
+  {
+    const Eigen::Array<scalar,N,1> nearest_corner{ ( n.array() > 0.0 ).select( min, max ) };
+    return n.dot( nearest_corner.matrix() - x ) <= 1.0e-6;
+  }
+
+  // Returns true if some point of the box [min,max] lies at a distance of at least r from the line through x with
+  // unit direction axis. The distance to a line is convex, so its maximum over the box is attained at a corner.
+  bool aabbReachesCylinder( const Array3s& min, const Array3s& max, const Vector3s& x, const Vector3s& axis, const scalar& r );
+
+  // Returns true if some point of the box [min,max] lies at a distance of at least r from the point x
+  template<int N>
+  bool aabbReachesSphere( const Eigen::Array<scalar,N,1>& min, const Eigen::Array<scalar,N,1>& max, const Eigen::Matrix<scalar,N,1>& x, const scalar& r )
+  {
+    // The furthest corner of the box from x is selected per axis
+    const Eigen::Array<scalar,N,1> furthest{ ( min - x.array() ).abs().max( ( max - x.array() ).abs() ) };
+    return furthest.matrix().norm() >= r - 1.0e-6;
+  }
 }
 
 #endif
@@ -0,0 +1,191 @@
+#include "SpatialGrid.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+template<int N>
+static void computeGridBounds( const std::vector<AABB<N>>& aabbs, Eigen::Array<scalar,N,1>& min_coord, scalar& h )
+{
+  using ArrayNs = Eigen::Array<scalar,N,1>;
+
+  // Compute a bounding box for all AABBs
+  min_coord = ArrayNs::Constant( SCALAR_INFINITY );
+  ArrayNs max_coord{ ArrayNs::Constant( -SCALAR_INFINITY ) };
+  for( typename std::vector<AABB<N>>::size_type aabb_idx = 0; aabb_idx < aabbs.size(); ++aabb_idx )
+  {
+    assert( ( aabbs[aabb_idx].min() < aabbs[aabb_idx].max() ).all() );
+    min_coord = min_coord.min( aabbs[aabb_idx].min() );
+    max_coord = max_coord.max( aabbs[aabb_idx].max() );
+    assert( ( min_coord < max_coord ).all() );
+  }
+  // Inflate the AABB to account for FPA quantization errors
+  min_coord -= 2.0e-6;
+
+  // Compute the grid cell width
+  {
+    ArrayNs delta{ ArrayNs::Zero() };
+    for( typename std::vector<AABB<N>>::size_type aabb_idx = 0; aabb_idx < aabbs.size(); ++aabb_idx )
+    {
+      delta += aabbs[aabb_idx].max() - aabbs[aabb_idx].min();
+    }
+    h = delta.maxCoeff() / scalar( aabbs.size() );
+  }
+  assert( h > 0.0 );
+}
+
+template<int N>
+static void computeCellIndex( const Eigen::Array<scalar,N,1>& coord, const Eigen::Array<scalar,N,1>& min_coord, const scalar& h, unsigned* index )
+{
+  assert( ( coord > min_coord ).all() ); assert( h > 0.0 );
+  // Unsigned cast same as floor if input is positive
+  Eigen::Map<Eigen::Array<unsigned,N,1>>{ index } = ( ( coord - min_coord ) / h ).template cast<unsigned>();
+}
+
+template<int N>
+static unsigned bucketForCell( const std::array<unsigned,N>& index, const unsigned bucket_mask )
+{
+  // Spatial hash of Teschner et al. 2003, folded into a power of two number of buckets
+  static_assert( N <= 3, "Error, spatial hash only supports up to three dimensions." );
+  constexpr std::uint32_t primes[3] = { 73856093u, 19349663u, 83492791u };
+  std::uint32_t key{ 0 };
+  for( int dim = 0; dim < N; ++dim )
+  {
+    key ^= std::uint32_t( index[dim] ) * primes[dim];
+  }
+  return unsigned( key ) & bucket_mask;
+}
+
+// Calls func on the bucket of every cell in the box [lower,upper]
+template<int N, typename Function>
+static void forEachBucket( const unsigned* lower, const unsigned* upper, const unsigned bucket_mask, Function func )
+{
+  std::array<unsigned,N> index;
+  std::copy( lower, lower + N, index.begin() );
+  while( true )
+  {
+    func( bucketForCell<N>( index, bucket_mask ) );
+    // Advance to the next cell, odometer style
+    int dim{ 0 };
+    while( dim < N && index[dim] == upper[dim] )
+    {
+      index[dim] = lower[dim];
+      ++dim;
+    }
+    if( dim == N )
+    {
+      return;
+    }
+    ++index[dim];
+  }
+}
+
+template<int N>
+void SpatialGrid<N>::getPotentialOverlaps( const std::vector<AABB<N>>& aabbs, std::vector<std::pair<unsigned,unsigned>>& overlaps )
+{
+  overlaps.clear();
+  if( aabbs.size() < 2 )
+  {
+    return;
+  }
+
+  Eigen::Array<scalar,N,1> min_coord;
+  scalar h;
+  computeGridBounds( aabbs, min_coord, h );
+
+  // Compute the cells each AABB overlaps with. Slightly enlarge the boxes to account for FPA errors.
+  const unsigned naabbs{ static_cast<unsigned>( aabbs.size() ) };
+  m_cell_ranges.resize( 2 * N * naabbs );
+  std::vector<unsigned>::size_type num_entries{ 0 };
+  for( unsigned aabb_idx = 0; aabb_idx < naabbs; ++aabb_idx )
+  {
+    unsigned* const lower{ &m_cell_ranges[ 2 * N * aabb_idx ] };
+    unsigned* const upper{ lower + N };
+    computeCellIndex<N>( aabbs[aabb_idx].min() - 1.0e-6, min_coord, h, lower );
+    computeCellIndex<N>( aabbs[aabb_idx].max() + 1.0e-6, min_coord, h, upper );
+    std::vector<unsigned>::size_type num_cells{ 1 };
+    for( int dim = 0; dim < N; ++dim )
+    {
+      assert( lower[dim] <= upper[dim] );
+      num_cells *= upper[dim] - lower[dim] + 1;
+    }
+    num_entries += num_cells;
+  }
+
+  // Use at least as many buckets as entries to keep chains short
+  unsigned num_buckets{ 1 };
+  while( num_buckets < num_entries )
+  {
+    num_buckets *= 2;
+  }
+  const unsigned bucket_mask{ num_buckets - 1 };
+
+  // Counting sort of the AABBs by bucket: count the entries in each bucket
+  m_bucket_offsets.assign( num_buckets + 1, 0 );
+  for( unsigned aabb_idx = 0; aabb_idx < naabbs; ++aabb_idx )
+  {
+    const unsigned* const lower{ &m_cell_ranges[ 2 * N * aabb_idx ] };
+    forEachBucket<N>( lower, lower + N, bucket_mask, [this]( const unsigned bucket ) { ++m_bucket_offsets[bucket]; } );
+  }
+  // Convert the counts to one-past-the-end offsets
+  for( unsigned bucket = 1; bucket <= num_buckets; ++bucket )
+  {
+    m_bucket_offsets[bucket] += m_bucket_offsets[bucket - 1];
+  }
+  assert( m_bucket_offsets[num_buckets] == num_entries );
+  // Scatter the AABBs in reverse so that each offset ends at the start of its bucket with indices in increasing order
+  m_bucket_entries.resize( num_entries );
+  for( unsigned aabb_idx = naabbs; aabb_idx-- > 0; )
+  {
+    const unsigned* const lower{ &m_cell_ranges[ 2 * N * aabb_idx ] };
+    forEachBucket<N>( lower, lower + N, bucket_mask, [this,aabb_idx]( const unsigned bucket ) { m_bucket_entries[ --m_bucket_offsets[bucket] ] = aabb_idx; } );
+  }
+
+  // Visit each pair of AABBs in each bucket
+  for( unsigned bucket = 0; bucket < num_buckets; ++bucket )
+  {
+    const unsigned bucket_end{ m_bucket_offsets[bucket + 1] };
+    for( unsigned idx0 = m_bucket_offsets[bucket]; idx0 + 1 < bucket_end; ++idx0 )
+    {
+      const unsigned aabb0{ m_bucket_entries[idx0] };
+      for( unsigned idx1 = idx0 + 1; idx1 < bucket_end; ++idx1 )
+      {
+        const unsigned aabb1{ m_bucket_entries[idx1] };
+        // An AABB lands in a bucket more than once when several of its cells hash to that bucket
+        if( aabb0 == aabb1 )
+        {
+          continue;
+        }
+        assert( aabb0 < aabb1 );
+        if( aabbs[aabb0].overlaps( aabbs[aabb1] ) )
+        {
+          overlaps.emplace_back( aabb0, aabb1 );
+        }
+      }
+    }
+  }
+
+  // Pairs that share several cells or buckets are reported repeatedly
+  std::sort( overlaps.begin(), overlaps.end() );
+  overlaps.erase( std::unique( overlaps.begin(), overlaps.end() ), overlaps.end() );
+}
+
+template<int N>
+void SpatialGrid<N>::getPotentialOverlapsAllPairs( const std::vector<AABB<N>>& aabbs, std::vector<std::pair<unsigned,unsigned>>& overlaps )
+{
+  overlaps.clear();
+  const unsigned naabbs{ static_cast<unsigned>( aabbs.size() ) };
+  for( unsigned idx0 = 0; idx0 < naabbs; ++idx0 )
+  {
+    for( unsigned idx1 = idx0 + 1; idx1 < naabbs; ++idx1 )
+    {
+      if( aabbs[idx0].overlaps( aabbs[idx1] ) )
+      {
+        overlaps.emplace_back( idx0, idx1 );
+      }
+    }
+  }
+}
+
+template class SpatialGrid<2>;
+template class SpatialGrid<3>;
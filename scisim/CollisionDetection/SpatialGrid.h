@@ -0,0 +1,35 @@
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include "AABB.h"
+
+#include <utility>
+#include <vector>
+
+// Uniform grid broad phase shared by the 2D and 3D simulations. Cells are hashed into a flat, counting-sorted
+// bucket array that is retained between calls, so a grid held across timesteps stops allocating once the
+// buffers have grown to the size of the scene.
+template<int N>
+class SpatialGrid final
+{
+
+public:
+
+  // Computes all pairs of potentially overlapping AABBs. Pairs are returned with first < second, sorted, and without duplicates.
+  void getPotentialOverlaps( const std::vector<AABB<N>>& aabbs, std::vector<std::pair<unsigned,unsigned>>& overlaps );
+
+  // Reference implementation that tests all pairs of AABBs, with the same output conventions as getPotentialOverlaps.
+  static void getPotentialOverlapsAllPairs( const std::vector<AABB<N>>& aabbs, std::vector<std::pair<unsigned,unsigned>>& overlaps );
+
+private:
+
+  // Lower and upper cell indices covered by each AABB, N entries for each bound
+  std::vector<unsigned> m_cell_ranges;
+  // Start of each bucket in m_bucket_entries, with one extra trailing entry
+  std::vector<unsigned> m_bucket_offsets;
+  // Indices of the AABBs in each bucket, sorted by bucket
+  std::vector<unsigned> m_bucket_entries;
+
+};
+
+#endif
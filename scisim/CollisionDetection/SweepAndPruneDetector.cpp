@@ -0,0 +1,214 @@
+#include "SweepAndPruneDetector.h"
+
+#include <algorithm>
+#include <iterator>
+
+static std::uint64_t pairKey( const unsigned first, const unsigned second )
+{
+  assert( first < second );
+  return ( std::uint64_t( first ) << 32 ) | std::uint64_t( second );
+}
+
+template<int N>
+bool SweepAndPruneDetector<N>::precedes( const Endpoint& a, const Endpoint& b )
+{
+  // Lower endpoints precede upper endpoints at equal values, so touching AABBs overlap as in AABB::overlaps
+  return a.value < b.value || ( a.value == b.value && ( a.encoded_index & 1 ) < ( b.encoded_index & 1 ) );
+}
+
+template<int N>
+void SweepAndPruneDetector<N>::update( const std::vector<AABB<N>>& aabbs )
+{
+  m_added_pairs.clear();
+  m_removed_pairs.clear();
+
+  const unsigned old_count{ unsigned( m_aabbs.size() ) };
+  const unsigned new_count{ unsigned( aabbs.size() ) };
+
+  // Deleting from the middle of the scene shifts every later index, which looks to the incremental update like
+  // large motions, and a first update has no sorted order to start from, so both sort from scratch
+  if( old_count == 0 || new_count < old_count )
+  {
+    rebuild( aabbs );
+    return;
+  }
+
+  // New AABBs enter after every existing endpoint, where they overlap nothing, and are sorted into place below
+  for( unsigned aabb_idx = old_count; aabb_idx < new_count; ++aabb_idx )
+  {
+    for( std::vector<Endpoint>& endpoints : m_endpoints )
+    {
+      endpoints.emplace_back( Endpoint{ 0.0, aabb_idx << 1 } );
+      endpoints.emplace_back( Endpoint{ 0.0, ( aabb_idx << 1 ) | 1 } );
+    }
+  }
+
+  m_aabbs = aabbs;
+  for( int axis = 0; axis < N; ++axis )
+  {
+    for( Endpoint& endpoint : m_endpoints[axis] )
+    {
+      const AABB<N>& aabb{ m_aabbs[endpoint.encoded_index >> 1] };
+      endpoint.value = ( endpoint.encoded_index & 1 ) ? aabb.max()( axis ) : aabb.min()( axis );
+    }
+    sortAxis( axis );
+  }
+
+  // Fold the changes into the sorted list of overlaps
+  if( m_added_pairs.empty() && m_removed_pairs.empty() )
+  {
+    return;
+  }
+  std::sort( m_added_pairs.begin(), m_added_pairs.end() );
+  std::sort( m_removed_pairs.begin(), m_removed_pairs.end() );
+  m_merge_buffer.clear();
+  std::set_difference( m_overlaps.begin(), m_overlaps.end(), m_removed_pairs.begin(), m_removed_pairs.end(), std::back_inserter( m_merge_buffer ) );
+  m_overlaps.clear();
+  std::merge( m_merge_buffer.begin(), m_merge_buffer.end(), m_added_pairs.begin(), m_added_pairs.end(), std::back_inserter( m_overlaps ) );
+  assert( m_overlaps.size() == m_pair_keys.size() );
+}
+
+template<int N>
+void SweepAndPruneDetector<N>::rebuild( const std::vector<AABB<N>>& aabbs )
+{
+  m_aabbs = aabbs;
+  const unsigned count{ unsigned( m_aabbs.size() ) };
+  for( int axis = 0; axis < N; ++axis )
+  {
+    std::vector<Endpoint>& endpoints{ m_endpoints[axis] };
+    endpoints.resize( 2 * count );
+    for( unsigned aabb_idx = 0; aabb_idx < count; ++aabb_idx )
+    {
+      endpoints[2 * aabb_idx] = Endpoint{ m_aabbs[aabb_idx].min()( axis ), aabb_idx << 1 };
+      endpoints[2 * aabb_idx + 1] = Endpoint{ m_aabbs[aabb_idx].max()( axis ), ( aabb_idx << 1 ) | 1 };
+    }
+    std::sort( endpoints.begin(), endpoints.end(), precedes );
+  }
+
+  // Sweep the first axis, testing each AABB against those whose interval is open when it starts
+  m_merge_buffer.clear();
+  std::vector<unsigned>& open_aabbs{ m_open_aabbs };
+  open_aabbs.clear();
+  for( const Endpoint& endpoint : m_endpoints[0] )
+  {
+    const unsigned aabb_idx{ endpoint.encoded_index >> 1 };
+    if( endpoint.encoded_index & 1 )
+    {
+      open_aabbs.erase( std::find( open_aabbs.begin(), open_aabbs.end(), aabb_idx ) );
+      continue;
+    }
+    for( const unsigned open_idx : open_aabbs )
+    {
+      if( m_aabbs[aabb_idx].overlaps( m_aabbs[open_idx] ) )
+      {
+        m_merge_buffer.emplace_back( std::min( aabb_idx, open_idx ), std::max( aabb_idx, open_idx ) );
+      }
+    }
+    open_aabbs.emplace_back( aabb_idx );
+  }
+  std::sort( m_merge_buffer.begin(), m_merge_buffer.end() );
+
+  // Report the difference from the previous overlaps
+  std::set_difference( m_merge_buffer.begin(), m_merge_buffer.end(), m_overlaps.begin(), m_overlaps.end(), std::back_inserter( m_added_pairs ) );
+  std::set_difference( m_overlaps.begin(), m_overlaps.end(), m_merge_buffer.begin(), m_merge_buffer.end(), std::back_inserter( m_removed_pairs ) );
+  m_overlaps.swap( m_merge_buffer );
+
+  m_pair_keys.clear();
+  m_pair_keys.reserve( m_overlaps.size() );
+  for( const std::pair<unsigned,unsigned>& pair : m_overlaps )
+  {
+    m_pair_keys.insert( pairKey( pair.first, pair.second ) );
+  }
+}
+
+template<int N>
+void SweepAndPruneDetector<N>::sortAxis( const int axis )
+{
+  std::vector<Endpoint>& endpoints{ m_endpoints[axis] };
+
+  for( unsigned idx = 1; idx < unsigned( endpoints.size() ); ++idx )
+  {
+    const Endpoint moving{ endpoints[idx] };
+    const bool moving_is_upper{ ( moving.encoded_index & 1 ) != 0 };
+    const unsigned moving_aabb{ moving.encoded_index >> 1 };
+    unsigned slot{ idx };
+    while( slot > 0 && precedes( moving, endpoints[slot - 1] ) )
+    {
+      const Endpoint passed{ endpoints[slot - 1] };
+      const bool passed_is_upper{ ( passed.encoded_index & 1 ) != 0 };
+      const unsigned passed_aabb{ passed.encoded_index >> 1 };
+      // A lower endpoint passing an upper endpoint starts an overlap along this axis, which is an overlap of the
+      // AABBs if they also overlap along every other axis
+      if( !moving_is_upper && passed_is_upper )
+      {
+        assert( moving_aabb != passed_aabb );
+        if( m_aabbs[moving_aabb].overlaps( m_aabbs[passed_aabb] ) )
+        {
+          insertPair( std::min( moving_aabb, passed_aabb ), std::max( moving_aabb, passed_aabb ) );
+        }
+      }
+      // An upper endpoint passing a lower endpoint separates the AABBs
+      else if( moving_is_upper && !passed_is_upper )
+      {
+        assert( moving_aabb != passed_aabb );
+        erasePair( std::min( moving_aabb, passed_aabb ), std::max( moving_aabb, passed_aabb ) );
+      }
+      endpoints[slot] = passed;
+      --slot;
+    }
+    endpoints[slot] = moving;
+  }
+}
+
+template<int N>
+void SweepAndPruneDetector<N>::insertPair( const unsigned first, const unsigned second )
+{
+  if( m_pair_keys.insert( pairKey( first, second ) ).second )
+  {
+    m_added_pairs.emplace_back( first, second );
+  }
+}
+
+template<int N>
+void SweepAndPruneDetector<N>::erasePair( const unsigned first, const unsigned second )
+{
+  if( m_pair_keys.erase( pairKey( first, second ) ) != 0 )
+  {
+    m_removed_pairs.emplace_back( first, second );
+  }
+}
+
+template<int N>
+void SweepAndPruneDetector<N>::clear()
+{
+  m_aabbs.clear();
+  for( std::vector<Endpoint>& endpoints : m_endpoints )
+  {
+    endpoints.clear();
+  }
+  m_pair_keys.clear();
+  m_overlaps.clear();
+  m_added_pairs.clear();
+  m_removed_pairs.clear();
+}
+
+template<int N>
+const std::vector<std::pair<unsigned,unsigned>>& SweepAndPruneDetector<N>::overlaps() const
+{
+  return m_overlaps;
+}
+
+template<int N>
+const std::vector<std::pair<unsigned,unsigned>>& SweepAndPruneDetector<N>::addedPairs() const
+{
+  return m_added_pairs;
+}
+
+template<int N>
+const std::vector<std::pair<unsigned,unsigned>>& SweepAndPruneDetector<N>::removedPairs() const
+{
+  return m_removed_pairs;
+}
+
+template class SweepAndPruneDetector<2>;
+template class SweepAndPruneDetector<3>;
@@ -0,0 +1,68 @@
+#ifndef SWEEP_AND_PRUNE_DETECTOR_H
+#define SWEEP_AND_PRUNE_DETECTOR_H
+
+#include "AABB.h"
+
+#include <array>
+#include <cstdint>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// Incremental sweep and prune broad phase. The endpoints of the AABBs along each axis are kept sorted across calls
+// and repaired with insertion sort, which is close to linear when the bodies move coherently between steps. Every
+// swap of a lower endpoint past an upper endpoint starts or ends an overlap along that axis, so the set of
+// overlapping pairs is maintained from the swaps alone and persists between calls.
+//
+// AABBs are identified by their index. Indices past the previous count are inserted incrementally, so bodies added
+// at the end of the scene cost only their own endpoint moves. A smaller count means bodies were deleted and the
+// remaining indices shifted, so the endpoints are then sorted and swept from scratch; either way the added and
+// removed pairs are reported relative to the previous update.
+template<int N>
+class SweepAndPruneDetector final
+{
+
+public:
+
+  // Moves the tracked AABBs to aabbs and updates the overlapping pairs
+  void update( const std::vector<AABB<N>>& aabbs );
+
+  // Stops tracking all AABBs
+  void clear();
+
+  // All pairs of overlapping AABBs. Pairs are stored with first < second, sorted, and without duplicates.
+  const std::vector<std::pair<unsigned,unsigned>>& overlaps() const;
+
+  // Pairs that started and stopped overlapping during the last update, with the same conventions as overlaps
+  const std::vector<std::pair<unsigned,unsigned>>& addedPairs() const;
+  const std::vector<std::pair<unsigned,unsigned>>& removedPairs() const;
+
+private:
+
+  struct Endpoint
+  {
+    scalar value;
+    // Index of the AABB shifted left by one, with the low bit set for upper endpoints
+    unsigned encoded_index;
+  };
+
+  static bool precedes( const Endpoint& a, const Endpoint& b );
+
+  void rebuild( const std::vector<AABB<N>>& aabbs );
+  void sortAxis( const int axis );
+  void insertPair( const unsigned first, const unsigned second );
+  void erasePair( const unsigned first, const unsigned second );
+
+  std::vector<AABB<N>> m_aabbs;
+  std::array<std::vector<Endpoint>,N> m_endpoints;
+  // Keys of the overlapping pairs, for constant time membership tests during the sort
+  std::unordered_set<std::uint64_t> m_pair_keys;
+  std::vector<std::pair<unsigned,unsigned>> m_overlaps;
+  std::vector<std::pair<unsigned,unsigned>> m_added_pairs;
+  std::vector<std::pair<unsigned,unsigned>> m_removed_pairs;
+  std::vector<std::pair<unsigned,unsigned>> m_merge_buffer;
+  std::vector<unsigned> m_open_aabbs;
+
+};
+
+#endif
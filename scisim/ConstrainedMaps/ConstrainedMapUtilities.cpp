@@ -20,6 +20,12 @@
 #include "scisim/ConstrainedMaps/Sobogus.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorAPGD.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorPI.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorPGS.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorSparseActiveSet.h"
+#include "scisim/ConstrainedMaps/FrictionMaps/MDPOperatorSparseActiveSet.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorComparison.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorIslands.h"
+#include "scisim/ConstrainedMaps/FrictionSolverIslands.h"
 
 #ifdef IPOPT_FOUND
 #include "scisim/ConstrainedMaps/ImpactMaps/LCPOperatorIpopt.h"
@@ -157,6 +163,22 @@ std::unique_ptr<ImpactOperator> ConstrainedMapUtilities::deserializeImpactOperat
   {
     impact_operator.reset(new LCPOperatorPI{input_stream} );
   }
+  else if( "lcp_pgs" == impact_operator_name )
+  {
+    impact_operator.reset( new LCPOperatorPGS{ input_stream } );
+  }
+  else if( "lcp_sparse_active_set" == impact_operator_name )
+  {
+    impact_operator.reset( new LCPOperatorSparseActiveSet{ input_stream } );
+  }
+  else if( "impact_operator_comparison" == impact_operator_name )
+  {
+    impact_operator.reset( new ImpactOperatorComparison{ input_stream } );
+  }
+  else if( "impact_operator_islands" == impact_operator_name )
+  {
+    impact_operator.reset( new ImpactOperatorIslands{ input_stream } );
+  }
   else if( "NULL" == impact_operator_name )
   {
     impact_operator.reset( nullptr );
@@ -195,7 +217,11 @@ std::unique_ptr<FrictionOperator> ConstrainedMapUtilities::deserializeFrictionOp
   }
   else
   #endif
-  if( "NULL" == friction_operator_name )
+  if( "mdp_sparse_active_set" == friction_operator_name )
+  {
+    friction_operator.reset( new MDPOperatorSparseActiveSet{ input_stream } );
+  }
+  else if( "NULL" == friction_operator_name )
   {
     friction_operator.reset( nullptr );
   }
@@ -223,6 +249,10 @@ std::unique_ptr<FrictionSolver> ConstrainedMapUtilities::deserializeFrictionSolv
   {
     friction_solver.reset( new Sobogus{ input_stream } );
   }
+  else if( "friction_solver_islands" == friction_solver_name )
+  {
+    friction_solver.reset( new FrictionSolverIslands{ input_stream } );
+  }
   else if( "NULL" == friction_solver_name )
   {
     friction_solver.reset( nullptr );
@@ -6,6 +6,7 @@
 #include "FrictionOperator.h"
 
 #include "scisim/Constraints/Constraint.h"
+#include "scisim/Constraints/ContactBatch.h"
 
 FrictionOperator::~FrictionOperator()
 {}
@@ -18,6 +19,17 @@ void FrictionOperator::formGeneralizedSmoothFrictionBasis( const unsigned ndofs,
   const unsigned nambientdims{ static_cast<unsigned>( bases.rows() ) };
   const unsigned nsamples{ nambientdims - 1 };
 
+  // Assemble point contacts in a single pass over their batched geometry
+  {
+    ContactBatch local_batch;
+    const ContactBatch* const batch{ ncons != 0 ? ContactBatch::acquire( q, K, local_batch ) : nullptr };
+    if( batch != nullptr )
+    {
+      batch->computeD( ndofs, bases, D );
+      return;
+    }
+  }
+
   D.resize( ndofs, nsamples * ncons );
 
   auto itr = K.cbegin();
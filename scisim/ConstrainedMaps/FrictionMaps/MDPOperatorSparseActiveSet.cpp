@@ -0,0 +1,164 @@
+#include "MDPOperatorSparseActiveSet.h"
+
+#include "scisim/Utilities.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+MDPOperatorSparseActiveSet::MDPOperatorSparseActiveSet( const int impulses_per_normal, const scalar& tol, const unsigned max_iters )
+: m_impulses_per_normal( impulses_per_normal )
+, m_tol( tol )
+, m_max_iters( max_iters )
+, m_qp( tol, max_iters )
+{
+  assert( m_impulses_per_normal == 1 || m_impulses_per_normal == 2 );
+  assert( m_tol >= 0.0 );
+}
+
+MDPOperatorSparseActiveSet::MDPOperatorSparseActiveSet( std::istream& input_stream )
+: m_impulses_per_normal( Utilities::deserialize<int>( input_stream ) )
+, m_tol( Utilities::deserialize<scalar>( input_stream ) )
+, m_max_iters( Utilities::deserialize<unsigned>( input_stream ) )
+, m_qp( m_tol, m_max_iters )
+{
+  assert( m_impulses_per_normal == 1 || m_impulses_per_normal == 2 );
+  assert( m_tol >= 0.0 );
+}
+
+void MDPOperatorSparseActiveSet::flow( const scalar& t, const SparseMatrixsc& Minv, const VectorXs& v0, const SparseMatrixsc& D, const SparseMatrixsc& Q, const VectorXs& gdotD, const VectorXs& mu, const VectorXs& alpha, VectorXs& beta, VectorXs& lambda )
+{
+  assert( Q.rows() == Q.cols() ); assert( Q.rows() == beta.size() );
+  assert( D.rows() == v0.size() ); assert( D.cols() == gdotD.size() );
+  assert( mu.size() == alpha.size() ); assert( lambda.size() == alpha.size() );
+  assert( beta.size() == m_impulses_per_normal * alpha.size() );
+  assert( ( mu.array() >= 0.0 ).all() ); assert( ( alpha.array() >= -1.0e-8 ).all() );
+
+  // Linear term in the objective
+  const VectorXs c{ D.transpose() * v0 + gdotD };
+
+  // Bounds on the friction impulses of each contact
+  VectorXs upper{ beta.size() };
+  for( int con_idx = 0; con_idx < alpha.size(); ++con_idx )
+  {
+    upper.segment( m_impulses_per_normal * con_idx, m_impulses_per_normal ).setConstant( mu( con_idx ) * std::max( scalar( 0.0 ), alpha( con_idx ) ) );
+  }
+  const VectorXs lower{ -upper };
+
+  beta = beta.cwiseMax( lower ).cwiseMin( upper );
+  if( !m_qp.solve( Q, c, lower, upper, beta ) )
+  {
+    std::cerr << "MDPOperatorSparseActiveSet warning, failed to converge in " << m_qp.lastSolveIterations() << " iterations" << std::endl;
+  }
+
+  if( m_impulses_per_normal == 1 )
+  {
+    // The multiplier of each contact's bounds is the magnitude of the gradient of the impulse held at a bound
+    const VectorXs& gradient{ m_qp.gradient() };
+    for( int con_idx = 0; con_idx < alpha.size(); ++con_idx )
+    {
+      lambda( con_idx ) = beta( con_idx ) <= lower( con_idx ) || beta( con_idx ) >= upper( con_idx ) ? std::fabs( gradient( con_idx ) ) : 0.0;
+    }
+    return;
+  }
+
+  // The square circumscribes each contact's friction disk, so a solution with every pair inside its disk solves the
+  // problem with the disks. Otherwise alternate solves over the squares with projections onto the disks until the two
+  // agree (ADMM with the squares and the disks as the two constraint sets).
+  if( !insideDisks( upper, beta ) )
+  {
+    solveWithDisks( Q, c, lower, upper, beta );
+  }
+
+  // The multiplier of each contact's disk is the magnitude of the gradient of a pair on the edge of the disk
+  const VectorXs gradient{ Q * beta + c };
+  for( int con_idx = 0; con_idx < alpha.size(); ++con_idx )
+  {
+    const scalar radius{ upper( 2 * con_idx ) };
+    lambda( con_idx ) = beta.segment<2>( 2 * con_idx ).norm() >= radius - m_tol ? gradient.segment<2>( 2 * con_idx ).norm() : 0.0;
+  }
+}
+
+bool MDPOperatorSparseActiveSet::insideDisks( const VectorXs& radii, const VectorXs& beta ) const
+{
+  for( int con_idx = 0; con_idx < beta.size() / 2; ++con_idx )
+  {
+    if( beta.segment<2>( 2 * con_idx ).norm() > radii( 2 * con_idx ) + m_tol )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void projectOntoDisks( const VectorXs& radii, VectorXs& beta )
+{
+  for( int con_idx = 0; con_idx < beta.size() / 2; ++con_idx )
+  {
+    const scalar norm{ beta.segment<2>( 2 * con_idx ).norm() };
+    if( norm > radii( 2 * con_idx ) )
+    {
+      beta.segment<2>( 2 * con_idx ) *= radii( 2 * con_idx ) / norm;
+    }
+  }
+}
+
+void MDPOperatorSparseActiveSet::solveWithDisks( const SparseMatrixsc& Q, const VectorXs& c, const VectorXs& lower, const VectorXs& upper, VectorXs& beta )
+{
+  // Penalty on the disagreement between the two sets, on the scale of Q
+  const scalar rho{ Q.rows() != 0 && Q.diagonal().mean() > 0.0 ? Q.diagonal().mean() : 1.0 };
+  SparseMatrixsc Q_rho{ Q.rows(), Q.cols() };
+  Q_rho.setIdentity();
+  Q_rho = Q + rho * Q_rho;
+
+  // beta is the iterate over the squares, z its projection onto the disks, and u the scaled multiplier of beta = z
+  VectorXs z{ beta };
+  projectOntoDisks( upper, z );
+  VectorXs u{ VectorXs::Zero( beta.size() ) };
+  VectorXs z_previous{ beta.size() };
+  for( unsigned itr = 0; itr < m_max_iters; ++itr )
+  {
+    if( !m_qp.solve( Q_rho, c - rho * ( z - u ), lower, upper, beta ) )
+    {
+      std::cerr << "MDPOperatorSparseActiveSet warning, failed to converge in " << m_qp.lastSolveIterations() << " iterations" << std::endl;
+    }
+    z_previous = z;
+    z = beta + u;
+    projectOntoDisks( upper, z );
+    u += beta - z;
+    if( ( beta - z ).lpNorm<Eigen::Infinity>() <= m_tol && rho * ( z - z_previous ).lpNorm<Eigen::Infinity>() <= m_tol )
+    {
+      beta = z;
+      return;
+    }
+  }
+  std::cerr << "MDPOperatorSparseActiveSet warning, friction disks failed to converge in " << m_max_iters << " iterations" << std::endl;
+  beta = z;
+}
+
+int MDPOperatorSparseActiveSet::numFrictionImpulsesPerNormal() const
+{
+  return m_impulses_per_normal;
+}
+
+std::string MDPOperatorSparseActiveSet::name() const
+{
+  return "mdp_sparse_active_set";
+}
+
+std::unique_ptr<FrictionOperator> MDPOperatorSparseActiveSet::clone() const
+{
+  return std::unique_ptr<FrictionOperator>{ new MDPOperatorSparseActiveSet{ m_impulses_per_normal, m_tol, m_max_iters } };
+}
+
+void MDPOperatorSparseActiveSet::serialize( std::ostream& output_stream ) const
+{
+  Utilities::serialize( m_impulses_per_normal, output_stream );
+  Utilities::serialize( m_tol, output_stream );
+  Utilities::serialize( m_max_iters, output_stream );
+}
+
+bool MDPOperatorSparseActiveSet::isLinearized() const
+{
+  return false;
+}
@@ -0,0 +1,51 @@
+#ifndef MDP_OPERATOR_SPARSE_ACTIVE_SET_H
+#define MDP_OPERATOR_SPARSE_ACTIVE_SET_H
+
+#include "FrictionOperator.h"
+#include "scisim/Math/QPSolvers/SparseActiveSetQP.h"
+
+// Solves the problem:
+//   1/2 beta^T Q beta + beta^T ( D^T v0 + gdotD )
+// with a sparse active set method. With one friction impulse per normal the constraints are
+//   - mu_i alpha_i <= beta_i <= mu_i alpha_i
+// and this is the 2D friction problem solved by BoundConstrainedMDPOperatorQL. With two impulses per normal the
+// constraints are the friction disks || beta_i || <= mu_i alpha_i. The square circumscribing each disk bounds the
+// first solve, and if any pair leaves its disk, solves over the squares alternate with projections onto the disks
+// until the two agree.
+class MDPOperatorSparseActiveSet final : public FrictionOperator
+{
+
+public:
+
+  MDPOperatorSparseActiveSet( const int impulses_per_normal, const scalar& tol, const unsigned max_iters );
+  explicit MDPOperatorSparseActiveSet( std::istream& input_stream );
+
+  virtual ~MDPOperatorSparseActiveSet() override = default;
+
+  virtual void flow( const scalar& t, const SparseMatrixsc& Minv, const VectorXs& v0, const SparseMatrixsc& D, const SparseMatrixsc& Q, const VectorXs& gdotD, const VectorXs& mu, const VectorXs& alpha, VectorXs& beta, VectorXs& lambda ) override;
+
+  virtual int numFrictionImpulsesPerNormal() const override;
+
+  virtual std::string name() const override;
+
+  virtual std::unique_ptr<FrictionOperator> clone() const override;
+
+  virtual void serialize( std::ostream& output_stream ) const override;
+
+  virtual bool isLinearized() const override;
+
+private:
+
+  // Whether each pair of impulses lies within the disk of radius radii( 2 * i )
+  bool insideDisks( const VectorXs& radii, const VectorXs& beta ) const;
+  void solveWithDisks( const SparseMatrixsc& Q, const VectorXs& c, const VectorXs& lower, const VectorXs& upper, VectorXs& beta );
+
+  const int m_impulses_per_normal;
+  const scalar m_tol;
+  const unsigned m_max_iters;
+
+  SparseActiveSetQP m_qp;
+
+};
+
+#endif
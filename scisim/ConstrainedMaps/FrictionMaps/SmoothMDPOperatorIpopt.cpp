@@ -18,12 +18,14 @@
 #include "IpIpoptData.hpp"
 #include "IpTNLPAdapter.hpp"
 #include "IpOrigIpoptNLP.hpp"
-#include "scisim/ConstrainedMaps/FrictionMaps/FischerBurmeisterSmooth.h"
 #include "scisim/ConstrainedMaps/QPTerminationOperator.h"
 
 SmoothMDPOperatorIpopt::SmoothMDPOperatorIpopt( const std::vector<std::string>& linear_solvers, const scalar& tol )
 : m_linear_solver_order( linear_solvers )
 , m_tol( tol )
+, m_ipopt_app()
+, m_ipopt_problem()
+, m_solve_history( m_linear_solver_order )
 {
   assert( m_tol > 0.0 );
 
@@ -51,6 +53,9 @@ SmoothMDPOperatorIpopt::SmoothMDPOperatorIpopt( const std::vector<std::string>&
 SmoothMDPOperatorIpopt::SmoothMDPOperatorIpopt( std::istream& input_stream )
 : m_linear_solver_order( StringUtilities::deserializeVector( input_stream ) )
 , m_tol( Utilities::deserialize<scalar>( input_stream ) )
+, m_ipopt_app()
+, m_ipopt_problem()
+, m_solve_history( m_linear_solver_order )
 {
   assert( !m_linear_solver_order.empty() );
   assert( m_tol > 0.0 );
@@ -110,13 +115,17 @@ static void createIpoptApplication( const scalar& tol, Ipopt::SmartPtr<Ipopt::Ip
 
 void SmoothMDPOperatorIpopt::flow( const scalar& t, const SparseMatrixsc& Minv, const VectorXs& v0, const SparseMatrixsc& D, const SparseMatrixsc& Q, const VectorXs& gdotD, const VectorXs& mu, const VectorXs& alpha, VectorXs& beta, VectorXs& lambda )
 {
-  Ipopt::SmartPtr<Ipopt::IpoptApplication> ipopt_app;
-  createIpoptApplication( m_tol, ipopt_app );
+  // The application and problem persist across calls so that Ipopt can reuse its structures between solves
+  if( IsNull( m_ipopt_app ) )
+  {
+    createIpoptApplication( m_tol, m_ipopt_app );
+    // Use built in termination, for now
+    m_ipopt_problem = new SmoothMDPNLP;
+  }
 
-  // Create the Ipopt-based QP solver
-  // Use built in termination, for now
-  Ipopt::SmartPtr<Ipopt::TNLP> ipopt_problem{ new SmoothMDPNLP{ Q, beta, false, FischerBurmeisterSmooth{ m_tol, ( mu.array() * alpha.array() ).matrix() } } };
-  SmoothMDPNLP& qp_nlp{ *static_cast<SmoothMDPNLP*>( GetRawPtr( ipopt_problem ) ) };
+  SmoothMDPNLP& qp_nlp{ *static_cast<SmoothMDPNLP*>( GetRawPtr( m_ipopt_problem ) ) };
+  qp_nlp.setQ( &Q );
+  qp_nlp.setBeta( &beta );
 
   // Linear term in the objective
   assert( D.rows() == v0.size() ); assert( D.cols() == gdotD.size() );
@@ -128,26 +137,35 @@ void SmoothMDPOperatorIpopt::flow( const scalar& t, const SparseMatrixsc& Minv,
   // Backup beta, in case we need to fall back on another solver
   const VectorXs beta0{ beta };
 
-  for( const std::string& solver_name : m_linear_solver_order )
+  for( unsigned attempt = 0; attempt < m_solve_history.numAttempts(); ++attempt )
   {
     // Reset the initial guess
     beta = beta0;
 
-    // Set the current linear solver
+    const std::string& solver_name{ m_solve_history.linearSolver( attempt ) };
     assert( !solver_name.empty() );
-    ipopt_app->Options()->SetStringValue( "linear_solver", solver_name );
-    // Try to solve the QP
-    ipopt_app->OptimizeTNLP( ipopt_problem );
+    // Try to solve the QP, reusing the previous solve's structures if the sparsity of Q is unchanged
+    if( m_solve_history.canReoptimize( attempt, Q ) )
+    {
+      m_ipopt_app->ReOptimizeTNLP( m_ipopt_problem );
+    }
+    else
+    {
+      // Set the current linear solver
+      m_ipopt_app->Options()->SetStringValue( "linear_solver", solver_name );
+      m_ipopt_app->OptimizeTNLP( m_ipopt_problem );
+    }
     const Ipopt::SolverReturn solve_status{ qp_nlp.getReturnStatus() };
 
     // If the solve failed
     if( solve_status != Ipopt::SUCCESS && solve_status != Ipopt::STOP_AT_ACCEPTABLE_POINT )
     {
+      m_solve_history.recordFailure();
       // Print an error message
       std::cerr << "Failed to solve QP with Ipopt and linear solver " << solver_name << ": ";
       std::cerr << IpoptUtilities::ipoptReturnStatusToString( solve_status ) << std::endl;
       // If we exhausted all of the user-specified solvers
-      if( solver_name == m_linear_solver_order.back() )
+      if( attempt + 1 == m_solve_history.numAttempts() )
       {
         std::cerr << "Exhausted all linear solver options in SmoothMDPOperatorIpopt::flow. Exiting." << std::endl;
         std::exit( EXIT_FAILURE );
@@ -155,6 +173,7 @@ void SmoothMDPOperatorIpopt::flow( const scalar& t, const SparseMatrixsc& Minv,
     }
     else
     {
+      m_solve_history.recordSuccess( attempt, Q );
       break;
     }
   }
@@ -168,6 +187,9 @@ void SmoothMDPOperatorIpopt::flow( const scalar& t, const SparseMatrixsc& Minv,
       lambda( lambda_idx ) = vrel.segment<2>( 2 * lambda_idx ).norm();
     }
   }
+
+  qp_nlp.setQ( nullptr );
+  qp_nlp.setBeta( nullptr );
 }
 
 void SmoothMDPOperatorIpopt::solveQP( const QPTerminationOperator& termination_operator, const SparseMatrixsc& Minv, const SparseMatrixsc& D, const VectorXs& b, const VectorXs& c, VectorXs& beta, VectorXs& lambda, scalar& achieved_tol ) const
@@ -178,7 +200,7 @@ void SmoothMDPOperatorIpopt::solveQP( const QPTerminationOperator& termination_o
   const SparseMatrixsc Q{ D.transpose() * Minv * D };
 
   // Create the Ipopt-based QP solver
-  Ipopt::SmartPtr<Ipopt::TNLP> ipopt_problem{ new SmoothMDPNLP( Q, beta, true, termination_operator ) };
+  Ipopt::SmartPtr<Ipopt::TNLP> ipopt_problem{ new SmoothMDPNLP( Q, beta, termination_operator ) };
   SmoothMDPNLP& qp_nlp{ *static_cast<SmoothMDPNLP*>( GetRawPtr( ipopt_problem ) ) };
 
   // Linear term in the objective
@@ -233,15 +255,25 @@ void SmoothMDPOperatorIpopt::solveQP( const QPTerminationOperator& termination_o
 }
 
 
-SmoothMDPNLP::SmoothMDPNLP( const SparseMatrixsc& Q, VectorXs& beta, const bool use_custom_termination, const QPTerminationOperator& termination_operator )
-: m_Q( Q )
+SmoothMDPNLP::SmoothMDPNLP()
+: m_Q( nullptr )
 , m_A()
 , m_C()
-, m_beta( beta )
+, m_beta( nullptr )
 , m_diagonal_indices()
 , m_solve_return_status()
-, m_use_custom_termination( use_custom_termination )
-, m_termination_operator( termination_operator )
+, m_termination_operator( nullptr )
+, m_achieved_tolerance( SCALAR_INFINITY )
+{}
+
+SmoothMDPNLP::SmoothMDPNLP( const SparseMatrixsc& Q, VectorXs& beta, const QPTerminationOperator& termination_operator )
+: m_Q( &Q )
+, m_A()
+, m_C()
+, m_beta( &beta )
+, m_diagonal_indices()
+, m_solve_return_status()
+, m_termination_operator( &termination_operator )
 , m_achieved_tolerance( SCALAR_INFINITY )
 {}
 
@@ -250,11 +282,11 @@ SmoothMDPNLP::~SmoothMDPNLP()
 
 bool SmoothMDPNLP::get_nlp_info( Ipopt::Index& n, Ipopt::Index& m, Ipopt::Index& nnz_jac_g, Ipopt::Index& nnz_h_lag, TNLP::IndexStyleEnum& index_style )
 {
-  assert( m_Q.rows() == m_Q.cols() );
-  assert( m_A.size() == m_Q.rows() );
+  assert( Q().rows() == Q().cols() );
+  assert( m_A.size() == Q().rows() );
 
   // Number of friction impulses
-  assert( m_beta.size() == m_A.size() );
+  assert( beta().size() == m_A.size() );
   n = Ipopt::Index( m_A.size() );
 
   // Number of constraints -- one per contact/pair-of-impulses
@@ -262,7 +294,7 @@ bool SmoothMDPNLP::get_nlp_info( Ipopt::Index& n, Ipopt::Index& m, Ipopt::Index&
   m = n / 2;
 
   nnz_jac_g = n;
-  nnz_h_lag = IpoptUtilities::nzLowerTriangular( m_Q );
+  nnz_h_lag = IpoptUtilities::nzLowerTriangular( Q() );
   index_style = TNLP::C_STYLE;
 
   return true;
@@ -301,8 +333,8 @@ bool SmoothMDPNLP::get_starting_point( Ipopt::Index n, bool init_x, Ipopt::Numbe
   assert( !init_lambda );
   //assert( lambda == nullptr );
 
-  assert( m_beta.size() == n );
-  Eigen::Map< Eigen::Matrix< Ipopt::Number, Eigen::Dynamic, 1 > >{ x, n } = m_beta;
+  assert( beta().size() == n );
+  Eigen::Map< Eigen::Matrix< Ipopt::Number, Eigen::Dynamic, 1 > >{ x, n } = beta();
 
   return true;
 }
@@ -310,14 +342,14 @@ bool SmoothMDPNLP::get_starting_point( Ipopt::Index n, bool init_x, Ipopt::Numbe
 bool SmoothMDPNLP::eval_f( Ipopt::Index n, const Ipopt::Number* x, bool new_x, Ipopt::Number& obj_value )
 {
   static_assert( std::is_same<Ipopt::Number,scalar>::value, "Ipopt's floating point type must be the same type as SCISim's scalar." );
-  assert( m_Q.rows() == m_Q.cols() );
-  assert( m_A.size() == m_Q.rows() );
-  assert( n == m_Q.rows() );
+  assert( Q().rows() == Q().cols() );
+  assert( m_A.size() == Q().rows() );
+  assert( n == Q().rows() );
   assert( x != nullptr );
   
   const Eigen::Map< const Eigen::Matrix< Ipopt::Number, Eigen::Dynamic, 1 > > x_map{ x, n };
-  assert( m_Q.rows() == m_Q.cols() ); assert( m_Q.rows() == x_map.size() ); assert( m_A.size() == x_map.size() );
-  obj_value = 0.5 * x_map.transpose() * m_Q * x_map + m_A.dot( x_map );
+  assert( Q().rows() == Q().cols() ); assert( Q().rows() == x_map.size() ); assert( m_A.size() == x_map.size() );
+  obj_value = 0.5 * x_map.transpose() * Q() * x_map + m_A.dot( x_map );
 
   return true;
 }
@@ -325,17 +357,17 @@ bool SmoothMDPNLP::eval_f( Ipopt::Index n, const Ipopt::Number* x, bool new_x, I
 bool SmoothMDPNLP::eval_grad_f( Ipopt::Index n, const Ipopt::Number* x, bool new_x, Ipopt::Number* grad_f )
 {
   static_assert( std::is_same<Ipopt::Number,scalar>::value, "Ipopt's floating point type must be the same type as SCISim's scalar." );
-  assert( m_Q.rows() == m_Q.cols() );
-  assert( m_A.size() == m_Q.rows() );
-  assert( n == m_Q.rows() );
+  assert( Q().rows() == Q().cols() );
+  assert( m_A.size() == Q().rows() );
+  assert( n == Q().rows() );
   assert( x != nullptr );
   assert( grad_f != nullptr );
 
   const Eigen::Map< const Eigen::Matrix< Ipopt::Number, Eigen::Dynamic, 1 > > x_map{ x, n };
   Eigen::Map< Eigen::Matrix< Ipopt::Number, Eigen::Dynamic, 1 > > grad_map{ grad_f, n };
 
-  assert( m_Q.rows() == m_Q.cols() ); assert( m_Q.rows() == x_map.size() ); assert( m_A.size() == x_map.size() );
-  grad_map = m_Q * x_map + m_A;
+  assert( Q().rows() == Q().cols() ); assert( Q().rows() == x_map.size() ); assert( m_A.size() == x_map.size() );
+  grad_map = Q() * x_map + m_A;
 
   return true;
 }
@@ -415,7 +447,7 @@ bool SmoothMDPNLP::eval_h( Ipopt::Index n, const Ipopt::Number* x, bool new_x, I
     assert( jCol != nullptr );
     static_assert( std::is_same<Ipopt::Number,scalar>::value, "Ipopt's floating point type must be the same type as SCISim's scalar." );
     {
-      const int nnz{ IpoptUtilities::sparsityPatternLowerTriangular( m_Q, iRow, jCol ) };
+      const int nnz{ IpoptUtilities::sparsityPatternLowerTriangular( Q(), iRow, jCol ) };
       assert( nnz == nele_hess );
       Utilities::ignoreUnusedVariable( nnz ); // To silence warnings in release mode
     }
@@ -439,7 +471,7 @@ bool SmoothMDPNLP::eval_h( Ipopt::Index n, const Ipopt::Number* x, bool new_x, I
     static_assert( std::is_same<Ipopt::Number,scalar>::value, "Ipopt's floating point type must be the same type as SCISim's scalar." );
     assert( Ipopt::Index(m_diagonal_indices.size()) == n );
     {
-      const int nnz{ IpoptUtilities::valuesLowerTriangular( m_Q, values ) };
+      const int nnz{ IpoptUtilities::valuesLowerTriangular( Q(), values ) };
       assert( nnz == nele_hess );
       Utilities::ignoreUnusedVariable( nnz ); // To silence warnings in release mode
     }
@@ -464,15 +496,25 @@ bool SmoothMDPNLP::eval_h( Ipopt::Index n, const Ipopt::Number* x, bool new_x, I
 void SmoothMDPNLP::finalize_solution( Ipopt::SolverReturn status, Ipopt::Index n, const Ipopt::Number* x, const Ipopt::Number* z_L, const Ipopt::Number* z_U, Ipopt::Index m, const Ipopt::Number* g, const Ipopt::Number* lambda, Ipopt::Number obj_value, const Ipopt::IpoptData* ip_data, Ipopt::IpoptCalculatedQuantities* ip_cq )
 {
   m_solve_return_status = status;
-  m_beta = Eigen::Map< const Eigen::Matrix<Ipopt::Number,1,Eigen::Dynamic> >{ x, n };
+  beta() = Eigen::Map< const Eigen::Matrix<Ipopt::Number,1,Eigen::Dynamic> >{ x, n };
 
-  if( m_use_custom_termination )
+  if( m_termination_operator != nullptr )
   {
-    const VectorXs y{ m_Q * m_beta + m_A };
-    m_achieved_tolerance = m_termination_operator( m_beta, y );
+    const VectorXs y{ Q() * beta() + m_A };
+    m_achieved_tolerance = ( *m_termination_operator )( beta(), y );
   }
 }
 
+void SmoothMDPNLP::setQ( const SparseMatrixsc* Q )
+{
+  m_Q = Q;
+}
+
+void SmoothMDPNLP::setBeta( VectorXs* beta )
+{
+  m_beta = beta;
+}
+
 Ipopt::SolverReturn SmoothMDPNLP::getReturnStatus() const
 {
   return m_solve_return_status;
@@ -12,6 +12,7 @@
 #include "FrictionOperator.h"
 
 #include "IpIpoptApplication.hpp"
+#include "scisim/ConstrainedMaps/IpoptUtilities.h"
 
 class QPTerminationOperator;
 
@@ -44,13 +45,20 @@ private:
   const std::vector<std::string> m_linear_solver_order;
   const scalar m_tol;
 
+  // Ipopt state that persists across calls to flow, created on the first call
+  Ipopt::SmartPtr<Ipopt::IpoptApplication> m_ipopt_app;
+  Ipopt::SmartPtr<Ipopt::TNLP> m_ipopt_problem;
+  IpoptSolveHistory m_solve_history;
+
 };
 
 class SmoothMDPNLP final : public Ipopt::TNLP
 {
 public:
 
-  SmoothMDPNLP( const SparseMatrixsc& Q, VectorXs& beta, const bool use_custom_termination, const QPTerminationOperator& termination_operator );
+  // Solves with Ipopt's built in termination criteria
+  SmoothMDPNLP();
+  SmoothMDPNLP( const SparseMatrixsc& Q, VectorXs& beta, const QPTerminationOperator& termination_operator );
 
   virtual ~SmoothMDPNLP() override;
 
@@ -92,9 +100,14 @@ public:
   
   inline VectorXs& beta()
   {
-    return m_beta;
+    assert( m_beta != nullptr );
+    return *m_beta;
   }
-  
+
+  // Q and beta must outlive the solves that use them
+  void setQ( const SparseMatrixsc* Q );
+  void setBeta( VectorXs* beta );
+
   Ipopt::SolverReturn getReturnStatus() const;
 
   inline const scalar& achievedTolerance() const
@@ -104,10 +117,16 @@ public:
 
 private:
 
-  const SparseMatrixsc& m_Q;
+  inline const SparseMatrixsc& Q() const
+  {
+    assert( m_Q != nullptr );
+    return *m_Q;
+  }
+
+  const SparseMatrixsc* m_Q;
   VectorXs m_A;
   VectorXs m_C;
-  VectorXs& m_beta;
+  VectorXs* m_beta;
 
   // Indices of the diagonals in the sparse rep
   std::vector<int> m_diagonal_indices;
@@ -115,8 +134,8 @@ private:
   // Return status from the last solve
   Ipopt::SolverReturn m_solve_return_status;
 
-  const bool m_use_custom_termination;
-  const QPTerminationOperator& m_termination_operator;
+  // Custom termination criteria, or nullptr to use Ipopt's criteria
+  const QPTerminationOperator* const m_termination_operator;
   scalar m_achieved_tolerance;
 
   SmoothMDPNLP( const SmoothMDPNLP& );
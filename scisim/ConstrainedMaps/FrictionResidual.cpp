@@ -0,0 +1,122 @@
+#include "FrictionResidual.h"
+
+#include "scisim/Math/BlockDiagonalMass.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+FrictionResidual::FrictionResidual()
+: m_n_constant()
+, m_d_constant()
+, m_un()
+, m_ut()
+, m_impulse()
+, m_v()
+{}
+
+void FrictionResidual::initialize( const SparseMatrixsc& N, const VectorXs& v0, const VectorXs& CoR, const VectorXs& nrel, const VectorXs& drel )
+{
+  assert( N.rows() == v0.size() );
+  assert( N.cols() == CoR.size() );
+  assert( N.cols() == nrel.size() );
+
+  m_n_constant.resize( N.cols() );
+  m_n_constant.noalias() = N.transpose() * v0;
+  m_n_constant.array() *= CoR.array();
+  m_n_constant += nrel;
+
+  m_d_constant = drel;
+}
+
+scalar FrictionResidual::evalError( const SparseMatrixsc& N, const SparseMatrixsc& D, const VectorXs& mu, const VectorXs& alpha, const VectorXs& beta, const VectorXs& v )
+{
+  assert( N.cols() == alpha.size() );
+  assert( D.cols() == beta.size() );
+  assert( mu.size() == alpha.size() );
+  assert( m_n_constant.size() == alpha.size() );
+  assert( m_d_constant.size() == beta.size() );
+  assert( alpha.size() == 0 || beta.size() % alpha.size() == 0 );
+
+  if( alpha.size() == 0 )
+  {
+    return 0.0;
+  }
+
+  m_un.resize( alpha.size() );
+  m_un.noalias() = N.transpose() * v;
+  m_un += m_n_constant;
+  m_ut.resize( beta.size() );
+  m_ut.noalias() = D.transpose() * v;
+  m_ut += m_d_constant;
+
+  const unsigned num_samples{ unsigned( beta.size() / alpha.size() ) };
+  scalar error{ 0.0 };
+  for( unsigned con_idx = 0; con_idx < unsigned( alpha.size() ); ++con_idx )
+  {
+    const unsigned sample_idx{ num_samples * con_idx };
+    error = std::max( error, evalContactResidual( mu( con_idx ), alpha( con_idx ), beta.data() + sample_idx, m_un( con_idx ), m_ut.data() + sample_idx, num_samples ) );
+  }
+  return error;
+}
+
+scalar FrictionResidual::evalError( const BlockDiagonalMass& Minv, const SparseMatrixsc& N, const SparseMatrixsc& D, const VectorXs& v0, const VectorXs& mu, const VectorXs& alpha, const VectorXs& beta )
+{
+  assert( Minv.rows() == v0.size() );
+  assert( Minv.cols() == v0.size() );
+
+  m_impulse.resize( v0.size() );
+  m_impulse.noalias() = N * alpha;
+  m_impulse.noalias() += D * beta;
+  Minv.multiply( m_impulse, m_v );
+  m_v += v0;
+
+  return evalError( N, D, mu, alpha, beta, m_v );
+}
+
+// With the change of variables of De Saxce, the Coulomb law at a contact is the complementarity problem
+//   r in K_mu, u + mu || u_T || e_N in K_1/mu, r . ( u + mu || u_T || e_N ) = 0
+// with r = ( alpha, beta ) and u = ( un, ut ). Scaling the normal component of r and the tangent components of the
+// complementary variable by mu maps both cones to the unit Lorentz cone, where the Fischer-Burmeister function is
+//   x + y - sqrt( x o x + y o y )
+// with o the Jordan product of the cone and sqrt taken through the spectral decomposition.
+scalar FrictionResidual::evalContactResidual( const scalar& mu, const scalar& alpha, const scalar* beta, const scalar& un, const scalar* ut, const unsigned num_samples )
+{
+  scalar ut_norm_squared{ 0.0 };
+  scalar beta_norm_squared{ 0.0 };
+  for( unsigned sample_idx = 0; sample_idx < num_samples; ++sample_idx )
+  {
+    ut_norm_squared += ut[sample_idx] * ut[sample_idx];
+    beta_norm_squared += beta[sample_idx] * beta[sample_idx];
+  }
+
+  // Normal components of the scaled impulse and the scaled, shifted velocity
+  const scalar x0{ mu * alpha };
+  const scalar y0{ un + mu * std::sqrt( ut_norm_squared ) };
+
+  // w = x o x + y o y = ( w0, 2 ( x0 xT + y0 yT ) )
+  const scalar w0{ x0 * x0 + beta_norm_squared + y0 * y0 + mu * mu * ut_norm_squared };
+  scalar wt_norm_squared{ 0.0 };
+  for( unsigned sample_idx = 0; sample_idx < num_samples; ++sample_idx )
+  {
+    const scalar wt{ 2.0 * ( x0 * beta[sample_idx] + y0 * mu * ut[sample_idx] ) };
+    wt_norm_squared += wt * wt;
+  }
+  const scalar wt_norm{ std::sqrt( wt_norm_squared ) };
+
+  // Square roots of the spectral values of w
+  const scalar s1{ std::sqrt( std::max( w0 + wt_norm, scalar( 0.0 ) ) ) };
+  const scalar s2{ std::sqrt( std::max( w0 - wt_norm, scalar( 0.0 ) ) ) };
+
+  const scalar fb0{ x0 + y0 - 0.5 * ( s1 + s2 ) };
+  scalar residual{ fb0 * fb0 };
+  // The tangent part of sqrt( w ) is parallel to the tangent part of w
+  const scalar tangent_scale{ wt_norm > 0.0 ? 0.5 * ( s1 - s2 ) / wt_norm : 0.0 };
+  for( unsigned sample_idx = 0; sample_idx < num_samples; ++sample_idx )
+  {
+    const scalar wt{ 2.0 * ( x0 * beta[sample_idx] + y0 * mu * ut[sample_idx] ) };
+    const scalar fbt{ beta[sample_idx] + mu * ut[sample_idx] - tangent_scale * wt };
+    residual += fbt * fbt;
+  }
+  return residual;
+}
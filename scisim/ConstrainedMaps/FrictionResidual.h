@@ -0,0 +1,47 @@
+#ifndef FRICTION_RESIDUAL_H
+#define FRICTION_RESIDUAL_H
+
+#include "scisim/Math/MathDefines.h"
+
+class BlockDiagonalMass;
+
+// Residual of the Coulomb friction law for a set of contacts with smooth friction bases, evaluated directly from the
+// impact and friction bases N and D. The per contact residual is the squared norm of the Fischer-Burmeister function
+// of the second order cone complementarity problem obtained by the De Saxce change of variables, and the global error
+// is the largest per contact residual. This is the metric computed by SobogusFrictionProblem::computeError, without
+// assembling the local Delassus operator. After the first evaluation for a given number of contacts and degrees of
+// freedom, evaluations do not allocate.
+class FrictionResidual final
+{
+
+public:
+
+  FrictionResidual();
+
+  // Caches the constant part of the local contact velocities, CoR N^T v0 + nrel and drel
+  void initialize( const SparseMatrixsc& N, const VectorXs& v0, const VectorXs& CoR, const VectorXs& nrel, const VectorXs& drel );
+
+  // Error of the impulses alpha and beta given the resulting velocity v
+  scalar evalError( const SparseMatrixsc& N, const SparseMatrixsc& D, const VectorXs& mu, const VectorXs& alpha, const VectorXs& beta, const VectorXs& v );
+
+  // Error of the impulses alpha and beta, with the resulting velocity v0 + M^-1 ( N alpha + D beta ) formed internally
+  scalar evalError( const BlockDiagonalMass& Minv, const SparseMatrixsc& N, const SparseMatrixsc& D, const VectorXs& v0, const VectorXs& mu, const VectorXs& alpha, const VectorXs& beta );
+
+  // Residual of a single contact with normal impulse alpha, friction impulses beta, normal velocity un, and
+  // tangent velocities ut; beta and ut point to num_samples entries
+  static scalar evalContactResidual( const scalar& mu, const scalar& alpha, const scalar* beta, const scalar& un, const scalar* ut, const unsigned num_samples );
+
+private:
+
+  VectorXs m_n_constant;
+  VectorXs m_d_constant;
+
+  // Workspace for the local velocities and for the resulting velocity
+  VectorXs m_un;
+  VectorXs m_ut;
+  VectorXs m_impulse;
+  VectorXs m_v;
+
+};
+
+#endif
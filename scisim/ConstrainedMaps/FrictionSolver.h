@@ -33,6 +33,8 @@ public:
 
   virtual std::string name() const = 0;
 
+  virtual std::unique_ptr<FrictionSolver> clone() const = 0;
+
 protected:
 
   FrictionSolver() = default;
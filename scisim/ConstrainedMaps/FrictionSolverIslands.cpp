@@ -0,0 +1,228 @@
+#include "FrictionSolverIslands.h"
+
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "scisim/Constraints/Constraint.h"
+#include "scisim/Constraints/ContactBatch.h"
+#include "ConstrainedMapUtilities.h"
+#include "scisim/Timer/Profiler.h"
+
+FrictionSolverIslands::FrictionSolverIslands( const FrictionSolver& friction_solver )
+: m_friction_solver( friction_solver.clone() )
+, m_islands()
+, m_thread_solvers()
+, m_thread_body_maps()
+, m_island_problems()
+, m_island_systems()
+{
+  assert( m_friction_solver != nullptr );
+}
+
+FrictionSolverIslands::FrictionSolverIslands( std::istream& input_stream )
+: m_friction_solver( ConstrainedMapUtilities::deserializeFrictionSolver( input_stream ) )
+, m_islands()
+, m_thread_solvers()
+, m_thread_body_maps()
+, m_island_problems()
+, m_island_systems()
+{
+  assert( m_friction_solver != nullptr );
+}
+
+FrictionSolverIslands::~FrictionSolverIslands()
+{}
+
+void FrictionSolverIslands::solveIsland( const unsigned island, const unsigned thread, const unsigned iteration, const scalar& dt, const FlowableSystem& fsys, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& f, const unsigned max_iters, const scalar& tol )
+{
+  Island& problem{ m_island_problems[island] };
+  FlowableSubsystem& system{ m_island_systems[island] };
+  std::vector<int>& body_map{ m_thread_body_maps[thread] };
+
+  // Simulated bodies of the island, in increasing order so that renumbering preserves the order of each constraint's bodies
+  std::vector<unsigned> bodies;
+  for( const std::unique_ptr<Constraint>& con : problem.active_set )
+  {
+    std::pair<int,int> con_bodies;
+    con->getSimulatedBodyIndices( con_bodies );
+    for( const int body : { con_bodies.first, con_bodies.second } )
+    {
+      if( body >= 0 && body_map[body] == -1 )
+      {
+        body_map[body] = 0;
+        bodies.emplace_back( unsigned( body ) );
+      }
+    }
+  }
+  std::sort( bodies.begin(), bodies.end() );
+  for( std::vector<unsigned>::size_type body = 0; body < bodies.size(); ++body )
+  {
+    body_map[bodies[body]] = int( body );
+  }
+
+  // Renumber the constraints to the island's bodies
+  for( const std::unique_ptr<Constraint>& con : problem.active_set )
+  {
+    con->setSimulatedBody0( unsigned( body_map[con->simulatedBody0()] ) );
+    if( con->simulatedBody1() >= 0 )
+    {
+      con->setSimulatedBody1( unsigned( body_map[con->simulatedBody1()] ) );
+    }
+  }
+
+  system.setBodies( fsys, M, Minv, bodies );
+  system.gatherConfiguration( q0, problem.q0 );
+  system.gatherVelocity( v0, problem.v0 );
+  system.gatherVelocity( f, problem.f );
+  problem.vout.resize( problem.v0.size() );
+
+  {
+    // The island's contacts are gathered once for every assembly of the solve, and only while they carry the island's numbering
+    const ScopedContactBatch contact_batch{ problem.q0, problem.active_set };
+    m_thread_solvers[thread]->solve( iteration, dt, system, system.M(), system.Minv(), problem.CoR, problem.mu, problem.q0, problem.v0, problem.active_set, problem.contact_bases, problem.nrel_extra, problem.drel_extra, max_iters, tol, problem.f, problem.alpha, problem.beta, problem.vout, problem.solve_succeeded, problem.error );
+  }
+
+  // Restore the global numbering
+  for( const std::unique_ptr<Constraint>& con : problem.active_set )
+  {
+    con->setSimulatedBody0( bodies[con->simulatedBody0()] );
+    if( con->simulatedBody1() >= 0 )
+    {
+      con->setSimulatedBody1( bodies[con->simulatedBody1()] );
+    }
+  }
+  for( const unsigned body : bodies )
+  {
+    body_map[body] = -1;
+  }
+}
+
+void FrictionSolverIslands::solve( const unsigned iteration, const scalar& dt, const FlowableSystem& fsys, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& CoR, const VectorXs& mu, const VectorXs& q0, const VectorXs& v0, std::vector<std::unique_ptr<Constraint>>& active_set, const MatrixXXsc& contact_bases, const VectorXs& nrel_extra, const VectorXs& drel_extra, const unsigned max_iters, const scalar& tol, VectorXs& f, VectorXs& alpha, VectorXs& beta, VectorXs& vout, bool& solve_succeeded, scalar& error )
+{
+  assert( alpha.size() == long( active_set.size() ) );
+  assert( mu.size() == alpha.size() );
+
+  m_islands.compute( active_set );
+  const unsigned num_islands{ m_islands.numIslands() };
+  SCISIM_PROFILE_COUNT( ProfileCounter::ISLANDS, num_islands );
+
+  // A single island is the original problem
+  if( num_islands <= 1 )
+  {
+    m_friction_solver->solve( iteration, dt, fsys, M, Minv, CoR, mu, q0, v0, active_set, contact_bases, nrel_extra, drel_extra, max_iters, tol, f, alpha, beta, vout, solve_succeeded, error );
+    return;
+  }
+
+  const long dim{ contact_bases.rows() };
+  const long num_friction{ beta.size() / alpha.size() };
+
+  // Slice the problem into islands; the constraints are moved into the islands and moved back once solved
+  m_island_problems.resize( num_islands );
+  m_island_systems.resize( num_islands );
+  for( unsigned island = 0; island < num_islands; ++island )
+  {
+    const unsigned num_cons{ m_islands.islandSize( island ) };
+    const unsigned* const island_cons{ m_islands.islandConstraints( island ) };
+    Island& problem{ m_island_problems[island] };
+    problem.active_set.resize( num_cons );
+    problem.CoR.resize( num_cons );
+    problem.mu.resize( num_cons );
+    problem.contact_bases.resize( dim, dim * num_cons );
+    problem.nrel_extra.resize( nrel_extra.size() == 0 ? 0 : num_cons );
+    problem.drel_extra.resize( drel_extra.size() == 0 ? 0 : num_friction * num_cons );
+    problem.alpha.resize( num_cons );
+    problem.beta.resize( num_friction * num_cons );
+    for( unsigned idx = 0; idx < num_cons; ++idx )
+    {
+      const unsigned con{ island_cons[idx] };
+      problem.active_set[idx] = std::move( active_set[con] );
+      problem.CoR( idx ) = CoR( con );
+      problem.mu( idx ) = mu( con );
+      problem.contact_bases.middleCols( dim * idx, dim ) = contact_bases.middleCols( dim * con, dim );
+      if( nrel_extra.size() != 0 )
+      {
+        problem.nrel_extra( idx ) = nrel_extra( con );
+      }
+      if( drel_extra.size() != 0 )
+      {
+        problem.drel_extra.segment( num_friction * idx, num_friction ) = drel_extra.segment( num_friction * con, num_friction );
+      }
+      problem.alpha( idx ) = alpha( con );
+      problem.beta.segment( num_friction * idx, num_friction ) = beta.segment( num_friction * con, num_friction );
+    }
+  }
+
+  #ifdef _OPENMP
+  const unsigned num_threads{ unsigned( omp_get_max_threads() ) };
+  #else
+  const unsigned num_threads{ 1 };
+  #endif
+  while( m_thread_solvers.size() < num_threads )
+  {
+    m_thread_solvers.emplace_back( m_friction_solver->clone() );
+  }
+  m_thread_body_maps.resize( num_threads );
+  for( std::vector<int>& body_map : m_thread_body_maps )
+  {
+    body_map.resize( fsys.numBodies(), -1 );
+  }
+
+  #pragma omp parallel for schedule( dynamic )
+  for( unsigned island = 0; island < num_islands; ++island )
+  {
+    #ifdef _OPENMP
+    const unsigned thread{ unsigned( omp_get_thread_num() ) };
+    #else
+    const unsigned thread{ 0 };
+    #endif
+    solveIsland( island, thread, iteration, dt, fsys, M, Minv, q0, v0, f, max_iters, tol );
+  }
+
+  // Islands own disjoint constraints and degrees of freedom; bodies outside every island keep their velocity and
+  // receive no impulse
+  f.setZero();
+  vout = v0;
+  solve_succeeded = true;
+  error = 0.0;
+  for( unsigned island = 0; island < num_islands; ++island )
+  {
+    const unsigned num_cons{ m_islands.islandSize( island ) };
+    const unsigned* const island_cons{ m_islands.islandConstraints( island ) };
+    Island& problem{ m_island_problems[island] };
+    for( unsigned idx = 0; idx < num_cons; ++idx )
+    {
+      const unsigned con{ island_cons[idx] };
+      active_set[con] = std::move( problem.active_set[idx] );
+      alpha( con ) = problem.alpha( idx );
+      beta.segment( num_friction * con, num_friction ) = problem.beta.segment( num_friction * idx, num_friction );
+    }
+    m_island_systems[island].scatterVelocity( problem.f, f );
+    m_island_systems[island].scatterVelocity( problem.vout, vout );
+    solve_succeeded = solve_succeeded && problem.solve_succeeded;
+    error = std::max( error, problem.error );
+  }
+}
+
+unsigned FrictionSolverIslands::numFrictionImpulsesPerNormal( const unsigned ambient_space_dimensions ) const
+{
+  return m_friction_solver->numFrictionImpulsesPerNormal( ambient_space_dimensions );
+}
+
+void FrictionSolverIslands::serialize( std::ostream& output_stream ) const
+{
+  assert( output_stream.good() );
+  ConstrainedMapUtilities::serialize( m_friction_solver, output_stream );
+}
+
+std::string FrictionSolverIslands::name() const
+{
+  return "friction_solver_islands";
+}
+
+std::unique_ptr<FrictionSolver> FrictionSolverIslands::clone() const
+{
+  return std::unique_ptr<FrictionSolver>{ new FrictionSolverIslands{ *m_friction_solver } };
+}
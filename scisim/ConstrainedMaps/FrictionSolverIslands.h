@@ -0,0 +1,73 @@
+#ifndef FRICTION_SOLVER_ISLANDS_H
+#define FRICTION_SOLVER_ISLANDS_H
+
+#include "FrictionSolver.h"
+
+#include <vector>
+
+#include "scisim/Constraints/ConstraintIslands.h"
+#include "scisim/UnconstrainedMaps/FlowableSubsystem.h"
+
+// Splits the active set into islands of contacts between simulated bodies, with static geometry and kinematic
+// bodies acting as cuts, and solves each island with its own copy of a friction solver, concurrently when OpenMP is
+// enabled. Each island is restricted to its own bodies: the constraints are renumbered to the island's bodies for
+// the duration of the solve, as in Sobogus, and the wrapped solver sees only the island's configuration,
+// velocities, and masses. Islands touch disjoint degrees of freedom, so their impulses and velocities are scattered
+// back into the global result.
+class FrictionSolverIslands final : public FrictionSolver
+{
+
+public:
+
+  explicit FrictionSolverIslands( const FrictionSolver& friction_solver );
+  explicit FrictionSolverIslands( std::istream& input_stream );
+  virtual ~FrictionSolverIslands() override;
+
+  virtual void solve( const unsigned iteration, const scalar& dt, const FlowableSystem& fsys, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& CoR, const VectorXs& mu, const VectorXs& q0, const VectorXs& v0, std::vector<std::unique_ptr<Constraint>>& active_set, const MatrixXXsc& contact_bases, const VectorXs& nrel_extra, const VectorXs& drel_extra, const unsigned max_iters, const scalar& tol, VectorXs& f, VectorXs& alpha, VectorXs& beta, VectorXs& vout, bool& solve_succeeded, scalar& error ) override;
+
+  virtual unsigned numFrictionImpulsesPerNormal( const unsigned ambient_space_dimensions ) const override;
+
+  virtual void serialize( std::ostream& output_stream ) const override;
+
+  virtual std::string name() const override;
+
+  virtual std::unique_ptr<FrictionSolver> clone() const override;
+
+private:
+
+  void solveIsland( const unsigned island, const unsigned thread, const unsigned iteration, const scalar& dt, const FlowableSystem& fsys, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& f, const unsigned max_iters, const scalar& tol );
+
+  // Per island copy of the problem and its solution
+  struct Island
+  {
+    std::vector<std::unique_ptr<Constraint>> active_set;
+    VectorXs q0;
+    VectorXs v0;
+    VectorXs CoR;
+    VectorXs mu;
+    MatrixXXsc contact_bases;
+    VectorXs nrel_extra;
+    VectorXs drel_extra;
+    VectorXs f;
+    VectorXs alpha;
+    VectorXs beta;
+    VectorXs vout;
+    bool solve_succeeded;
+    scalar error;
+  };
+
+  const std::unique_ptr<FrictionSolver> m_friction_solver;
+
+  ConstraintIslands m_islands;
+
+  // Per thread copies of the solver and maps from global to island bodies, reused across steps
+  std::vector<std::unique_ptr<FrictionSolver>> m_thread_solvers;
+  std::vector<std::vector<int>> m_thread_body_maps;
+
+  std::vector<Island> m_island_problems;
+  // Bodies of each island; kept apart from the islands, which hold constraints and can only be moved
+  std::vector<FlowableSubsystem> m_island_systems;
+
+};
+
+#endif
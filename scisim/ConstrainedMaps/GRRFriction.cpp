@@ -11,7 +11,11 @@
 #include "scisim/ConstrainedMaps/FrictionMaps/FrictionOperator.h"
 #include "scisim/ConstrainedMaps/ConstrainedMapUtilities.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorUtilities.h"
+#include "scisim/ConstrainedMaps/FrictionResidual.h"
 #include "scisim/Constraints/Constraint.h"
+#include "scisim/Math/DelassusOperator.h"
+#include "scisim/Math/BlockDiagonalMass.h"
+#include "scisim/UnconstrainedMaps/FlowableSystem.h"
 
 GRRFriction::GRRFriction( const ImpactOperator& impact_operator, const FrictionOperator& friction_operator )
 : m_impact_operator( impact_operator.clone() )
@@ -62,32 +66,44 @@ void GRRFriction::solve( const unsigned iteration, const scalar& dt, const Flowa
     m_friction_operator->formGeneralizedFrictionBasis( q0, v0, active_set, D, drel );
   }
 
+  assert( fsys.MinvBlocks().rows() == Minv.rows() );
+
+  // Quadratic term in LCP QP
+  const DelassusOperator QN{ N, fsys.MinvBlocks() };
   // Impact solve
   {
-    // Quadratic term in LCP QP
-    const SparseMatrixsc QN{ N.transpose() * Minv * N };
-    assert( ( Eigen::Map<const ArrayXs>{QN.valuePtr(), QN.nonZeros()} != 0.0 ).any() );
+    assert( ( Eigen::Map<const ArrayXs>{QN.matrix().valuePtr(), QN.matrix().nonZeros()} != 0.0 ).any() );
 
     alpha.setZero();
     m_impact_operator->flow( active_set, M, Minv, q0, v0, v0, N, QN, nrel, CoR, alpha );
   }
 
+  // Quadratic term in MDP QP
+  const DelassusOperator QD{ D, fsys.MinvBlocks() };
   // Friction solve
   {
-    // Quadratic term in MDP QP
-    const SparseMatrixsc QD{ D.transpose() * Minv * D };
-    assert( ( Eigen::Map<const ArrayXs>{QD.valuePtr(), QD.nonZeros()} != 0.0 ).any() );
+    assert( ( Eigen::Map<const ArrayXs>{QD.matrix().valuePtr(), QD.matrix().nonZeros()} != 0.0 ).any() );
 
-    vout = v0 + Minv * N * alpha;
+    vout = v0 + QN.MinvN() * alpha;
     beta.setZero();
     // TODO: Get rid of lambda from the friction operator
     VectorXs temp_lambda{ mu.size() };
-    m_friction_operator->flow( iteration * dt, Minv, vout, D, QD, drel, mu, alpha, beta, temp_lambda );
+    m_friction_operator->flow( iteration * dt, Minv, vout, D, QD.matrix(), drel, mu, alpha, beta, temp_lambda );
   }
 
-  vout = v0 + Minv * ( N * alpha + D * beta );
+  vout = v0 + QN.MinvN() * alpha + QD.MinvN() * beta;
   solve_succeeded = true;
-  error = 0.0;
+  // The residual measures the Coulomb law, which linearized friction bases only approximate
+  if( !m_friction_operator->isLinearized() )
+  {
+    FrictionResidual residual;
+    residual.initialize( N, v0, CoR, nrel, drel );
+    error = residual.evalError( N, D, mu, alpha, beta, vout );
+  }
+  else
+  {
+    error = 0.0;
+  }
 }
 
 unsigned GRRFriction::numFrictionImpulsesPerNormal( const unsigned ambient_space_dimensions ) const
@@ -105,3 +121,8 @@ std::string GRRFriction::name() const
 {
   return "grr_friction";
 }
+
+std::unique_ptr<FrictionSolver> GRRFriction::clone() const
+{
+  return std::unique_ptr<FrictionSolver>{ new GRRFriction{ *m_impact_operator, *m_friction_operator } };
+}
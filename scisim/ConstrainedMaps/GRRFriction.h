@@ -34,6 +34,8 @@ public:
 
   virtual std::string name() const override;
 
+  virtual std::unique_ptr<FrictionSolver> clone() const override;
+
 private:
 
   const std::unique_ptr<ImpactOperator> m_impact_operator;
@@ -12,10 +12,16 @@
 #include "scisim/ConstrainedMaps/FrictionSolver.h"
 #include "scisim/Constraints/Constraint.h"
 #include "scisim/Constraints/ConstrainedSystem.h"
+#include "scisim/Constraints/ContactBatch.h"
 #include "scisim/UnconstrainedMaps/UnconstrainedMap.h"
 #include "scisim/ScriptingCallback.h"
 #include "scisim/UnconstrainedMaps/FlowableSystem.h"
 #include "scisim/Utilities.h"
+#include "scisim/Timer/Profiler.h"
+
+#ifdef USE_HDF5
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactSolution.h"
+#endif
 
 GeometricImpactFrictionMap::GeometricImpactFrictionMap( const scalar& abs_tol, const unsigned max_iters, const ImpulsesToCache impulses_to_cache )
 : m_f( VectorXs::Zero( 0 ) )
@@ -24,7 +30,7 @@ GeometricImpactFrictionMap::GeometricImpactFrictionMap( const scalar& abs_tol, c
 , m_impulses_to_cache( impulses_to_cache )
 #ifdef USE_HDF5
 , m_write_constraint_forces( false )
-, m_constraint_force_stream( nullptr )
+, m_impact_solution( nullptr )
 #endif
 {
   assert( m_abs_tol >= 0.0 );
@@ -37,7 +43,7 @@ GeometricImpactFrictionMap::GeometricImpactFrictionMap( std::istream& input_stre
 , m_impulses_to_cache( Utilities::deserialize<ImpulsesToCache>( input_stream ) )
 #ifdef USE_HDF5
 , m_write_constraint_forces( false )
-, m_constraint_force_stream( nullptr )
+, m_impact_solution( nullptr )
 #endif
 {
   assert( m_abs_tol >= 0.0 );
@@ -173,6 +179,7 @@ GeometricImpactFrictionMap::GeometricImpactFrictionMap( std::istream& input_stre
 
 static void initializeImpulses( const ImpulsesToCache cache_mode, const unsigned ambient_dims, const std::vector<std::unique_ptr<Constraint>>& active_set, ConstrainedSystem& csys, VectorXs& alpha, VectorXs& beta )
 {
+  SCISIM_PROFILE_SCOPE( ProfilePhase::WARM_START );
   switch( cache_mode )
   {
     case ImpulsesToCache::NONE:
@@ -221,6 +228,7 @@ static void initializeImpulses( const ImpulsesToCache cache_mode, const unsigned
 
 static void cacheImpulses( const ImpulsesToCache cache_mode, const unsigned ambient_dims, const std::vector<std::unique_ptr<Constraint>>& active_set, ConstrainedSystem& csys, const VectorXs& alpha, const VectorXs& beta )
 {
+  SCISIM_PROFILE_SCOPE( ProfilePhase::WARM_START );
   switch( cache_mode )
   {
     case ImpulsesToCache::NONE:
@@ -276,7 +284,10 @@ void GeometricImpactFrictionMap::flow( ScriptingCallback& call_back, FlowableSys
   }
 
   // Compute an unconstrained predictor step
-  umap.flow( q0, v0, fsys, iteration, dt, q1, v1 );
+  {
+    SCISIM_PROFILE_SCOPE( ProfilePhase::FLOW );
+    umap.flow( q0, v0, fsys, iteration, dt, q1, v1 );
+  }
 
   // Using the configuration at the predictor step, compute the set of active constraints
   std::vector<std::unique_ptr<Constraint>> active_set;
@@ -292,13 +303,16 @@ void GeometricImpactFrictionMap::flow( ScriptingCallback& call_back, FlowableSys
       exportConstraintForcesToBinary( q0, active_set, MatrixXXsc{ fsys.ambientSpaceDimensions(), 0 }, VectorXs::Zero(0), VectorXs::Zero(0), dt );
     }
     m_write_constraint_forces = false;
-    m_constraint_force_stream = nullptr;
+    m_impact_solution = nullptr;
     #endif
     return;
   }
 
   const unsigned ncollisions{ static_cast<unsigned>( active_set.size() ) };
 
+  // Gather the contacts once for the bases, N, and D assembled during this step
+  const ScopedContactBatch contact_batch{ q0, active_set };
+
   // Pre-compute the full contact basis
   MatrixXXsc contact_bases;
   csys.computeContactBases( q0, v0, active_set, contact_bases );
@@ -341,7 +355,10 @@ void GeometricImpactFrictionMap::flow( ScriptingCallback& call_back, FlowableSys
     bool solve_succeeded;
     VectorXs nrel_extra;
     VectorXs drel_extra;
-    friction_solver.solve( iteration, dt, fsys, fsys.M(), fsys.Minv(), CoR, mu, q0, v0, active_set, contact_bases, nrel_extra, drel_extra, m_max_iters, m_abs_tol, m_f, alpha, beta, v2, solve_succeeded, error );
+    {
+      SCISIM_PROFILE_SCOPE( ProfilePhase::SOLVER );
+      friction_solver.solve( iteration, dt, fsys, fsys.M(), fsys.Minv(), CoR, mu, q0, v0, active_set, contact_bases, nrel_extra, drel_extra, m_max_iters, m_abs_tol, m_f, alpha, beta, v2, solve_succeeded, error );
+    }
     assert( error >= 0.0 );
     if( !solve_succeeded )
     {
@@ -434,10 +451,11 @@ void GeometricImpactFrictionMap::flow( ScriptingCallback& call_back, FlowableSys
     exportConstraintForcesToBinary( q0, active_set, contact_bases, alpha, beta, dt );
   }
   m_write_constraint_forces = false;
-  m_constraint_force_stream = nullptr;
+  m_impact_solution = nullptr;
   #endif
 
   // Using the initial configuration and the new velocity, compute the final state
+  SCISIM_PROFILE_SCOPE( ProfilePhase::FLOW );
   umap.flow( q0, v2, fsys, iteration, dt, q1, v1 );
 }
 
@@ -450,8 +468,8 @@ void GeometricImpactFrictionMap::resetCachedData()
 void GeometricImpactFrictionMap::exportConstraintForcesToBinary( const VectorXs& q, const std::vector<std::unique_ptr<Constraint>>& constraints, const MatrixXXsc& contact_bases, const VectorXs& alpha, const VectorXs& beta, const scalar& dt )
 {
   assert( m_write_constraint_forces );
-  assert( m_constraint_force_stream != nullptr );
-  ImpactFrictionMap::exportConstraintForcesToBinaryFile( q, constraints, contact_bases, alpha, beta, dt, *m_constraint_force_stream );
+  assert( m_impact_solution != nullptr );
+  m_impact_solution->setSolution( q, constraints, contact_bases, alpha, beta, dt );
 }
 #endif
 
@@ -464,7 +482,7 @@ void GeometricImpactFrictionMap::serialize( std::ostream& output_stream ) const
   Utilities::serialize( m_impulses_to_cache, output_stream );
   #ifdef USE_HDF5
   assert( m_write_constraint_forces == false );
-  assert( m_constraint_force_stream == nullptr );
+  assert( m_impact_solution == nullptr );
   #endif
 }
 
@@ -474,9 +492,9 @@ std::string GeometricImpactFrictionMap::name() const
 }
 
 #ifdef USE_HDF5
-void GeometricImpactFrictionMap::exportForcesNextStep( HDF5File& output_file )
+void GeometricImpactFrictionMap::exportForcesNextStep( ImpactSolution& impact_solution )
 {
   m_write_constraint_forces = true;
-  m_constraint_force_stream = &output_file;
+  m_impact_solution = &impact_solution;
 }
 #endif
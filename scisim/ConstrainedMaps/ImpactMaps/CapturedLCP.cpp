@@ -0,0 +1,84 @@
+#include "CapturedLCP.h"
+
+#include <iostream>
+
+#include "scisim/Constraints/Constraint.h"
+#include "scisim/Math/MathUtilities.h"
+#include "scisim/StringUtilities.h"
+#include "scisim/Utilities.h"
+
+// Identifies files of captured LCPs and the version of their layout
+static constexpr unsigned s_captured_lcp_magic{ 0x4C435031 };
+
+CapturedLCP::CapturedLCP()
+: iteration( 0 )
+, q0()
+, v0()
+, M()
+, Minv()
+, N()
+, nrel()
+, CoR()
+, alpha0()
+, constraint_names()
+, body0()
+, body1()
+{}
+
+CapturedLCP::CapturedLCP( std::istream& input_stream )
+: CapturedLCP()
+{
+  assert( input_stream.good() );
+  if( Utilities::deserialize<unsigned>( input_stream ) != s_captured_lcp_magic )
+  {
+    std::cerr << "Error, input is not a captured LCP or was captured by an incompatible version. Exiting." << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
+  iteration = Utilities::deserialize<unsigned>( input_stream );
+  q0 = MathUtilities::deserialize<VectorXs>( input_stream );
+  v0 = MathUtilities::deserialize<VectorXs>( input_stream );
+  MathUtilities::deserialize( M, input_stream );
+  MathUtilities::deserialize( Minv, input_stream );
+  MathUtilities::deserialize( N, input_stream );
+  nrel = MathUtilities::deserialize<VectorXs>( input_stream );
+  CoR = MathUtilities::deserialize<VectorXs>( input_stream );
+  alpha0 = MathUtilities::deserialize<VectorXs>( input_stream );
+  constraint_names = StringUtilities::deserializeVector( input_stream );
+  body0 = Utilities::deserialize<std::vector<int>>( input_stream );
+  body1 = Utilities::deserialize<std::vector<int>>( input_stream );
+  assert( N.cols() == nrel.size() ); assert( N.cols() == CoR.size() ); assert( N.cols() == alpha0.size() );
+  assert( constraint_names.size() == std::vector<std::string>::size_type( N.cols() ) );
+}
+
+void CapturedLCP::setConstraints( const std::vector<std::unique_ptr<Constraint>>& constraints )
+{
+  constraint_names.clear();
+  body0.clear();
+  body1.clear();
+  for( const std::unique_ptr<Constraint>& constraint : constraints )
+  {
+    std::pair<int,int> bodies;
+    constraint->getBodyIndices( bodies );
+    constraint_names.emplace_back( constraint->name() );
+    body0.emplace_back( bodies.first );
+    body1.emplace_back( bodies.second );
+  }
+}
+
+void CapturedLCP::serialize( std::ostream& output_stream ) const
+{
+  assert( output_stream.good() );
+  Utilities::serialize( s_captured_lcp_magic, output_stream );
+  Utilities::serialize( iteration, output_stream );
+  MathUtilities::serialize( q0, output_stream );
+  MathUtilities::serialize( v0, output_stream );
+  MathUtilities::serialize( M, output_stream );
+  MathUtilities::serialize( Minv, output_stream );
+  MathUtilities::serialize( N, output_stream );
+  MathUtilities::serialize( nrel, output_stream );
+  MathUtilities::serialize( CoR, output_stream );
+  MathUtilities::serialize( alpha0, output_stream );
+  StringUtilities::serializeVector( constraint_names, output_stream );
+  Utilities::serialize( body0, output_stream );
+  Utilities::serialize( body1, output_stream );
+}
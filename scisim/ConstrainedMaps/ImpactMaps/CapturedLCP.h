@@ -0,0 +1,45 @@
+#ifndef CAPTURED_LCP_H
+#define CAPTURED_LCP_H
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "scisim/Math/MathDefines.h"
+
+class Constraint;
+
+// The inputs to ImpactOperator::flow for one step of ImpactMap::flow, saved so that the LCP can be replayed
+// offline through any impact operator. Q = N^T M^-1 N and the linear term are recomputed from N, M^-1, v0,
+// nrel, and CoR on replay.
+struct CapturedLCP final
+{
+
+  CapturedLCP();
+  explicit CapturedLCP( std::istream& input_stream );
+
+  // Records the metadata of the constraints that generated the LCP
+  void setConstraints( const std::vector<std::unique_ptr<Constraint>>& constraints );
+
+  void serialize( std::ostream& output_stream ) const;
+
+  unsigned iteration;
+  VectorXs q0;
+  VectorXs v0;
+  SparseMatrixsc M;
+  SparseMatrixsc Minv;
+  SparseMatrixsc N;
+  VectorXs nrel;
+  VectorXs CoR;
+  // Initial iterate, such as impulses warm started from the previous step
+  VectorXs alpha0;
+
+  // Name and body indices of the constraint behind each column of N
+  std::vector<std::string> constraint_names;
+  std::vector<int> body0;
+  std::vector<int> body1;
+
+};
+
+#endif
@@ -7,6 +7,7 @@
 
 #include <iostream>
 
+#include "scisim/Math/DelassusOperator.h"
 #include "scisim/Math/MathUtilities.h"
 #include "scisim/ConstrainedMaps/ConstrainedMapUtilities.h"
 #include "scisim/Utilities.h"
@@ -30,7 +31,7 @@ GROperator::GROperator( std::istream& input_stream )
 GROperator::~GROperator()
 {}
 
-void GROperator::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
+void GROperator::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
 {
   // Not intended for use with staggered projections
   assert( ( v0.array() == v0F.array() ).all() );
@@ -101,9 +102,8 @@ void GROperator::flow( const std::vector<std::unique_ptr<Constraint>>& cons, con
     }
 
     VectorXs alpha_local{ VectorXs::Zero( num_contacts_with_negative_vel ) };
-    SparseMatrixsc N_local;
-    MathUtilities::extractColumns( N, violated_indices, N_local );
-    const SparseMatrixsc Q_local = N_local.transpose() * Minv * N_local;
+    const DelassusOperator Q_local{ Q, violated_indices };
+    const SparseMatrixsc& N_local{ Q_local.N() };
     // Solve the 'local' problem
     m_impact_operator->flow( cons, M, Minv, q0, v1, v1, N_local, Q_local, nrel_local, CoR_local, alpha_local );
 
@@ -146,3 +146,9 @@ void GROperator::serialize( std::ostream& output_stream ) const
   Utilities::serialize( m_v_tol, output_stream );
   ConstrainedMapUtilities::serialize( m_impact_operator, output_stream );
 }
+
+// The wrapped operator receives the full constraint set with a subset of the columns of N
+bool GROperator::indexesConstraints() const
+{
+  return m_impact_operator->indexesConstraints();
+}
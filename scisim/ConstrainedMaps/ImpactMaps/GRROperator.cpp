@@ -28,7 +28,7 @@ GRROperator::GRROperator( std::istream& input_stream )
 GRROperator::~GRROperator()
 {}
 
-void GRROperator::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
+void GRROperator::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
 {
   // Not intended for use with staggered projections
   assert( ( v0.array() == v0F.array() ).all() );
@@ -84,3 +84,8 @@ void GRROperator::serialize( std::ostream& output_stream ) const
   ConstrainedMapUtilities::serialize( m_elastic_operator, output_stream );
   ConstrainedMapUtilities::serialize( m_inelastic_operator, output_stream );
 }
+
+bool GRROperator::indexesConstraints() const
+{
+  return m_elastic_operator->indexesConstraints() || m_inelastic_operator->indexesConstraints();
+}
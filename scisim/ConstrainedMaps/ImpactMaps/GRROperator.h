@@ -19,7 +19,7 @@ public:
   explicit GRROperator( std::istream& input_stream );
   virtual ~GRROperator() override;
 
-  virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) override;
+  virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) override;
 
   virtual std::string name() const override;
 
@@ -27,6 +27,8 @@ public:
 
   virtual void serialize( std::ostream& output_stream ) const override;
 
+  virtual bool indexesConstraints() const override;
+
 private:
 
   const std::unique_ptr<ImpactOperator> m_elastic_operator;
@@ -19,7 +19,7 @@ GaussSeidelOperator::GaussSeidelOperator( std::istream& input_stream )
   assert( m_v_tol >= 0.0 );
 }
 
-void GaussSeidelOperator::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
+void GaussSeidelOperator::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
 {
   // TODO: Check input sizes, etc
   assert( ( alpha.array() == 0.0 ).all() );
@@ -70,3 +70,8 @@ void GaussSeidelOperator::serialize( std::ostream& output_stream ) const
 {
   Utilities::serialize( m_v_tol, output_stream );
 }
+
+bool GaussSeidelOperator::indexesConstraints() const
+{
+  return true;
+}
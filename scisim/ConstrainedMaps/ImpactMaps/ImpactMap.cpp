@@ -5,16 +5,24 @@
 
 #include "ImpactMap.h"
 
+#include <fstream>
+#include <iomanip>
+#include <iostream>
 #include <memory>
+#include <sstream>
 
 #include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorUtilities.h"
 #include "scisim/Constraints/ConstrainedSystem.h"
 #include "scisim/Constraints/Constraint.h"
+#include "scisim/Constraints/ContactBatch.h"
 #include "scisim/UnconstrainedMaps/FlowableSystem.h"
 #include "scisim/UnconstrainedMaps/UnconstrainedMap.h"
 #include "scisim/ScriptingCallback.h"
 #include "scisim/Utilities.h"
+#include "scisim/Math/DelassusOperator.h"
+#include "scisim/Timer/Profiler.h"
 #include "ImpactOperator.h"
+#include "CapturedLCP.h"
 
 #ifdef USE_HDF5
 #include "scisim/ConstrainedMaps/ImpactMaps/ImpactSolution.h"
@@ -22,6 +30,7 @@
 
 ImpactMap::ImpactMap( const bool warm_start )
 : m_warm_start( warm_start )
+, m_capture_directory()
 #ifdef USE_HDF5
 , m_write_constraint_forces( false )
 , m_impact_solution( nullptr )
@@ -30,6 +39,7 @@ ImpactMap::ImpactMap( const bool warm_start )
 
 ImpactMap::ImpactMap( std::istream& input_stream )
 : m_warm_start( Utilities::deserialize<bool>( input_stream ) )
+, m_capture_directory()
 #ifdef USE_HDF5
 , m_write_constraint_forces( false )
 , m_impact_solution( nullptr )
@@ -51,7 +61,10 @@ static bool constraintSetShouldConserveAngularMomentum( const std::vector<std::u
 void ImpactMap::flow( ScriptingCallback& call_back, FlowableSystem& fsys, ConstrainedSystem& csys, UnconstrainedMap& umap, ImpactOperator& imap, const unsigned iteration, const scalar& dt, const scalar& CoR_default, const VectorXs& q0, const VectorXs& v0, VectorXs& q1, VectorXs& v1 )
 {
   // Compute an unconstrained predictor step, save result into q1 and v1
-  umap.flow( q0, v0, fsys, iteration, dt, q1, v1 );
+  {
+    SCISIM_PROFILE_SCOPE( ProfilePhase::FLOW );
+    umap.flow( q0, v0, fsys, iteration, dt, q1, v1 );
+  }
 
   // Using the configuration at the predictor step, compute the set of active constraints.
   std::vector<std::unique_ptr<Constraint>> active_set;
@@ -75,12 +88,16 @@ void ImpactMap::flow( ScriptingCallback& call_back, FlowableSystem& fsys, Constr
 
   const unsigned ncollisions{ static_cast<unsigned>( active_set.size() ) };
 
+  // Gather the contacts once for the bases, N, and D assembled during this step
+  const ScopedContactBatch contact_batch{ q0, active_set };
+
   VectorXs alpha{ ncollisions };
   VectorXs v2{ v0.size() };
 
   // If desired, read in previous values for warm starting
   if( m_warm_start )
   {
+    SCISIM_PROFILE_SCOPE( ProfilePhase::WARM_START );
     unsigned col_num{ 0 };
     for( const std::unique_ptr<Constraint>& constraint : active_set )
     {
@@ -107,7 +124,7 @@ void ImpactMap::flow( ScriptingCallback& call_back, FlowableSystem& fsys, Constr
   ImpactOperatorUtilities::computeN( fsys, active_set, q0, N );
 
   // Quadratic term in LCP QP
-  const SparseMatrixsc Q{ N.transpose() * fsys.Minv() * N };
+  const DelassusOperator Q{ N, fsys.MinvBlocks() };
 
   // Evaluate the kinematic scripted object's velocity projected onto the constraint set
   VectorXs gdotN;
@@ -129,9 +146,18 @@ void ImpactMap::flow( ScriptingCallback& call_back, FlowableSystem& fsys, Constr
   }
   #endif
 
+  if( !m_capture_directory.empty() )
+  {
+    captureProblem( iteration, q0, v0, fsys.M(), fsys.Minv(), N, gdotN, CoR, alpha, active_set );
+  }
+
   // Note: No friction, so initial velocity passed in twice
-  imap.flow( active_set, fsys.M(), fsys.Minv(), q0, v0, v0, N, Q, gdotN, CoR, alpha );
-  v2 = v0 + fsys.Minv() * N * alpha;
+  {
+    SCISIM_PROFILE_SCOPE( ProfilePhase::SOLVER );
+    imap.flow( active_set, fsys.M(), fsys.Minv(), q0, v0, v0, N, Q, gdotN, CoR, alpha );
+  }
+  SCISIM_PROFILE_COUNT( ProfileCounter::SOLVER_ITERATIONS, imap.lastSolveIterations() );
+  v2 = v0 + Q.MinvN() * alpha;
 
   // Verify that momentum and angular momentum are conserved
   #ifndef NDEBUG
@@ -159,6 +185,7 @@ void ImpactMap::flow( ScriptingCallback& call_back, FlowableSystem& fsys, Constr
   assert( csys.constraintCacheEmpty() );
   if( m_warm_start )
   {
+    SCISIM_PROFILE_SCOPE( ProfilePhase::WARM_START );
     unsigned col_num = 0;
     for( const std::unique_ptr<Constraint>& constraint : active_set )
     {
@@ -184,9 +211,40 @@ void ImpactMap::flow( ScriptingCallback& call_back, FlowableSystem& fsys, Constr
   active_set.clear();
 
   // Using the initial configuration and the new velocity, compute the final state
+  SCISIM_PROFILE_SCOPE( ProfilePhase::FLOW );
   umap.flow( q0, v2, fsys, iteration, dt, q1, v1 );
 }
 
+void ImpactMap::captureProblems( const std::string& directory )
+{
+  m_capture_directory = directory;
+}
+
+void ImpactMap::captureProblem( const unsigned iteration, const VectorXs& q0, const VectorXs& v0, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const SparseMatrixsc& N, const VectorXs& nrel, const VectorXs& CoR, const VectorXs& alpha0, const std::vector<std::unique_ptr<Constraint>>& active_set ) const
+{
+  CapturedLCP lcp;
+  lcp.iteration = iteration;
+  lcp.q0 = q0;
+  lcp.v0 = v0;
+  lcp.M = M;
+  lcp.Minv = Minv;
+  lcp.N = N;
+  lcp.nrel = nrel;
+  lcp.CoR = CoR;
+  lcp.alpha0 = alpha0;
+  lcp.setConstraints( active_set );
+
+  std::stringstream file_name;
+  file_name << m_capture_directory << "/lcp_" << std::setfill( '0' ) << std::setw( 10 ) << iteration << ".bin";
+  std::ofstream output_stream{ file_name.str(), std::ios::binary };
+  if( !output_stream.is_open() )
+  {
+    std::cerr << "Error, failed to open " << file_name.str() << " for LCP capture. Exiting." << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
+  lcp.serialize( output_stream );
+}
+
 void ImpactMap::serialize( std::ostream& output_stream ) const
 {
   assert( output_stream.good() );
@@ -8,11 +8,16 @@
 
 #include "scisim/Math/MathDefines.h"
 
+#include <memory>
+#include <string>
+#include <vector>
+
 class ScriptingCallback;
 class FlowableSystem;
 class ConstrainedSystem;
 class UnconstrainedMap;
 class ImpactOperator;
+class Constraint;
 
 #ifdef USE_HDF5
 class ImpactSolution;
@@ -30,14 +35,23 @@ public:
 
   void serialize( std::ostream& output_stream ) const;
 
+  // Saves the LCP of each subsequent step to a file in the given directory for replay with lcp_bench;
+  // an empty directory disables capture
+  void captureProblems( const std::string& directory );
+
   #ifdef USE_HDF5
   void exportForcesNextStep( ImpactSolution& impact_solution );
   #endif
 
 private:
 
+  void captureProblem( const unsigned iteration, const VectorXs& q0, const VectorXs& v0, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const SparseMatrixsc& N, const VectorXs& nrel, const VectorXs& CoR, const VectorXs& alpha0, const std::vector<std::unique_ptr<Constraint>>& active_set ) const;
+
   bool m_warm_start;
 
+  // Destination of captured LCPs, or empty if capture is disabled
+  std::string m_capture_directory;
+
   #ifdef USE_HDF5
   // Temporary state for writing constraint forces
   bool m_write_constraint_forces;
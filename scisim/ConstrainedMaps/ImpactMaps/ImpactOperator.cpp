@@ -9,6 +9,21 @@
 ImpactOperator::~ImpactOperator()
 {}
 
+unsigned ImpactOperator::lastSolveIterations() const
+{
+  return 0;
+}
+
+bool ImpactOperator::reportsSolveIterations() const
+{
+  return false;
+}
+
+bool ImpactOperator::indexesConstraints() const
+{
+  return false;
+}
+
 // We assume an M-Matrix has only positive entries on the diagonal and non-positive entries elsewhere
 // The deviance returns the greatest deviation from this on both the diagonal and off-diagonal entries
 std::pair<double, double> ImpactOperator::MMatrixDeviance(const SparseMatrixsc &M) {
@@ -11,6 +11,7 @@
 #include <memory>
 
 class Constraint;
+class DelassusOperator;
 
 class ImpactOperator
 {
@@ -24,7 +25,7 @@ public:
 
   virtual ~ImpactOperator() = 0;
 
-  virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) = 0;
+  virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) = 0;
 
   virtual std::string name() const = 0;
 
@@ -32,6 +33,13 @@ public:
 
   virtual void serialize( std::ostream& output_stream ) const = 0;
 
+  // Iterations taken by the most recent call to flow, or 0 for operators that do not report iterations
+  virtual unsigned lastSolveIterations() const;
+  // True if lastSolveIterations counts the iterations of this operator
+  virtual bool reportsSolveIterations() const;
+  // True if flow indexes cons by the columns of N, so that cons must match the columns of N passed in
+  virtual bool indexesConstraints() const;
+
   static std::pair<double, double> MMatrixDeviance(const SparseMatrixsc &M);
 
 protected:
@@ -0,0 +1,125 @@
+#include "ImpactOperatorComparison.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+#include "ImpactOperatorUtilities.h"
+#include "scisim/ConstrainedMaps/ConstrainedMapUtilities.h"
+#include "scisim/Math/DelassusOperator.h"
+#include "scisim/StringUtilities.h"
+#include "scisim/Utilities.h"
+
+ImpactOperatorComparison::ImpactOperatorComparison( const std::vector<std::unique_ptr<ImpactOperator>>& operators, const std::string& output_file_name )
+: m_operators()
+, m_output_file_name( output_file_name )
+, m_num_solves( 0 )
+, m_output_file()
+{
+  assert( !operators.empty() );
+  for( const std::unique_ptr<ImpactOperator>& impact_operator : operators )
+  {
+    assert( impact_operator != nullptr );
+    m_operators.emplace_back( impact_operator->clone() );
+  }
+}
+
+ImpactOperatorComparison::ImpactOperatorComparison( std::istream& input_stream )
+: m_operators()
+, m_output_file_name( StringUtilities::deserialize( input_stream ) )
+, m_num_solves( Utilities::deserialize<unsigned>( input_stream ) )
+, m_output_file()
+{
+  const unsigned num_operators{ Utilities::deserialize<unsigned>( input_stream ) };
+  for( unsigned operator_num = 0; operator_num < num_operators; ++operator_num )
+  {
+    m_operators.emplace_back( ConstrainedMapUtilities::deserializeImpactOperator( input_stream ) );
+    assert( m_operators.back() != nullptr );
+  }
+}
+
+ImpactOperatorComparison::~ImpactOperatorComparison()
+{}
+
+void ImpactOperatorComparison::openOutputFile()
+{
+  // A fresh comparison starts a new file, a resumed comparison continues the existing one
+  m_output_file.open( m_output_file_name, m_num_solves == 0 ? std::ios::out : std::ios::app );
+  if( !m_output_file.is_open() )
+  {
+    std::cerr << "Error, failed to open impact operator comparison file: " << m_output_file_name << std::endl;
+    std::exit( EXIT_FAILURE );
+  }
+  if( m_num_solves == 0 )
+  {
+    m_output_file << "solve,operator,constraints,seconds,iterations,residual" << std::endl;
+  }
+}
+
+void ImpactOperatorComparison::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
+{
+  if( !m_output_file.is_open() )
+  {
+    openOutputFile();
+  }
+
+  // Residual of the LCP 0 <= alpha \perp Q alpha + b >= 0
+  VectorXs b;
+  ImpactOperatorUtilities::computeLCPQPLinearTerm( N, nrel, CoR, v0, v0F, b );
+  VectorXs Qalpha{ b.size() };
+
+  const VectorXs alpha0{ alpha };
+  VectorXs alpha_out{ alpha0.size() };
+  for( std::vector<std::unique_ptr<ImpactOperator>>::size_type operator_num = 0; operator_num < m_operators.size(); ++operator_num )
+  {
+    alpha_out = alpha0;
+    const std::chrono::steady_clock::time_point start{ std::chrono::steady_clock::now() };
+    m_operators[operator_num]->flow( cons, M, Minv, q0, v0, v0F, N, Q, nrel, CoR, alpha_out );
+    const std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    Q.multiply( alpha_out, Qalpha );
+    const scalar residual{ alpha_out.cwiseMin( Qalpha + b ).lpNorm<Eigen::Infinity>() };
+
+    // Operators that do not count iterations leave the field empty rather than reporting 0
+    m_output_file << m_num_solves << ',' << m_operators[operator_num]->name() << ',' << alpha0.size() << ',' << elapsed.count() << ',';
+    if( m_operators[operator_num]->reportsSolveIterations() )
+    {
+      m_output_file << m_operators[operator_num]->lastSolveIterations();
+    }
+    m_output_file << ',' << residual << '\n';
+
+    if( operator_num == 0 )
+    {
+      alpha = alpha_out;
+    }
+  }
+  m_output_file.flush();
+  ++m_num_solves;
+}
+
+std::string ImpactOperatorComparison::name() const
+{
+  return "impact_operator_comparison";
+}
+
+std::unique_ptr<ImpactOperator> ImpactOperatorComparison::clone() const
+{
+  return std::unique_ptr<ImpactOperator>{ new ImpactOperatorComparison{ m_operators, m_output_file_name } };
+}
+
+void ImpactOperatorComparison::serialize( std::ostream& output_stream ) const
+{
+  assert( output_stream.good() );
+  StringUtilities::serialize( m_output_file_name, output_stream );
+  Utilities::serialize( m_num_solves, output_stream );
+  Utilities::serialize( unsigned( m_operators.size() ), output_stream );
+  for( const std::unique_ptr<ImpactOperator>& impact_operator : m_operators )
+  {
+    ConstrainedMapUtilities::serialize( impact_operator, output_stream );
+  }
+}
+
+bool ImpactOperatorComparison::indexesConstraints() const
+{
+  return std::any_of( m_operators.begin(), m_operators.end(), []( const std::unique_ptr<ImpactOperator>& impact_operator ) { return impact_operator->indexesConstraints(); } );
+}
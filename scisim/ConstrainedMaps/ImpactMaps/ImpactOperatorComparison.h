@@ -0,0 +1,44 @@
+#ifndef IMPACT_OPERATOR_COMPARISON_H
+#define IMPACT_OPERATOR_COMPARISON_H
+
+#include "ImpactOperator.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Benchmarking operator that runs a set of impact operators on the same LCP, each from the same initial
+// iterate, and records the wall clock time, iteration count, and residual of each solve as a row of a CSV
+// file. The impulses computed by the first operator are returned.
+class ImpactOperatorComparison final : public ImpactOperator
+{
+
+public:
+
+  ImpactOperatorComparison( const std::vector<std::unique_ptr<ImpactOperator>>& operators, const std::string& output_file_name );
+  explicit ImpactOperatorComparison( std::istream& input_stream );
+  virtual ~ImpactOperatorComparison() override;
+
+  virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) override;
+
+  virtual std::string name() const override;
+
+  virtual std::unique_ptr<ImpactOperator> clone() const override;
+
+  virtual void serialize( std::ostream& output_stream ) const override;
+
+  virtual bool indexesConstraints() const override;
+
+private:
+
+  void openOutputFile();
+
+  std::vector<std::unique_ptr<ImpactOperator>> m_operators;
+  const std::string m_output_file_name;
+  // Number of LCPs solved so far; rows of later solves are appended after a resume
+  unsigned m_num_solves;
+  std::ofstream m_output_file;
+
+};
+
+#endif
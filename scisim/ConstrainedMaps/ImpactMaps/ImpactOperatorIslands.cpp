@@ -0,0 +1,210 @@
+#include "ImpactOperatorIslands.h"
+
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "scisim/ConstrainedMaps/ConstrainedMapUtilities.h"
+#include "scisim/Math/DelassusOperator.h"
+#include "scisim/Timer/Profiler.h"
+
+ImpactOperatorIslands::ImpactOperatorIslands( const ImpactOperator& impact_operator )
+: m_impact_operator( impact_operator.clone() )
+, m_islands()
+, m_thread_operators()
+, m_thread_dof_maps()
+, m_island_iterations()
+{
+  assert( m_impact_operator != nullptr );
+  assert( !m_impact_operator->indexesConstraints() );
+}
+
+ImpactOperatorIslands::ImpactOperatorIslands( std::istream& input_stream )
+: m_impact_operator( ConstrainedMapUtilities::deserializeImpactOperator( input_stream ) )
+, m_islands()
+, m_thread_operators()
+, m_thread_dof_maps()
+, m_island_iterations()
+{
+  assert( m_impact_operator != nullptr );
+  assert( !m_impact_operator->indexesConstraints() );
+}
+
+ImpactOperatorIslands::~ImpactOperatorIslands()
+{}
+
+// Extracts the given columns of A, renumbering rows through row_map. The rows of the result keep the order of the
+// rows of A, which requires row_map to be increasing on the rows present in the columns.
+static void extractIslandBlock( const SparseMatrixsc& A, const std::vector<unsigned>& cols, const std::vector<int>& row_map, const int num_rows, SparseMatrixsc& A_island )
+{
+  A_island.resize( num_rows, int( cols.size() ) );
+  int nnz{ 0 };
+  for( const unsigned col : cols )
+  {
+    nnz += int( A.outerIndexPtr()[col + 1] - A.outerIndexPtr()[col] );
+  }
+  A_island.reserve( nnz );
+  for( std::vector<unsigned>::size_type island_col = 0; island_col < cols.size(); ++island_col )
+  {
+    A_island.startVec( int( island_col ) );
+    for( SparseMatrixsc::InnerIterator it{ A, int( cols[island_col] ) }; it; ++it )
+    {
+      assert( row_map[it.row()] >= 0 );
+      A_island.insertBack( row_map[it.row()], int( island_col ) ) = it.value();
+    }
+  }
+  A_island.finalize();
+}
+
+void ImpactOperatorIslands::solveIsland( const unsigned island, const unsigned thread, const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& MinvN, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
+{
+  const unsigned num_cons{ m_islands.islandSize( island ) };
+  const unsigned* const island_cons{ m_islands.islandConstraints( island ) };
+  std::vector<int>& dof_map{ m_thread_dof_maps[thread] };
+
+  // Degrees of freedom touched by the island. M^-1 is block diagonal, so the rows of M^-1 N close the set under
+  // coupling through M and M^-1.
+  std::vector<unsigned> dofs;
+  for( unsigned idx = 0; idx < num_cons; ++idx )
+  {
+    for( SparseMatrixsc::InnerIterator it{ MinvN, int( island_cons[idx] ) }; it; ++it )
+    {
+      if( dof_map[it.row()] == -1 )
+      {
+        dof_map[it.row()] = 0;
+        dofs.emplace_back( unsigned( it.row() ) );
+      }
+    }
+    for( SparseMatrixsc::InnerIterator it{ N, int( island_cons[idx] ) }; it; ++it )
+    {
+      if( dof_map[it.row()] == -1 )
+      {
+        dof_map[it.row()] = 0;
+        dofs.emplace_back( unsigned( it.row() ) );
+      }
+    }
+  }
+  std::sort( dofs.begin(), dofs.end() );
+  for( std::vector<unsigned>::size_type dof = 0; dof < dofs.size(); ++dof )
+  {
+    dof_map[dofs[dof]] = int( dof );
+  }
+  const int num_dofs{ int( dofs.size() ) };
+
+  // Form the island's problem
+  const std::vector<unsigned> cols{ island_cons, island_cons + num_cons };
+  SparseMatrixsc M_island;
+  extractIslandBlock( M, dofs, dof_map, num_dofs, M_island );
+  SparseMatrixsc Minv_island;
+  extractIslandBlock( Minv, dofs, dof_map, num_dofs, Minv_island );
+  SparseMatrixsc N_island;
+  extractIslandBlock( N, cols, dof_map, num_dofs, N_island );
+  VectorXs v0_island{ num_dofs };
+  VectorXs v0F_island{ num_dofs };
+  for( int dof = 0; dof < num_dofs; ++dof )
+  {
+    v0_island( dof ) = v0( dofs[dof] );
+    v0F_island( dof ) = v0F( dofs[dof] );
+  }
+  VectorXs nrel_island{ num_cons };
+  VectorXs CoR_island{ num_cons };
+  VectorXs alpha_island{ num_cons };
+  for( unsigned idx = 0; idx < num_cons; ++idx )
+  {
+    nrel_island( idx ) = nrel( island_cons[idx] );
+    CoR_island( idx ) = CoR( island_cons[idx] );
+    alpha_island( idx ) = alpha( island_cons[idx] );
+  }
+  const DelassusOperator Q_island{ N_island, Minv_island };
+
+  ImpactOperator& impact_operator{ *m_thread_operators[thread] };
+  impact_operator.flow( cons, M_island, Minv_island, q0, v0_island, v0F_island, N_island, Q_island, nrel_island, CoR_island, alpha_island );
+  m_island_iterations[island] = impact_operator.lastSolveIterations();
+
+  // Islands own disjoint entries of alpha
+  for( unsigned idx = 0; idx < num_cons; ++idx )
+  {
+    alpha( island_cons[idx] ) = alpha_island( idx );
+  }
+
+  for( const unsigned dof : dofs )
+  {
+    dof_map[dof] = -1;
+  }
+}
+
+void ImpactOperatorIslands::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
+{
+  assert( alpha.size() == N.cols() );
+
+  m_islands.compute( N, Q.MinvN() );
+  const unsigned num_islands{ m_islands.numIslands() };
+  SCISIM_PROFILE_COUNT( ProfileCounter::ISLANDS, num_islands );
+  m_island_iterations.assign( num_islands, 0 );
+
+  // A single island is the original problem
+  if( num_islands <= 1 )
+  {
+    m_impact_operator->flow( cons, M, Minv, q0, v0, v0F, N, Q, nrel, CoR, alpha );
+    if( num_islands == 1 )
+    {
+      m_island_iterations[0] = m_impact_operator->lastSolveIterations();
+    }
+    return;
+  }
+
+  #ifdef _OPENMP
+  const unsigned num_threads{ unsigned( omp_get_max_threads() ) };
+  #else
+  const unsigned num_threads{ 1 };
+  #endif
+  while( m_thread_operators.size() < num_threads )
+  {
+    m_thread_operators.emplace_back( m_impact_operator->clone() );
+  }
+  m_thread_dof_maps.resize( num_threads );
+  for( std::vector<int>& dof_map : m_thread_dof_maps )
+  {
+    dof_map.resize( std::vector<int>::size_type( N.rows() ), -1 );
+  }
+
+  const SparseMatrixsc& MinvN{ Q.MinvN() };
+  #pragma omp parallel for schedule( dynamic )
+  for( unsigned island = 0; island < num_islands; ++island )
+  {
+    #ifdef _OPENMP
+    const unsigned thread{ unsigned( omp_get_thread_num() ) };
+    #else
+    const unsigned thread{ 0 };
+    #endif
+    solveIsland( island, thread, cons, M, Minv, q0, v0, v0F, N, MinvN, nrel, CoR, alpha );
+  }
+}
+
+std::string ImpactOperatorIslands::name() const
+{
+  return "impact_operator_islands";
+}
+
+std::unique_ptr<ImpactOperator> ImpactOperatorIslands::clone() const
+{
+  return std::unique_ptr<ImpactOperator>{ new ImpactOperatorIslands{ *m_impact_operator } };
+}
+
+void ImpactOperatorIslands::serialize( std::ostream& output_stream ) const
+{
+  assert( output_stream.good() );
+  ConstrainedMapUtilities::serialize( m_impact_operator, output_stream );
+}
+
+unsigned ImpactOperatorIslands::lastSolveIterations() const
+{
+  return m_island_iterations.empty() ? 0 : *std::max_element( m_island_iterations.begin(), m_island_iterations.end() );
+}
+
+bool ImpactOperatorIslands::reportsSolveIterations() const
+{
+  return m_impact_operator->reportsSolveIterations();
+}
@@ -0,0 +1,52 @@
+#ifndef IMPACT_OPERATOR_ISLANDS_H
+#define IMPACT_OPERATOR_ISLANDS_H
+
+#include "ImpactOperator.h"
+
+#include <vector>
+
+#include "scisim/Constraints/ConstraintIslands.h"
+
+// Splits the LCP into islands of constraints that share no degrees of freedom and solves each island with its own
+// copy of an impact operator, concurrently when OpenMP is enabled. Each island is restricted to the degrees of
+// freedom it touches. The wrapped operator receives the full constraint set and generalized configuration alongside
+// the island's N and velocities, so operators that index constraints by column, such as Gauss-Seidel, are rejected;
+// see ImpactOperator::indexesConstraints.
+class ImpactOperatorIslands final : public ImpactOperator
+{
+
+public:
+
+  explicit ImpactOperatorIslands( const ImpactOperator& impact_operator );
+  explicit ImpactOperatorIslands( std::istream& input_stream );
+  virtual ~ImpactOperatorIslands() override;
+
+  virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) override;
+
+  virtual std::string name() const override;
+
+  virtual std::unique_ptr<ImpactOperator> clone() const override;
+
+  virtual void serialize( std::ostream& output_stream ) const override;
+
+  // Largest iteration count of the islands solved in the last flow
+  virtual unsigned lastSolveIterations() const override;
+  virtual bool reportsSolveIterations() const override;
+
+private:
+
+  void solveIsland( const unsigned island, const unsigned thread, const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& MinvN, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha );
+
+  const std::unique_ptr<ImpactOperator> m_impact_operator;
+
+  ConstraintIslands m_islands;
+
+  // Per thread copies of the operator and maps from global to island degrees of freedom, reused across steps
+  std::vector<std::unique_ptr<ImpactOperator>> m_thread_operators;
+  std::vector<std::vector<int>> m_thread_dof_maps;
+
+  std::vector<unsigned> m_island_iterations;
+
+};
+
+#endif
@@ -6,9 +6,12 @@
 #include "ImpactOperatorUtilities.h"
 
 #include "scisim/Constraints/Constraint.h"
+#include "scisim/Constraints/ContactBatch.h"
+#include "scisim/Timer/Profiler.h"
 
 void ImpactOperatorUtilities::computeN( const FlowableSystem& fsys, const std::vector<std::unique_ptr<Constraint>>& V, const VectorXs& q, SparseMatrixsc& N )
 {
+  SCISIM_PROFILE_SCOPE( ProfilePhase::COMPUTE_N );
   assert( N.cols() == int( V.size() ) );
 
   // N.reserve( 0 ) seems to segfault for recent versions of Eigen
@@ -17,6 +20,18 @@ void ImpactOperatorUtilities::computeN( const FlowableSystem& fsys, const std::v
     return;
   }
 
+  // Assemble point contacts in a single pass over their batched geometry
+  {
+    ContactBatch local_batch;
+    const ContactBatch* const batch{ ContactBatch::acquire( q, V, local_batch ) };
+    if( batch != nullptr )
+    {
+      batch->computeN( unsigned( N.rows() ), N );
+      return;
+    }
+  }
+
+  // Otherwise fall back to assembling each constraint individually
   VectorXi column_nonzeros( N.cols() );
   {
     auto con_itr = V.cbegin();
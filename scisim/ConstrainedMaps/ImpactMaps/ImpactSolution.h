@@ -22,10 +22,15 @@ public:
 
   void setSolution( const VectorXs& q, const std::vector<std::unique_ptr<Constraint>>& constraints, const MatrixXXsc& impact_bases, const VectorXs& alpha, const scalar& dt );
 
+  // Saves a solution with friction; the columns of contact_bases hold the normal and then the tangents of each contact
+  void setSolution( const VectorXs& q, const std::vector<std::unique_ptr<Constraint>>& constraints, const MatrixXXsc& contact_bases, const VectorXs& alpha, const VectorXs& beta, const scalar& dt );
+
   void writeSolution( HDF5File& output_file );
 
 private:
 
+  void setContacts( const VectorXs& q, const std::vector<std::unique_ptr<Constraint>>& constraints, const unsigned ambient_space_dims );
+
   Matrix2Xic m_indices;
   MatrixXXsc m_points;
   MatrixXXsc m_normals;
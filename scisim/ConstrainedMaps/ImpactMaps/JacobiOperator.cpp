@@ -12,7 +12,7 @@ JacobiOperator::JacobiOperator( const scalar& v_tol )
 : m_v_tol( v_tol )
 {}
 
-void JacobiOperator::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
+void JacobiOperator::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
 {
   std::cerr << "Error, JacobiOperator::flow has not been updated to work with new interface." << std::endl;
   std::exit( EXIT_FAILURE );
@@ -66,3 +66,8 @@ void JacobiOperator::serialize( std::ostream& output_stream ) const
   std::cerr << "Code up JacobiOperator::serialize" << std::endl;
   std::exit( EXIT_FAILURE );
 }
+
+bool JacobiOperator::indexesConstraints() const
+{
+  return true;
+}
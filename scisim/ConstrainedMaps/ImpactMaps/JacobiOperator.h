@@ -17,7 +17,7 @@ public:
 
   virtual ~JacobiOperator() override = default;
 
-  virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) override;
+  virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) override;
 
   virtual std::string name() const override;
 
@@ -25,6 +25,8 @@ public:
 
   virtual void serialize( std::ostream& output_stream ) const override;
 
+  virtual bool indexesConstraints() const override;
+
 private:
 
   const scalar m_v_tol;
@@ -1,5 +1,6 @@
 #include "LCPOperatorAPGD.h"
 
+#include "scisim/Math/DelassusOperator.h"
 #include "scisim/Math/QPSolvers/ProjectionSolvers.h"
 #include "scisim/Math/QPSolvers/SparseMatrixVectorOperators.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorUtilities.h"
@@ -12,6 +13,7 @@
 LCPOperatorAPGD::LCPOperatorAPGD( const scalar& tol, const unsigned max_iters )
 : m_tol( tol )
 , m_max_iters( max_iters )
+, m_last_solve_iterations( 0 )
 {
   assert( m_tol >= 0.0 );
 }
@@ -19,23 +21,21 @@ LCPOperatorAPGD::LCPOperatorAPGD( const scalar& tol, const unsigned max_iters )
 LCPOperatorAPGD::LCPOperatorAPGD( std::istream& input_stream )
 : m_tol( Utilities::deserialize<scalar>( input_stream ) )
 , m_max_iters( Utilities::deserialize<unsigned>( input_stream ) )
+, m_last_solve_iterations( 0 )
 {
   assert( m_tol >= 0.0 );
 }
 
-void LCPOperatorAPGD::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
+void LCPOperatorAPGD::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
 {
   // b in b^T \alpha
   VectorXs b;
   ImpactOperatorUtilities::computeLCPQPLinearTerm( N, nrel, CoR, v0, v0F, b );
 
   ProjectionSolveResults results;
-  #ifdef MKL_FOUND
-  ProjectionSolvers::APGD( NonNegativeProjection{}, MinMapImpact{}, ObjectiveMKLColumnMajor{}, GradientMKLColumnMajor{}, MultiplyMKLColumnMajor{}, m_tol, m_max_iters, Q, b, alpha, results );
-  #else
-  ProjectionSolvers::APGD( NonNegativeProjection{}, MinMapImpact{}, ObjectiveEigenColumnMajor{}, GradientEigenColumnMajor{}, MultiplyEigenColumnMajor{}, m_tol, m_max_iters, Q, b, alpha, results );
-  #endif
+  ProjectionSolvers::APGD( NonNegativeProjection{}, MinMapImpact{}, ObjectiveDelassusOperator{}, GradientDelassusOperator{}, MultiplyDelassusOperator{}, m_tol, m_max_iters, Q, b, alpha, results );
   assert( ( alpha.array() >= 0.0 ).all() );
+  m_last_solve_iterations = results.num_iterations;
 
   if( results.status != ProjectionSolveStatus::Success )
   {
@@ -58,3 +58,13 @@ void LCPOperatorAPGD::serialize( std::ostream& output_stream ) const
   Utilities::serialize( m_tol, output_stream );
   Utilities::serialize( m_max_iters, output_stream );
 }
+
+unsigned LCPOperatorAPGD::lastSolveIterations() const
+{
+  return m_last_solve_iterations;
+}
+
+bool LCPOperatorAPGD::reportsSolveIterations() const
+{
+  return true;
+}
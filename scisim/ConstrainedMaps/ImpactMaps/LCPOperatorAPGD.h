@@ -13,7 +13,7 @@ public:
 
   virtual ~LCPOperatorAPGD() override = default;
 
-  virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) override;
+  virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) override;
 
   virtual std::string name() const override;
 
@@ -21,10 +21,14 @@ public:
 
   virtual void serialize( std::ostream& output_stream ) const override;
 
+  virtual unsigned lastSolveIterations() const override;
+  virtual bool reportsSolveIterations() const override;
+
 private:
 
   const scalar m_tol;
   const unsigned m_max_iters;
+  unsigned m_last_solve_iterations;
 
 };
 
@@ -21,13 +21,16 @@
 #include "IpIpoptData.hpp"
 #include "IpTNLPAdapter.hpp"
 #include "IpOrigIpoptNLP.hpp"
-#include "scisim/ConstrainedMaps/ImpactMaps/FischerBurmeisterImpact.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorUtilities.h"
 #include "scisim/ConstrainedMaps/QPTerminationOperator.h"
+#include "scisim/Math/DelassusOperator.h"
 
 LCPOperatorIpopt::LCPOperatorIpopt( const std::vector<std::string>& linear_solvers, const scalar& tol )
 : m_linear_solver_order( linear_solvers )
 , m_tol( tol )
+, m_ipopt_app()
+, m_ipopt_problem()
+, m_solve_history( m_linear_solver_order )
 {
   assert( m_tol > 0.0 );
 
@@ -55,6 +58,9 @@ LCPOperatorIpopt::LCPOperatorIpopt( const std::vector<std::string>& linear_solve
 LCPOperatorIpopt::LCPOperatorIpopt( std::istream& input_stream )
 : m_linear_solver_order( StringUtilities::deserializeVector( input_stream ) )
 , m_tol( Utilities::deserialize<scalar>( input_stream ) )
+, m_ipopt_app()
+, m_ipopt_problem()
+, m_solve_history( m_linear_solver_order )
 {
   assert( !m_linear_solver_order.empty() );
   assert( m_tol >= 0.0 );
@@ -91,10 +97,15 @@ static void createIpoptApplication( const scalar& tol, Ipopt::SmartPtr<Ipopt::Ip
 #endif
 }
 
-void LCPOperatorIpopt::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
+void LCPOperatorIpopt::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
 {
-  Ipopt::SmartPtr<Ipopt::IpoptApplication> ipopt_app;
-  createIpoptApplication( m_tol, ipopt_app );
+  // The application and problem persist across calls so that Ipopt can reuse its structures between solves
+  if( IsNull( m_ipopt_app ) )
+  {
+    createIpoptApplication( m_tol, m_ipopt_app );
+    // Use built in termination, for now
+    m_ipopt_problem = new QPNLP;
+  }
 
   // Create the Ipopt-based QP solver
   assert( Q.rows() == Q.cols() );
@@ -103,9 +114,8 @@ void LCPOperatorIpopt::flow( const std::vector<std::unique_ptr<Constraint>>& con
   // std::cout << "IPOPT," << Q.cols() << "," << std::max(res.first,res.second) << "," << res.first << "," << res.second << "," << DiagonalDominanceDeviance(Q) << ",";
   // Get initial time
   std::chrono::time_point<std::chrono::system_clock> start = std::chrono::system_clock::now();
-  // Use built in termination, for now
-  Ipopt::SmartPtr<Ipopt::TNLP> ipopt_problem = new QPNLP{ Q, false, FischerBurmeisterImpact{ m_tol } };
-  QPNLP& qp_nlp{ *static_cast<QPNLP*>( GetRawPtr( ipopt_problem ) ) };
+  QPNLP& qp_nlp{ *static_cast<QPNLP*>( GetRawPtr( m_ipopt_problem ) ) };
+  qp_nlp.setQ( &Q.matrix() );
 
   // A in A^T \alpha
   ImpactOperatorUtilities::computeLCPQPLinearTerm( N, nrel, CoR, v0, v0F, qp_nlp.A() );
@@ -116,26 +126,35 @@ void LCPOperatorIpopt::flow( const std::vector<std::unique_ptr<Constraint>>& con
   assert( N.cols() == nrel.size() ); assert( alpha.size() == nrel.size() );
   qp_nlp.setAlpha( &alpha );
 
-  for( const std::string& solver_name : m_linear_solver_order )
+  for( unsigned attempt = 0; attempt < m_solve_history.numAttempts(); ++attempt )
   {
     // Reset the initial guess
     alpha = alpha0;
 
-    // Set the current linear solver
+    const std::string& solver_name{ m_solve_history.linearSolver( attempt ) };
     assert( !solver_name.empty() );
-    ipopt_app->Options()->SetStringValue( "linear_solver", solver_name );
-    // Try to solve the QP
-    ipopt_app->OptimizeTNLP( ipopt_problem );
+    // Try to solve the QP, reusing the previous solve's structures if the sparsity of Q is unchanged
+    if( m_solve_history.canReoptimize( attempt, Q.matrix() ) )
+    {
+      m_ipopt_app->ReOptimizeTNLP( m_ipopt_problem );
+    }
+    else
+    {
+      // Set the current linear solver
+      m_ipopt_app->Options()->SetStringValue( "linear_solver", solver_name );
+      m_ipopt_app->OptimizeTNLP( m_ipopt_problem );
+    }
     const Ipopt::SolverReturn solve_status{ qp_nlp.getReturnStatus() };
 
     // If the solve failed
     if( solve_status != Ipopt::SUCCESS && solve_status != Ipopt::STOP_AT_ACCEPTABLE_POINT )
     {
+      m_solve_history.recordFailure();
       // Print an error message
       std::cerr << "Failed to solve QP with Ipopt and linear solver " << solver_name << ": ";
       std::cerr << IpoptUtilities::ipoptReturnStatusToString( solve_status ) << std::endl;
       // If we exhausted all of the user-specified solvers
-      if( solver_name == m_linear_solver_order.back() )
+      if( attempt + 1 == m_solve_history.numAttempts() )
       {
         std::cerr << "Exhausted all linear solver options in LCPOperatorIpopt::flow. Exiting." << std::endl;
         std::exit( EXIT_FAILURE );
@@ -143,9 +162,12 @@ void LCPOperatorIpopt::flow( const std::vector<std::unique_ptr<Constraint>>& con
     }
     else
     {
+      m_solve_history.recordSuccess( attempt, Q.matrix() );
       break;
     }
   }
+  qp_nlp.setQ( nullptr );
+  qp_nlp.setAlpha( nullptr );
   std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
   //std::cout << "LCPOperatorIpopt: Solved LCP in " << elapsed_seconds.count() << " seconds." << std::endl;
   std::cout << elapsed_seconds.count() << ",";
@@ -160,7 +182,7 @@ void LCPOperatorIpopt::solveQP( const QPTerminationOperator& termination_operato
 
   // Create the Ipopt-based QP solver
   assert( Q.rows() == Q.cols() );
-  Ipopt::SmartPtr<Ipopt::TNLP> ipopt_problem{ new QPNLP{ Q, true, termination_operator } };
+  Ipopt::SmartPtr<Ipopt::TNLP> ipopt_problem{ new QPNLP{ Q, termination_operator } };
   QPNLP& qp_nlp{ *static_cast<QPNLP*>( GetRawPtr( ipopt_problem ) ) };
 
   // A in A^T \alpha
@@ -225,13 +247,21 @@ void LCPOperatorIpopt::serialize( std::ostream& output_stream ) const
 
 
 
-QPNLP::QPNLP( const SparseMatrixsc& Q, const bool use_custom_termination, const QPTerminationOperator& termination_operator )
-: m_Q( Q )
+QPNLP::QPNLP()
+: m_Q( nullptr )
+, m_A()
+, m_alpha( nullptr )
+, m_solve_return_status( Ipopt::INTERNAL_ERROR )
+, m_termination_operator( nullptr )
+, m_achieved_tolerance( SCALAR_INFINITY )
+{}
+
+QPNLP::QPNLP( const SparseMatrixsc& Q, const QPTerminationOperator& termination_operator )
+: m_Q( &Q )
 , m_A()
 , m_alpha( nullptr )
 , m_solve_return_status( Ipopt::INTERNAL_ERROR )
-, m_use_custom_termination( use_custom_termination )
-, m_termination_operator( termination_operator )
+, m_termination_operator( &termination_operator )
 , m_achieved_tolerance( SCALAR_INFINITY )
 {}
 
@@ -240,13 +270,13 @@ QPNLP::~QPNLP()
 
 bool QPNLP::get_nlp_info( Ipopt::Index& n, Ipopt::Index& m, Ipopt::Index& nnz_jac_g, Ipopt::Index& nnz_h_lag, TNLP::IndexStyleEnum& index_style )
 {
-  assert( m_Q.rows() == m_Q.cols() );
-  assert( m_A.size() == m_Q.rows() );
+  assert( Q().rows() == Q().cols() );
+  assert( m_A.size() == Q().rows() );
 
   n = Ipopt::Index( m_A.size() );
   m = 0;
   nnz_jac_g = 0;
-  nnz_h_lag = IpoptUtilities::nzLowerTriangular( m_Q );
+  nnz_h_lag = IpoptUtilities::nzLowerTriangular( Q() );
   index_style = TNLP::C_STYLE;
 
   return true;
@@ -255,9 +285,9 @@ bool QPNLP::get_nlp_info( Ipopt::Index& n, Ipopt::Index& m, Ipopt::Index& nnz_ja
 bool QPNLP::get_bounds_info( Ipopt::Index n, Ipopt::Number* x_l, Ipopt::Number* x_u, Ipopt::Index m, Ipopt::Number* g_l, Ipopt::Number* g_u )
 {
   static_assert( std::is_same<Ipopt::Number,scalar>::value, "Ipopt's floating point type must be the same type as SCISim's scalar." );
-  assert( m_Q.rows() == m_Q.cols() );
-  assert( m_A.size() == m_Q.rows() );
-  assert( n == m_Q.rows() );
+  assert( Q().rows() == Q().cols() );
+  assert( m_A.size() == Q().rows() );
+  assert( n == Q().rows() );
   assert( m == 0 );
 
   assert( x_l != nullptr );
@@ -274,9 +304,9 @@ bool QPNLP::get_bounds_info( Ipopt::Index n, Ipopt::Number* x_l, Ipopt::Number*
 bool QPNLP::get_starting_point( Ipopt::Index n, bool init_x, Ipopt::Number* x, bool init_z, Ipopt::Number* z_L, Ipopt::Number* z_U, Ipopt::Index m, bool init_lambda, Ipopt::Number* lambda )
 {
   static_assert( std::is_same<Ipopt::Number,scalar>::value, "Ipopt's floating point type must be the same type as SCISim's scalar." );
-  assert( m_Q.rows() == m_Q.cols() );
-  assert( m_A.size() == m_Q.rows() );
-  assert( n == m_Q.rows() );
+  assert( Q().rows() == Q().cols() );
+  assert( m_A.size() == Q().rows() );
+  assert( n == Q().rows() );
   assert( m == 0 );
 
   if( init_x )
@@ -289,8 +319,8 @@ bool QPNLP::get_starting_point( Ipopt::Index n, bool init_x, Ipopt::Number* x, b
   {
     assert( init_z ); assert( z_L != nullptr ); assert( z_U != nullptr );
     assert( m_alpha != nullptr ); assert( m_alpha->size() == n );
-    assert( m_A.size() == n ); assert( m_Q.rows() == m_Q.cols() ); assert( m_Q.rows() == n );
-    Eigen::Map<Eigen::Matrix<Ipopt::Number,Eigen::Dynamic,1>>{ z_L, n } = m_Q * (*m_alpha) + m_A;
+    assert( m_A.size() == n ); assert( Q().rows() == Q().cols() ); assert( Q().rows() == n );
+    Eigen::Map<Eigen::Matrix<Ipopt::Number,Eigen::Dynamic,1>>{ z_L, n } = Q() * (*m_alpha) + m_A;
     // Upper bounds should be unused
     #ifndef NDEBUG
     Eigen::Map<Eigen::Matrix<Ipopt::Number,Eigen::Dynamic,1>>{ z_U, n }.setConstant( SCALAR_NAN );
@@ -305,13 +335,13 @@ bool QPNLP::get_starting_point( Ipopt::Index n, bool init_x, Ipopt::Number* x, b
 bool QPNLP::eval_f( Ipopt::Index n, const Ipopt::Number* x, bool new_x, Ipopt::Number& obj_value )
 {
   static_assert( std::is_same<Ipopt::Number,scalar>::value, "Ipopt's floating point type must be the same type as SCISim's scalar." );
-  assert( m_Q.rows() == m_Q.cols() );
-  assert( m_A.size() == m_Q.rows() );
-  assert( n == m_Q.rows() );
+  assert( Q().rows() == Q().cols() );
+  assert( m_A.size() == Q().rows() );
+  assert( n == Q().rows() );
   assert( x != nullptr );
 
   const Eigen::Map< const Eigen::Matrix< Ipopt::Number, Eigen::Dynamic, 1 > > x_map{ x, n };
-  obj_value = 0.5 * x_map.transpose() * m_Q * x_map + m_A.dot( x_map );
+  obj_value = 0.5 * x_map.transpose() * Q() * x_map + m_A.dot( x_map );
 
   return true;
 }  
@@ -319,16 +349,16 @@ bool QPNLP::eval_f( Ipopt::Index n, const Ipopt::Number* x, bool new_x, Ipopt::N
 bool QPNLP::eval_grad_f( Ipopt::Index n, const Ipopt::Number* x, bool new_x, Ipopt::Number* grad_f )
 {
   static_assert( std::is_same<Ipopt::Number,scalar>::value, "Ipopt's floating point type must be the same type as SCISim's scalar." );
-  assert( m_Q.rows() == m_Q.cols() );
-  assert( m_A.size() == m_Q.rows() );
-  assert( n == m_Q.rows() );
+  assert( Q().rows() == Q().cols() );
+  assert( m_A.size() == Q().rows() );
+  assert( n == Q().rows() );
   assert( x != nullptr );
   assert( grad_f != nullptr );
 
   const Eigen::Map< const Eigen::Matrix< Ipopt::Number, Eigen::Dynamic, 1 > > x_map{ x, n };
   Eigen::Map< Eigen::Matrix< Ipopt::Number, Eigen::Dynamic, 1 > > grad_map{ grad_f, n };
 
-  grad_map = m_Q * x_map + m_A;
+  grad_map = Q() * x_map + m_A;
 
   return true;
 }
@@ -342,10 +372,10 @@ bool QPNLP::eval_g( Ipopt::Index n, const Ipopt::Number* x, bool new_x, Ipopt::I
 // TODO: A little wierd that this is getting called... email Ipopt people
 bool QPNLP::eval_jac_g( Ipopt::Index n, const Ipopt::Number* x, bool new_x, Ipopt::Index m, Ipopt::Index nele_jac, Ipopt::Index* iRow, Ipopt::Index* jCol, Ipopt::Number* values )
 {
-  assert( m_Q.rows() == m_Q.cols() );
-  assert( m_A.size() == m_Q.rows() );
+  assert( Q().rows() == Q().cols() );
+  assert( m_A.size() == Q().rows() );
 
-  assert( n == m_Q.rows() );
+  assert( n == Q().rows() );
   assert( m == 0 );
   assert( nele_jac == 0 );
 
@@ -360,9 +390,9 @@ bool QPNLP::eval_jac_g( Ipopt::Index n, const Ipopt::Number* x, bool new_x, Ipop
 
 bool QPNLP::eval_h( Ipopt::Index n, const Ipopt::Number* x, bool new_x, Ipopt::Number obj_factor, Ipopt::Index m, const Ipopt::Number* lambda, bool new_lambda, Ipopt::Index nele_hess, Ipopt::Index* iRow, Ipopt::Index* jCol, Ipopt::Number* values )
 {
-  assert( m_Q.rows() == m_Q.cols() );
-  assert( m_A.size() == m_Q.rows() );
-  assert( n == m_Q.rows() );
+  assert( Q().rows() == Q().cols() );
+  assert( m_A.size() == Q().rows() );
+  assert( n == Q().rows() );
   assert( m == 0 );
 
   // Note: Ipopt requires the elements on and below the diagonal
@@ -378,7 +408,7 @@ bool QPNLP::eval_h( Ipopt::Index n, const Ipopt::Number* x, bool new_x, Ipopt::N
     Eigen::Map< Eigen::Matrix< Ipopt::Index, Eigen::Dynamic, 1 > >{ jCol, nele_hess }.setConstant( -1 );
     #endif
 
-    IpoptUtilities::sparsityPatternLowerTriangular( m_Q, iRow, jCol );
+    IpoptUtilities::sparsityPatternLowerTriangular( Q(), iRow, jCol );
   }
   else
   {
@@ -391,7 +421,7 @@ bool QPNLP::eval_h( Ipopt::Index n, const Ipopt::Number* x, bool new_x, Ipopt::N
     Eigen::Map< Eigen::Matrix< Ipopt::Number, Eigen::Dynamic, 1 > >{ values, nele_hess }.setConstant( SCALAR_NAN );
     #endif
 
-    IpoptUtilities::valuesLowerTriangular( m_Q, values );
+    IpoptUtilities::valuesLowerTriangular( Q(), values );
     Eigen::Map< Eigen::Matrix< Ipopt::Number, Eigen::Dynamic, 1 > >{ values, nele_hess } *= obj_factor;
   }
 
@@ -400,8 +430,8 @@ bool QPNLP::eval_h( Ipopt::Index n, const Ipopt::Number* x, bool new_x, Ipopt::N
 
 void QPNLP::finalize_solution( Ipopt::SolverReturn status, Ipopt::Index n, const Ipopt::Number* x, const Ipopt::Number* z_L, const Ipopt::Number* z_U, Ipopt::Index m, const Ipopt::Number* g, const Ipopt::Number* lambda, Ipopt::Number obj_value, const Ipopt::IpoptData* ip_data, Ipopt::IpoptCalculatedQuantities* ip_cq )
 {
-  assert( m_Q.rows() == m_Q.cols() );
-  assert( m_A.size() == m_Q.rows() );
+  assert( Q().rows() == Q().cols() );
+  assert( m_A.size() == Q().rows() );
   assert( m_alpha != nullptr );
   assert( m_alpha->size() == m_A.size() );
   assert( n == m_A.size() );
@@ -411,22 +441,27 @@ void QPNLP::finalize_solution( Ipopt::SolverReturn status, Ipopt::Index n, const
 
   *m_alpha = Eigen::Map<const Eigen::Matrix<Ipopt::Number,1,Eigen::Dynamic>>{ x, n };
 
-  if( m_use_custom_termination )
+  if( m_termination_operator != nullptr )
   {
-    const VectorXs y{ m_Q * (*m_alpha) + m_A };
-    m_achieved_tolerance = m_termination_operator( *m_alpha, y );
+    const VectorXs y{ Q() * (*m_alpha) + m_A };
+    m_achieved_tolerance = ( *m_termination_operator )( *m_alpha, y );
   }
 
   // Verify that the dual is in the ballpark
   #ifndef NDEBUG
   {
     const Eigen::Map<const Eigen::Matrix<Ipopt::Number,Eigen::Dynamic,1>> lower_dual{ z_L, n };
-    const VectorXs computed_dual{ m_Q * (*m_alpha) + m_A };
+    const VectorXs computed_dual{ Q() * (*m_alpha) + m_A };
     assert( ( lower_dual - computed_dual ).lpNorm<Eigen::Infinity>() <= 5.0e-6 );
   }
   #endif
 }
 
+void QPNLP::setQ( const SparseMatrixsc* Q )
+{
+  m_Q = Q;
+}
+
 void QPNLP::setAlpha( VectorXs* alpha )
 {
   m_alpha = alpha;
@@ -9,6 +9,7 @@
 #include "ImpactOperator.h"
 
 #include "IpIpoptApplication.hpp"
+#include "scisim/ConstrainedMaps/IpoptUtilities.h"
 
 class QPTerminationOperator;
 
@@ -22,7 +23,7 @@ public:
 
   virtual ~LCPOperatorIpopt() override = default;
 
-  virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) override;
+  virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) override;
 
   virtual std::string name() const override;
 
@@ -37,6 +38,11 @@ private:
   const std::vector<std::string> m_linear_solver_order;
   const scalar m_tol;
 
+  // Ipopt state that persists across calls to flow, created on the first call
+  Ipopt::SmartPtr<Ipopt::IpoptApplication> m_ipopt_app;
+  Ipopt::SmartPtr<Ipopt::TNLP> m_ipopt_problem;
+  IpoptSolveHistory m_solve_history;
+
 };
 
 class QPNLP final : public Ipopt::TNLP
@@ -44,7 +50,9 @@ class QPNLP final : public Ipopt::TNLP
 
 public:
 
-  QPNLP( const SparseMatrixsc& Q, const bool use_custom_termination, const QPTerminationOperator& termination_operator );
+  // Solves with Ipopt's built in termination criteria
+  QPNLP();
+  QPNLP( const SparseMatrixsc& Q, const QPTerminationOperator& termination_operator );
 
   virtual ~QPNLP() override;
 
@@ -76,9 +84,13 @@ public:
 
   inline const SparseMatrixsc& Q() const
   {
-    return m_Q;
+    assert( m_Q != nullptr );
+    return *m_Q;
   }
 
+  // Q must outlive the solves that use it
+  void setQ( const SparseMatrixsc* Q );
+
   inline const VectorXs& A() const
   {
     return m_A;
@@ -105,15 +117,15 @@ public:
 
 private:
 
-  const SparseMatrixsc& m_Q;
+  const SparseMatrixsc* m_Q;
   VectorXs m_A;
   VectorXs* m_alpha;
 
   // Return status from the last solve
   Ipopt::SolverReturn m_solve_return_status;
 
-  const bool m_use_custom_termination;
-  const QPTerminationOperator& m_termination_operator;
+  // Custom termination criteria, or nullptr to use Ipopt's criteria
+  const QPTerminationOperator* const m_termination_operator;
   scalar m_achieved_tolerance;
 
   QPNLP( const QPNLP& );
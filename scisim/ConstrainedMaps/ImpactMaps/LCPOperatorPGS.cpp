@@ -0,0 +1,275 @@
+#include "LCPOperatorPGS.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include "scisim/Math/DelassusOperator.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorUtilities.h"
+#include "scisim/Utilities.h"
+#include "MinMapImpact.h"
+
+LCPOperatorPGS::LCPOperatorPGS( const scalar& tol, const unsigned max_iters )
+: m_tol( tol )
+, m_max_iters( max_iters )
+, m_color_starts()
+, m_colored_constraints()
+, m_constraint_colors()
+, m_row_colors()
+, m_color_stamps()
+, m_N_outer()
+, m_N_inner()
+, m_MinvN_outer()
+, m_MinvN_inner()
+, m_last_solve_iterations( 0 )
+{
+  assert( m_tol >= 0.0 );
+}
+
+LCPOperatorPGS::LCPOperatorPGS( std::istream& input_stream )
+: m_tol( Utilities::deserialize<scalar>( input_stream ) )
+, m_max_iters( Utilities::deserialize<unsigned>( input_stream ) )
+, m_color_starts()
+, m_colored_constraints()
+, m_constraint_colors()
+, m_row_colors()
+, m_color_stamps()
+, m_N_outer()
+, m_N_inner()
+, m_MinvN_outer()
+, m_MinvN_inner()
+, m_last_solve_iterations( 0 )
+{
+  assert( m_tol >= 0.0 );
+}
+
+void LCPOperatorPGS::colorConstraints( const SparseMatrixsc& N, const SparseMatrixsc& MinvN )
+{
+  assert( N.rows() == MinvN.rows() ); assert( N.cols() == MinvN.cols() );
+  const unsigned ncons{ unsigned( N.cols() ) };
+
+  m_row_colors.resize( std::vector<std::vector<unsigned>>::size_type( N.rows() ) );
+  for( std::vector<unsigned>& row_colors : m_row_colors )
+  {
+    row_colors.clear();
+  }
+  m_constraint_colors.resize( ncons );
+  // m_color_stamps[c] == con + 1 marks color c as taken by a neighbor of constraint con
+  m_color_stamps.clear();
+
+  unsigned num_colors{ 0 };
+  for( unsigned con = 0; con < ncons; ++con )
+  {
+    for( SparseMatrixsc::InnerIterator it{ N, con }; it; ++it )
+    {
+      for( const unsigned color : m_row_colors[it.row()] )
+      {
+        m_color_stamps[color] = con + 1;
+      }
+    }
+    for( SparseMatrixsc::InnerIterator it{ MinvN, con }; it; ++it )
+    {
+      for( const unsigned color : m_row_colors[it.row()] )
+      {
+        m_color_stamps[color] = con + 1;
+      }
+    }
+
+    unsigned color{ 0 };
+    while( color < num_colors && m_color_stamps[color] == con + 1 )
+    {
+      ++color;
+    }
+    if( color == num_colors )
+    {
+      ++num_colors;
+      m_color_stamps.emplace_back( 0 );
+    }
+    m_constraint_colors[con] = color;
+
+    for( SparseMatrixsc::InnerIterator it{ N, con }; it; ++it )
+    {
+      m_row_colors[it.row()].emplace_back( color );
+    }
+    for( SparseMatrixsc::InnerIterator it{ MinvN, con }; it; ++it )
+    {
+      m_row_colors[it.row()].emplace_back( color );
+    }
+  }
+
+  // Bucket the constraints by color, preserving constraint order within each color
+  m_color_starts.assign( num_colors + 1, 0 );
+  for( unsigned con = 0; con < ncons; ++con )
+  {
+    ++m_color_starts[m_constraint_colors[con] + 1];
+  }
+  for( unsigned color = 0; color < num_colors; ++color )
+  {
+    m_color_starts[color + 1] += m_color_starts[color];
+  }
+  m_colored_constraints.resize( ncons );
+  for( unsigned con = 0; con < ncons; ++con )
+  {
+    m_colored_constraints[m_color_starts[m_constraint_colors[con]]++] = con;
+  }
+  for( unsigned color = num_colors; color > 0; --color )
+  {
+    m_color_starts[color] = m_color_starts[color - 1];
+  }
+  m_color_starts[0] = 0;
+}
+
+static bool patternMatches( const SparseMatrixsc& A, const VectorXi& outer, const VectorXi& inner )
+{
+  if( outer.size() != A.outerSize() + 1 || inner.size() != A.nonZeros() )
+  {
+    return false;
+  }
+  int curel{ 0 };
+  for( int col = 0; col < A.outerSize(); ++col )
+  {
+    if( outer( col ) != curel )
+    {
+      return false;
+    }
+    for( SparseMatrixsc::InnerIterator it{ A, col }; it; ++it )
+    {
+      if( inner( curel ) != it.row() )
+      {
+        return false;
+      }
+      ++curel;
+    }
+  }
+  return true;
+}
+
+static void recordPattern( const SparseMatrixsc& A, VectorXi& outer, VectorXi& inner )
+{
+  outer.resize( A.outerSize() + 1 );
+  inner.resize( A.nonZeros() );
+  int curel{ 0 };
+  for( int col = 0; col < A.outerSize(); ++col )
+  {
+    outer( col ) = curel;
+    for( SparseMatrixsc::InnerIterator it{ A, col }; it; ++it )
+    {
+      inner( curel++ ) = int( it.row() );
+    }
+  }
+  outer( A.outerSize() ) = curel;
+}
+
+void LCPOperatorPGS::updateColoring( const SparseMatrixsc& N, const SparseMatrixsc& MinvN )
+{
+  if( patternMatches( N, m_N_outer, m_N_inner ) && patternMatches( MinvN, m_MinvN_outer, m_MinvN_inner ) )
+  {
+    return;
+  }
+  colorConstraints( N, MinvN );
+  recordPattern( N, m_N_outer, m_N_inner );
+  recordPattern( MinvN, m_MinvN_outer, m_MinvN_inner );
+}
+
+void LCPOperatorPGS::computeGradient( const SparseMatrixsc& N, const VectorXs& u, const VectorXs& b, VectorXs& grad ) const
+{
+  const unsigned ncons{ unsigned( N.cols() ) };
+  grad.resize( ncons );
+  #pragma omp parallel for
+  for( unsigned con = 0; con < ncons; ++con )
+  {
+    grad( con ) = N.col( con ).dot( u ) + b( con );
+  }
+}
+
+void LCPOperatorPGS::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
+{
+  assert( alpha.size() == N.cols() );
+
+  // b in Q alpha + b
+  VectorXs b;
+  ImpactOperatorUtilities::computeLCPQPLinearTerm( N, nrel, CoR, v0, v0F, b );
+
+  const SparseMatrixsc& MinvN{ Q.MinvN() };
+  updateColoring( N, MinvN );
+
+  // Diagonal of Q, the inverse effective mass of each constraint
+  VectorXs Q_diag;
+  Q.computeDiagonal( Q_diag );
+  assert( ( Q_diag.array() > 0.0 ).all() );
+
+  alpha = alpha.cwiseMax( 0.0 );
+  // u = M^-1 N alpha, so that Q alpha + b = N^T u + b
+  VectorXs u{ MinvN * alpha };
+
+  VectorXs grad;
+  m_last_solve_iterations = 0;
+  scalar residual{ SCALAR_INFINITY };
+  while( m_last_solve_iterations < m_max_iters )
+  {
+    for( unsigned color = 0; color + 1 < unsigned( m_color_starts.size() ); ++color )
+    {
+      const unsigned color_end{ m_color_starts[color + 1] };
+      // Constraints of one color touch disjoint entries of u
+      #pragma omp parallel for
+      for( unsigned idx = m_color_starts[color]; idx < color_end; ++idx )
+      {
+        const unsigned con{ m_colored_constraints[idx] };
+        const scalar grad_con{ N.col( con ).dot( u ) + b( con ) };
+        const scalar alpha_new{ std::max( scalar( 0 ), alpha( con ) - grad_con / Q_diag( con ) ) };
+        const scalar delta{ alpha_new - alpha( con ) };
+        if( delta != 0.0 )
+        {
+          for( SparseMatrixsc::InnerIterator it{ MinvN, con }; it; ++it )
+          {
+            u( it.row() ) += delta * it.value();
+          }
+          alpha( con ) = alpha_new;
+        }
+      }
+    }
+    ++m_last_solve_iterations;
+
+    // A zero tolerance runs a fixed number of sweeps without evaluating the residual
+    if( m_tol > 0.0 )
+    {
+      computeGradient( N, u, b, grad );
+      residual = MinMapImpact{}( alpha, grad );
+      if( residual <= m_tol )
+      {
+        break;
+      }
+    }
+  }
+  assert( ( alpha.array() >= 0.0 ).all() );
+
+  if( m_tol > 0.0 && residual > m_tol )
+  {
+    std::cerr << "LCPOperatorPGS warning, failed to acheive desired tolerance: " << residual << std::endl;
+  }
+}
+
+std::string LCPOperatorPGS::name() const
+{
+  return "lcp_pgs";
+}
+
+std::unique_ptr<ImpactOperator> LCPOperatorPGS::clone() const
+{
+  return std::unique_ptr<ImpactOperator>{ new LCPOperatorPGS{ m_tol, m_max_iters } };
+}
+
+void LCPOperatorPGS::serialize( std::ostream& output_stream ) const
+{
+  Utilities::serialize( m_tol, output_stream );
+  Utilities::serialize( m_max_iters, output_stream );
+}
+
+unsigned LCPOperatorPGS::lastSolveIterations() const
+{
+  return m_last_solve_iterations;
+}
+
+bool LCPOperatorPGS::reportsSolveIterations() const
+{
+  return true;
+}
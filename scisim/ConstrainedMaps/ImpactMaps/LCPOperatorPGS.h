@@ -0,0 +1,64 @@
+#ifndef LCP_OPERATOR_PGS_H
+#define LCP_OPERATOR_PGS_H
+
+#include "ImpactOperator.h"
+
+// Projected Gauss-Seidel on the impact LCP. Constraints are colored so that no two constraints of a color share
+// a degree of freedom; the constraints of a color are relaxed concurrently when OpenMP is enabled, and colors
+// are swept in order. Terminates when the min-map residual falls below tol or after max_iters sweeps.
+class LCPOperatorPGS final : public ImpactOperator
+{
+
+public:
+
+  LCPOperatorPGS( const scalar& tol, const unsigned max_iters );
+  explicit LCPOperatorPGS( std::istream& input_stream );
+
+  virtual ~LCPOperatorPGS() override = default;
+
+  // alpha holds the initial iterate on entry, such as impulses cached from the previous step
+  virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) override;
+
+  virtual std::string name() const override;
+
+  virtual std::unique_ptr<ImpactOperator> clone() const override;
+
+  virtual void serialize( std::ostream& output_stream ) const override;
+
+  virtual unsigned lastSolveIterations() const override;
+  virtual bool reportsSolveIterations() const override;
+
+private:
+
+  // Greedily colors the constraints so that constraints of the same color touch disjoint rows of N and M^-1 N
+  void colorConstraints( const SparseMatrixsc& N, const SparseMatrixsc& MinvN );
+  // Colors the constraints unless the sparsity patterns of N and M^-1 N match the last coloring
+  void updateColoring( const SparseMatrixsc& N, const SparseMatrixsc& MinvN );
+
+  // Computes Q alpha + b from u = M^-1 N alpha
+  void computeGradient( const SparseMatrixsc& N, const VectorXs& u, const VectorXs& b, VectorXs& grad ) const;
+
+  const scalar m_tol;
+  const unsigned m_max_iters;
+
+  // Constraints grouped by color; the constraints of color c are m_colored_constraints[m_color_starts[c], m_color_starts[c + 1])
+  std::vector<unsigned> m_color_starts;
+  std::vector<unsigned> m_colored_constraints;
+
+  // Coloring workspace, reused across steps
+  std::vector<unsigned> m_constraint_colors;
+  std::vector<std::vector<unsigned>> m_row_colors;
+  std::vector<unsigned> m_color_stamps;
+
+  // Compressed column sparsity patterns of the N and M^-1 N that were colored; the coloring depends only on these,
+  // so it is reused while they are unchanged
+  VectorXi m_N_outer;
+  VectorXi m_N_inner;
+  VectorXi m_MinvN_outer;
+  VectorXi m_MinvN_inner;
+
+  unsigned m_last_solve_iterations;
+
+};
+
+#endif
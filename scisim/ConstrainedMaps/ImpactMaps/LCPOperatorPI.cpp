@@ -5,109 +5,144 @@
 #include <iostream>
 #include "LCPOperatorPI.h"
 #include "scisim/Utilities.h"
-#include <chrono>
+#include "scisim/Math/DelassusOperator.h"
+#include "ImpactOperatorUtilities.h"
 
-const std::string header = "Method,Size,M Matrix,MM Diag,MM Non-Diag,DD Bad Rows,DD Max Dev,IPOPT,Iterations,PI";
-bool first_time = true;
-
-LCPOperatorPI::LCPOperatorPI(const scalar &tol, const unsigned &max_iters)
+LCPOperatorPI::LCPOperatorPI(const scalar &tol, const unsigned &max_iters, const Preconditioner preconditioner)
 : m_tol (tol)
 , max_iters (max_iters)
-, alt_solver({"ma97", "ma57", "mumps", "ma27", "ma86"}, tol)
+, m_preconditioner (preconditioner)
+, m_active()
+, m_active_index()
+, m_Q_active()
+, m_b_active()
+, m_x_active()
+, m_ic_cg()
+, m_jacobi_cg()
+, m_last_solve_iterations (0)
 {
   assert(m_tol >= 0);
-  if(first_time) {
-    std::cout << header << std::endl;
-    first_time = false;
-  }
 }
 
 LCPOperatorPI::LCPOperatorPI(std::istream &input_stream)
 : m_tol (Utilities::deserialize<scalar>( input_stream ))
 , max_iters (Utilities::deserialize<unsigned>(input_stream))
-, alt_solver({"ma97", "ma57", "mumps", "ma27", "ma86"}, m_tol)
+, m_preconditioner (Utilities::deserialize<Preconditioner>(input_stream))
+, m_active()
+, m_active_index()
+, m_Q_active()
+, m_b_active()
+, m_x_active()
+, m_ic_cg()
+, m_jacobi_cg()
+, m_last_solve_iterations (0)
 {
   assert(m_tol >= 0);
-  if(first_time) {
-    std::cout << header << std::endl;
-    first_time = false;
-  }
 }
 
-// Returns the error of our solution
-scalar getPolicy(const SparseMatrixsc &Q, const VectorXs &x, const VectorXs &b, SparseMatrixsc &policy)
+scalar LCPOperatorPI::updatePolicy(const SparseMatrixsc &Q, const VectorXs &b, const VectorXs &x)
 {
+  const VectorXs y { Q * x + b };
   scalar err2 = 0;
-  VectorXs y = Q * x + b;
+  m_active.clear();
   for (int i = 0; i < x.size(); ++i) {
-    scalar choice;
-    if (y(i) < x(i))
-      choice = 1;
-    else
-      choice = 0;
     err2 += fmin(x(i), y(i)) * fmin(x(i), y(i));
-    policy.coeffRef(i, i) = choice;
+    // Enforce Qx + b = 0 where it is the smaller of the two, and x = 0 elsewhere
+    if (y(i) < x(i)) {
+      m_active.emplace_back(i);
+    }
   }
   return sqrt(err2);
 }
 
-void updateValue(const SparseMatrixsc &policy, const SparseMatrixsc &Q, const VectorXs &b, VectorXs &x)
+template<typename Solver>
+void LCPOperatorPI::solveReducedSystem(Solver &solver, const VectorXs &rhs, VectorXs &x_active) const
 {
-  Eigen::ConjugateGradient<SparseMatrixsc, Eigen::Lower|Eigen::Upper> cg;
-  SparseMatrixsc I {b.size(), b.size()};
-  I.setIdentity();
-  cg.compute(policy * Q * policy + I - policy);
-  x = cg.solve(-policy * b);
+  solver.compute(m_Q_active);
+  if (solver.info() != Eigen::Success) {
+    std::cerr << "LCPOperatorPI: Failed to factor the preconditioner of the reduced system" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  // Eigen's tolerance is relative to the right hand side, so scale it to match the complementarity tolerance
+  solver.setTolerance(m_tol / std::max(scalar(1), rhs.norm()));
+  // The previous iterate restricted to the active indices is a good initial guess
+  x_active = solver.solveWithGuess(rhs, x_active);
 }
 
-void reportTime(const std::chrono::time_point<std::chrono::system_clock> &start)
+void LCPOperatorPI::solveReducedSystem(const SparseMatrixsc &Q, const VectorXs &b, VectorXs &x)
 {
-  std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
-  // std::cout << "LCPOperatorPI: Time elapsed: " << elapsed_seconds.count() << "s\n";
-  std::cout << elapsed_seconds.count() << ",";
+  const int num_active = int(m_active.size());
+
+  // Map from full to reduced indices, -1 for indices with x = 0 enforced
+  m_active_index.assign(x.size(), -1);
+  for (int local = 0; local < num_active; ++local) {
+    m_active_index[m_active[local]] = local;
+  }
+
+  // Extract the principal submatrix Q_AA; rows remain sorted as the index map is monotone
+  m_Q_active.resize(num_active, num_active);
+  m_Q_active.reserve(Q.nonZeros());
+  m_b_active.resize(num_active);
+  m_x_active.resize(num_active);
+  for (int local = 0; local < num_active; ++local) {
+    const int col = int(m_active[local]);
+    m_Q_active.startVec(local);
+    for (SparseMatrixsc::InnerIterator it(Q, col); it; ++it) {
+      const int local_row = m_active_index[it.row()];
+      if (local_row >= 0) {
+        m_Q_active.insertBack(local_row, local) = it.value();
+      }
+    }
+    m_b_active(local) = -b(col);
+    m_x_active(local) = x(col);
+  }
+  m_Q_active.finalize();
+
+  if (num_active != 0) {
+    switch (m_preconditioner) {
+      case Preconditioner::IncompleteCholesky:
+        solveReducedSystem(m_ic_cg, m_b_active, m_x_active);
+        break;
+      case Preconditioner::Jacobi:
+        solveReducedSystem(m_jacobi_cg, m_b_active, m_x_active);
+        break;
+    }
+  }
+
+  x.setZero();
+  for (int local = 0; local < num_active; ++local) {
+    x(m_active[local]) = m_x_active(local);
+  }
 }
 
 void LCPOperatorPI::flow(const std::vector<std::unique_ptr<Constraint>> &cons, const SparseMatrixsc &M,
                          const SparseMatrixsc &Minv, const VectorXs &q0, const VectorXs &v0, const VectorXs &v0F,
-                         const SparseMatrixsc &N, const SparseMatrixsc &Q, const VectorXs &nrel, const VectorXs &CoR,
+                         const SparseMatrixsc &N, const DelassusOperator &Q, const VectorXs &nrel, const VectorXs &CoR,
                          VectorXs &alpha) {
-  // std::cout << "LCPOperatorPI: Solving LCP of size " << N.cols() << std::endl;
-  auto mm = MMatrixDeviance(Q);
-  auto dd = DiagonalDominanceDeviance(Q);
-  std::cout << "Both," << N.cols() << "," << std::max(mm.first,mm.second) << "," << mm.first << "," << mm.second << "," << dd.first << "," << dd.second << ",";
-  alt_solver.flow(cons, M, Minv, q0, v0, v0F, N, Q, nrel, CoR, alpha);
-  // Get initial time
-  std::chrono::time_point<std::chrono::system_clock> start = std::chrono::system_clock::now();
-
-  VectorXs b { N.transpose() * (1 + CoR(0)) * v0 };
+  assert(alpha.size() == N.cols());
+  // Warm start from the impulses supplied by the caller
+  VectorXs x { alpha.cwiseMax(0.0) };
+
+  const SparseMatrixsc& Qmat = Q.matrix();
+  VectorXs b;
+  ImpactOperatorUtilities::computeLCPQPLinearTerm(N, nrel, CoR, v0, v0F, b);
   // Solve complementarity with x and Qx + b
-  VectorXs x { b.size() }; // Initial guess of 0 (maybe change later)
-  SparseMatrixsc policy { x.size(), x.size() };
   scalar error = 0;
   for (unsigned n_iter = 0; n_iter <= max_iters; ++n_iter)
   {
-    error = getPolicy(Q, x, b, policy);
+    error = updatePolicy(Qmat, b, x);
     if (error <= m_tol) {
-      alpha = x; // To use IPOPT version for real output, comment all lines assigning alpha
-      // std::cout << "LCPOperatorPI: Converged in " << n_iter << " iterations." << std::endl;
-      std::cout << n_iter << ",";
-      reportTime(start);
-      std::cout << std::endl;
+      m_last_solve_iterations = n_iter;
+      alpha = x;
       return;
     }
     if (n_iter == max_iters)
       break;
-    updateValue(policy, Q, b, x);
+    solveReducedSystem(Qmat, b, x);
   }
-  // std::cout << "LCPOperatorPI: Failed to converge in " << max_iters << " iterations." << std::endl;
-  std::cout << max_iters << ",";
-  reportTime(start);
-  std::cerr << "LCPOperatorPI: Result did not converge" << std::endl;
-  std::cerr << "LCPOperatorPI: Error is: " << error << std::endl;
-  std::cerr << "LCPOperatorPI: Failed with size: " << N.cols() << std::endl;
-  std::cerr << "LCPOperatorPI: Failed with CoR: " << CoR(0) << std::endl;
+  m_last_solve_iterations = max_iters;
+  std::cerr << "LCPOperatorPI: Failed to converge in " << max_iters << " iterations, error is: " << error << std::endl;
   alpha = x;
-  std::cout << std::endl;
 }
 
 std::string LCPOperatorPI::name() const {
@@ -115,11 +150,21 @@ std::string LCPOperatorPI::name() const {
 }
 
 std::unique_ptr<ImpactOperator> LCPOperatorPI::clone() const {
-  return std::unique_ptr<ImpactOperator>(new LCPOperatorPI(m_tol, max_iters));
+  return std::unique_ptr<ImpactOperator>(new LCPOperatorPI(m_tol, max_iters, m_preconditioner));
 }
 
 void LCPOperatorPI::serialize(std::ostream &output_stream) const {
   Utilities::serialize(m_tol, output_stream);
+  Utilities::serialize(max_iters, output_stream);
+  Utilities::serialize(m_preconditioner, output_stream);
+}
+
+unsigned LCPOperatorPI::lastSolveIterations() const {
+  return m_last_solve_iterations;
+}
+
+bool LCPOperatorPI::reportsSolveIterations() const {
+  return true;
 }
 
 
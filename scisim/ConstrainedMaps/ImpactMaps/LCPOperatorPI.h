@@ -5,19 +5,29 @@
 #ifndef SCISIM_LCP_OPERATOR_PI_H
 #define SCISIM_LCP_OPERATOR_PI_H
 
+#include <Eigen/IterativeLinearSolvers>
+
 #include "ImpactOperator.h"
-#include "LCPOperatorIpopt.h"
 
 class LCPOperatorPI final : public ImpactOperator {
 
 public:
 
-    explicit LCPOperatorPI( const scalar& tol, const unsigned& max_iters );
+    // Preconditioner for the conjugate gradient solve of the reduced system. Impact constraints are scalar,
+    // so block Jacobi over constraints reduces to Jacobi.
+    enum class Preconditioner
+    {
+        IncompleteCholesky,
+        Jacobi
+    };
+
+    explicit LCPOperatorPI( const scalar& tol, const unsigned& max_iters, const Preconditioner preconditioner = Preconditioner::IncompleteCholesky );
     explicit LCPOperatorPI( std::istream& input_stream );
 
     virtual ~LCPOperatorPI() override = default;
 
-    virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) override;
+    // alpha holds the initial iterate on entry, such as impulses cached from the previous step
+    virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) override;
 
     virtual std::string name() const override;
 
@@ -25,10 +35,34 @@ public:
 
     virtual void serialize( std::ostream& output_stream ) const override;
 
+    virtual unsigned lastSolveIterations() const override;
+    virtual bool reportsSolveIterations() const override;
+
 private:
+
+    // Updates the active indices, where Qx + b = 0 is enforced, from the iterate x and returns the complementarity error
+    scalar updatePolicy( const SparseMatrixsc& Q, const VectorXs& b, const VectorXs& x );
+
+    // Solves Q_AA x_A = -b_A on the active indices and sets the remaining entries of x to 0
+    void solveReducedSystem( const SparseMatrixsc& Q, const VectorXs& b, VectorXs& x );
+
+    template<typename Solver>
+    void solveReducedSystem( Solver& solver, const VectorXs& rhs, VectorXs& x_active ) const;
+
     const scalar m_tol;
     const unsigned max_iters;
-    LCPOperatorIpopt alt_solver;
+    const Preconditioner m_preconditioner;
+
+    // Policy and reduced system storage, reused across iterations and steps
+    std::vector<unsigned> m_active;
+    std::vector<int> m_active_index;
+    SparseMatrixsc m_Q_active;
+    VectorXs m_b_active;
+    VectorXs m_x_active;
+    Eigen::ConjugateGradient<SparseMatrixsc, Eigen::Lower|Eigen::Upper, Eigen::IncompleteCholesky<scalar>> m_ic_cg;
+    Eigen::ConjugateGradient<SparseMatrixsc, Eigen::Lower|Eigen::Upper, Eigen::DiagonalPreconditioner<scalar>> m_jacobi_cg;
+
+    unsigned m_last_solve_iterations;
 };
 
 
@@ -7,6 +7,7 @@
 
 #include "ImpactOperatorUtilities.h"
 #include "scisim/Utilities.h"
+#include "scisim/Math/DelassusOperator.h"
 #include "scisim/Math/QL/QLUtilities.h"
 
 #include <iostream>
@@ -101,11 +102,11 @@ static int solveQP( const scalar& tol, MatrixXXsc& C, VectorXs& dvec, VectorXs&
   return ifail;
 }
 
-void LCPOperatorQL::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
+void LCPOperatorQL::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
 {
   // Q in 1/2 \alpha^T Q \alpha
   assert( Q.rows() == Q.cols() );
-  MatrixXXsc Qdense = Q;
+  MatrixXXsc Qdense = Q.matrix();
 
   // Linear term in the objective
   VectorXs Adense;
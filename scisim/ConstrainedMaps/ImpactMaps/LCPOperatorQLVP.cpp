@@ -120,7 +120,7 @@ LCPOperatorQLVP::LCPOperatorQLVP( const scalar& tol )
 //  return ifail;
 //}
 
-void LCPOperatorQLVP::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const SparseMatrixsc& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
+void LCPOperatorQLVP::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
 {
   std::cerr << "Error, LCPOperatorQLVP::flow not updated to work with new interface" << std::endl;
   std::exit( EXIT_FAILURE );
@@ -0,0 +1,68 @@
+#include "LCPOperatorSparseActiveSet.h"
+
+#include <iostream>
+
+#include "scisim/Math/DelassusOperator.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorUtilities.h"
+#include "scisim/Utilities.h"
+
+LCPOperatorSparseActiveSet::LCPOperatorSparseActiveSet( const scalar& tol, const unsigned max_iters )
+: m_tol( tol )
+, m_max_iters( max_iters )
+, m_qp( tol, max_iters )
+{
+  assert( m_tol >= 0.0 );
+}
+
+LCPOperatorSparseActiveSet::LCPOperatorSparseActiveSet( std::istream& input_stream )
+: m_tol( Utilities::deserialize<scalar>( input_stream ) )
+, m_max_iters( Utilities::deserialize<unsigned>( input_stream ) )
+, m_qp( m_tol, m_max_iters )
+{
+  assert( m_tol >= 0.0 );
+}
+
+void LCPOperatorSparseActiveSet::flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha )
+{
+  assert( alpha.size() == N.cols() );
+
+  // b in Q alpha + b
+  VectorXs b;
+  ImpactOperatorUtilities::computeLCPQPLinearTerm( N, nrel, CoR, v0, v0F, b );
+
+  const VectorXs lower{ VectorXs::Zero( alpha.size() ) };
+  const VectorXs upper{ VectorXs::Constant( alpha.size(), SCALAR_INFINITY ) };
+
+  alpha = alpha.cwiseMax( 0.0 );
+  if( !m_qp.solve( Q.matrix(), b, lower, upper, alpha ) )
+  {
+    std::cerr << "LCPOperatorSparseActiveSet warning, failed to converge in " << m_qp.lastSolveIterations() << " iterations" << std::endl;
+  }
+  assert( ( alpha.array() >= 0.0 ).all() );
+}
+
+std::string LCPOperatorSparseActiveSet::name() const
+{
+  return "lcp_sparse_active_set";
+}
+
+std::unique_ptr<ImpactOperator> LCPOperatorSparseActiveSet::clone() const
+{
+  return std::unique_ptr<ImpactOperator>{ new LCPOperatorSparseActiveSet{ m_tol, m_max_iters } };
+}
+
+void LCPOperatorSparseActiveSet::serialize( std::ostream& output_stream ) const
+{
+  Utilities::serialize( m_tol, output_stream );
+  Utilities::serialize( m_max_iters, output_stream );
+}
+
+unsigned LCPOperatorSparseActiveSet::lastSolveIterations() const
+{
+  return m_qp.lastSolveIterations();
+}
+
+bool LCPOperatorSparseActiveSet::reportsSolveIterations() const
+{
+  return true;
+}
@@ -0,0 +1,43 @@
+#ifndef LCP_OPERATOR_SPARSE_ACTIVE_SET_H
+#define LCP_OPERATOR_SPARSE_ACTIVE_SET_H
+
+#include "ImpactOperator.h"
+#include "scisim/Math/QPSolvers/SparseActiveSetQP.h"
+
+// Solves the impact LCP as the QP min 1/2 alpha^T Q alpha + b^T alpha s.t. alpha >= 0 with a sparse active set
+// method. Q is never densified, so memory scales with the number of nonzeros of Q rather than the square of the
+// number of constraints. Terminates when the projected gradient, which is the min-map residual of the LCP, falls below
+// tol, or after max_iters iterations.
+class LCPOperatorSparseActiveSet final : public ImpactOperator
+{
+
+public:
+
+  LCPOperatorSparseActiveSet( const scalar& tol, const unsigned max_iters );
+  explicit LCPOperatorSparseActiveSet( std::istream& input_stream );
+
+  virtual ~LCPOperatorSparseActiveSet() override = default;
+
+  // alpha holds the initial iterate on entry, such as impulses cached from the previous step
+  virtual void flow( const std::vector<std::unique_ptr<Constraint>>& cons, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const VectorXs& q0, const VectorXs& v0, const VectorXs& v0F, const SparseMatrixsc& N, const DelassusOperator& Q, const VectorXs& nrel, const VectorXs& CoR, VectorXs& alpha ) override;
+
+  virtual std::string name() const override;
+
+  virtual std::unique_ptr<ImpactOperator> clone() const override;
+
+  virtual void serialize( std::ostream& output_stream ) const override;
+
+  virtual unsigned lastSolveIterations() const override;
+  virtual bool reportsSolveIterations() const override;
+
+private:
+
+  const scalar m_tol;
+  const unsigned m_max_iters;
+
+  // Reuses the symbolic factorization across steps while the sparsity pattern of Q is unchanged
+  SparseActiveSetQP m_qp;
+
+};
+
+#endif
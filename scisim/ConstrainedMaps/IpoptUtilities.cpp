@@ -186,3 +186,87 @@ int IpoptUtilities::valuesLowerTriangular( const SparseMatrixsc& A, scalar* vals
 
   return curel;
 }
+
+IpoptSolveHistory::IpoptSolveHistory( const std::vector<std::string>& linear_solvers )
+: m_linear_solvers( linear_solvers )
+, m_last_linear_solver( 0 )
+, m_last_solve_succeeded( false )
+, m_H_outer()
+, m_H_inner()
+{
+  assert( !m_linear_solvers.empty() );
+}
+
+unsigned IpoptSolveHistory::numAttempts() const
+{
+  return unsigned( m_linear_solvers.size() );
+}
+
+unsigned IpoptSolveHistory::linearSolverIndex( const unsigned attempt ) const
+{
+  assert( attempt < numAttempts() );
+  if( attempt == 0 )
+  {
+    return m_last_linear_solver;
+  }
+  // Skip over the solver that was tried first
+  return attempt <= m_last_linear_solver ? attempt - 1 : attempt;
+}
+
+const std::string& IpoptSolveHistory::linearSolver( const unsigned attempt ) const
+{
+  return m_linear_solvers[ linearSolverIndex( attempt ) ];
+}
+
+bool IpoptSolveHistory::canReoptimize( const unsigned attempt, const SparseMatrixsc& H ) const
+{
+  if( attempt != 0 || !m_last_solve_succeeded )
+  {
+    return false;
+  }
+  if( m_H_outer.size() != H.outerSize() + 1 || m_H_inner.size() != H.nonZeros() )
+  {
+    return false;
+  }
+  int curel{ 0 };
+  for( int col = 0; col < H.outerSize(); ++col )
+  {
+    if( m_H_outer( col ) != curel )
+    {
+      return false;
+    }
+    for( SparseMatrixsc::InnerIterator it( H, col ); it; ++it )
+    {
+      if( m_H_inner( curel ) != it.row() )
+      {
+        return false;
+      }
+      ++curel;
+    }
+  }
+  return true;
+}
+
+void IpoptSolveHistory::recordSuccess( const unsigned attempt, const SparseMatrixsc& H )
+{
+  m_last_linear_solver = linearSolverIndex( attempt );
+  m_last_solve_succeeded = true;
+
+  m_H_outer.resize( H.outerSize() + 1 );
+  m_H_inner.resize( H.nonZeros() );
+  int curel{ 0 };
+  for( int col = 0; col < H.outerSize(); ++col )
+  {
+    m_H_outer( col ) = curel;
+    for( SparseMatrixsc::InnerIterator it( H, col ); it; ++it )
+    {
+      m_H_inner( curel++ ) = int( it.row() );
+    }
+  }
+  m_H_outer( H.outerSize() ) = curel;
+}
+
+void IpoptSolveHistory::recordFailure()
+{
+  m_last_solve_succeeded = false;
+}
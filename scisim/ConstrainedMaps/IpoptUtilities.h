@@ -37,4 +37,41 @@ namespace IpoptUtilities
 
 }
 
+// Tracks the outcome of the previous solve of an Ipopt application that persists across solves. Successive solves try
+// the linear solver that last succeeded first, and re-solve with the structures (including the symbolic factorization
+// of the linear solver) that Ipopt built for the previous problem when the Hessian's sparsity pattern is unchanged.
+class IpoptSolveHistory final
+{
+
+public:
+
+  explicit IpoptSolveHistory( const std::vector<std::string>& linear_solvers );
+
+  unsigned numAttempts() const;
+
+  // The linear solver for the given attempt at a solve; the first attempt uses the solver that last succeeded,
+  // followed by the remaining solvers in the user's order
+  const std::string& linearSolver( const unsigned attempt ) const;
+
+  // Whether the given attempt may call ReOptimizeTNLP for the same TNLP with Hessian H
+  bool canReoptimize( const unsigned attempt, const SparseMatrixsc& H ) const;
+
+  void recordSuccess( const unsigned attempt, const SparseMatrixsc& H );
+
+  void recordFailure();
+
+private:
+
+  unsigned linearSolverIndex( const unsigned attempt ) const;
+
+  const std::vector<std::string>& m_linear_solvers;
+  unsigned m_last_linear_solver;
+  bool m_last_solve_succeeded;
+
+  // Compressed column sparsity pattern of the Hessian of the last successful solve
+  VectorXi m_H_outer;
+  VectorXi m_H_inner;
+
+};
+
 #endif
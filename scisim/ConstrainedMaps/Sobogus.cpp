@@ -8,6 +8,7 @@
 #include "scisim/Constraints/Constraint.h"
 #include "scisim/UnconstrainedMaps/FlowableSystem.h"
 #include "scisim/Utilities.h"
+#include "scisim/Timer/Profiler.h"
 
 #ifndef NDEBUG
 #include "scisim/Math/MathUtilities.h"
@@ -1003,6 +1004,7 @@ void Sobogus::solve( const unsigned iteration, const scalar& dt, const FlowableS
   {
     unsigned num_iterations;
     sfp.solve( active_set, mu, max_iters, m_eval_every, tol, alpha, beta, f_local, v_local_out, solve_succeeded, error, num_iterations );
+    SCISIM_PROFILE_COUNT( ProfileCounter::SOLVER_ITERATIONS, num_iterations );
   }
 
   // TODO: Convert the following to functions like above
@@ -1102,3 +1104,8 @@ std::string Sobogus::name() const
 {
   return "sobogus";
 }
+
+std::unique_ptr<FrictionSolver> Sobogus::clone() const
+{
+  return std::unique_ptr<FrictionSolver>{ new Sobogus{ m_solver_type, m_eval_every } };
+}
@@ -90,6 +90,8 @@ public:
 
   virtual std::string name() const override;
 
+  virtual std::unique_ptr<FrictionSolver> clone() const override;
+
 private:
 
   void flattenMass( const SparseMatrixsc& M, VectorXs& masses );
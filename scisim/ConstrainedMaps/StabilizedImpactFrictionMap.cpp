@@ -12,10 +12,16 @@
 #include "scisim/ConstrainedMaps/FrictionSolver.h"
 #include "scisim/Constraints/Constraint.h"
 #include "scisim/Constraints/ConstrainedSystem.h"
+#include "scisim/Constraints/ContactBatch.h"
 #include "scisim/UnconstrainedMaps/UnconstrainedMap.h"
 #include "scisim/ScriptingCallback.h"
 #include "scisim/UnconstrainedMaps/FlowableSystem.h"
 #include "scisim/Utilities.h"
+#include "scisim/Timer/Profiler.h"
+
+#ifdef USE_HDF5
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactSolution.h"
+#endif
 
 StabilizedImpactFrictionMap::StabilizedImpactFrictionMap( const scalar& abs_tol, const unsigned max_iters, const bool external_warm_start_alpha, const bool external_warm_start_beta )
 : m_f( VectorXs::Zero( 0 ) )
@@ -25,7 +31,7 @@ StabilizedImpactFrictionMap::StabilizedImpactFrictionMap( const scalar& abs_tol,
 , m_external_warm_start_beta( external_warm_start_beta )
 #ifdef USE_HDF5
 , m_write_constraint_forces( false )
-, m_constraint_force_stream( nullptr )
+, m_impact_solution( nullptr )
 #endif
 {
   assert( m_abs_tol >= 0.0 );
@@ -39,7 +45,7 @@ StabilizedImpactFrictionMap::StabilizedImpactFrictionMap( std::istream& input_st
 , m_external_warm_start_beta( Utilities::deserialize<bool>( input_stream ) )
 #ifdef USE_HDF5
 , m_write_constraint_forces( false )
-, m_constraint_force_stream( nullptr )
+, m_impact_solution( nullptr )
 #endif
 {
   assert( m_abs_tol >= 0.0 );
@@ -57,7 +63,10 @@ void StabilizedImpactFrictionMap::flow( ScriptingCallback& call_back, FlowableSy
   }
 
   // Compute an unconstrained predictor step
-  umap.flow( q0, v0, fsys, iteration, dt, q1, v1 );
+  {
+    SCISIM_PROFILE_SCOPE( ProfilePhase::FLOW );
+    umap.flow( q0, v0, fsys, iteration, dt, q1, v1 );
+  }
 
   // Using the configuration at the predictor step, compute the set of active constraints
   std::vector<std::unique_ptr<Constraint>> active_set;
@@ -72,13 +81,16 @@ void StabilizedImpactFrictionMap::flow( ScriptingCallback& call_back, FlowableSy
       exportConstraintForcesToBinary( q0, active_set, MatrixXXsc{ fsys.ambientSpaceDimensions(), 0 }, VectorXs::Zero(0), VectorXs::Zero(0), dt );
     }
     m_write_constraint_forces = false;
-    m_constraint_force_stream = nullptr;
+    m_impact_solution = nullptr;
     #endif
     return;
   }
 
   const unsigned ncollisions{ static_cast<unsigned>( active_set.size() ) };
 
+  // Gather the contacts once for the bases, N, and D assembled during this step
+  const ScopedContactBatch contact_batch{ q0, active_set };
+
   // Pre-compute the full contact basis
   MatrixXXsc contact_bases;
   // NB: v1, not v0, so linear samples are aligned with the incoming velocity
@@ -124,7 +136,10 @@ void StabilizedImpactFrictionMap::flow( ScriptingCallback& call_back, FlowableSy
     VectorXs v2{ v1.size() };
     VectorXs nrel_extra;
     VectorXs drel_extra;
-    friction_solver.solve( iteration, dt, fsys, fsys.M(), fsys.Minv(), CoR, mu, q0, v1, active_set, contact_bases, nrel_extra, drel_extra, m_max_iters, m_abs_tol, m_f, alpha, beta, v2, solve_succeeded, error );
+    {
+      SCISIM_PROFILE_SCOPE( ProfilePhase::SOLVER );
+      friction_solver.solve( iteration, dt, fsys, fsys.M(), fsys.Minv(), CoR, mu, q0, v1, active_set, contact_bases, nrel_extra, drel_extra, m_max_iters, m_abs_tol, m_f, alpha, beta, v2, solve_succeeded, error );
+    }
     //std::cout << "alpha: " << alpha.transpose() << std::endl;
     //std::cout << "beta: " << beta.transpose() << std::endl;
     assert( error >= 0.0 );
@@ -174,11 +189,12 @@ void StabilizedImpactFrictionMap::flow( ScriptingCallback& call_back, FlowableSy
     exportConstraintForcesToBinary( q0, active_set, contact_bases, alpha, beta, dt );
   }
   m_write_constraint_forces = false;
-  m_constraint_force_stream = nullptr;
+  m_impact_solution = nullptr;
   #endif
 
   active_set.clear();
 
+  SCISIM_PROFILE_SCOPE( ProfilePhase::FLOW );
   fsys.linearInertialConfigurationUpdate( q0, v1, dt, q1 );
 }
 
@@ -191,8 +207,8 @@ void StabilizedImpactFrictionMap::resetCachedData()
 void StabilizedImpactFrictionMap::exportConstraintForcesToBinary( const VectorXs& q, const std::vector<std::unique_ptr<Constraint>>& constraints, const MatrixXXsc& contact_bases, const VectorXs& alpha, const VectorXs& beta, const scalar& dt )
 {
   assert( m_write_constraint_forces );
-  assert( m_constraint_force_stream != nullptr );
-  ImpactFrictionMap::exportConstraintForcesToBinaryFile( q, constraints, contact_bases, alpha, beta, dt, *m_constraint_force_stream );
+  assert( m_impact_solution != nullptr );
+  m_impact_solution->setSolution( q, constraints, contact_bases, alpha, beta, dt );
 }
 #endif
 
@@ -206,7 +222,7 @@ void StabilizedImpactFrictionMap::serialize( std::ostream& output_stream ) const
   Utilities::serialize( m_external_warm_start_beta, output_stream );
   #ifdef USE_HDF5
   assert( m_write_constraint_forces == false );
-  assert( m_constraint_force_stream == nullptr );
+  assert( m_impact_solution == nullptr );
   #endif
 }
 
@@ -216,9 +232,9 @@ std::string StabilizedImpactFrictionMap::name() const
 }
 
 #ifdef USE_HDF5
-void StabilizedImpactFrictionMap::exportForcesNextStep( HDF5File& output_file )
+void StabilizedImpactFrictionMap::exportForcesNextStep( ImpactSolution& impact_solution )
 {
   m_write_constraint_forces = true;
-  m_constraint_force_stream = &output_file;
+  m_impact_solution = &impact_solution;
 }
 #endif
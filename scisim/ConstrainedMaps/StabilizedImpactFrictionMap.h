@@ -12,7 +12,7 @@ class Constraint;
 class FrictionSolver;
 
 #ifdef USE_HDF5
-class HDF5File;
+class ImpactSolution;
 #endif
 
 class StabilizedImpactFrictionMap final : public ImpactFrictionMap
@@ -40,7 +40,7 @@ public:
   virtual std::string name() const override;
 
   #ifdef USE_HDF5
-  virtual void exportForcesNextStep( HDF5File& output_file ) override;
+  virtual void exportForcesNextStep( ImpactSolution& impact_solution ) override;
   #endif
 
 private:
@@ -63,7 +63,7 @@ private:
   #ifdef USE_HDF5
   // Temporary state for writing constraint forces
   bool m_write_constraint_forces;
-  HDF5File* m_constraint_force_stream;
+  ImpactSolution* m_impact_solution;
   #endif
 
 };
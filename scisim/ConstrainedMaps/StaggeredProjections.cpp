@@ -8,16 +8,16 @@
 #include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperator.h"
 #include "scisim/ConstrainedMaps/FrictionMaps/FrictionOperator.h"
 #include "scisim/Constraints/Constraint.h"
+#include "scisim/Math/DelassusOperator.h"
+#include "scisim/Math/BlockDiagonalMass.h"
 #include "scisim/ConstrainedMaps/ConstrainedMapUtilities.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorUtilities.h"
+#include "scisim/ConstrainedMaps/FrictionResidual.h"
 #include "scisim/UnconstrainedMaps/FlowableSystem.h"
 #include "scisim/Utilities.h"
 
 #include <iostream>
 
-// For error computation
-#include "scisim/ConstrainedMaps/Sobogus.h"
-
 #ifndef NDEBUG
 #include "scisim/Math/MathUtilities.h"
 #endif
@@ -99,47 +99,6 @@ static bool frictionSolutinIsContractionB( const SparseMatrixsc& M, const Sparse
 }
 #endif
 
-static void computePerContactForce( const VectorXs& alpha, const VectorXs& beta, const MatrixXXsc& contact_bases, VectorXs& per_contact_force )
-{
-  assert( alpha.size() + beta.size() == contact_bases.cols() );
-  assert( beta.size() % alpha.size() == 0 );
-
-  const unsigned ncontacts{ static_cast<unsigned>( alpha.size() ) };
-  const unsigned num_friction_samples{ static_cast<unsigned>( beta.size() ) / ncontacts };
-  const unsigned dofs_per_body{ static_cast<unsigned>( contact_bases.rows() ) };
-
-  per_contact_force.setZero( dofs_per_body * ncontacts );
-
-  for( unsigned clsn_idx = 0; clsn_idx < ncontacts; ++clsn_idx )
-  {
-    const unsigned base_normal_index{ ( num_friction_samples + 1 ) * clsn_idx };
-    assert( base_normal_index < contact_bases.cols() );
-    // Grab the contact basis
-    const MatrixXXsc basis{ contact_bases.block( 0, base_normal_index, dofs_per_body, dofs_per_body ) };
-    assert( ( basis * basis.transpose() - MatrixXXsc::Identity( basis.rows(), basis.cols() ) ).lpNorm<Eigen::Infinity>() <= 1.0e-6 );
-    assert( fabs( basis.determinant() - 1.0 ) <= 1.0e-6 );
-    // Add in the impact contribution
-    const unsigned base_force_index{ dofs_per_body * clsn_idx };
-    assert( base_force_index + dofs_per_body - 1 < per_contact_force.size() );
-    per_contact_force.segment( base_force_index, dofs_per_body ) += alpha( clsn_idx ) * basis.col( 0 );
-    // Add in the friction contributions
-    for( unsigned sample_num = 0; sample_num < num_friction_samples; ++sample_num )
-    {
-      const unsigned base_friction_index{ num_friction_samples * clsn_idx + sample_num };
-      assert( base_friction_index < beta.size() );
-      assert( fabs( basis.col( sample_num + 1 ).dot( basis.col( 0 ) ) ) <= 1.0e-6 );
-      per_contact_force.segment( base_force_index, dofs_per_body ) += beta( base_friction_index ) * basis.col( sample_num + 1 );
-    }
-  }
-}
-
-static scalar computeSobogusError( const VectorXs& alpha, const VectorXs& beta, const MatrixXXsc& contact_bases, SobogusFrictionProblem& sobogus_problem )
-{
-  VectorXs per_contact_force;
-  computePerContactForce( alpha, beta, contact_bases, per_contact_force );
-  return sobogus_problem.computeError( per_contact_force );
-}
-
 // TODO: Pre-allocate space for temporaries
 // TODO: Make as many variables const as possible (D, N, nrel, drel, ...)
 // TODO: Unify interfces for formGeneralizedSmoothFrictionBasis and computeN
@@ -150,6 +109,7 @@ void StaggeredProjections::solve( const unsigned iteration, const scalar& dt, co
   assert( MathUtilities::isSquare( M ) );
   assert( MathUtilities::isSquare( Minv ) );
   assert( M.rows() == Minv.rows() );
+  assert( fsys.MinvBlocks().rows() == Minv.rows() );
   assert( CoR.size() == alpha.size() );
   assert( CoR.size() == mu.size() );
   assert( active_set.size() == std::vector<std::unique_ptr<Constraint>>::size_type( mu.size() ) );
@@ -183,22 +143,19 @@ void StaggeredProjections::solve( const unsigned iteration, const scalar& dt, co
   Constraint::evalKinematicRelVelGivenBases( q0, v0, active_set, contact_bases, nrel, drel );
 
   // For computing the error
-  // TODO: Move this to a member variable that is passed into the solver, to make it easy to change the implementation later
-  assert( fsys.numVelDoFsPerBody() == 2 || fsys.numVelDoFsPerBody() == 3 || fsys.numVelDoFsPerBody() == 6 );
-  SobogusFrictionProblem sbfp( fsys.numVelDoFsPerBody() == 2 ? SobogusSolverType::Balls2D : fsys.numVelDoFsPerBody() == 3 ? SobogusSolverType::RigidBody2D : SobogusSolverType::RigidBodies3D );
-  {
-    VectorXs flat_masses;
-    sbfp.flattenMass( M, flat_masses );
-    sbfp.initialize( active_set, contact_bases, flat_masses, q0, v0, CoR, mu, nrel, drel );
-  }
+  FrictionResidual residual;
+  residual.initialize( N, v0, CoR, nrel, drel );
 
   // Quadratic term in LCP QP
-  const SparseMatrixsc QN{ N.transpose() * Minv * N };
-  assert( ( Eigen::Map<const ArrayXs>{QN.valuePtr(), QN.nonZeros()} != 0.0 ).any() );
+  const DelassusOperator QN{ N, fsys.MinvBlocks() };
+  assert( ( Eigen::Map<const ArrayXs>{QN.matrix().valuePtr(), QN.matrix().nonZeros()} != 0.0 ).any() );
 
   // Quadratic term in MDP QP
-  const SparseMatrixsc QD{ D.transpose() * Minv * D };
-  assert( ( Eigen::Map<const ArrayXs>{QD.valuePtr(), QD.nonZeros()} != 0.0 ).any() );
+  const DelassusOperator QD{ D, fsys.MinvBlocks() };
+  assert( ( Eigen::Map<const ArrayXs>{QD.matrix().valuePtr(), QD.matrix().nonZeros()} != 0.0 ).any() );
+
+  // Workspace for M^-1 f
+  VectorXs Minv_f;
 
   // Track the 'best' friction result as progress is not always monotonic
   VectorXs best_alpha{ alpha };
@@ -216,7 +173,8 @@ void StaggeredProjections::solve( const unsigned iteration, const scalar& dt, co
     // Impact solve
     {
       // Incoming velocity with the friction impulses applied
-      const VectorXs vbeta{ v0 + Minv * f };
+      fsys.MinvBlocks().multiply( f, Minv_f );
+      const VectorXs vbeta{ v0 + Minv_f };
       // Solve for the impact impulses given the total friction impulse
       if( !m_warm_start_alpha )
       {
@@ -230,7 +188,7 @@ void StaggeredProjections::solve( const unsigned iteration, const scalar& dt, co
     // Friction solve
     {
       // Incoming velocity with the impact impulses applied
-      const VectorXs vaplha{ v0 + Minv * N * alpha };
+      const VectorXs vaplha{ v0 + QN.MinvN() * alpha };
 
       // Solve for a new estimate of the friction impulse
       if( !m_warm_start_beta )
@@ -240,7 +198,7 @@ void StaggeredProjections::solve( const unsigned iteration, const scalar& dt, co
       {
         // TODO: Get rid of lambda from the friction operator
         VectorXs temp_lambda{ mu.size() };
-        m_friction_operator->flow( iteration * dt, Minv, vaplha, D, QD, drel, mu, alpha, beta, temp_lambda );
+        m_friction_operator->flow( iteration * dt, Minv, vaplha, D, QD.matrix(), drel, mu, alpha, beta, temp_lambda );
       }
       f = D * beta;
       // Verify that || M^-1 f ||_M^2 <= || vinit + M^-1 N \alpha ||_M^2
@@ -250,7 +208,7 @@ void StaggeredProjections::solve( const unsigned iteration, const scalar& dt, co
     }
 
     // Compute the new global error
-    const scalar global_error{ computeSobogusError( alpha, beta, contact_bases, sbfp ) };
+    const scalar global_error{ residual.evalError( fsys.MinvBlocks(), N, D, v0, mu, alpha, beta ) };
 
     // If the current solution is the best yet, cache it
     if( global_error < error )
@@ -285,7 +243,7 @@ void StaggeredProjections::solve( const unsigned iteration, const scalar& dt, co
     std::cerr << "Warning, staggered projections failed, falling back to best solution at iteration: " << best_iteration << std::endl;
   }
 
-  assert( error == computeSobogusError( alpha, beta, contact_bases, sbfp ) );
+  assert( error == residual.evalError( fsys.MinvBlocks(), N, D, v0, mu, alpha, beta ) );
   assert( ( beta.array() == best_beta.array() ).all() );
   assert( ( alpha.array() == best_alpha.array() ).all() );
   assert( ( f - D * beta ).lpNorm<Eigen::Infinity>() == 0.0 );
@@ -293,7 +251,8 @@ void StaggeredProjections::solve( const unsigned iteration, const scalar& dt, co
   // Final impact solve to prevent penetration
   {
     // Incoming velocity with the friction impulses applied
-    const VectorXs vbeta{ v0 + Minv * f };
+    fsys.MinvBlocks().multiply( f, Minv_f );
+    const VectorXs vbeta{ v0 + Minv_f };
     // Solve for the impact impulses given the total friction impulse
     if( !m_warm_start_alpha )
     {
@@ -306,10 +265,10 @@ void StaggeredProjections::solve( const unsigned iteration, const scalar& dt, co
 
   // Compute the final velocity
   // TODO: assert vout == vbeta + Minv * N * alpha
-  vout = v0 + Minv * ( N * alpha + f );
+  vout = v0 + QN.MinvN() * alpha + QD.MinvN() * beta;
 
   // Compute the final error
-  error = computeSobogusError( alpha, beta, contact_bases, sbfp );
+  error = residual.evalError( N, D, mu, alpha, beta, vout );
   solve_succeeded = error <= tol;
   if( !solve_succeeded )
   {
@@ -334,3 +293,8 @@ std::string StaggeredProjections::name() const
 {
   return "staggered_projections";
 }
+
+std::unique_ptr<FrictionSolver> StaggeredProjections::clone() const
+{
+  return std::unique_ptr<FrictionSolver>{ new StaggeredProjections{ m_warm_start_alpha, m_warm_start_beta, *m_impact_operator, *m_friction_operator } };
+}
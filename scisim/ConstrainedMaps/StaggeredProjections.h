@@ -35,6 +35,8 @@ public:
 
   virtual std::string name() const override;
 
+  virtual std::unique_ptr<FrictionSolver> clone() const override;
+
 private:
 
   const bool m_warm_start_alpha;
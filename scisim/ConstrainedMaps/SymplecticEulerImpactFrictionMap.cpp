@@ -6,12 +6,19 @@
 #include "scisim/ConstrainedMaps/FrictionSolver.h"
 #include "scisim/Constraints/Constraint.h"
 #include "scisim/Constraints/ConstrainedSystem.h"
+#include "scisim/Constraints/ContactBatch.h"
 #include "scisim/UnconstrainedMaps/UnconstrainedMap.h"
 #include "scisim/ScriptingCallback.h"
 #include "scisim/UnconstrainedMaps/FlowableSystem.h"
+#include "scisim/Math/BlockDiagonalMass.h"
 #include "scisim/Utilities.h"
 #include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperatorUtilities.h"
 #include "scisim/ConstrainedMaps/FrictionMaps/FrictionOperator.h"
+#include "scisim/Timer/Profiler.h"
+
+#ifdef USE_HDF5
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactSolution.h"
+#endif
 
 SymplecticEulerImpactFrictionMap::SymplecticEulerImpactFrictionMap( const scalar& abs_tol, const unsigned max_iters, const ImpulsesToCache impulses_to_cache, const bool stabilize, const scalar& penetration_threshold )
 : m_f( VectorXs::Zero( 0 ) )
@@ -22,7 +29,7 @@ SymplecticEulerImpactFrictionMap::SymplecticEulerImpactFrictionMap( const scalar
 , m_impulses_to_cache( impulses_to_cache )
 #ifdef USE_HDF5
 , m_write_constraint_forces( false )
-, m_constraint_force_stream( nullptr )
+, m_impact_solution( nullptr )
 #endif
 {
   assert( m_abs_tol >= 0.0 );
@@ -38,7 +45,7 @@ SymplecticEulerImpactFrictionMap::SymplecticEulerImpactFrictionMap( std::istream
 , m_impulses_to_cache( Utilities::deserialize<ImpulsesToCache>( input_stream ) )
 #ifdef USE_HDF5
 , m_write_constraint_forces( false )
-, m_constraint_force_stream( nullptr )
+, m_impact_solution( nullptr )
 #endif
 {
   assert( m_abs_tol >= 0.0 );
@@ -47,6 +54,7 @@ SymplecticEulerImpactFrictionMap::SymplecticEulerImpactFrictionMap( std::istream
 
 static void initializeImpulses( const ImpulsesToCache cache_mode, const unsigned ambient_dims, const std::vector<std::unique_ptr<Constraint>>& active_set, ConstrainedSystem& csys, VectorXs& alpha, VectorXs& beta, const VectorXs& q, const VectorXs& v )
 {
+  SCISIM_PROFILE_SCOPE( ProfilePhase::WARM_START );
   switch( cache_mode )
   {
     case ImpulsesToCache::NONE:
@@ -132,6 +140,7 @@ static void initializeImpulses( const ImpulsesToCache cache_mode, const unsigned
 
 static void cacheImpulses( const ImpulsesToCache cache_mode, const unsigned ambient_dims, const std::vector<std::unique_ptr<Constraint>>& active_set, ConstrainedSystem& csys, const VectorXs& alpha, const VectorXs& beta, const VectorXs& q, const VectorXs& v )
 {
+  SCISIM_PROFILE_SCOPE( ProfilePhase::WARM_START );
   switch( cache_mode )
   {
     case ImpulsesToCache::NONE:
@@ -220,10 +229,12 @@ void SymplecticEulerImpactFrictionMap::flow( ScriptingCallback& call_back, Flowa
   // Compute the force at the start of step and the corresponding change in velocity
   VectorXs vdelta( q0.size() );
   {
+    SCISIM_PROFILE_SCOPE( ProfilePhase::FLOW );
     VectorXs F( fsys.Minv().cols() );
     fsys.computeForce( q0, v0, dt, F );
     fsys.zeroOutForcesOnFixedBodies( F );
-    vdelta = dt * ( fsys.Minv() * F );
+    fsys.MinvBlocks().multiply( F, vdelta );
+    vdelta *= dt;
   }
 
   // Take a predictor step for collision detection
@@ -244,12 +255,15 @@ void SymplecticEulerImpactFrictionMap::flow( ScriptingCallback& call_back, Flowa
       exportConstraintForcesToBinary( q0, active_set, MatrixXXsc{ fsys.ambientSpaceDimensions(), 0 }, VectorXs::Zero(0), VectorXs::Zero(0), dt );
     }
     m_write_constraint_forces = false;
-    m_constraint_force_stream = nullptr;
+    m_impact_solution = nullptr;
     #endif
     return;
   }
   const unsigned ncollisions{ static_cast<unsigned>( active_set.size() ) };
 
+  // Gather the contacts once for the bases, N, and D assembled during this step
+  const ScopedContactBatch contact_batch{ q0, active_set };
+
   // Set the coefficients of friction to the default
   VectorXs mu{ VectorXs::Constant( ncollisions, mu_default ) };
   // If scripting is enabled, use the scripted version
@@ -326,7 +340,10 @@ void SymplecticEulerImpactFrictionMap::flow( ScriptingCallback& call_back, Flowa
       nrel += g0 / dt;
     }
 
-    friction_solver.solve( iteration, dt, fsys, fsys.M(), fsys.Minv(), CoR, mu, q0, v0, active_set, contact_bases, nrel, drel, m_max_iters, m_abs_tol, m_f, alpha, beta, v1, solve_succeeded, error );
+    {
+      SCISIM_PROFILE_SCOPE( ProfilePhase::SOLVER );
+      friction_solver.solve( iteration, dt, fsys, fsys.M(), fsys.Minv(), CoR, mu, q0, v0, active_set, contact_bases, nrel, drel, m_max_iters, m_abs_tol, m_f, alpha, beta, v1, solve_succeeded, error );
+    }
     assert( error >= 0.0 );
     if( !solve_succeeded )
     {
@@ -400,9 +417,10 @@ void SymplecticEulerImpactFrictionMap::flow( ScriptingCallback& call_back, Flowa
     exportConstraintForcesToBinary( q0, active_set, contact_bases, alpha, beta, dt );
   }
   m_write_constraint_forces = false;
-  m_constraint_force_stream = nullptr;
+  m_impact_solution = nullptr;
   #endif
 
+  SCISIM_PROFILE_SCOPE( ProfilePhase::FLOW );
   fsys.linearInertialConfigurationUpdate( q0, v1, dt, q1 );
 }
 
@@ -415,8 +433,8 @@ void SymplecticEulerImpactFrictionMap::resetCachedData()
 void SymplecticEulerImpactFrictionMap::exportConstraintForcesToBinary( const VectorXs& q, const std::vector<std::unique_ptr<Constraint>>& constraints, const MatrixXXsc& contact_bases, const VectorXs& alpha, const VectorXs& beta, const scalar& dt )
 {
   assert( m_write_constraint_forces );
-  assert( m_constraint_force_stream != nullptr );
-  ImpactFrictionMap::exportConstraintForcesToBinaryFile( q, constraints, contact_bases, alpha, beta, dt, *m_constraint_force_stream );
+  assert( m_impact_solution != nullptr );
+  m_impact_solution->setSolution( q, constraints, contact_bases, alpha, beta, dt );
 }
 #endif
 
@@ -431,7 +449,7 @@ void SymplecticEulerImpactFrictionMap::serialize( std::ostream& output_stream )
   Utilities::serialize( m_impulses_to_cache, output_stream );
   #ifdef USE_HDF5
   assert( m_write_constraint_forces == false );
-  assert( m_constraint_force_stream == nullptr );
+  assert( m_impact_solution == nullptr );
   #endif
 }
 
@@ -441,9 +459,9 @@ std::string SymplecticEulerImpactFrictionMap::name() const
 }
 
 #ifdef USE_HDF5
-void SymplecticEulerImpactFrictionMap::exportForcesNextStep( HDF5File& output_file )
+void SymplecticEulerImpactFrictionMap::exportForcesNextStep( ImpactSolution& impact_solution )
 {
   m_write_constraint_forces = true;
-  m_constraint_force_stream = &output_file;
+  m_impact_solution = &impact_solution;
 }
 #endif
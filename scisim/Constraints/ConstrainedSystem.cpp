@@ -5,4 +5,39 @@
 
 #include "ConstrainedSystem.h"
 
+#include <cassert>
+
+ConstrainedSystem::ConstrainedSystem()
+: m_constraint_arena()
+{}
+
+ConstrainedSystem::ConstrainedSystem( const ConstrainedSystem& other )
+: m_constraint_arena()
+{
+  assert( other.m_constraint_arena.liveAllocations() == 0 );
+}
+
+ConstrainedSystem::ConstrainedSystem( ConstrainedSystem&& other ) noexcept
+: m_constraint_arena()
+{
+  assert( other.m_constraint_arena.liveAllocations() == 0 );
+}
+
+ConstrainedSystem& ConstrainedSystem::operator=( const ConstrainedSystem& other )
+{
+  assert( m_constraint_arena.liveAllocations() == 0 ); assert( other.m_constraint_arena.liveAllocations() == 0 );
+  return *this;
+}
+
+ConstrainedSystem& ConstrainedSystem::operator=( ConstrainedSystem&& other ) noexcept
+{
+  assert( m_constraint_arena.liveAllocations() == 0 ); assert( other.m_constraint_arena.liveAllocations() == 0 );
+  return *this;
+}
+
 ConstrainedSystem::~ConstrainedSystem() = default;
+
+ConstraintArena& ConstrainedSystem::constraintArena() const
+{
+  return m_constraint_arena;
+}
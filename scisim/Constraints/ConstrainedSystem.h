@@ -9,6 +9,7 @@
 #include <memory>
 
 #include "scisim/Math/MathDefines.h"
+#include "ConstraintArena.h"
 
 class Constraint;
 
@@ -28,13 +29,23 @@ public:
 
 protected:
 
-  ConstrainedSystem() = default;
-  ConstrainedSystem( const ConstrainedSystem& ) = default;
-  ConstrainedSystem( ConstrainedSystem&& ) noexcept = default;
-  ConstrainedSystem& operator=( const ConstrainedSystem& other ) = default;
-  ConstrainedSystem& operator=( ConstrainedSystem&& other ) noexcept = default;
+  ConstrainedSystem();
+  // Each system keeps its own arena: copies and moves start with an empty arena and assignment keeps the target's.
+  // Constraints record their arena, so neither system may have live constraints.
+  ConstrainedSystem( const ConstrainedSystem& other );
+  ConstrainedSystem( ConstrainedSystem&& other ) noexcept;
+  ConstrainedSystem& operator=( const ConstrainedSystem& other );
+  ConstrainedSystem& operator=( ConstrainedSystem&& other ) noexcept;
   virtual ~ConstrainedSystem() = 0;
 
+  // Storage for the constraints generated by computeActiveSet, recycled between timesteps
+  ConstraintArena& constraintArena() const;
+
+private:
+
+  // Allocating constraints does not alter the observable state of the system
+  mutable ConstraintArena m_constraint_arena;
+
 };
 
 #endif
@@ -5,7 +5,56 @@
 
 #include "Constraint.h"
 
+#include <cstring>
 #include <iostream>
+#include <new>
+
+#include "ConstraintArena.h"
+
+// Every constraint is preceded by a header recording the arena it was allocated from, or nullptr for the heap
+static constexpr std::size_t s_allocation_header_size{ ConstraintArena::alignment };
+static_assert( sizeof(ConstraintArena*) <= s_allocation_header_size, "Error, allocation header too small to hold an arena." );
+
+static void* writeAllocationHeader( void* storage, ConstraintArena* arena )
+{
+  std::memcpy( storage, &arena, sizeof(ConstraintArena*) );
+  return static_cast<unsigned char*>( storage ) + s_allocation_header_size;
+}
+
+void* Constraint::operator new( std::size_t size )
+{
+  return writeAllocationHeader( ::operator new( size + s_allocation_header_size ), nullptr );
+}
+
+void* Constraint::operator new( std::size_t size, ConstraintArena& arena )
+{
+  return writeAllocationHeader( arena.allocate( size + s_allocation_header_size ), &arena );
+}
+
+void Constraint::operator delete( void* ptr )
+{
+  if( ptr == nullptr )
+  {
+    return;
+  }
+  unsigned char* const storage{ static_cast<unsigned char*>( ptr ) - s_allocation_header_size };
+  ConstraintArena* arena;
+  std::memcpy( &arena, storage, sizeof(ConstraintArena*) );
+  if( arena == nullptr )
+  {
+    ::operator delete( storage );
+  }
+  else
+  {
+    arena->release();
+  }
+}
+
+void Constraint::operator delete( void*, ConstraintArena& arena )
+{
+  // Only invoked if a constructor throws during arena allocation
+  arena.release();
+}
 
 void Constraint::computeBasis( const VectorXs& q, const VectorXs& v, MatrixXXsc& basis ) const
 {
@@ -158,6 +207,11 @@ void Constraint::computeGeneralizedFrictionGivenTangentSample( const VectorXs& q
   std::exit( EXIT_FAILURE );
 }
 
+bool Constraint::addToContactBatch( const VectorXs& q, ContactBatch& batch ) const
+{
+  return false;
+}
+
 int Constraint::frictionStencilSize() const
 {
   std::cerr << "Constraint::frictionStencilSize not implemented for: " << name() << std::endl;
@@ -8,12 +8,15 @@
 #ifndef CONSTRAINT_H
 #define CONSTRAINT_H
 
+#include <cstddef>
 #include <iosfwd>
 #include <memory>
 
 #include "scisim/Math/MathDefines.h"
 
 class FlowableSystem;
+class ConstraintArena;
+class ContactBatch;
 
 class Constraint
 {
@@ -27,6 +30,12 @@ public:
 
   virtual ~Constraint() = 0;
 
+  // Constraints may be allocated on the heap or in a ConstraintArena; both are destroyed through the usual delete
+  static void* operator new( std::size_t size );
+  static void* operator new( std::size_t size, ConstraintArena& arena );
+  static void operator delete( void* ptr );
+  static void operator delete( void* ptr, ConstraintArena& arena );
+
   // Returns the full contact basis
   void computeBasis( const VectorXs& q, const VectorXs& v, MatrixXXsc& basis ) const;
 
@@ -63,6 +72,10 @@ public:
 
   virtual void computeGeneralizedFrictionGivenTangentSample( const VectorXs& q, const VectorXs& t, const unsigned column, SparseMatrixsc& D ) const;
 
+  // Appends this constraint to a batch of point contacts. Returns false if the constraint must be assembled through
+  // evalgradg, computeGeneralizedFrictionGivenTangentSample, and computeContactBasis instead.
+  virtual bool addToContactBatch( const VectorXs& q, ContactBatch& batch ) const;
+
   // Returns the size of the impact stencil
   virtual int impactStencilSize() const = 0;
 
@@ -0,0 +1,97 @@
+#include "ConstraintArena.h"
+
+#include <algorithm>
+#include <cassert>
+
+// Size of the first block allocated by an arena
+static constexpr std::size_t s_initial_block_size{ 1 << 16 };
+
+ConstraintArena::ConstraintArena()
+: m_blocks()
+, m_current_block( nullptr )
+, m_live_allocations( 0 )
+, m_block_mutex()
+{}
+
+ConstraintArena::~ConstraintArena()
+{
+  assert( m_live_allocations == 0 );
+}
+
+void* ConstraintArena::allocate( const std::size_t size )
+{
+  const std::size_t padded_size{ ( size + alignment - 1 ) / alignment * alignment };
+  while( true )
+  {
+    Block* const block{ m_current_block.load( std::memory_order_acquire ) };
+    if( block != nullptr )
+    {
+      const std::size_t offset{ block->used.fetch_add( padded_size, std::memory_order_relaxed ) };
+      if( offset + padded_size <= block->capacity )
+      {
+        m_live_allocations.fetch_add( 1, std::memory_order_relaxed );
+        return block->begin + offset;
+      }
+    }
+    // The current block is exhausted; unless another thread already replaced it, add a new block
+    std::lock_guard<std::mutex> lock{ m_block_mutex };
+    if( m_current_block.load( std::memory_order_relaxed ) == block )
+    {
+      addBlock( padded_size );
+    }
+  }
+}
+
+void ConstraintArena::release()
+{
+  assert( m_live_allocations > 0 );
+  m_live_allocations.fetch_sub( 1, std::memory_order_relaxed );
+}
+
+void ConstraintArena::reset()
+{
+  if( m_live_allocations != 0 || m_blocks.empty() )
+  {
+    return;
+  }
+  // Replace multiple blocks with a single block large enough to hold everything allocated since the last reset
+  if( m_blocks.size() > 1 )
+  {
+    std::size_t total_capacity{ 0 };
+    for( const std::unique_ptr<Block>& block : m_blocks )
+    {
+      total_capacity += block->capacity;
+    }
+    m_blocks.clear();
+    m_current_block = nullptr;
+    addBlock( total_capacity );
+  }
+  else
+  {
+    m_blocks.front()->used = 0;
+  }
+}
+
+std::size_t ConstraintArena::liveAllocations() const
+{
+  return m_live_allocations;
+}
+
+void ConstraintArena::addBlock( const std::size_t min_capacity )
+{
+  std::size_t capacity{ m_blocks.empty() ? s_initial_block_size : 2 * m_blocks.back()->capacity };
+  capacity = std::max( capacity, min_capacity );
+
+  std::unique_ptr<Block> block{ new Block };
+  // Over-allocate so that the start of the block can be aligned
+  block->data.reset( new unsigned char[ capacity + alignment ] );
+  void* begin{ block->data.get() };
+  std::size_t space{ capacity + alignment };
+  block->begin = static_cast<unsigned char*>( std::align( alignment, capacity, begin, space ) );
+  assert( block->begin != nullptr );
+  block->capacity = capacity;
+  block->used = 0;
+
+  m_blocks.emplace_back( std::move( block ) );
+  m_current_block.store( m_blocks.back().get(), std::memory_order_release );
+}
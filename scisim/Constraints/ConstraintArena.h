@@ -0,0 +1,65 @@
+#ifndef CONSTRAINT_ARENA_H
+#define CONSTRAINT_ARENA_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "scisim/Math/MathDefines.h"
+
+// Step-scoped bump allocator for constraints. Constraints are placement-constructed into the arena with
+// new( arena ) ConstraintType{ ... } and destroyed through the usual std::unique_ptr<Constraint>. Storage
+// is recycled by reset once every constraint allocated from the arena has been destroyed, rather than
+// being returned to the system allocator. Allocation is safe to call concurrently from multiple threads.
+class ConstraintArena final
+{
+
+public:
+
+  // Alignment of every allocation, sufficient for any fixed-size Eigen member
+  static constexpr std::size_t alignment{ alignof(std::max_align_t) > EIGEN_MAX_STATIC_ALIGN_BYTES ? alignof(std::max_align_t) : EIGEN_MAX_STATIC_ALIGN_BYTES };
+
+  ConstraintArena();
+  // Live constraints record the address of their arena, so an arena can be neither copied nor moved
+  ConstraintArena( const ConstraintArena& ) = delete;
+  ConstraintArena( ConstraintArena&& ) = delete;
+  ConstraintArena& operator=( const ConstraintArena& ) = delete;
+  ConstraintArena& operator=( ConstraintArena&& ) = delete;
+  ~ConstraintArena();
+
+  // Returns storage for one object of the given size
+  void* allocate( const std::size_t size );
+
+  // Signals that an object allocated from this arena has been destroyed
+  void release();
+
+  // Rewinds the arena if no allocated objects remain alive, coalescing all storage into a single block.
+  // Must not be called concurrently with allocate.
+  void reset();
+
+  // Number of allocated objects that have not been released
+  std::size_t liveAllocations() const;
+
+private:
+
+  struct Block final
+  {
+    std::unique_ptr<unsigned char[]> data;
+    // Aligned start of the usable storage in data
+    unsigned char* begin;
+    std::size_t capacity;
+    std::atomic<std::size_t> used;
+  };
+
+  void addBlock( const std::size_t min_capacity );
+
+  std::vector<std::unique_ptr<Block>> m_blocks;
+  std::atomic<Block*> m_current_block;
+  std::atomic<std::size_t> m_live_allocations;
+  std::mutex m_block_mutex;
+
+};
+
+#endif
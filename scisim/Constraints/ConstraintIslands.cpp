@@ -0,0 +1,150 @@
+#include "ConstraintIslands.h"
+
+#include <algorithm>
+
+#include "Constraint.h"
+
+ConstraintIslands::ConstraintIslands()
+: m_parents()
+, m_root_islands()
+, m_island_starts( 1, 0 )
+, m_island_constraints()
+{}
+
+void ConstraintIslands::initializeNodes( const unsigned num_nodes )
+{
+  m_parents.resize( num_nodes );
+  for( unsigned node = 0; node < num_nodes; ++node )
+  {
+    m_parents[node] = node;
+  }
+}
+
+unsigned ConstraintIslands::findRoot( unsigned node )
+{
+  assert( node < m_parents.size() );
+  while( m_parents[node] != node )
+  {
+    // Path halving
+    m_parents[node] = m_parents[m_parents[node]];
+    node = m_parents[node];
+  }
+  return node;
+}
+
+void ConstraintIslands::unite( const unsigned node0, const unsigned node1 )
+{
+  const unsigned root0{ findRoot( node0 ) };
+  const unsigned root1{ findRoot( node1 ) };
+  if( root0 != root1 )
+  {
+    m_parents[std::max( root0, root1 )] = std::min( root0, root1 );
+  }
+}
+
+void ConstraintIslands::groupConstraints( const std::vector<unsigned>& constraint_nodes )
+{
+  const unsigned ncons{ unsigned( constraint_nodes.size() ) };
+
+  // Number the islands in order of their first constraint
+  std::vector<unsigned> constraint_islands( ncons );
+  m_root_islands.assign( m_parents.size(), -1 );
+  unsigned num_islands{ 0 };
+  for( unsigned con = 0; con < ncons; ++con )
+  {
+    const unsigned root{ findRoot( constraint_nodes[con] ) };
+    if( m_root_islands[root] == -1 )
+    {
+      m_root_islands[root] = int( num_islands++ );
+    }
+    constraint_islands[con] = unsigned( m_root_islands[root] );
+  }
+
+  // Bucket the constraints by island, preserving their order
+  m_island_starts.assign( num_islands + 1, 0 );
+  for( unsigned con = 0; con < ncons; ++con )
+  {
+    ++m_island_starts[constraint_islands[con] + 1];
+  }
+  for( unsigned island = 0; island < num_islands; ++island )
+  {
+    m_island_starts[island + 1] += m_island_starts[island];
+  }
+  m_island_constraints.resize( ncons );
+  std::vector<unsigned> next_slot{ m_island_starts.begin(), m_island_starts.end() - 1 };
+  for( unsigned con = 0; con < ncons; ++con )
+  {
+    m_island_constraints[next_slot[constraint_islands[con]]++] = con;
+  }
+}
+
+void ConstraintIslands::compute( const std::vector<std::unique_ptr<Constraint>>& active_set )
+{
+  unsigned num_bodies{ 0 };
+  for( const std::unique_ptr<Constraint>& con : active_set )
+  {
+    std::pair<int,int> bodies;
+    con->getSimulatedBodyIndices( bodies );
+    assert( bodies.first >= 0 );
+    num_bodies = std::max( num_bodies, unsigned( std::max( bodies.first, bodies.second ) + 1 ) );
+  }
+  initializeNodes( num_bodies );
+
+  std::vector<unsigned> constraint_nodes( active_set.size() );
+  for( std::vector<std::unique_ptr<Constraint>>::size_type con = 0; con < active_set.size(); ++con )
+  {
+    std::pair<int,int> bodies;
+    active_set[con]->getSimulatedBodyIndices( bodies );
+    if( bodies.second >= 0 )
+    {
+      unite( unsigned( bodies.first ), unsigned( bodies.second ) );
+    }
+    constraint_nodes[con] = unsigned( bodies.first );
+  }
+
+  groupConstraints( constraint_nodes );
+}
+
+void ConstraintIslands::compute( const SparseMatrixsc& N, const SparseMatrixsc& MinvN )
+{
+  assert( N.rows() == MinvN.rows() ); assert( N.cols() == MinvN.cols() );
+  const unsigned ncons{ unsigned( N.cols() ) };
+
+  // Nodes are the rows of N followed by one node per column, so that a column without entries forms its own island
+  initializeNodes( unsigned( N.rows() ) + ncons );
+
+  std::vector<unsigned> constraint_nodes( ncons );
+  for( unsigned con = 0; con < ncons; ++con )
+  {
+    const unsigned con_node{ unsigned( N.rows() ) + con };
+    for( SparseMatrixsc::InnerIterator it{ N, int( con ) }; it; ++it )
+    {
+      unite( con_node, unsigned( it.row() ) );
+    }
+    for( SparseMatrixsc::InnerIterator it{ MinvN, int( con ) }; it; ++it )
+    {
+      unite( con_node, unsigned( it.row() ) );
+    }
+    constraint_nodes[con] = con_node;
+  }
+
+  groupConstraints( constraint_nodes );
+}
+
+unsigned ConstraintIslands::numIslands() const
+{
+  assert( !m_island_starts.empty() );
+  return unsigned( m_island_starts.size() - 1 );
+}
+
+unsigned ConstraintIslands::islandSize( const unsigned island ) const
+{
+  assert( island < numIslands() );
+  return m_island_starts[island + 1] - m_island_starts[island];
+}
+
+const unsigned* ConstraintIslands::islandConstraints( const unsigned island ) const
+{
+  assert( island < numIslands() );
+  return m_island_constraints.data() + m_island_starts[island];
+}
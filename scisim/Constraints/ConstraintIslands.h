@@ -0,0 +1,55 @@
+#ifndef CONSTRAINT_ISLANDS_H
+#define CONSTRAINT_ISLANDS_H
+
+#include <memory>
+#include <vector>
+
+#include "scisim/Math/MathDefines.h"
+
+class Constraint;
+
+// Partitions a set of constraints into islands, the connected components of the graph whose edges are constraints,
+// so that each island can be solved independently. Islands are ordered by their first constraint and the constraints
+// of an island are in increasing order, so the partition does not depend on how islands are later scheduled.
+class ConstraintIslands final
+{
+
+public:
+
+  ConstraintIslands();
+
+  // Islands over simulated bodies. Static geometry and kinematic bodies are not simulated, so constraints against
+  // them do not join islands.
+  void compute( const std::vector<std::unique_ptr<Constraint>>& active_set );
+
+  // Islands over the columns of N, where two columns are coupled if they share a row of N or of M^-1 N
+  void compute( const SparseMatrixsc& N, const SparseMatrixsc& MinvN );
+
+  unsigned numIslands() const;
+
+  // Number of constraints in an island
+  unsigned islandSize( const unsigned island ) const;
+
+  // Indices of the constraints in an island
+  const unsigned* islandConstraints( const unsigned island ) const;
+
+private:
+
+  void initializeNodes( const unsigned num_nodes );
+  unsigned findRoot( unsigned node );
+  void unite( const unsigned node0, const unsigned node1 );
+  // Groups constraints by the root of their first node
+  void groupConstraints( const std::vector<unsigned>& constraint_nodes );
+
+  // Union-find forest over the graph nodes
+  std::vector<unsigned> m_parents;
+  // Island of each root node, or -1 if not yet assigned
+  std::vector<int> m_root_islands;
+
+  // The constraints of island i are m_island_constraints[m_island_starts[i], m_island_starts[i + 1])
+  std::vector<unsigned> m_island_starts;
+  std::vector<unsigned> m_island_constraints;
+
+};
+
+#endif
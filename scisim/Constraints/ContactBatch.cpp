@@ -0,0 +1,375 @@
+#include "ContactBatch.h"
+
+#include <algorithm>
+
+#include "Constraint.h"
+#include "FrictionUtilities.h"
+#include "scisim/Math/MathUtilities.h"
+
+// Number of rotational degrees of freedom of a rigid body in the given ambient dimension
+static constexpr int rotationalDoFs( const int dimension )
+{
+  return dimension == 2 ? 1 : 3;
+}
+
+// Largest number of entries in a Jacobian column: two bodies with translational and rotational degrees of freedom
+static constexpr int s_max_column_entries{ 2 * ( 3 + rotationalDoFs( 3 ) ) };
+
+static void leverArmCross( const Eigen::Map<const Vector2s>& r, const Vector2s& d, scalar* torque )
+{
+  torque[0] = MathUtilities::cross( r, d );
+}
+
+static void leverArmCross( const Eigen::Map<const Vector3s>& r, const Vector3s& d, scalar* torque )
+{
+  Eigen::Map<Vector3s>{ torque } = r.cross( d );
+}
+
+// Innermost shared batch of each thread
+static thread_local ScopedContactBatch* t_current_scope{ nullptr };
+
+template<int DIM>
+static int columnSize( const int* rows, const bool rotational )
+{
+  int size{ 0 };
+  for( int body = 0; body < 2; ++body )
+  {
+    if( rows[2 * body] >= 0 )
+    {
+      size += rotational ? DIM + rotationalDoFs( DIM ) : DIM;
+    }
+  }
+  return size;
+}
+
+// Computes the entries of one Jacobian column, sorted by row
+template<int DIM>
+static int gatherColumn( const int* rows, const scalar* r0, const scalar* r1, const Eigen::Matrix<scalar,DIM,1>& direction, const bool rotational, SparseMatrixsc::StorageIndex* entry_rows, scalar* entry_values )
+{
+  int num_entries{ 0 };
+  for( int body = 0; body < 2; ++body )
+  {
+    const int translation_row{ rows[2 * body] };
+    if( translation_row < 0 )
+    {
+      continue;
+    }
+    const scalar sign{ body == 0 ? 1.0 : -1.0 };
+    for( int dim = 0; dim < DIM; ++dim )
+    {
+      entry_rows[num_entries] = translation_row + dim;
+      entry_values[num_entries] = sign * direction( dim );
+      ++num_entries;
+    }
+    if( rotational )
+    {
+      const int rotation_row{ rows[2 * body + 1] };
+      assert( rotation_row >= 0 );
+      scalar torque[rotationalDoFs( DIM )];
+      leverArmCross( Eigen::Map<const Eigen::Matrix<scalar,DIM,1>>{ body == 0 ? r0 : r1 }, direction, torque );
+      for( int dof = 0; dof < rotationalDoFs( DIM ); ++dof )
+      {
+        entry_rows[num_entries] = rotation_row + dof;
+        entry_values[num_entries] = sign * torque[dof];
+        ++num_entries;
+      }
+    }
+  }
+  // Insertion sort, as columns hold at most a dozen entries
+  for( int entry = 1; entry < num_entries; ++entry )
+  {
+    const SparseMatrixsc::StorageIndex row{ entry_rows[entry] };
+    const scalar value{ entry_values[entry] };
+    int position{ entry };
+    while( position > 0 && entry_rows[position - 1] > row )
+    {
+      entry_rows[position] = entry_rows[position - 1];
+      entry_values[position] = entry_values[position - 1];
+      --position;
+    }
+    entry_rows[position] = row;
+    entry_values[position] = value;
+  }
+  return num_entries;
+}
+
+ContactBatch::ContactBatch()
+: m_dimension( 0 )
+, m_num_contacts( 0 )
+, m_groups()
+{}
+
+bool ContactBatch::build( const VectorXs& q, const std::vector<std::unique_ptr<Constraint>>& active_set )
+{
+  clear();
+  for( const std::unique_ptr<Constraint>& constraint : active_set )
+  {
+    if( !constraint->addToContactBatch( q, *this ) )
+    {
+      clear();
+      return false;
+    }
+  }
+  assert( m_num_contacts == active_set.size() );
+  return true;
+}
+
+const ContactBatch* ContactBatch::acquire( const VectorXs& q, const std::vector<std::unique_ptr<Constraint>>& active_set, ContactBatch& batch )
+{
+  for( ScopedContactBatch* scope = t_current_scope; scope != nullptr; scope = scope->m_parent )
+  {
+    if( &scope->m_q == &q && &scope->m_active_set == &active_set )
+    {
+      if( !scope->m_built )
+      {
+        scope->m_batched = scope->m_batch.build( q, active_set );
+        scope->m_built = true;
+      }
+      assert( !scope->m_batched || scope->m_batch.numContacts() == active_set.size() );
+      return scope->m_batched ? &scope->m_batch : nullptr;
+    }
+  }
+  return batch.build( q, active_set ) ? &batch : nullptr;
+}
+
+void ContactBatch::clear()
+{
+  m_dimension = 0;
+  m_num_contacts = 0;
+  for( Group& group : m_groups )
+  {
+    group.columns.clear();
+    group.rows.clear();
+    group.normals.clear();
+    group.lever_arms0.clear();
+    group.lever_arms1.clear();
+    group.kinematic_velocities.clear();
+  }
+}
+
+void ContactBatch::addContact( const Kind kind, const int translation_row0, const int rotation_row0, const Vector2s& r0, const int translation_row1, const int rotation_row1, const Vector2s& r1, const Vector2s& n, const Vector2s& kinematic_velocity )
+{
+  addContact<2>( kind, translation_row0, rotation_row0, r0, translation_row1, rotation_row1, r1, n, kinematic_velocity );
+}
+
+void ContactBatch::addContact( const Kind kind, const int translation_row0, const int rotation_row0, const Vector3s& r0, const int translation_row1, const int rotation_row1, const Vector3s& r1, const Vector3s& n, const Vector3s& kinematic_velocity )
+{
+  addContact<3>( kind, translation_row0, rotation_row0, r0, translation_row1, rotation_row1, r1, n, kinematic_velocity );
+}
+
+template<int DIM>
+void ContactBatch::addContact( const Kind kind, const int translation_row0, const int rotation_row0, const Eigen::Matrix<scalar,DIM,1>& r0, const int translation_row1, const int rotation_row1, const Eigen::Matrix<scalar,DIM,1>& r1, const Eigen::Matrix<scalar,DIM,1>& n, const Eigen::Matrix<scalar,DIM,1>& kinematic_velocity )
+{
+  assert( m_dimension == 0 || m_dimension == DIM );
+  assert( translation_row0 >= 0 || translation_row1 >= 0 );
+  assert( fabs( n.norm() - 1.0 ) <= 1.0e-6 );
+  m_dimension = DIM;
+
+  Group& group{ m_groups[ static_cast<unsigned>( kind ) ] };
+  group.columns.emplace_back( m_num_contacts++ );
+  group.rows.insert( group.rows.end(), { translation_row0, rotation_row0, translation_row1, rotation_row1 } );
+  group.normals.insert( group.normals.end(), n.data(), n.data() + DIM );
+  group.lever_arms0.insert( group.lever_arms0.end(), r0.data(), r0.data() + DIM );
+  group.lever_arms1.insert( group.lever_arms1.end(), r1.data(), r1.data() + DIM );
+  group.kinematic_velocities.insert( group.kinematic_velocities.end(), kinematic_velocity.data(), kinematic_velocity.data() + DIM );
+}
+
+unsigned ContactBatch::numContacts() const
+{
+  return m_num_contacts;
+}
+
+template<int DIM, typename Function>
+void ContactBatch::assembleJacobian( const unsigned ndofs, const unsigned directions_per_contact, const std::array<bool,3>& rotational, Function direction, SparseMatrixsc& J ) const
+{
+  const unsigned ncols{ directions_per_contact * m_num_contacts };
+  J.resize( ndofs, ncols );
+  if( ncols == 0 )
+  {
+    return;
+  }
+  assert( J.isCompressed() );
+
+  // Count the entries in each column and convert the counts to offsets
+  SparseMatrixsc::StorageIndex* const outer{ J.outerIndexPtr() };
+  outer[0] = 0;
+  for( unsigned kind = 0; kind < m_groups.size(); ++kind )
+  {
+    const Group& group{ m_groups[kind] };
+    for( std::vector<unsigned>::size_type contact = 0; contact < group.columns.size(); ++contact )
+    {
+      const int column_size{ columnSize<DIM>( &group.rows[4 * contact], rotational[kind] ) };
+      for( unsigned sample = 0; sample < directions_per_contact; ++sample )
+      {
+        outer[ directions_per_contact * group.columns[contact] + sample + 1 ] = column_size;
+      }
+    }
+  }
+  for( unsigned col = 0; col < ncols; ++col )
+  {
+    outer[col + 1] += outer[col];
+  }
+  J.resizeNonZeros( outer[ncols] );
+
+  // Fill the columns of each group with a kernel specialized to the group's Jacobian shape
+  SparseMatrixsc::StorageIndex* const inner{ J.innerIndexPtr() };
+  scalar* const values{ J.valuePtr() };
+  for( unsigned kind = 0; kind < m_groups.size(); ++kind )
+  {
+    const Group& group{ m_groups[kind] };
+    for( std::vector<unsigned>::size_type contact = 0; contact < group.columns.size(); ++contact )
+    {
+      for( unsigned sample = 0; sample < directions_per_contact; ++sample )
+      {
+        const unsigned col{ directions_per_contact * group.columns[contact] + sample };
+        SparseMatrixsc::StorageIndex entry_rows[s_max_column_entries];
+        scalar entry_values[s_max_column_entries];
+        const int num_entries{ gatherColumn<DIM>( &group.rows[4 * contact], &group.lever_arms0[DIM * contact], &group.lever_arms1[DIM * contact], direction( group, contact, sample ), rotational[kind], entry_rows, entry_values ) };
+        assert( num_entries == outer[col + 1] - outer[col] );
+        std::copy( entry_rows, entry_rows + num_entries, inner + outer[col] );
+        std::copy( entry_values, entry_values + num_entries, values + outer[col] );
+      }
+    }
+  }
+
+  // Drop entries that vanish, for example along axis aligned normals
+  J.prune( []( const Eigen::Index& row, const Eigen::Index& col, const scalar& value ) { return value != 0.0; } );
+  assert( J.innerNonZeroPtr() == nullptr );
+}
+
+void ContactBatch::computeN( const unsigned ndofs, SparseMatrixsc& N ) const
+{
+  // Normal impulses at contacts between spheres exert no torque
+  const std::array<bool,3> rotational{ { false, false, true } };
+  if( m_dimension == 2 )
+  {
+    assembleJacobian<2>( ndofs, 1, rotational, []( const Group& group, const std::vector<unsigned>::size_type contact, const unsigned ) { return Eigen::Map<const Vector2s>{ &group.normals[2 * contact] }; }, N );
+  }
+  else
+  {
+    assembleJacobian<3>( ndofs, 1, rotational, []( const Group& group, const std::vector<unsigned>::size_type contact, const unsigned ) { return Eigen::Map<const Vector3s>{ &group.normals[3 * contact] }; }, N );
+  }
+}
+
+void ContactBatch::computeD( const unsigned ndofs, const MatrixXXsc& contact_bases, SparseMatrixsc& D ) const
+{
+  assert( m_num_contacts == 0 || contact_bases.rows() == m_dimension );
+  assert( contact_bases.cols() == contact_bases.rows() * m_num_contacts );
+  const std::array<bool,3> rotational{ { false, true, true } };
+  if( m_dimension == 2 )
+  {
+    assembleJacobian<2>( ndofs, 1, rotational, [&contact_bases]( const Group& group, const std::vector<unsigned>::size_type contact, const unsigned sample ) { return Vector2s{ contact_bases.col( 2 * group.columns[contact] + sample + 1 ) }; }, D );
+  }
+  else
+  {
+    assembleJacobian<3>( ndofs, 2, rotational, [&contact_bases]( const Group& group, const std::vector<unsigned>::size_type contact, const unsigned sample ) { return Vector3s{ contact_bases.col( 3 * group.columns[contact] + sample + 1 ) }; }, D );
+  }
+}
+
+void ContactBatch::computeImpactBases( MatrixXXsc& impact_bases ) const
+{
+  assert( m_dimension != 0 );
+  impact_bases.resize( m_dimension, m_num_contacts );
+  for( const Group& group : m_groups )
+  {
+    for( std::vector<unsigned>::size_type contact = 0; contact < group.columns.size(); ++contact )
+    {
+      impact_bases.col( group.columns[contact] ) = Eigen::Map<const VectorXs>{ &group.normals[m_dimension * contact], m_dimension };
+    }
+  }
+}
+
+void ContactBatch::computeContactBases( const VectorXs& v, MatrixXXsc& contact_bases ) const
+{
+  assert( m_dimension != 0 );
+  contact_bases.resize( m_dimension, m_dimension * m_num_contacts );
+
+  // In 2D the basis is fixed by the normal
+  if( m_dimension == 2 )
+  {
+    for( const Group& group : m_groups )
+    {
+      for( std::vector<unsigned>::size_type contact = 0; contact < group.columns.size(); ++contact )
+      {
+        const Eigen::Map<const Vector2s> n{ &group.normals[2 * contact] };
+        contact_bases.block<2,2>( 0, 2 * group.columns[contact] ) << n.x(), -n.y(), n.y(), n.x();
+      }
+    }
+    return;
+  }
+
+  // In 3D the first tangent opposes the relative velocity at the contact
+  for( unsigned kind = 0; kind < m_groups.size(); ++kind )
+  {
+    const Group& group{ m_groups[kind] };
+    const bool rotational{ static_cast<Kind>( kind ) != Kind::Particle };
+    for( std::vector<unsigned>::size_type contact = 0; contact < group.columns.size(); ++contact )
+    {
+      const int* const rows{ &group.rows[4 * contact] };
+      const Eigen::Map<const Vector3s> n{ &group.normals[3 * contact] };
+
+      // v_0 + omega_0 x r_0 - ( v_1 + omega_1 x r_1 ) - v_kinematic
+      Vector3s s{ - Eigen::Map<const Vector3s>{ &group.kinematic_velocities[3 * contact] } };
+      for( int body = 0; body < 2; ++body )
+      {
+        if( rows[2 * body] < 0 )
+        {
+          continue;
+        }
+        assert( rows[2 * body] + 2 < v.size() );
+        Vector3s point_velocity{ v.segment<3>( rows[2 * body] ) };
+        if( rotational )
+        {
+          assert( rows[2 * body + 1] + 2 < v.size() );
+          point_velocity += v.segment<3>( rows[2 * body + 1] ).cross( Eigen::Map<const Vector3s>{ body == 0 ? &group.lever_arms0[3 * contact] : &group.lever_arms1[3 * contact] } );
+        }
+        if( body == 0 )
+        {
+          s += point_velocity;
+        }
+        else
+        {
+          s -= point_velocity;
+        }
+      }
+
+      // If the relative velocity is zero, any vector will do
+      if( n.cross( s ).squaredNorm() < 1.0e-9 )
+      {
+        s = FrictionUtilities::orthogonalVector( n );
+      }
+      // Otherwise project out the component along the normal and normalize the relative velocity
+      else
+      {
+        s = ( s - s.dot( n ) * n ).normalized();
+      }
+      // Invert the tangent vector in order to oppose
+      s *= -1.0;
+
+      // Create a second orthogonal sample in the tangent plane
+      const Vector3s t{ n.cross( s ).normalized() };
+
+      assert( MathUtilities::isRightHandedOrthoNormal( n, s, t, 1.0e-6 ) );
+      contact_bases.col( 3 * group.columns[contact] ) = n;
+      contact_bases.col( 3 * group.columns[contact] + 1 ) = s;
+      contact_bases.col( 3 * group.columns[contact] + 2 ) = t;
+    }
+  }
+}
+
+ScopedContactBatch::ScopedContactBatch( const VectorXs& q, const std::vector<std::unique_ptr<Constraint>>& active_set )
+: m_q( q )
+, m_active_set( active_set )
+, m_parent( t_current_scope )
+, m_batch()
+, m_built( false )
+, m_batched( false )
+{
+  t_current_scope = this;
+}
+
+ScopedContactBatch::~ScopedContactBatch()
+{
+  assert( t_current_scope == this );
+  t_current_scope = m_parent;
+}
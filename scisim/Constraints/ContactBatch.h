@@ -0,0 +1,124 @@
+#ifndef CONTACT_BATCH_H
+#define CONTACT_BATCH_H
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "scisim/Math/MathDefines.h"
+
+class Constraint;
+
+// Structure of arrays description of the point contacts in an active set. Contacts are grouped by the shape of
+// their Jacobians and each group is assembled into N, D, and the contact bases by a dedicated kernel, without
+// virtual dispatch or per-contact allocation. Constraints that can not be described as point contacts are
+// assembled through the virtual Constraint interface instead.
+class ContactBatch final
+{
+
+public:
+
+  // Shape of the Jacobian of a contact
+  enum class Kind : unsigned
+  {
+    // Contact between particles, which have no rotational degrees of freedom
+    Particle = 0,
+    // Contact between round bodies; lever arms are parallel to the normal, so normal impulses exert no torque
+    Sphere = 1,
+    // Contact between arbitrary rigid bodies
+    Body = 2
+  };
+
+  ContactBatch();
+
+  // Rebuilds the batch from an active set. Returns false, leaving the batch empty, if any constraint does not support batching.
+  bool build( const VectorXs& q, const std::vector<std::unique_ptr<Constraint>>& active_set );
+
+  // The batch of an active set: that of the innermost ScopedContactBatch of this thread over the same q and active
+  // set, built on first use, or otherwise batch rebuilt from them. Returns nullptr if the active set can not be
+  // batched.
+  static const ContactBatch* acquire( const VectorXs& q, const std::vector<std::unique_ptr<Constraint>>& active_set, ContactBatch& batch );
+
+  void clear();
+
+  // Appends a contact as the next column of the batch. Rows index the first translational and rotational degree
+  // of freedom of each body; a body that is not simulated, such as static geometry, has a translational row of -1.
+  // Lever arms run from each body's center of mass to the contact point. The kinematic velocity is the velocity of
+  // the contact point due to scripted motion of the second body.
+  void addContact( const Kind kind, const int translation_row0, const int rotation_row0, const Vector2s& r0, const int translation_row1, const int rotation_row1, const Vector2s& r1, const Vector2s& n, const Vector2s& kinematic_velocity );
+  void addContact( const Kind kind, const int translation_row0, const int rotation_row0, const Vector3s& r0, const int translation_row1, const int rotation_row1, const Vector3s& r1, const Vector3s& n, const Vector3s& kinematic_velocity );
+
+  unsigned numContacts() const;
+
+  // Equivalent to ImpactOperatorUtilities::computeN
+  void computeN( const unsigned ndofs, SparseMatrixsc& N ) const;
+
+  // Equivalent to ConstrainedSystem::computeImpactBases
+  void computeImpactBases( MatrixXXsc& impact_bases ) const;
+
+  // Equivalent to ConstrainedSystem::computeContactBases
+  void computeContactBases( const VectorXs& v, MatrixXXsc& contact_bases ) const;
+
+  // Equivalent to FrictionOperator::formGeneralizedSmoothFrictionBasis
+  void computeD( const unsigned ndofs, const MatrixXXsc& contact_bases, SparseMatrixsc& D ) const;
+
+private:
+
+  // Contacts that share a Kind
+  struct Group final
+  {
+    // Column of each contact
+    std::vector<unsigned> columns;
+    // Translational and rotational rows of both bodies, 4 entries per contact
+    std::vector<int> rows;
+    // Ambient dimension entries per contact
+    std::vector<scalar> normals;
+    std::vector<scalar> lever_arms0;
+    std::vector<scalar> lever_arms1;
+    std::vector<scalar> kinematic_velocities;
+  };
+
+  template<int DIM>
+  void addContact( const Kind kind, const int translation_row0, const int rotation_row0, const Eigen::Matrix<scalar,DIM,1>& r0, const int translation_row1, const int rotation_row1, const Eigen::Matrix<scalar,DIM,1>& r1, const Eigen::Matrix<scalar,DIM,1>& n, const Eigen::Matrix<scalar,DIM,1>& kinematic_velocity );
+
+  // Assembles a Jacobian with directions_per_contact columns per contact, where the directions are supplied by a
+  // function of the group, the contact's position within the group, and the direction's index
+  template<int DIM, typename Function>
+  void assembleJacobian( const unsigned ndofs, const unsigned directions_per_contact, const std::array<bool,3>& rotational, Function direction, SparseMatrixsc& J ) const;
+
+  // 2 or 3, or 0 for an empty batch
+  unsigned m_dimension;
+  unsigned m_num_contacts;
+  std::array<Group,3> m_groups;
+
+};
+
+// Shares the batch of an active set among the assemblies of one step, so that N, D, and the contact bases are
+// assembled from contacts gathered once. While alive, ContactBatch::acquire on this thread of the same q and active
+// set returns its batch. Neither q nor the active set may change during the scope.
+class ScopedContactBatch final
+{
+
+public:
+
+  ScopedContactBatch( const VectorXs& q, const std::vector<std::unique_ptr<Constraint>>& active_set );
+  ~ScopedContactBatch();
+
+  ScopedContactBatch( const ScopedContactBatch& ) = delete;
+  ScopedContactBatch& operator=( const ScopedContactBatch& ) = delete;
+
+private:
+
+  friend class ContactBatch;
+
+  const VectorXs& m_q;
+  const std::vector<std::unique_ptr<Constraint>>& m_active_set;
+  // Scope enclosing this one on this thread, if any
+  ScopedContactBatch* const m_parent;
+  ContactBatch m_batch;
+  bool m_built;
+  bool m_batched;
+
+};
+
+#endif
@@ -6,18 +6,25 @@
 #include "HDF5File.h"
 
 #include <cassert>
+#include <vector>
 
 using HDFGID = HDFID<H5Gclose>;
 using HDFTID = HDFID<H5Tclose>;
 using HDFSID = HDFID<H5Sclose>;
 using HDFDID = HDFID<H5Dclose>;
+using HDFPID = HDFID<H5Pclose>;
+
+// Size by which the memory of an in-memory file grows
+static constexpr std::size_t s_in_memory_increment{ 1 << 20 };
 
 HDF5File::HDF5File()
 : m_hdf_file_id( -1 )
+, m_float_precision( HDF5FloatPrecision::DOUBLE )
 {}
 
 HDF5File::HDF5File( const std::string& file_name, const HDF5AccessType& access_type )
 : m_hdf_file_id( -1 )
+, m_float_precision( HDF5FloatPrecision::DOUBLE )
 {
   open( file_name, access_type );
 }
@@ -32,6 +39,7 @@ HDF5File::~HDF5File()
 
 HDF5File::HDF5File( HDF5File&& other )
 : m_hdf_file_id( other.m_hdf_file_id )
+, m_float_precision( other.m_float_precision )
 {
   other.m_hdf_file_id = -1;
 }
@@ -40,6 +48,7 @@ HDF5File& HDF5File::operator=( HDF5File&& other )
 {
   using std::swap;
   swap( other.m_hdf_file_id, m_hdf_file_id );
+  swap( other.m_float_precision, m_float_precision );
   return *this;
 }
 
@@ -54,6 +63,19 @@ void HDF5File::open( const std::string& file_name, const HDF5AccessType& access_
     case HDF5AccessType::READ_ONLY:
       m_hdf_file_id = H5Fopen( file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
       break;
+    case HDF5AccessType::READ_WRITE_EXISTING:
+      m_hdf_file_id = H5Fopen( file_name.c_str(), H5F_ACC_RDWR, H5P_DEFAULT );
+      break;
+    case HDF5AccessType::IN_MEMORY:
+    {
+      const HDFPID access_properties{ H5Pcreate( H5P_FILE_ACCESS ) };
+      if( access_properties < 0 || H5Pset_fapl_core( access_properties, s_in_memory_increment, 0 ) < 0 )
+      {
+        throw std::string{ "Failed to create in-memory file access properties for: " } + file_name;
+      }
+      m_hdf_file_id = H5Fcreate( file_name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, access_properties );
+      break;
+    }
   }
   // Check that the file successfully opened
   if( m_hdf_file_id < 0 )
@@ -67,6 +89,133 @@ bool HDF5File::is_open() const
   return m_hdf_file_id >= 0;
 }
 
+void HDF5File::flush() const
+{
+  assert( m_hdf_file_id >= 0 );
+  if( H5Fflush( m_hdf_file_id, H5F_SCOPE_LOCAL ) < 0 )
+  {
+    throw std::string{ "Failed to flush HDF file" };
+  }
+}
+
+std::string HDF5File::image() const
+{
+  flush();
+  const ssize_t image_size{ H5Fget_file_image( m_hdf_file_id, nullptr, 0 ) };
+  if( image_size < 0 )
+  {
+    throw std::string{ "Failed to get size of HDF file image" };
+  }
+  std::string file_image( std::string::size_type( image_size ), '\0' );
+  if( image_size > 0 && H5Fget_file_image( m_hdf_file_id, &file_image[0], std::size_t( image_size ) ) != image_size )
+  {
+    throw std::string{ "Failed to get HDF file image" };
+  }
+  return file_image;
+}
+
+void HDF5File::setFloatPrecision( const HDF5FloatPrecision precision )
+{
+  m_float_precision = precision;
+}
+
+HDF5FloatPrecision HDF5File::floatPrecision() const
+{
+  return m_float_precision;
+}
+
+std::string HDF5File::floatPrecisionName( const HDF5FloatPrecision precision )
+{
+  return precision == HDF5FloatPrecision::SINGLE ? "single" : "double";
+}
+
+// Returns a new type equal to type with double precision floating point data replaced by single precision data
+static HDFTID createNarrowedType( const hid_t type )
+{
+  switch( H5Tget_class( type ) )
+  {
+    case H5T_FLOAT:
+    {
+      return HDFTID{ H5Tcopy( H5Tget_size( type ) > sizeof( float ) ? H5T_NATIVE_FLOAT : type ) };
+    }
+    case H5T_ARRAY:
+    {
+      const HDFTID base_type{ H5Tget_super( type ) };
+      const int rank{ H5Tget_array_ndims( type ) };
+      if( base_type < 0 || rank < 0 )
+      {
+        throw std::string{ "Failed to query HDF array type" };
+      }
+      std::vector<hsize_t> dims( static_cast<std::vector<hsize_t>::size_type>( rank ) );
+      if( H5Tget_array_dims2( type, dims.data() ) < 0 )
+      {
+        throw std::string{ "Failed to query HDF array dimensions" };
+      }
+      const HDFTID narrowed_base_type{ createNarrowedType( base_type ) };
+      return HDFTID{ H5Tarray_create2( narrowed_base_type, unsigned( rank ), dims.data() ) };
+    }
+    case H5T_COMPOUND:
+    {
+      const int member_count{ H5Tget_nmembers( type ) };
+      if( member_count < 0 )
+      {
+        throw std::string{ "Failed to query HDF compound type" };
+      }
+      // Members are packed in order, as the narrowed members no longer fit the offsets of the memory layout
+      std::vector<HDFTID> member_types;
+      std::size_t compound_size{ 0 };
+      for( int member = 0; member < member_count; ++member )
+      {
+        const HDFTID member_type{ H5Tget_member_type( type, unsigned( member ) ) };
+        if( member_type < 0 )
+        {
+          throw std::string{ "Failed to query HDF compound member type" };
+        }
+        member_types.emplace_back( createNarrowedType( member_type ) );
+        compound_size += H5Tget_size( member_types.back() );
+      }
+      HDFTID compound_type{ H5Tcreate( H5T_COMPOUND, compound_size ) };
+      if( compound_type < 0 )
+      {
+        throw std::string{ "Failed to create HDF compound type" };
+      }
+      std::size_t offset{ 0 };
+      for( int member = 0; member < member_count; ++member )
+      {
+        char* const member_name{ H5Tget_member_name( type, unsigned( member ) ) };
+        const herr_t insert_status{ H5Tinsert( compound_type, member_name, offset, member_types[member] ) };
+        H5free_memory( member_name );
+        if( insert_status < 0 )
+        {
+          throw std::string{ "Failed to insert member in HDF compound type" };
+        }
+        offset += H5Tget_size( member_types[member] );
+      }
+      return compound_type;
+    }
+    default:
+    {
+      return HDFTID{ H5Tcopy( type ) };
+    }
+  }
+}
+
+HDFID<H5Tclose> HDF5File::storageType( const hid_t memory_type ) const
+{
+  HDFTID storage_type{ m_float_precision == HDF5FloatPrecision::SINGLE ? createNarrowedType( memory_type ) : HDFTID{ H5Tcopy( memory_type ) } };
+  if( storage_type < 0 )
+  {
+    throw std::string{ "Failed to create HDF storage type" };
+  }
+  return storage_type;
+}
+
+std::mutex& HDF5File::libraryMutex()
+{
+  static std::mutex library_mutex;
+  return library_mutex;
+}
+
 void HDF5File::write( const std::string& full_name, const std::string& string_variable ) const
 {
   const auto split_name = splitFullName( full_name );
@@ -12,6 +12,7 @@
 #ifndef HDF5_FILE_H
 #define HDF5_FILE_H
 
+#include <mutex>
 #include <string>
 #include <Eigen/Core>
 #include <Eigen/Sparse>
@@ -110,7 +111,19 @@ namespace HDF5SupportedTypes
 enum class HDF5AccessType
 {
   READ_ONLY,
-  READ_WRITE
+  // Creates the file, truncating any existing file
+  READ_WRITE,
+  // Opens an existing file for reading and writing
+  READ_WRITE_EXISTING,
+  // Creates the file in memory only; its contents are retrieved with image()
+  IN_MEMORY
+};
+
+// Precision at which floating point data are stored in a file
+enum class HDF5FloatPrecision
+{
+  DOUBLE,
+  SINGLE
 };
 
 class HDF5File final
@@ -130,10 +143,39 @@ public:
 
   bool is_open() const;
 
+  // Writes buffered data to disk, so the file is readable while it remains open
+  void flush() const;
+
+  // Returns the bytes of the file as they would appear on disk
+  std::string image() const;
+
+  // Floating point data written after this call are stored at the given precision, converting from the precision of
+  // the data in memory as needed; the default is double
+  void setFloatPrecision( const HDF5FloatPrecision precision );
+
+  HDF5FloatPrecision floatPrecision() const;
+
+  static std::string floatPrecisionName( const HDF5FloatPrecision precision );
+
+  // Returns the type that stores data of the given memory type in this file, narrowing double to single precision
+  // floating point data, including members of arrays and compound types, if requested
+  HDFID<H5Tclose> storageType( const hid_t memory_type ) const;
+
+  // The HDF5 library is not thread safe by default, so threads that share it serialize their calls through this mutex
+  static std::mutex& libraryMutex();
+
   HDFID<H5Gclose> findOrCreateGroup( const std::string& group_name ) const;
 
   HDFID<H5Gclose> findGroup( const std::string& group_name ) const;
 
+  template<typename ScalarType>
+  static constexpr hid_t computeHDFType()
+  {
+    using std::is_same;
+    static_assert( is_same<ScalarType,double>::value || is_same<ScalarType,float>::value || is_same<ScalarType,int>::value || is_same<ScalarType,unsigned>::value || is_same<ScalarType,long>::value, "Error, unsupported HDF5 type encountered." );
+    return is_same<ScalarType,double>::value ? H5T_NATIVE_DOUBLE : is_same<ScalarType,float>::value ? H5T_NATIVE_FLOAT : is_same<ScalarType,int>::value ? H5T_NATIVE_INT : is_same<ScalarType,unsigned>::value ? H5T_NATIVE_UINT : is_same<ScalarType,long>::value ? H5T_NATIVE_LONG : -1;
+  }
+
   void write( const std::string& full_name, const std::string& string_variable ) const;
 
   template<typename Scalar>
@@ -169,7 +211,8 @@ public:
     // Open the requested group
     const HDFGID grp_id{ findOrCreateGroup( split_name.first ) };
 
-    const HDFDID dataset_id{ H5Dcreate2( grp_id, split_name.second.c_str(), computeHDFType<Scalar>(), dataspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
+    const HDFID<H5Tclose> storage_type{ storageType( computeHDFType<Scalar>() ) };
+    const HDFDID dataset_id{ H5Dcreate2( grp_id, split_name.second.c_str(), storage_type, dataspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
     if( dataset_id < 0 )
     {
       throw std::string{ "Failed to create HDF data set" };
@@ -215,7 +258,8 @@ public:
     // Open the requested group
     const HDFGID grp_id{ findOrCreateGroup( split_name.first ) };
 
-    const HDFDID dataset_id{ H5Dcreate2( grp_id, split_name.second.c_str(), computeHDFType<Scalar>(), dataspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
+    const HDFID<H5Tclose> storage_type{ storageType( computeHDFType<Scalar>() ) };
+    const HDFDID dataset_id{ H5Dcreate2( grp_id, split_name.second.c_str(), storage_type, dataspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) };
     if( dataset_id < 0 )
     {
       throw std::string{ "Failed to create HDF data set" };
@@ -467,14 +511,6 @@ private:
     return dimensions;
   }
 
-  template<typename ScalarType>
-  static constexpr hid_t computeHDFType()
-  {
-    using std::is_same;
-    static_assert( is_same<ScalarType,double>::value || is_same<ScalarType,float>::value || is_same<ScalarType,int>::value || is_same<ScalarType,unsigned>::value || is_same<ScalarType,long>::value, "Error, unsupported HDF5 type encountered." );
-    return is_same<ScalarType,double>::value ? H5T_NATIVE_DOUBLE : is_same<ScalarType,float>::value ? H5T_NATIVE_FLOAT : is_same<ScalarType,int>::value ? H5T_NATIVE_INT : is_same<ScalarType,unsigned>::value ? H5T_NATIVE_UINT : is_same<ScalarType,long>::value ? H5T_NATIVE_LONG : -1;
-  }
-
   template<typename Derived>
   static constexpr bool isColumnMajor()
   {
@@ -510,6 +546,7 @@ private:
   }
 
   hid_t m_hdf_file_id;
+  HDF5FloatPrecision m_float_precision;
 
 };
 
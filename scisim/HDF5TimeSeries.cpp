@@ -0,0 +1,247 @@
+#include "HDF5TimeSeries.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+
+using HDFGID = HDFID<H5Gclose>;
+using HDFSID = HDFID<H5Sclose>;
+using HDFDID = HDFID<H5Dclose>;
+using HDFPID = HDFID<H5Pclose>;
+
+// Minimum number of elements in a chunk; frames larger than this get one chunk each
+static constexpr hsize_t s_min_chunk_size{ 16384 };
+
+static const std::string s_shape_suffix{ "_shape" };
+
+HDF5TimeSeries::HDF5TimeSeries()
+: m_file()
+, m_compression_level( 0 )
+, m_num_frames( 0 )
+, m_defer_appends( false )
+, m_pending_frame()
+{}
+
+void HDF5TimeSeries::open( const std::string& file_name, const unsigned compression_level, const bool resume, const unsigned num_frames, const HDF5FloatPrecision precision )
+{
+  if( compression_level > 9 )
+  {
+    throw std::string{ "Invalid HDF5 compression level, must be between 0 and 9" };
+  }
+  m_compression_level = compression_level;
+  m_num_frames = 0;
+
+  if( resume && num_frames > 0 && std::ifstream{ file_name }.good() )
+  {
+    m_file.open( file_name, HDF5AccessType::READ_WRITE_EXISTING );
+    truncate( num_frames );
+  }
+  else
+  {
+    m_file.open( file_name, HDF5AccessType::READ_WRITE );
+  }
+  m_file.setFloatPrecision( precision );
+}
+
+bool HDF5TimeSeries::is_open() const
+{
+  return m_file.is_open();
+}
+
+unsigned HDF5TimeSeries::numFrames() const
+{
+  return m_num_frames;
+}
+
+void HDF5TimeSeries::beginFrame( const unsigned iteration, const double& time, const double& timestep )
+{
+  ++m_num_frames;
+  appendFrameData( "iteration", Eigen::Matrix<unsigned,1,1>::Constant( iteration ), true );
+  appendFrameData( "time", Eigen::Matrix<double,1,1>::Constant( time ), true );
+  appendFrameData( "timestep", Eigen::Matrix<double,1,1>::Constant( timestep ), true );
+}
+
+HDF5File& HDF5TimeSeries::file()
+{
+  return m_file;
+}
+
+void HDF5TimeSeries::flush() const
+{
+  m_file.flush();
+}
+
+void HDF5TimeSeries::deferAppends( const bool defer )
+{
+  assert( m_pending_frame.empty() );
+  m_defer_appends = defer;
+}
+
+HDF5TimeSeries::PendingFrame HDF5TimeSeries::takePendingFrame()
+{
+  PendingFrame frame;
+  using std::swap;
+  swap( frame, m_pending_frame );
+  return frame;
+}
+
+void HDF5TimeSeries::writePendingFrame( const PendingFrame& frame )
+{
+  for( const PendingAppend& pending : frame )
+  {
+    appendData( pending.full_name, pending.type(), pending.full_precision, pending.data.data(), pending.count );
+  }
+  flush();
+}
+
+void HDF5TimeSeries::appendOrDefer( const std::string& full_name, hid_t (*type)(), const bool full_precision, const void* const data, const hsize_t count, const std::size_t type_size )
+{
+  if( !m_defer_appends )
+  {
+    appendData( full_name, type(), full_precision, data, count );
+    return;
+  }
+  std::vector<char> data_copy( std::size_t( count ) * type_size );
+  if( !data_copy.empty() )
+  {
+    std::memcpy( data_copy.data(), data, data_copy.size() );
+  }
+  m_pending_frame.emplace_back( PendingAppend{ full_name, type, full_precision, std::move( data_copy ), count } );
+}
+
+void HDF5TimeSeries::appendData( const std::string& full_name, const hid_t type, const bool full_precision, const void* const data, const hsize_t count )
+{
+  assert( m_file.is_open() );
+  const std::size_t found{ full_name.find_last_of( '/' ) };
+  const std::string group_name{ found == std::string::npos ? "" : full_name.substr( 0, found ) };
+  const std::string data_set_name{ found == std::string::npos ? full_name : full_name.substr( found + 1 ) };
+  const HDFGID grp_id{ m_file.findOrCreateGroup( group_name ) };
+
+  // Open the data set, creating it on first use
+  HDFDID data_set;
+  hsize_t current_size{ 0 };
+  if( H5Lexists( grp_id, data_set_name.c_str(), H5P_DEFAULT ) > 0 )
+  {
+    data_set = HDFDID{ H5Dopen2( grp_id, data_set_name.c_str(), H5P_DEFAULT ) };
+    if( data_set < 0 )
+    {
+      throw std::string{ "Failed to open HDF data set " } + full_name;
+    }
+    const HDFSID file_space{ H5Dget_space( data_set ) };
+    if( file_space < 0 || H5Sget_simple_extent_dims( file_space, &current_size, nullptr ) != 1 )
+    {
+      throw std::string{ "Failed to get extent of HDF data set " } + full_name;
+    }
+  }
+  else
+  {
+    const hsize_t dims[]{ 0 };
+    const hsize_t max_dims[]{ H5S_UNLIMITED };
+    const HDFSID file_space{ H5Screate_simple( 1, dims, max_dims ) };
+    const HDFPID create_properties{ H5Pcreate( H5P_DATASET_CREATE ) };
+    if( file_space < 0 || create_properties < 0 )
+    {
+      throw std::string{ "Failed to create HDF data space for " } + full_name;
+    }
+    const hsize_t chunk_dims[]{ std::max( count, s_min_chunk_size ) };
+    if( H5Pset_chunk( create_properties, 1, chunk_dims ) < 0 )
+    {
+      throw std::string{ "Failed to set HDF chunk size for " } + full_name;
+    }
+    if( m_compression_level != 0 )
+    {
+      if( H5Pset_shuffle( create_properties ) < 0 || H5Pset_deflate( create_properties, m_compression_level ) < 0 )
+      {
+        throw std::string{ "Failed to enable HDF compression for " } + full_name;
+      }
+    }
+    const HDFID<H5Tclose> storage_type{ full_precision ? HDFID<H5Tclose>{ H5Tcopy( type ) } : m_file.storageType( type ) };
+    data_set = HDFDID{ H5Dcreate2( grp_id, data_set_name.c_str(), storage_type, file_space, H5P_DEFAULT, create_properties, H5P_DEFAULT ) };
+    if( data_set < 0 )
+    {
+      throw std::string{ "Failed to create HDF data set " } + full_name;
+    }
+  }
+
+  if( count == 0 )
+  {
+    return;
+  }
+
+  // Extend the data set and write the frame at its end
+  const hsize_t new_size[]{ current_size + count };
+  if( H5Dset_extent( data_set, new_size ) < 0 )
+  {
+    throw std::string{ "Failed to extend HDF data set " } + full_name;
+  }
+  const HDFSID file_space{ H5Dget_space( data_set ) };
+  const hsize_t offset[]{ current_size };
+  const hsize_t counts[]{ count };
+  if( file_space < 0 || H5Sselect_hyperslab( file_space, H5S_SELECT_SET, offset, nullptr, counts, nullptr ) < 0 )
+  {
+    throw std::string{ "Failed to select HDF hyperslab in " } + full_name;
+  }
+  const HDFSID mem_space{ H5Screate_simple( 1, counts, nullptr ) };
+  if( mem_space < 0 || H5Dwrite( data_set, type, mem_space, file_space, H5P_DEFAULT, data ) < 0 )
+  {
+    throw std::string{ "Failed to write HDF data to " } + full_name;
+  }
+}
+
+// Collects the names of the shape data sets in a file
+static herr_t collectShapeDataSets( hid_t, const char* name, const H5L_info_t*, void* op_data )
+{
+  const std::string link_name{ name };
+  if( link_name.size() > s_shape_suffix.size() && link_name.compare( link_name.size() - s_shape_suffix.size(), s_shape_suffix.size(), s_shape_suffix ) == 0 )
+  {
+    static_cast<std::vector<std::string>*>( op_data )->emplace_back( link_name.substr( 0, link_name.size() - s_shape_suffix.size() ) );
+  }
+  return 0;
+}
+
+void HDF5TimeSeries::truncate( const unsigned num_frames )
+{
+  const HDFGID root_id{ m_file.findGroup( "" ) };
+  std::vector<std::string> names;
+  if( H5Lvisit( root_id, H5_INDEX_NAME, H5_ITER_NATIVE, collectShapeDataSets, &names ) < 0 )
+  {
+    throw std::string{ "Failed to list HDF data sets" };
+  }
+
+  for( const std::string& name : names )
+  {
+    const HDFDID value_set{ H5Dopen2( root_id, name.c_str(), H5P_DEFAULT ) };
+    const HDFDID shape_set{ H5Dopen2( root_id, ( name + s_shape_suffix ).c_str(), H5P_DEFAULT ) };
+    std::vector<unsigned> shapes;
+    {
+      hsize_t shape_count{ 0 };
+      const HDFSID shape_space{ H5Dget_space( shape_set ) };
+      if( shape_set < 0 || shape_space < 0 || H5Sget_simple_extent_dims( shape_space, &shape_count, nullptr ) != 1 )
+      {
+        throw std::string{ "Failed to open HDF data set " } + name + s_shape_suffix;
+      }
+      shapes.resize( std::vector<unsigned>::size_type( shape_count ) );
+      if( shape_count != 0 && H5Dread( shape_set, H5T_NATIVE_UINT, H5S_ALL, H5S_ALL, H5P_DEFAULT, shapes.data() ) < 0 )
+      {
+        throw std::string{ "Failed to read HDF data set " } + name + s_shape_suffix;
+      }
+    }
+    const hsize_t frames{ std::min( hsize_t( num_frames ), hsize_t( shapes.size() / 2 ) ) };
+    hsize_t values{ 0 };
+    for( hsize_t frame = 0; frame < frames; ++frame )
+    {
+      values += hsize_t( shapes[2 * frame] ) * hsize_t( shapes[2 * frame + 1] );
+    }
+    const hsize_t value_size[]{ values };
+    const hsize_t shape_size[]{ 2 * frames };
+    if( value_set < 0 || shape_set < 0 || H5Dset_extent( value_set, value_size ) < 0 || H5Dset_extent( shape_set, shape_size ) < 0 )
+    {
+      throw std::string{ "Failed to truncate HDF data set " } + name;
+    }
+    if( name == "time" )
+    {
+      m_num_frames = unsigned( frames );
+    }
+  }
+}
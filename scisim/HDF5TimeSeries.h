@@ -0,0 +1,103 @@
+#ifndef HDF5_TIME_SERIES_H
+#define HDF5_TIME_SERIES_H
+
+#include "HDF5File.h"
+
+#include <vector>
+
+// Simulation output for a whole run in one HDF5 file. Data that change between frames are appended to chunked,
+// extendible one dimensional datasets along the time axis; frames may differ in size, so the rows and columns of
+// each frame of a dataset are appended to a companion dataset named with the suffix _shape. Data that do not change,
+// such as geometry, are written once through file().
+class HDF5TimeSeries final
+{
+
+public:
+
+  // Copies of the data appended to the series while appends are deferred. The HDF5 type is looked up when the data
+  // are written, as even that touches the library.
+  struct PendingAppend final
+  {
+    std::string full_name;
+    hid_t (*type)();
+    bool full_precision;
+    std::vector<char> data;
+    hsize_t count;
+  };
+  using PendingFrame = std::vector<PendingAppend>;
+
+  HDF5TimeSeries();
+
+  HDF5TimeSeries( const HDF5TimeSeries& ) = delete;
+  HDF5TimeSeries& operator=( const HDF5TimeSeries& ) = delete;
+
+  // Creates the file, or if resume is set and the file holds frames, reopens it and discards all frames after the
+  // first num_frames. A compression level from 1 to 9 enables the shuffle and deflate filters on new datasets.
+  // Floating point data in new datasets are stored at the given precision, except for the time stamps of frames.
+  void open( const std::string& file_name, const unsigned compression_level, const bool resume, const unsigned num_frames, const HDF5FloatPrecision precision = HDF5FloatPrecision::DOUBLE );
+
+  bool is_open() const;
+
+  // Number of frames begun so far
+  unsigned numFrames() const;
+
+  // Starts a new frame, appending its iteration, time, and timestep
+  void beginFrame( const unsigned iteration, const double& time, const double& timestep );
+
+  // Appends the data of the current frame to the dataset full_name
+  template<typename Derived>
+  void append( const std::string& full_name, const Eigen::DenseBase<Derived>& data )
+  {
+    appendFrameData( full_name, data, false );
+  }
+
+  // While deferred, appended data are copied to a pending frame instead of being written, so that the file can be
+  // written from another thread with writePendingFrame
+  void deferAppends( const bool defer );
+
+  // Returns and clears the data appended since the last call
+  PendingFrame takePendingFrame();
+
+  // Writes data returned by takePendingFrame and flushes the file
+  void writePendingFrame( const PendingFrame& frame );
+
+  HDF5File& file();
+
+  // Writes the frames appended so far to disk
+  void flush() const;
+
+private:
+
+  template<typename Scalar>
+  static hid_t nativeType()
+  {
+    return HDF5File::computeHDFType<Scalar>();
+  }
+
+  template<typename Derived>
+  void appendFrameData( const std::string& full_name, const Eigen::DenseBase<Derived>& data, const bool full_precision )
+  {
+    using Scalar = typename Derived::Scalar;
+    static_assert( HDF5SupportedTypes::isSupportedEigenType<Scalar>(), "Error, scalar type of Eigen variable must be float, double, unsigned or integer" );
+    // Frames are stored row major, matching HDF5File::write
+    const Eigen::Matrix<Scalar,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> row_major_data{ data.derived().matrix() };
+    appendOrDefer( full_name, &nativeType<Scalar>, full_precision, row_major_data.data(), hsize_t( row_major_data.size() ), sizeof( Scalar ) );
+    const Eigen::Matrix<unsigned,2,1> shape{ unsigned( data.rows() ), unsigned( data.cols() ) };
+    appendOrDefer( full_name + "_shape", &nativeType<unsigned>, true, shape.data(), 2, sizeof( unsigned ) );
+  }
+
+  void appendOrDefer( const std::string& full_name, hid_t (*type)(), const bool full_precision, const void* const data, const hsize_t count, const std::size_t type_size );
+
+  void appendData( const std::string& full_name, const hid_t type, const bool full_precision, const void* const data, const hsize_t count );
+
+  void truncate( const unsigned num_frames );
+
+  HDF5File m_file;
+  unsigned m_compression_level;
+  unsigned m_num_frames;
+  bool m_defer_appends;
+  PendingFrame m_pending_frame;
+
+};
+
+#endif
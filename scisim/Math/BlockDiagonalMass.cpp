@@ -0,0 +1,209 @@
+#include "BlockDiagonalMass.h"
+
+BlockDiagonalMass::BlockDiagonalMass()
+: m_block_size( 1 )
+, m_num_blocks( 0 )
+, m_values()
+{}
+
+BlockDiagonalMass::BlockDiagonalMass( const SparseMatrixsc& M, const int block_size )
+: m_block_size( 1 )
+, m_num_blocks( 0 )
+, m_values()
+{
+  setFromSparse( M, block_size );
+}
+
+void BlockDiagonalMass::setFromSparse( const SparseMatrixsc& M, const int block_size )
+{
+  assert( M.rows() == M.cols() );
+  assert( block_size > 0 );
+  assert( M.rows() % block_size == 0 );
+
+  m_block_size = block_size;
+  m_num_blocks = int( M.rows() ) / block_size;
+  m_values.setZero( block_size * block_size * m_num_blocks );
+  for( int col = 0; col < M.outerSize(); ++col )
+  {
+    const int block{ col / block_size };
+    for( SparseMatrixsc::InnerIterator it{ M, col }; it; ++it )
+    {
+      assert( it.row() / block_size == block );
+      m_values( block_size * block_size * block + block_size * ( col % block_size ) + it.row() % block_size ) = it.value();
+    }
+  }
+}
+
+void BlockDiagonalMass::toSparse( SparseMatrixsc& M ) const
+{
+  M.resize( rows(), cols() );
+  M.reserve( m_values.size() );
+  for( int col = 0; col < cols(); ++col )
+  {
+    M.startVec( col );
+    const int block{ col / m_block_size };
+    const scalar* const block_col{ blockData( block ) + m_block_size * ( col % m_block_size ) };
+    for( int local_row = 0; local_row < m_block_size; ++local_row )
+    {
+      M.insertBack( m_block_size * block + local_row, col ) = block_col[local_row];
+    }
+  }
+  M.finalize();
+}
+
+int BlockDiagonalMass::rows() const
+{
+  return m_block_size * m_num_blocks;
+}
+
+int BlockDiagonalMass::cols() const
+{
+  return m_block_size * m_num_blocks;
+}
+
+int BlockDiagonalMass::blockSize() const
+{
+  return m_block_size;
+}
+
+int BlockDiagonalMass::numBlocks() const
+{
+  return m_num_blocks;
+}
+
+const scalar* BlockDiagonalMass::blockData( const int block ) const
+{
+  assert( block >= 0 ); assert( block < m_num_blocks );
+  return m_values.data() + m_block_size * m_block_size * block;
+}
+
+// BS is the block size, or Eigen::Dynamic for sizes without a dedicated kernel
+template<int BS>
+static void multiplyVector( const int block_size, const int num_blocks, const VectorXs& values, const VectorXs& x, VectorXs& y )
+{
+  using BlockMatrix = Eigen::Matrix<scalar,BS,BS>;
+  using BlockVector = Eigen::Matrix<scalar,BS,1>;
+  #pragma omp parallel for
+  for( int block = 0; block < num_blocks; ++block )
+  {
+    const Eigen::Map<const BlockMatrix> B{ values.data() + block_size * block_size * block, block_size, block_size };
+    const Eigen::Map<const BlockVector> x_block{ x.data() + block_size * block, block_size };
+    Eigen::Map<BlockVector> y_block{ y.data() + block_size * block, block_size };
+    y_block.noalias() = B * x_block;
+  }
+}
+
+void BlockDiagonalMass::multiply( const VectorXs& x, VectorXs& y ) const
+{
+  assert( x.size() == cols() );
+  assert( y.data() != x.data() );
+  y.resize( rows() );
+  switch( m_block_size )
+  {
+    case 1:
+      y = m_values.cwiseProduct( x );
+      break;
+    case 2:
+      multiplyVector<2>( m_block_size, m_num_blocks, m_values, x, y );
+      break;
+    case 3:
+      multiplyVector<3>( m_block_size, m_num_blocks, m_values, x, y );
+      break;
+    default:
+      multiplyVector<Eigen::Dynamic>( m_block_size, m_num_blocks, m_values, x, y );
+      break;
+  }
+}
+
+template<int BS>
+static void multiplySparse( const int block_size, const VectorXs& values, const SparseMatrixsc& A, SparseMatrixsc& C )
+{
+  using BlockMatrix = Eigen::Matrix<scalar,BS,BS>;
+  using BlockVector = Eigen::Matrix<scalar,BS,1>;
+  const int ncols{ int( A.cols() ) };
+
+  // Each run of entries of a column of A within one block produces a full block column of C
+  C.resize( A.rows(), A.cols() );
+  int* const outer{ C.outerIndexPtr() };
+  outer[0] = 0;
+  #pragma omp parallel for
+  for( int col = 0; col < ncols; ++col )
+  {
+    int num_entries{ 0 };
+    int previous_block{ -1 };
+    for( SparseMatrixsc::InnerIterator it{ A, col }; it; ++it )
+    {
+      const int block{ int( it.row() ) / block_size };
+      assert( block >= previous_block );
+      if( block != previous_block )
+      {
+        num_entries += block_size;
+        previous_block = block;
+      }
+    }
+    outer[col + 1] = num_entries;
+  }
+  for( int col = 0; col < ncols; ++col )
+  {
+    outer[col + 1] += outer[col];
+  }
+  C.resizeNonZeros( outer[ncols] );
+
+  #pragma omp parallel for
+  for( int col = 0; col < ncols; ++col )
+  {
+    int output_idx{ outer[col] };
+    SparseMatrixsc::InnerIterator it{ A, col };
+    BlockVector product( block_size );
+    while( it )
+    {
+      const int block{ int( it.row() ) / block_size };
+      const Eigen::Map<const BlockMatrix> B{ values.data() + block_size * block_size * block, block_size, block_size };
+      product.setZero();
+      for( ; it && int( it.row() ) / block_size == block; ++it )
+      {
+        product += it.value() * B.col( int( it.row() ) - block_size * block );
+      }
+      for( int local_row = 0; local_row < block_size; ++local_row )
+      {
+        C.innerIndexPtr()[output_idx] = block_size * block + local_row;
+        C.valuePtr()[output_idx] = product( local_row );
+        ++output_idx;
+      }
+    }
+    assert( output_idx == outer[col + 1] );
+  }
+}
+
+void BlockDiagonalMass::multiply( const SparseMatrixsc& A, SparseMatrixsc& C ) const
+{
+  assert( A.rows() == cols() );
+  assert( &A != &C );
+  switch( m_block_size )
+  {
+    case 1:
+    {
+      // Scaling the rows of A preserves its sparsity
+      C = A;
+      C.makeCompressed();
+      scalar* const C_values{ C.valuePtr() };
+      const int* const C_rows{ C.innerIndexPtr() };
+      const int nnz{ int( C.nonZeros() ) };
+      #pragma omp parallel for
+      for( int entry = 0; entry < nnz; ++entry )
+      {
+        C_values[entry] *= m_values( C_rows[entry] );
+      }
+      break;
+    }
+    case 2:
+      multiplySparse<2>( m_block_size, m_values, A, C );
+      break;
+    case 3:
+      multiplySparse<3>( m_block_size, m_values, A, C );
+      break;
+    default:
+      multiplySparse<Eigen::Dynamic>( m_block_size, m_values, A, C );
+      break;
+  }
+}
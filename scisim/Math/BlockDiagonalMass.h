@@ -0,0 +1,48 @@
+#ifndef BLOCK_DIAGONAL_MASS_H
+#define BLOCK_DIAGONAL_MASS_H
+
+#include "MathDefines.h"
+
+// A block diagonal mass matrix, or its inverse, with square blocks of a single size: 1x1 blocks for diagonal
+// matrices and 3x3 blocks for the masses and inertia tensors of 3D rigid bodies. The blocks are stored contiguously
+// in column major order and products are evaluated with fixed size kernels over the blocks, in parallel when OpenMP
+// is enabled, avoiding the index traffic of a general sparse matrix.
+class BlockDiagonalMass final
+{
+
+public:
+
+  BlockDiagonalMass();
+
+  // Extracts the blocks of a sparse matrix whose nonzeros all lie in its diagonal blocks of size block_size
+  BlockDiagonalMass( const SparseMatrixsc& M, const int block_size );
+
+  void setFromSparse( const SparseMatrixsc& M, const int block_size );
+
+  // Sparse matrix with every entry of every block stored, for callers that require a general sparse matrix
+  void toSparse( SparseMatrixsc& M ) const;
+
+  int rows() const;
+  int cols() const;
+  int blockSize() const;
+  int numBlocks() const;
+
+  // Column major entries of the given block
+  const scalar* blockData( const int block ) const;
+
+  // y = B x
+  void multiply( const VectorXs& x, VectorXs& y ) const;
+
+  // C = B A. Each column of C is nonzero in every row of each block that the column of A touches, so for 1x1
+  // blocks C shares the sparsity of A.
+  void multiply( const SparseMatrixsc& A, SparseMatrixsc& C ) const;
+
+private:
+
+  int m_block_size;
+  int m_num_blocks;
+  VectorXs m_values;
+
+};
+
+#endif
@@ -0,0 +1,106 @@
+#include "DelassusOperator.h"
+
+#include "BlockDiagonalMass.h"
+#include "MathUtilities.h"
+#include "scisim/Timer/Profiler.h"
+
+DelassusOperator::DelassusOperator( const SparseMatrixsc& N, const SparseMatrixsc& Minv )
+: m_N( N )
+, m_Minv_N()
+, m_workspace( N.rows() )
+, m_Q_assembled( false )
+, m_Q()
+{
+  assert( Minv.rows() == Minv.cols() );
+  assert( Minv.cols() == N.rows() );
+  SCISIM_PROFILE_SCOPE( ProfilePhase::DELASSUS );
+  m_Minv_N = Minv * N;
+}
+
+DelassusOperator::DelassusOperator( const SparseMatrixsc& N, const BlockDiagonalMass& Minv )
+: m_N( N )
+, m_Minv_N()
+, m_workspace( N.rows() )
+, m_Q_assembled( false )
+, m_Q()
+{
+  assert( Minv.cols() == N.rows() );
+  SCISIM_PROFILE_SCOPE( ProfilePhase::DELASSUS );
+  Minv.multiply( N, m_Minv_N );
+}
+
+DelassusOperator::DelassusOperator( const DelassusOperator& other, const std::vector<unsigned>& cols )
+: m_N()
+, m_Minv_N()
+, m_workspace( other.m_N.rows() )
+, m_Q_assembled( false )
+, m_Q()
+{
+  MathUtilities::extractColumns( other.m_N, cols, m_N );
+  MathUtilities::extractColumns( other.m_Minv_N, cols, m_Minv_N );
+}
+
+int DelassusOperator::rows() const
+{
+  return int( m_N.cols() );
+}
+
+int DelassusOperator::cols() const
+{
+  return int( m_N.cols() );
+}
+
+const SparseMatrixsc& DelassusOperator::N() const
+{
+  return m_N;
+}
+
+const SparseMatrixsc& DelassusOperator::MinvN() const
+{
+  return m_Minv_N;
+}
+
+void DelassusOperator::multiply( const VectorXs& x, VectorXs& y ) const
+{
+  assert( x.size() == cols() );
+  assert( y.data() != x.data() );
+  m_workspace.noalias() = m_Minv_N * x;
+  y.noalias() = m_N.transpose() * m_workspace;
+}
+
+void DelassusOperator::computeDiagonal( VectorXs& diagonal ) const
+{
+  diagonal.resize( cols() );
+  for( int col = 0; col < cols(); ++col )
+  {
+    diagonal( col ) = m_N.col( col ).dot( m_Minv_N.col( col ) );
+  }
+}
+
+void DelassusOperator::computeDiagonalBlocks( const int block_size, MatrixXXsc& blocks ) const
+{
+  assert( block_size > 0 );
+  assert( cols() % block_size == 0 );
+  blocks.resize( block_size, cols() );
+  for( int block_start = 0; block_start < cols(); block_start += block_size )
+  {
+    for( int col = 0; col < block_size; ++col )
+    {
+      for( int row = 0; row < block_size; ++row )
+      {
+        blocks( row, block_start + col ) = m_N.col( block_start + row ).dot( m_Minv_N.col( block_start + col ) );
+      }
+    }
+  }
+}
+
+const SparseMatrixsc& DelassusOperator::matrix() const
+{
+  if( !m_Q_assembled )
+  {
+    SCISIM_PROFILE_SCOPE( ProfilePhase::DELASSUS );
+    m_Q = m_N.transpose() * m_Minv_N;
+    m_Q_assembled = true;
+  }
+  return m_Q;
+}
@@ -0,0 +1,63 @@
+#ifndef DELASSUS_OPERATOR_H
+#define DELASSUS_OPERATOR_H
+
+#include <vector>
+
+#include "MathDefines.h"
+
+class BlockDiagonalMass;
+
+// The Delassus operator Q = N^T M^-1 N of a set of constraints. Products with Q are evaluated matrix free
+// through M^-1 N, which shares the sparsity of N because M^-1 is block diagonal, so Q is only assembled
+// for solvers that explicitly require the matrix.
+//
+// Not thread safe: the const products share a workspace and matrix() assembles Q lazily, so an operator must not
+// be used from several threads at once. Solvers that run in parallel, such as ImpactOperatorIslands, form a
+// separate operator per task.
+class DelassusOperator final
+{
+
+public:
+
+  // Products are formed in the same storage order as the column major sparse matrix operators
+  static constexpr bool IsRowMajor{ false };
+
+  DelassusOperator( const SparseMatrixsc& N, const SparseMatrixsc& Minv );
+
+  // Forms M^-1 N with the block kernels of M^-1
+  DelassusOperator( const SparseMatrixsc& N, const BlockDiagonalMass& Minv );
+
+  // Restriction of an operator to a subset of its constraints, formed without multiplying by M^-1 again
+  DelassusOperator( const DelassusOperator& other, const std::vector<unsigned>& cols );
+
+  int rows() const;
+  int cols() const;
+
+  const SparseMatrixsc& N() const;
+  const SparseMatrixsc& MinvN() const;
+
+  // y = Q x
+  void multiply( const VectorXs& x, VectorXs& y ) const;
+
+  void computeDiagonal( VectorXs& diagonal ) const;
+
+  // Diagonal blocks of Q for consecutive groups of block_size constraints, stored side by side
+  void computeDiagonalBlocks( const int block_size, MatrixXXsc& blocks ) const;
+
+  // Explicitly assembled Q, formed on first use
+  const SparseMatrixsc& matrix() const;
+
+private:
+
+  SparseMatrixsc m_N;
+  SparseMatrixsc m_Minv_N;
+
+  // Workspace for products, sized to the number of degrees of freedom
+  mutable VectorXs m_workspace;
+
+  mutable bool m_Q_assembled;
+  mutable SparseMatrixsc m_Q;
+
+};
+
+#endif
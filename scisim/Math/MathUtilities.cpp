@@ -7,6 +7,8 @@
 
 #include <fstream>
 
+#include "DelassusOperator.h"
+
 bool MathUtilities::isRightHandedOrthoNormal( const Vector2s& a, const Vector2s& b, const scalar& tol )
 {
   // All basis vectors should be unit
@@ -85,6 +87,11 @@ bool MathUtilities::isSymmetric( const SparseMatrixsc& A, const scalar& tol )
   return true;
 }
 
+bool MathUtilities::isSymmetric( const DelassusOperator& A, const scalar& tol )
+{
+  return isSymmetric( A.matrix(), tol );
+}
+
 unsigned MathUtilities::computeNumDigits( unsigned n )
 {
   if( n == 0 ) { return 1; }
@@ -9,6 +9,8 @@
 
 #include "scisim/Utilities.h"
 
+class DelassusOperator;
+
 namespace MathUtilities
 {
 
@@ -33,6 +35,8 @@ namespace MathUtilities
 
   bool isSymmetric( const SparseMatrixsc& A, const scalar& tol );
 
+  bool isSymmetric( const DelassusOperator& A, const scalar& tol );
+
   // Extracts columns in cols from A0, in order, and places them in A1
   void extractColumns( const SparseMatrixsc& A0, const std::vector<unsigned>& cols, SparseMatrixsc& A1 );
 
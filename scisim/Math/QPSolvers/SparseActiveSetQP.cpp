@@ -0,0 +1,189 @@
+#include "SparseActiveSetQP.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+
+// Added to the diagonal of the free block, relative to the largest diagonal entry of Q, so that the factorization
+// succeeds when the free block is only semi-definite, as with redundant contacts
+static constexpr scalar RELATIVE_REGULARIZATION{ 1.0e-10 };
+
+// Sufficient decrease parameter and maximum number of halvings of the projected search
+static constexpr scalar SUFFICIENT_DECREASE{ 1.0e-4 };
+static constexpr unsigned MAX_BACKTRACKS{ 40 };
+
+SparseActiveSetQP::SparseActiveSetQP( const scalar& tol, const unsigned max_iters )
+: m_tol( tol )
+, m_max_iters( max_iters )
+, m_K()
+, m_Q_values()
+, m_pattern_analyzed( false )
+, m_ldlt()
+, m_free()
+, m_direction()
+, m_trial()
+, m_trial_gradient()
+, m_direction_taken()
+, m_gradient()
+, m_last_solve_iterations( 0 )
+{
+  assert( m_tol >= 0.0 );
+}
+
+void SparseActiveSetQP::initializePattern( const SparseMatrixsc& Q )
+{
+  // The sum keeps explicit zeros, so every diagonal entry is in the pattern
+  SparseMatrixsc identity{ Q.rows(), Q.cols() };
+  identity.setIdentity();
+  SparseMatrixsc K{ Q + 0.0 * identity };
+  K.makeCompressed();
+
+  const bool same_pattern{ m_pattern_analyzed && K.rows() == m_K.rows() && K.nonZeros() == m_K.nonZeros() &&
+                           std::equal( K.outerIndexPtr(), K.outerIndexPtr() + K.outerSize() + 1, m_K.outerIndexPtr() ) &&
+                           std::equal( K.innerIndexPtr(), K.innerIndexPtr() + K.nonZeros(), m_K.innerIndexPtr() ) };
+
+  m_K.swap( K );
+  m_Q_values = Eigen::Map<const VectorXs>{ m_K.valuePtr(), m_K.nonZeros() };
+
+  if( !same_pattern )
+  {
+    m_ldlt.analyzePattern( m_K );
+    m_pattern_analyzed = true;
+  }
+}
+
+void SparseActiveSetQP::updateSystem( const VectorXs& l, const VectorXs& u, const VectorXs& x )
+{
+  m_free.resize( std::vector<bool>::size_type( x.size() ) );
+  for( int var = 0; var < x.size(); ++var )
+  {
+    m_free[var] = l( var ) < x( var ) && x( var ) < u( var );
+  }
+
+  scalar max_diagonal{ 0.0 };
+  for( int col = 0; col < m_K.outerSize(); ++col )
+  {
+    for( int idx = m_K.outerIndexPtr()[col]; idx < m_K.outerIndexPtr()[col + 1]; ++idx )
+    {
+      if( m_K.innerIndexPtr()[idx] == col )
+      {
+        max_diagonal = std::max( max_diagonal, m_Q_values( idx ) );
+      }
+    }
+  }
+  const scalar regularization{ RELATIVE_REGULARIZATION * std::max( max_diagonal, scalar( 1.0 ) ) };
+
+  for( int col = 0; col < m_K.outerSize(); ++col )
+  {
+    for( int idx = m_K.outerIndexPtr()[col]; idx < m_K.outerIndexPtr()[col + 1]; ++idx )
+    {
+      const int row{ m_K.innerIndexPtr()[idx] };
+      if( m_free[row] && m_free[col] )
+      {
+        m_K.valuePtr()[idx] = m_Q_values( idx ) + ( row == col ? regularization : 0.0 );
+      }
+      else
+      {
+        m_K.valuePtr()[idx] = row == col ? 1.0 : 0.0;
+      }
+    }
+  }
+
+  m_direction.resize( x.size() );
+  for( int var = 0; var < x.size(); ++var )
+  {
+    m_direction( var ) = m_free[var] ? -m_gradient( var ) : 0.0;
+  }
+}
+
+void SparseActiveSetQP::projectedSearch( const SparseMatrixsc& Q, const VectorXs& b, const VectorXs& l, const VectorXs& u, scalar step, VectorXs& x )
+{
+  for( unsigned backtrack = 0; backtrack < MAX_BACKTRACKS; ++backtrack )
+  {
+    m_trial = ( x + step * m_direction ).cwiseMax( l ).cwiseMin( u );
+    m_trial_gradient.noalias() = Q * m_trial;
+    m_trial_gradient += b;
+    // The change in the objective is 1/2 ( x_trial - x )^T ( g + g_trial ), which unlike the difference of the two
+    // objectives stays accurate as the iterates converge
+    m_direction_taken = m_trial - x;
+    const scalar change{ 0.5 * m_direction_taken.dot( m_gradient + m_trial_gradient ) };
+    if( change <= SUFFICIENT_DECREASE * m_gradient.dot( m_direction_taken ) )
+    {
+      x.swap( m_trial );
+      m_gradient.swap( m_trial_gradient );
+      return;
+    }
+    step *= 0.5;
+  }
+}
+
+scalar SparseActiveSetQP::projectedGradientNorm( const VectorXs& l, const VectorXs& u, const VectorXs& x ) const
+{
+  return ( ( x - m_gradient ).cwiseMax( l ).cwiseMin( u ) - x ).lpNorm<Eigen::Infinity>();
+}
+
+bool SparseActiveSetQP::solve( const SparseMatrixsc& Q, const VectorXs& b, const VectorXs& l, const VectorXs& u, VectorXs& x )
+{
+  assert( Q.rows() == Q.cols() );
+  assert( b.size() == Q.rows() ); assert( l.size() == Q.rows() ); assert( u.size() == Q.rows() ); assert( x.size() == Q.rows() );
+  assert( ( l.array() <= u.array() ).all() );
+
+  m_last_solve_iterations = 0;
+  x = x.cwiseMax( l ).cwiseMin( u );
+  m_gradient.resize( x.size() );
+  m_gradient.noalias() = Q * x;
+  m_gradient += b;
+  if( x.size() == 0 )
+  {
+    return true;
+  }
+
+  initializePattern( Q );
+
+  while( projectedGradientNorm( l, u, x ) > m_tol )
+  {
+    if( m_last_solve_iterations == m_max_iters )
+    {
+      return false;
+    }
+    ++m_last_solve_iterations;
+
+    // Projected gradient step from the minimizer of the objective along the steepest descent direction, restricted
+    // to the variables that can move, which adds and releases bounds
+    m_direction = -m_gradient;
+    for( int var = 0; var < x.size(); ++var )
+    {
+      if( ( x( var ) <= l( var ) && m_direction( var ) < 0.0 ) || ( x( var ) >= u( var ) && m_direction( var ) > 0.0 ) )
+      {
+        m_direction( var ) = 0.0;
+      }
+    }
+    m_trial_gradient.noalias() = Q * m_direction;
+    const scalar curvature{ m_direction.dot( m_trial_gradient ) };
+    const scalar step{ curvature > 0.0 ? m_direction.squaredNorm() / curvature : 1.0 };
+    projectedSearch( Q, b, l, u, step, x );
+
+    // Newton step in the variables strictly between their bounds
+    updateSystem( l, u, x );
+    m_ldlt.factorize( m_K );
+    if( m_ldlt.info() != Eigen::Success )
+    {
+      std::cerr << "SparseActiveSetQP warning, failed to factor the free block of Q" << std::endl;
+      return false;
+    }
+    m_direction = m_ldlt.solve( m_direction );
+    projectedSearch( Q, b, l, u, 1.0, x );
+  }
+
+  return true;
+}
+
+const VectorXs& SparseActiveSetQP::gradient() const
+{
+  return m_gradient;
+}
+
+unsigned SparseActiveSetQP::lastSolveIterations() const
+{
+  return m_last_solve_iterations;
+}
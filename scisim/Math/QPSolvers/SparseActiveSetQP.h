@@ -0,0 +1,67 @@
+#ifndef SPARSE_ACTIVE_SET_QP_H
+#define SPARSE_ACTIVE_SET_QP_H
+
+#include "scisim/Math/MathDefines.h"
+
+#include <Eigen/SparseCholesky>
+
+#include <vector>
+
+// Solves the bound constrained convex QP
+//   min 1/2 x^T Q x + b^T x  s.t.  l <= x <= u
+// with sparse Q by an active set method in the style of More and Toraldo. Each iteration takes a projected gradient
+// step, which can add or release any number of bounds at once, then fixes the variables that sit at a bound and takes
+// a projected Newton step in the remaining free variables using a sparse LDL^T factorization. Both steps use a
+// projected backtracking search, so the objective decreases monotonically even when Q is only semi-definite.
+//
+// The factored matrix keeps the sparsity pattern of Q for every active set, with the rows and columns of active
+// variables replaced by rows and columns of the identity, so the symbolic factorization is computed once per pattern
+// and reused as variables enter and leave the active set, and across solves while the pattern is unchanged.
+class SparseActiveSetQP final
+{
+
+public:
+
+  SparseActiveSetQP( const scalar& tol, const unsigned max_iters );
+
+  // x holds the initial guess on entry and is projected onto the bounds. Entries of l and u may be infinite. Returns
+  // true once the projected gradient falls below tol, and false if that did not happen within max_iters iterations.
+  bool solve( const SparseMatrixsc& Q, const VectorXs& b, const VectorXs& l, const VectorXs& u, VectorXs& x );
+
+  // Q x + b at the last solution; the multipliers of the bound constraints
+  const VectorXs& gradient() const;
+
+  unsigned lastSolveIterations() const;
+
+private:
+
+  void initializePattern( const SparseMatrixsc& Q );
+  // Fills m_K with the free block of Q and m_direction with the negated free gradient, for the variables of x strictly
+  // between their bounds
+  void updateSystem( const VectorXs& l, const VectorXs& u, const VectorXs& x );
+  // Backtracks from x + step m_direction, projected onto the bounds, until the objective decreases sufficiently, and
+  // updates x and m_gradient; leaves x unchanged if no step does
+  void projectedSearch( const SparseMatrixsc& Q, const VectorXs& b, const VectorXs& l, const VectorXs& u, scalar step, VectorXs& x );
+  scalar projectedGradientNorm( const VectorXs& l, const VectorXs& u, const VectorXs& x ) const;
+
+  const scalar m_tol;
+  const unsigned m_max_iters;
+
+  // Q with its diagonal added to the pattern; m_Q_values holds the values of Q in that pattern
+  SparseMatrixsc m_K;
+  VectorXs m_Q_values;
+  bool m_pattern_analyzed;
+  Eigen::SimplicialLDLT<SparseMatrixsc> m_ldlt;
+
+  std::vector<bool> m_free;
+  VectorXs m_direction;
+  VectorXs m_trial;
+  VectorXs m_trial_gradient;
+  VectorXs m_direction_taken;
+  VectorXs m_gradient;
+
+  unsigned m_last_solve_iterations;
+
+};
+
+#endif
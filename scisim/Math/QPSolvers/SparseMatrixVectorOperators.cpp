@@ -1,5 +1,7 @@
 #include "SparseMatrixVectorOperators.h"
 
+#include "scisim/Math/DelassusOperator.h"
+
 #ifndef NDEBUG
 #include "scisim/Math/MathUtilities.h"
 #endif
@@ -42,6 +44,33 @@ void MultiplyEigenColumnMajor::operator()( const SparseMatrixsc& A, const Vector
   y.noalias() = A.transpose() * x;
 }
 
+scalar ObjectiveDelassusOperator::operator()( const DelassusOperator& A, const VectorXs& b, const VectorXs& x ) const
+{
+  assert( A.rows() == b.size() );
+  assert( A.rows() == x.size() );
+  VectorXs Ax{ x.size() };
+  A.multiply( x, Ax );
+  return x.dot( 0.5 * Ax + b );
+}
+
+void GradientDelassusOperator::operator()( const DelassusOperator& A, const VectorXs& b, const VectorXs& x, VectorXs& grad ) const
+{
+  assert( A.rows() == b.size() );
+  assert( A.rows() == x.size() );
+  assert( A.rows() == grad.size() );
+  assert( grad.data() != x.data() );
+  assert( grad.data() != b.data() );
+  A.multiply( x, grad );
+  grad += b;
+}
+
+void MultiplyDelassusOperator::operator()( const DelassusOperator& A, const VectorXs& x, VectorXs& y ) const
+{
+  assert( A.rows() == x.size() );
+  assert( A.rows() == y.size() );
+  A.multiply( x, y );
+}
+
 #ifdef MKL_FOUND
 scalar ObjectiveMKLColumnMajor::operator()( const SparseMatrixsc& A, const VectorXs& b, const VectorXs& x ) const
 {
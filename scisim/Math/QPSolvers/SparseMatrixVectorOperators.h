@@ -3,6 +3,8 @@
 
 #include "scisim/Math/MathDefines.h"
 
+class DelassusOperator;
+
 struct ObjectiveEigenColumnMajor final
 {
   scalar operator()( const SparseMatrixsc& A, const VectorXs& b, const VectorXs& x ) const;
@@ -33,6 +35,37 @@ struct MultiplyEigenColumnMajor final
   }
 };
 
+// Matrix free evaluation with the Delassus operator
+struct ObjectiveDelassusOperator final
+{
+  scalar operator()( const DelassusOperator& A, const VectorXs& b, const VectorXs& x ) const;
+
+  static constexpr bool columnMajor()
+  {
+    return true;
+  }
+};
+
+struct GradientDelassusOperator final
+{
+  void operator()( const DelassusOperator& A, const VectorXs& b, const VectorXs& x, VectorXs& grad ) const;
+
+  static constexpr bool columnMajor()
+  {
+    return true;
+  }
+};
+
+struct MultiplyDelassusOperator final
+{
+  void operator()( const DelassusOperator& A, const VectorXs& x, VectorXs& y ) const;
+
+  static constexpr bool columnMajor()
+  {
+    return true;
+  }
+};
+
 #ifdef MKL_FOUND
 struct ObjectiveMKLColumnMajor final
 {
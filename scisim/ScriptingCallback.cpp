@@ -7,6 +7,8 @@
 
 #include "ScriptingCallback.h"
 
+#include "Timer/Profiler.h"
+
 ScriptingCallback::~ScriptingCallback() = default;
 
 void ScriptingCallback::restitutionCoefficientCallback( const std::vector<std::unique_ptr<Constraint>>& active_set, VectorXs& cor )
@@ -15,6 +17,7 @@ void ScriptingCallback::restitutionCoefficientCallback( const std::vector<std::u
   {
     return;
   }
+  SCISIM_PROFILE_SCOPE( ProfilePhase::SCRIPTING );
   restitutionCoefficient( active_set, cor );
   assert( ( cor.array() >= 0.0 ).all() );
   assert( ( cor.array() <= 1.0 ).all() );
@@ -26,6 +29,7 @@ void ScriptingCallback::frictionCoefficientCallback( const std::vector<std::uniq
   {
     return;
   }
+  SCISIM_PROFILE_SCOPE( ProfilePhase::SCRIPTING );
   frictionCoefficient( active_set, mu );
   assert( ( mu.array() >= 0.0 ).all() );
 }
@@ -36,6 +40,7 @@ void ScriptingCallback::startOfSimCallback()
   {
     return;
   }
+  SCISIM_PROFILE_SCOPE( ProfilePhase::SCRIPTING );
   startOfSim();
 }
 
@@ -45,6 +50,7 @@ void ScriptingCallback::endOfSimCallback()
   {
     return;
   }
+  SCISIM_PROFILE_SCOPE( ProfilePhase::SCRIPTING );
   endOfSim();
 }
 
@@ -54,6 +60,7 @@ void ScriptingCallback::startOfStepCallback( const unsigned next_iteration, cons
   {
     return;
   }
+  SCISIM_PROFILE_SCOPE( ProfilePhase::SCRIPTING );
   startOfStep( next_iteration, dt );
 }
 
@@ -63,5 +70,6 @@ void ScriptingCallback::endOfStepCallback( const unsigned next_iteration, const
   {
     return;
   }
+  SCISIM_PROFILE_SCOPE( ProfilePhase::SCRIPTING );
   endOfStep( next_iteration, dt );
 }
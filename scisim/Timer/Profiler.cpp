@@ -0,0 +1,307 @@
+#include "Profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <iomanip>
+#include <ostream>
+
+static constexpr unsigned NUM_PHASES{ unsigned( ProfilePhase::COUNT ) };
+static constexpr unsigned NUM_COUNTERS{ unsigned( ProfileCounter::COUNT ) };
+
+namespace
+{
+
+  struct RunTotals final
+  {
+    unsigned num_steps{ 0 };
+    std::int64_t step_nanoseconds{ 0 };
+    std::array<std::int64_t,NUM_PHASES> phase_nanoseconds{};
+    std::array<std::uint64_t,NUM_COUNTERS> counts{};
+    std::array<std::uint64_t,NUM_COUNTERS> max_counts{};
+  };
+
+  struct ProfilerState final
+  {
+    std::atomic<bool> enabled{ false };
+    std::ostream* report{ nullptr };
+    ProfileFormat format{ ProfileFormat::CSV };
+    // Measurements of the current step
+    std::array<std::atomic<std::int64_t>,NUM_PHASES> phase_nanoseconds{};
+    std::array<std::atomic<std::uint64_t>,NUM_COUNTERS> counts{};
+    std::chrono::steady_clock::time_point step_start{};
+    RunTotals totals{};
+  };
+
+}
+
+static ProfilerState& profilerState()
+{
+  static ProfilerState state;
+  return state;
+}
+
+// Innermost timer of each thread
+static thread_local ScopedProfileTimer* t_current_timer{ nullptr };
+
+static double toSeconds( const std::int64_t nanoseconds )
+{
+  return 1.0e-9 * double( nanoseconds );
+}
+
+static void writeCSVHeader( std::ostream& report )
+{
+  report << "iteration,step_s";
+  for( unsigned phase = 0; phase < NUM_PHASES; ++phase )
+  {
+    report << ',' << Profiler::phaseName( ProfilePhase( phase ) ) << "_s";
+  }
+  for( unsigned counter = 0; counter < NUM_COUNTERS; ++counter )
+  {
+    report << ',' << Profiler::counterName( ProfileCounter( counter ) );
+  }
+  report << '\n';
+}
+
+static void writeStepRecord( const unsigned iteration, const std::int64_t step_nanoseconds, const std::array<std::int64_t,NUM_PHASES>& phase_nanoseconds, const std::array<std::uint64_t,NUM_COUNTERS>& counts, const ProfileFormat format, std::ostream& report )
+{
+  if( format == ProfileFormat::CSV )
+  {
+    report << iteration << ',' << toSeconds( step_nanoseconds );
+    for( const std::int64_t nanoseconds : phase_nanoseconds )
+    {
+      report << ',' << toSeconds( nanoseconds );
+    }
+    for( const std::uint64_t count : counts )
+    {
+      report << ',' << count;
+    }
+  }
+  else
+  {
+    report << "{\"iteration\":" << iteration << ",\"step_s\":" << toSeconds( step_nanoseconds );
+    for( unsigned phase = 0; phase < NUM_PHASES; ++phase )
+    {
+      report << ",\"" << Profiler::phaseName( ProfilePhase( phase ) ) << "_s\":" << toSeconds( phase_nanoseconds[phase] );
+    }
+    for( unsigned counter = 0; counter < NUM_COUNTERS; ++counter )
+    {
+      report << ",\"" << Profiler::counterName( ProfileCounter( counter ) ) << "\":" << counts[counter];
+    }
+    report << '}';
+  }
+  report << '\n';
+}
+
+void Profiler::enable( std::ostream* report, const ProfileFormat format )
+{
+  ProfilerState& state{ profilerState() };
+  state.report = report;
+  state.format = format;
+  if( report != nullptr && format == ProfileFormat::CSV )
+  {
+    writeCSVHeader( *report );
+  }
+  state.enabled = true;
+}
+
+bool Profiler::enabled()
+{
+  return profilerState().enabled.load( std::memory_order_relaxed );
+}
+
+void Profiler::addTime( const ProfilePhase phase, const std::int64_t nanoseconds )
+{
+  assert( phase < ProfilePhase::COUNT );
+  profilerState().phase_nanoseconds[unsigned( phase )].fetch_add( nanoseconds, std::memory_order_relaxed );
+}
+
+void Profiler::addCount( const ProfileCounter counter, const std::uint64_t amount )
+{
+  assert( counter < ProfileCounter::COUNT );
+  if( !enabled() )
+  {
+    return;
+  }
+  profilerState().counts[unsigned( counter )].fetch_add( amount, std::memory_order_relaxed );
+}
+
+void Profiler::beginStep()
+{
+  profilerState().step_start = std::chrono::steady_clock::now();
+}
+
+void Profiler::endStep( const unsigned iteration )
+{
+  ProfilerState& state{ profilerState() };
+  if( !state.enabled )
+  {
+    return;
+  }
+  const std::int64_t step_nanoseconds{ std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - state.step_start ).count() };
+
+  std::array<std::int64_t,NUM_PHASES> phase_nanoseconds;
+  for( unsigned phase = 0; phase < NUM_PHASES; ++phase )
+  {
+    phase_nanoseconds[phase] = state.phase_nanoseconds[phase].exchange( 0, std::memory_order_relaxed );
+    state.totals.phase_nanoseconds[phase] += phase_nanoseconds[phase];
+  }
+  std::array<std::uint64_t,NUM_COUNTERS> counts;
+  for( unsigned counter = 0; counter < NUM_COUNTERS; ++counter )
+  {
+    counts[counter] = state.counts[counter].exchange( 0, std::memory_order_relaxed );
+    state.totals.counts[counter] += counts[counter];
+    state.totals.max_counts[counter] = std::max( state.totals.max_counts[counter], counts[counter] );
+  }
+  ++state.totals.num_steps;
+  state.totals.step_nanoseconds += step_nanoseconds;
+
+  if( state.report != nullptr )
+  {
+    writeStepRecord( iteration, step_nanoseconds, phase_nanoseconds, counts, state.format, *state.report );
+  }
+}
+
+void Profiler::writeSummary( std::ostream& output_stream )
+{
+  const RunTotals& totals{ profilerState().totals };
+  const double step_seconds{ toSeconds( totals.step_nanoseconds ) };
+  const double num_steps{ double( std::max( totals.num_steps, 1u ) ) };
+
+  const std::ios_base::fmtflags flags{ output_stream.flags() };
+  const std::streamsize precision{ output_stream.precision() };
+  output_stream << std::fixed << std::setprecision( 3 );
+
+  output_stream << "Profile of " << totals.num_steps << " steps taking " << step_seconds << " s" << std::endl;
+  output_stream << "   " << std::left << std::setw( 20 ) << "phase" << std::right << std::setw( 14 ) << "total (s)" << std::setw( 14 ) << "per step (ms)" << std::setw( 10 ) << "share" << std::endl;
+  std::int64_t attributed_nanoseconds{ 0 };
+  const auto print_phase = [&output_stream,step_seconds,num_steps]( const std::string& name, const std::int64_t nanoseconds )
+  {
+    const double seconds{ toSeconds( nanoseconds ) };
+    output_stream << "   " << std::left << std::setw( 20 ) << name << std::right << std::setw( 14 ) << seconds << std::setw( 14 ) << 1000.0 * seconds / num_steps;
+    output_stream << std::setw( 9 ) << ( step_seconds > 0.0 ? 100.0 * seconds / step_seconds : 0.0 ) << '%' << std::endl;
+  };
+  for( unsigned phase = 0; phase < NUM_PHASES; ++phase )
+  {
+    print_phase( phaseName( ProfilePhase( phase ) ), totals.phase_nanoseconds[phase] );
+    attributed_nanoseconds += totals.phase_nanoseconds[phase];
+  }
+  // Parallel phases can sum to more than the elapsed time, in which case nothing is unattributed
+  print_phase( "other", std::max( totals.step_nanoseconds - attributed_nanoseconds, std::int64_t( 0 ) ) );
+
+  output_stream << "   " << std::left << std::setw( 20 ) << "counter" << std::right << std::setw( 14 ) << "total" << std::setw( 14 ) << "per step" << std::setw( 10 ) << "max" << std::endl;
+  for( unsigned counter = 0; counter < NUM_COUNTERS; ++counter )
+  {
+    output_stream << "   " << std::left << std::setw( 20 ) << counterName( ProfileCounter( counter ) ) << std::right << std::setw( 14 ) << totals.counts[counter];
+    output_stream << std::setw( 14 ) << double( totals.counts[counter] ) / num_steps << std::setw( 10 ) << totals.max_counts[counter] << std::endl;
+  }
+
+  output_stream.flags( flags );
+  output_stream.precision( precision );
+}
+
+void Profiler::reset()
+{
+  ProfilerState& state{ profilerState() };
+  for( std::atomic<std::int64_t>& nanoseconds : state.phase_nanoseconds )
+  {
+    nanoseconds = 0;
+  }
+  for( std::atomic<std::uint64_t>& count : state.counts )
+  {
+    count = 0;
+  }
+  state.totals = RunTotals{};
+}
+
+std::uint64_t Profiler::totalCount( const ProfileCounter counter )
+{
+  assert( counter < ProfileCounter::COUNT );
+  return profilerState().totals.counts[unsigned( counter )];
+}
+
+std::string Profiler::phaseName( const ProfilePhase phase )
+{
+  switch( phase )
+  {
+    case ProfilePhase::FLOW:
+      return "flow";
+    case ProfilePhase::BROAD_PHASE:
+      return "broad_phase";
+    case ProfilePhase::NARROW_PHASE:
+      return "narrow_phase";
+    case ProfilePhase::COMPUTE_N:
+      return "compute_n";
+    case ProfilePhase::DELASSUS:
+      return "delassus";
+    case ProfilePhase::SOLVER:
+      return "solver";
+    case ProfilePhase::WARM_START:
+      return "warm_start";
+    case ProfilePhase::SCRIPTING:
+      return "scripting";
+    case ProfilePhase::OUTPUT:
+      return "output";
+    case ProfilePhase::COUNT:
+      break;
+  }
+  assert( false );
+  return "";
+}
+
+std::string Profiler::counterName( const ProfileCounter counter )
+{
+  switch( counter )
+  {
+    case ProfileCounter::CONTACTS:
+      return "contacts";
+    case ProfileCounter::ISLANDS:
+      return "islands";
+    case ProfileCounter::SOLVER_ITERATIONS:
+      return "solver_iterations";
+    case ProfileCounter::COUNT:
+      break;
+  }
+  assert( false );
+  return "";
+}
+
+ScopedProfileTimer::ScopedProfileTimer( const ProfilePhase phase )
+: m_phase( phase )
+, m_active( Profiler::enabled() )
+, m_start( m_active ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{} )
+, m_parent( t_current_timer )
+, m_nested_nanoseconds( 0 )
+{
+  if( m_active )
+  {
+    t_current_timer = this;
+  }
+}
+
+ScopedProfileTimer::~ScopedProfileTimer()
+{
+  if( !m_active )
+  {
+    return;
+  }
+  const std::int64_t elapsed{ std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - m_start ).count() };
+  Profiler::addTime( m_phase, elapsed - m_nested_nanoseconds );
+  if( m_parent != nullptr )
+  {
+    m_parent->m_nested_nanoseconds += elapsed;
+  }
+  t_current_timer = m_parent;
+}
+
+ProfiledStep::ProfiledStep( const unsigned iteration )
+: m_iteration( iteration )
+{
+  Profiler::beginStep();
+}
+
+ProfiledStep::~ProfiledStep()
+{
+  Profiler::endStep( m_iteration );
+}
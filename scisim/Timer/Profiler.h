@@ -0,0 +1,125 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+// Parts of a timestep timed by ScopedProfileTimer. Time spent in a nested phase is charged to the nested phase alone,
+// so the phases of a step do not overlap.
+enum class ProfilePhase : unsigned
+{
+  FLOW,
+  BROAD_PHASE,
+  NARROW_PHASE,
+  COMPUTE_N,
+  DELASSUS,
+  SOLVER,
+  WARM_START,
+  SCRIPTING,
+  OUTPUT,
+  COUNT
+};
+
+enum class ProfileCounter : unsigned
+{
+  CONTACTS,
+  ISLANDS,
+  SOLVER_ITERATIONS,
+  COUNT
+};
+
+enum class ProfileFormat
+{
+  CSV,
+  // One JSON object per line
+  JSON
+};
+
+// Accumulates phase times and counters over each step and over the whole run. Measurements may be taken from any
+// thread; times measured by threads working in parallel are summed. Nothing is recorded until enable is called.
+namespace Profiler
+{
+
+  // Starts recording; if report is not null, a record of each completed step is written to it
+  void enable( std::ostream* report, const ProfileFormat format );
+
+  bool enabled();
+
+  void addTime( const ProfilePhase phase, const std::int64_t nanoseconds );
+
+  void addCount( const ProfileCounter counter, const std::uint64_t amount );
+
+  void beginStep();
+
+  // Reports the measurements taken since beginStep and adds them to the run totals
+  void endStep( const unsigned iteration );
+
+  // Prints the run totals of each phase and counter
+  void writeSummary( std::ostream& output_stream );
+
+  // Discards the run totals and the measurements of the current step
+  void reset();
+
+  // Run total of a counter over the steps ended since enable or reset
+  std::uint64_t totalCount( const ProfileCounter counter );
+
+  std::string phaseName( const ProfilePhase phase );
+
+  std::string counterName( const ProfileCounter counter );
+
+}
+
+class ScopedProfileTimer final
+{
+
+public:
+
+  explicit ScopedProfileTimer( const ProfilePhase phase );
+  ~ScopedProfileTimer();
+
+  ScopedProfileTimer( const ScopedProfileTimer& ) = delete;
+  ScopedProfileTimer& operator=( const ScopedProfileTimer& ) = delete;
+
+private:
+
+  const ProfilePhase m_phase;
+  const bool m_active;
+  const std::chrono::steady_clock::time_point m_start;
+  // Timer of the enclosing phase on this thread, if any
+  ScopedProfileTimer* const m_parent;
+  std::int64_t m_nested_nanoseconds;
+
+};
+
+// Brackets one timestep
+class ProfiledStep final
+{
+
+public:
+
+  explicit ProfiledStep( const unsigned iteration );
+  ~ProfiledStep();
+
+  ProfiledStep( const ProfiledStep& ) = delete;
+  ProfiledStep& operator=( const ProfiledStep& ) = delete;
+
+private:
+
+  const unsigned m_iteration;
+
+};
+
+// Instrumentation in hot paths goes through these macros so that it compiles away without USE_PROFILING
+#ifdef USE_PROFILING
+#define SCISIM_PROFILE_CONCATENATE_IMPL( a, b ) a##b
+#define SCISIM_PROFILE_CONCATENATE( a, b ) SCISIM_PROFILE_CONCATENATE_IMPL( a, b )
+#define SCISIM_PROFILE_SCOPE( phase ) const ScopedProfileTimer SCISIM_PROFILE_CONCATENATE( scoped_profile_timer_, __LINE__ ){ phase }
+#define SCISIM_PROFILE_COUNT( counter, amount ) Profiler::addCount( counter, std::uint64_t( amount ) )
+#else
+#define SCISIM_PROFILE_SCOPE( phase ) static_cast<void>( 0 )
+#define SCISIM_PROFILE_COUNT( counter, amount ) static_cast<void>( 0 )
+#endif
+
+#endif
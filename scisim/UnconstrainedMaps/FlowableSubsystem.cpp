@@ -0,0 +1,250 @@
+#include "FlowableSubsystem.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+
+// Copies the entries of the given bodies from a vector of the full system, section by section
+static void gatherSections( const std::vector<int>& sections, const std::vector<unsigned>& bodies, const unsigned num_system_bodies, const VectorXs& x, VectorXs& x_sub )
+{
+  const int num_bodies{ int( bodies.size() ) };
+  int system_start{ 0 };
+  int sub_start{ 0 };
+  for( const int section_size : sections )
+  {
+    for( int body = 0; body < num_bodies; ++body )
+    {
+      x_sub.segment( sub_start + section_size * body, section_size ) = x.segment( system_start + section_size * int( bodies[body] ), section_size );
+    }
+    system_start += section_size * int( num_system_bodies );
+    sub_start += section_size * num_bodies;
+  }
+}
+
+// Extracts the blocks of the given bodies from a matrix of the full system whose nonzeros lie in per body blocks of
+// each section, so an entry keeps its offset from the diagonal
+static void extractMassBlocks( const std::vector<int>& sections, const std::vector<unsigned>& bodies, const unsigned num_system_bodies, const SparseMatrixsc& M, SparseMatrixsc& M_sub )
+{
+  const int num_bodies{ int( bodies.size() ) };
+  int num_dofs{ 0 };
+  for( const int section_size : sections )
+  {
+    num_dofs += section_size * num_bodies;
+  }
+  M_sub.resize( num_dofs, num_dofs );
+
+  int nnz{ 0 };
+  {
+    int system_start{ 0 };
+    for( const int section_size : sections )
+    {
+      for( const unsigned body : bodies )
+      {
+        const int first_col{ system_start + section_size * int( body ) };
+        nnz += int( M.outerIndexPtr()[first_col + section_size] - M.outerIndexPtr()[first_col] );
+      }
+      system_start += section_size * int( num_system_bodies );
+    }
+  }
+  M_sub.reserve( nnz );
+
+  int system_start{ 0 };
+  int sub_col{ 0 };
+  for( const int section_size : sections )
+  {
+    for( const unsigned body : bodies )
+    {
+      const int first_col{ system_start + section_size * int( body ) };
+      for( int col = first_col; col < first_col + section_size; ++col )
+      {
+        M_sub.startVec( sub_col );
+        for( SparseMatrixsc::InnerIterator it{ M, col }; it; ++it )
+        {
+          assert( it.row() >= first_col ); assert( it.row() < first_col + section_size );
+          M_sub.insertBack( sub_col + int( it.row() ) - col, sub_col ) = it.value();
+        }
+        ++sub_col;
+      }
+    }
+    system_start += section_size * int( num_system_bodies );
+  }
+  M_sub.finalize();
+}
+
+FlowableSubsystem::FlowableSubsystem()
+: m_system( nullptr )
+, m_num_system_bodies( 0 )
+, m_bodies()
+, m_q_sections()
+, m_v_sections()
+, m_M()
+, m_Minv()
+, m_M_blocks()
+, m_Minv_blocks()
+{}
+
+FlowableSubsystem::~FlowableSubsystem() = default;
+
+void FlowableSubsystem::setBodies( const FlowableSystem& system, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const std::vector<unsigned>& bodies )
+{
+  assert( std::is_sorted( bodies.begin(), bodies.end() ) );
+  assert( M.rows() == system.nvdofs() ); assert( Minv.rows() == system.nvdofs() );
+
+  m_system = &system;
+  m_num_system_bodies = system.numBodies();
+  m_bodies = bodies;
+
+  if( system.ambientSpaceDimensions() == 3 && system.numVelDoFsPerBody() == 6 )
+  {
+    m_q_sections = { 3, 9 };
+    m_v_sections = { 3, 3 };
+  }
+  else
+  {
+    m_q_sections = { system.nqdofs() / int( m_num_system_bodies ) };
+    m_v_sections = { int( system.numVelDoFsPerBody() ) };
+  }
+
+  extractMassBlocks( m_v_sections, m_bodies, m_num_system_bodies, M, m_M );
+  extractMassBlocks( m_v_sections, m_bodies, m_num_system_bodies, Minv, m_Minv );
+  m_M_blocks.setFromSparse( m_M, system.MBlocks().blockSize() );
+  m_Minv_blocks.setFromSparse( m_Minv, system.MinvBlocks().blockSize() );
+}
+
+const std::vector<unsigned>& FlowableSubsystem::bodies() const
+{
+  return m_bodies;
+}
+
+void FlowableSubsystem::gatherConfiguration( const VectorXs& q, VectorXs& q_sub ) const
+{
+  assert( m_system != nullptr ); assert( q.size() == m_system->nqdofs() );
+  q_sub.resize( nqdofs() );
+  gatherSections( m_q_sections, m_bodies, m_num_system_bodies, q, q_sub );
+}
+
+void FlowableSubsystem::gatherVelocity( const VectorXs& v, VectorXs& v_sub ) const
+{
+  assert( m_system != nullptr ); assert( v.size() == m_system->nvdofs() );
+  v_sub.resize( nvdofs() );
+  gatherSections( m_v_sections, m_bodies, m_num_system_bodies, v, v_sub );
+}
+
+void FlowableSubsystem::scatterVelocity( const VectorXs& v_sub, VectorXs& v ) const
+{
+  assert( m_system != nullptr ); assert( v.size() == m_system->nvdofs() ); assert( v_sub.size() == nvdofs() );
+  const int num_bodies{ int( m_bodies.size() ) };
+  int system_start{ 0 };
+  int sub_start{ 0 };
+  for( const int section_size : m_v_sections )
+  {
+    for( int body = 0; body < num_bodies; ++body )
+    {
+      v.segment( system_start + section_size * int( m_bodies[body] ), section_size ) = v_sub.segment( sub_start + section_size * body, section_size );
+    }
+    system_start += section_size * int( m_num_system_bodies );
+    sub_start += section_size * num_bodies;
+  }
+}
+
+int FlowableSubsystem::nqdofs() const
+{
+  int num_dofs{ 0 };
+  for( const int section_size : m_q_sections )
+  {
+    num_dofs += section_size * int( m_bodies.size() );
+  }
+  return num_dofs;
+}
+
+int FlowableSubsystem::nvdofs() const
+{
+  return int( m_M.rows() );
+}
+
+unsigned FlowableSubsystem::numVelDoFsPerBody() const
+{
+  assert( m_system != nullptr );
+  return m_system->numVelDoFsPerBody();
+}
+
+unsigned FlowableSubsystem::ambientSpaceDimensions() const
+{
+  assert( m_system != nullptr );
+  return m_system->ambientSpaceDimensions();
+}
+
+bool FlowableSubsystem::isKinematicallyScripted( const int i ) const
+{
+  assert( m_system != nullptr ); assert( i >= 0 ); assert( i < int( m_bodies.size() ) );
+  return m_system->isKinematicallyScripted( int( m_bodies[i] ) );
+}
+
+void FlowableSubsystem::computeForce( const VectorXs& q, const VectorXs& v, const scalar& t, VectorXs& F )
+{
+  std::cerr << "FlowableSubsystem::computeForce not supported" << std::endl;
+  std::exit( EXIT_FAILURE );
+}
+
+void FlowableSubsystem::zeroOutForcesOnFixedBodies( VectorXs& F ) const
+{
+  std::cerr << "FlowableSubsystem::zeroOutForcesOnFixedBodies not supported" << std::endl;
+  std::exit( EXIT_FAILURE );
+}
+
+void FlowableSubsystem::linearInertialConfigurationUpdate( const VectorXs& q0, const VectorXs& v0, const scalar& dt, VectorXs& q1 ) const
+{
+  std::cerr << "FlowableSubsystem::linearInertialConfigurationUpdate not supported" << std::endl;
+  std::exit( EXIT_FAILURE );
+}
+
+const SparseMatrixsc& FlowableSubsystem::M() const
+{
+  return m_M;
+}
+
+const SparseMatrixsc& FlowableSubsystem::Minv() const
+{
+  return m_Minv;
+}
+
+const SparseMatrixsc& FlowableSubsystem::M0() const
+{
+  std::cerr << "FlowableSubsystem::M0 not supported" << std::endl;
+  std::exit( EXIT_FAILURE );
+}
+
+const SparseMatrixsc& FlowableSubsystem::Minv0() const
+{
+  std::cerr << "FlowableSubsystem::Minv0 not supported" << std::endl;
+  std::exit( EXIT_FAILURE );
+}
+
+const BlockDiagonalMass& FlowableSubsystem::MBlocks() const
+{
+  return m_M_blocks;
+}
+
+const BlockDiagonalMass& FlowableSubsystem::MinvBlocks() const
+{
+  return m_Minv_blocks;
+}
+
+void FlowableSubsystem::computeMomentum( const VectorXs& v, VectorXs& p ) const
+{
+  std::cerr << "FlowableSubsystem::computeMomentum not supported" << std::endl;
+  std::exit( EXIT_FAILURE );
+}
+
+void FlowableSubsystem::computeAngularMomentum( const VectorXs& v, VectorXs& L ) const
+{
+  std::cerr << "FlowableSubsystem::computeAngularMomentum not supported" << std::endl;
+  std::exit( EXIT_FAILURE );
+}
+
+std::string FlowableSubsystem::name() const
+{
+  assert( m_system != nullptr );
+  return m_system->name();
+}
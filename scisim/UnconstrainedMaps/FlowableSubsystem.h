@@ -0,0 +1,83 @@
+#ifndef FLOWABLE_SUBSYSTEM_H
+#define FLOWABLE_SUBSYSTEM_H
+
+#include "FlowableSystem.h"
+
+#include <vector>
+
+#include "scisim/Math/BlockDiagonalMass.h"
+
+// A subset of the bodies of a FlowableSystem, with degrees of freedom numbered as in a system of only those bodies,
+// so that solvers can be applied to part of a system at a cost proportional to the size of the part. Provides the
+// masses of the bodies and queries about them; the subsystem can not compute forces or momenta.
+class FlowableSubsystem final : public FlowableSystem
+{
+
+public:
+
+  FlowableSubsystem();
+  FlowableSubsystem( const FlowableSubsystem& ) = default;
+  FlowableSubsystem& operator=( const FlowableSubsystem& ) = default;
+  FlowableSubsystem( FlowableSubsystem&& ) = default;
+  FlowableSubsystem& operator=( FlowableSubsystem&& ) = default;
+  virtual ~FlowableSubsystem() override;
+
+  // Restricts the subsystem to the given bodies of system, in increasing order, and extracts their blocks of the
+  // system's mass matrix M and its inverse Minv
+  void setBodies( const FlowableSystem& system, const SparseMatrixsc& M, const SparseMatrixsc& Minv, const std::vector<unsigned>& bodies );
+
+  // Global index of each body of the subsystem
+  const std::vector<unsigned>& bodies() const;
+
+  // Copies the entries of the subsystem's bodies from a configuration or velocity of the full system
+  void gatherConfiguration( const VectorXs& q, VectorXs& q_sub ) const;
+  void gatherVelocity( const VectorXs& v, VectorXs& v_sub ) const;
+
+  // Copies a velocity of the subsystem into the entries of its bodies in a velocity of the full system
+  void scatterVelocity( const VectorXs& v_sub, VectorXs& v ) const;
+
+  // Inherited from FlowableSystem
+
+  virtual int nqdofs() const override;
+  virtual int nvdofs() const override;
+  virtual unsigned numVelDoFsPerBody() const override;
+  virtual unsigned ambientSpaceDimensions() const override;
+
+  virtual bool isKinematicallyScripted( const int i ) const override;
+
+  virtual void computeForce( const VectorXs& q, const VectorXs& v, const scalar& t, VectorXs& F ) override;
+  virtual void zeroOutForcesOnFixedBodies( VectorXs& F ) const override;
+
+  virtual void linearInertialConfigurationUpdate( const VectorXs& q0, const VectorXs& v0, const scalar& dt, VectorXs& q1 ) const override;
+
+  virtual const SparseMatrixsc& M() const override;
+  virtual const SparseMatrixsc& Minv() const override;
+  virtual const SparseMatrixsc& M0() const override;
+  virtual const SparseMatrixsc& Minv0() const override;
+  virtual const BlockDiagonalMass& MBlocks() const override;
+  virtual const BlockDiagonalMass& MinvBlocks() const override;
+
+  virtual void computeMomentum( const VectorXs& v, VectorXs& p ) const override;
+  virtual void computeAngularMomentum( const VectorXs& v, VectorXs& L ) const override;
+
+  virtual std::string name() const override;
+
+private:
+
+  const FlowableSystem* m_system;
+  unsigned m_num_system_bodies;
+  std::vector<unsigned> m_bodies;
+
+  // Per body size of each section of q and of v. 3D rigid bodies store the translational and rotational degrees of
+  // freedom of all bodies in consecutive sections; the other systems store each body's degrees of freedom together.
+  std::vector<int> m_q_sections;
+  std::vector<int> m_v_sections;
+
+  SparseMatrixsc m_M;
+  SparseMatrixsc m_Minv;
+  BlockDiagonalMass m_M_blocks;
+  BlockDiagonalMass m_Minv_blocks;
+
+};
+
+#endif
@@ -3,6 +3,8 @@
 
 #include "scisim/Math/MathDefines.h"
 
+class BlockDiagonalMass;
+
 class FlowableSystem
 {
 
@@ -39,6 +41,11 @@ public:
   // Returns the reference configuration inverse mass matrix as a sparse matrix
   virtual const SparseMatrixsc& Minv0() const = 0;
 
+  // Returns the mass matrix as a block diagonal matrix, for fast products in the integrators and constraint solvers
+  virtual const BlockDiagonalMass& MBlocks() const = 0;
+  // Returns the inverse mass matrix as a block diagonal matrix
+  virtual const BlockDiagonalMass& MinvBlocks() const = 0;
+
   // For the given velocity and the system's current configuration and mass, computes the momentum
   virtual void computeMomentum( const VectorXs& v, VectorXs& p ) const = 0;
   // For the given velocity and the system's current configuration and mass, computes the angular momentum
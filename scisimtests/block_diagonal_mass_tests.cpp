@@ -0,0 +1,158 @@
+// block_diagonal_mass_tests.cpp
+//
+// Breannan Smith
+// Last updated: 10/17/2026
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "scisim/Math/BlockDiagonalMass.h"
+#include "scisim/Math/MathDefines.h"
+
+// Block diagonal matrix with dense, nonsymmetric blocks, so that a transposed block would be detected
+static SparseMatrixsc blockDiagonalMatrix( const int block_size, const int num_blocks )
+{
+  std::vector<Eigen::Triplet<scalar>> triplets;
+  for( int block = 0; block < num_blocks; ++block )
+  {
+    for( int local_col = 0; local_col < block_size; ++local_col )
+    {
+      for( int local_row = 0; local_row < block_size; ++local_row )
+      {
+        const scalar value{ 1.0 + 0.5 * std::sin( 1.3 * block + 0.7 * local_row + 2.1 * local_col ) + ( local_row == local_col ? 2.0 : 0.0 ) };
+        triplets.emplace_back( block_size * block + local_row, block_size * block + local_col, value );
+      }
+    }
+  }
+  SparseMatrixsc M{ block_size * num_blocks, block_size * num_blocks };
+  M.setFromTriplets( triplets.begin(), triplets.end() );
+  M.makeCompressed();
+  return M;
+}
+
+// Sparse matrix with empty columns, including the first and last, and columns whose entries span one block partially,
+// several blocks, and every row
+static SparseMatrixsc spanningMatrix( const int block_size, const int num_blocks )
+{
+  const int nrows{ block_size * num_blocks };
+  std::vector<Eigen::Triplet<scalar>> triplets;
+  // Column 0 is empty
+  // Column 1 holds the last row of the first block, the first row of the third block, and all of the last block
+  triplets.emplace_back( block_size - 1, 1, 0.8 );
+  triplets.emplace_back( 2 * block_size, 1, -1.1 );
+  for( int local_row = 0; local_row < block_size; ++local_row )
+  {
+    triplets.emplace_back( block_size * ( num_blocks - 1 ) + local_row, 1, 0.3 * ( local_row + 1 ) );
+  }
+  // Column 2 holds a single entry in the middle of the system
+  triplets.emplace_back( nrows / 2, 2, 1.7 );
+  // Column 3 is empty
+  // Column 4 holds every row
+  for( int row = 0; row < nrows; ++row )
+  {
+    triplets.emplace_back( row, 4, std::cos( 0.9 * row ) );
+  }
+  // Column 5 holds every other row, touching every block when blocks have more than one row
+  for( int row = 0; row < nrows; row += 2 )
+  {
+    triplets.emplace_back( row, 5, -0.4 + 0.1 * row );
+  }
+  // Column 6 is empty
+  SparseMatrixsc A{ nrows, 7 };
+  A.setFromTriplets( triplets.begin(), triplets.end() );
+  A.makeCompressed();
+  return A;
+}
+
+// Eigen requires the row indices within each column of a compressed matrix to be strictly increasing
+static bool rowsIncreasing( const SparseMatrixsc& A )
+{
+  for( int col = 0; col < A.outerSize(); ++col )
+  {
+    for( int entry = A.outerIndexPtr()[col] + 1; entry < A.outerIndexPtr()[col + 1]; ++entry )
+    {
+      if( A.innerIndexPtr()[entry] <= A.innerIndexPtr()[entry - 1] )
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Products with the blocks and the sparse matrix recovered from them must match products with the sparse matrix
+static int executeSparseComparisonTest( const int block_size )
+{
+  const int num_blocks{ 6 };
+  const SparseMatrixsc M{ blockDiagonalMatrix( block_size, num_blocks ) };
+  const BlockDiagonalMass B{ M, block_size };
+
+  VectorXs x{ M.cols() };
+  for( int row = 0; row < x.size(); ++row )
+  {
+    x( row ) = std::sin( 2.3 * row ) - 0.2;
+  }
+  VectorXs y;
+  B.multiply( x, y );
+  const scalar vector_difference{ ( y - M * x ).lpNorm<Eigen::Infinity>() };
+
+  const SparseMatrixsc A{ spanningMatrix( block_size, num_blocks ) };
+  SparseMatrixsc C;
+  B.multiply( A, C );
+  const SparseMatrixsc MA{ M * A };
+  const scalar matrix_difference{ MatrixXXsc{ C - MA }.lpNorm<Eigen::Infinity>() };
+  const bool product_well_formed{ C.isCompressed() && rowsIncreasing( C ) && C.rows() == MA.rows() && C.cols() == MA.cols() };
+
+  SparseMatrixsc M_recovered;
+  B.toSparse( M_recovered );
+  const scalar recovered_difference{ MatrixXXsc{ M_recovered - M }.lpNorm<Eigen::Infinity>() };
+  const bool recovered_well_formed{ M_recovered.isCompressed() && rowsIncreasing( M_recovered ) && M_recovered.nonZeros() == M.nonZeros() };
+
+  const scalar max_difference{ std::max( vector_difference, std::max( matrix_difference, recovered_difference ) ) };
+
+  std::cout << "Block size:                 " << block_size << std::endl;
+  std::cout << "Vector product difference:  " << vector_difference << std::endl;
+  std::cout << "Matrix product difference:  " << matrix_difference << std::endl;
+  std::cout << "Recovered difference:       " << recovered_difference << std::endl;
+  std::cout << "Product well formed:        " << product_well_formed << std::endl;
+  std::cout << "Recovered well formed:      " << recovered_well_formed << std::endl;
+
+  if( product_well_formed && recovered_well_formed && max_difference <= 1.0e-12 )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+int main( int argc, char** argv )
+{
+  if( argc != 2 )
+  {
+    std::cerr << "Usage: " << argv[0] << " test_name" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if( std::string{ argv[1] } == "block_size_1_00" )
+  {
+    return executeSparseComparisonTest( 1 );
+  }
+  else if( std::string{ argv[1] } == "block_size_3_00" )
+  {
+    return executeSparseComparisonTest( 3 );
+  }
+  // Sizes without a dedicated kernel use the dynamically sized one
+  else if( std::string{ argv[1] } == "block_size_5_00" )
+  {
+    return executeSparseComparisonTest( 5 );
+  }
+
+  std::cerr << "Invalid test specified: " << argv[1] << std::endl;
+  return EXIT_FAILURE;
+}
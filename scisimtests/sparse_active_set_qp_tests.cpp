@@ -0,0 +1,371 @@
+// sparse_active_set_qp_tests.cpp
+//
+// Breannan Smith
+// Last updated: 10/17/2026
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "scisim/ConstrainedMaps/FrictionMaps/MDPOperatorSparseActiveSet.h"
+#include "scisim/Math/MathDefines.h"
+#include "scisim/Math/QPSolvers/SparseActiveSetQP.h"
+
+static constexpr scalar INF{ std::numeric_limits<scalar>::infinity() };
+
+// Contact Jacobian of a chain of disks in the plane, with a contact between each disk and the next and between each
+// disk and the ground. Duplicated contacts are appended as extra columns equal to existing ones.
+static SparseMatrixsc chainContactJacobian( const unsigned nbodies, const unsigned nduplicates )
+{
+  std::vector<Eigen::Triplet<scalar>> triplets;
+  int col{ 0 };
+  for( unsigned body = 0; body < nbodies; ++body )
+  {
+    // Contact with the ground
+    triplets.emplace_back( 2 * body + 1, col, 1.0 );
+    ++col;
+    if( body + 1 < nbodies )
+    {
+      const scalar theta{ 0.3 * std::sin( 1.7 * body ) };
+      const Vector2s n{ std::cos( theta ), std::sin( theta ) };
+      triplets.emplace_back( 2 * body + 0, col, -n.x() );
+      triplets.emplace_back( 2 * body + 1, col, -n.y() );
+      triplets.emplace_back( 2 * body + 2, col, n.x() );
+      triplets.emplace_back( 2 * body + 3, col, n.y() );
+      ++col;
+    }
+  }
+  const int ncontacts{ col };
+  for( unsigned duplicate = 0; duplicate < nduplicates; ++duplicate )
+  {
+    const int source_col{ int( ( 3 * duplicate + 1 ) % unsigned( ncontacts ) ) };
+    for( const Eigen::Triplet<scalar>& triplet : std::vector<Eigen::Triplet<scalar>>{ triplets } )
+    {
+      if( triplet.col() == source_col )
+      {
+        triplets.emplace_back( triplet.row(), col, triplet.value() );
+      }
+    }
+    ++col;
+  }
+  SparseMatrixsc N{ int( 2 * nbodies ), col };
+  N.setFromTriplets( triplets.begin(), triplets.end() );
+  return N;
+}
+
+// The Delassus operator N^T M^-1 N of the chain, with varied masses
+static SparseMatrixsc delassusOperator( const SparseMatrixsc& N )
+{
+  VectorXs Minv{ N.rows() };
+  for( int dof = 0; dof < N.rows(); ++dof )
+  {
+    Minv( dof ) = 1.0 / ( 1.0 + 0.5 * std::sin( 0.9 * ( dof / 2 ) ) );
+  }
+  SparseMatrixsc Q{ N.transpose() * Minv.asDiagonal() * N };
+  Q.makeCompressed();
+  return Q;
+}
+
+static VectorXs sampleVector( const int size, const scalar& frequency, const scalar& amplitude )
+{
+  VectorXs v{ size };
+  for( int idx = 0; idx < size; ++idx )
+  {
+    v( idx ) = amplitude * std::sin( frequency * idx + 0.4 );
+  }
+  return v;
+}
+
+static scalar objective( const SparseMatrixsc& Q, const VectorXs& b, const VectorXs& x )
+{
+  return 0.5 * x.dot( Q * x ) + b.dot( x );
+}
+
+// Largest violation of the KKT conditions of the bound constrained QP: feasibility, and a gradient that vanishes at
+// free variables, is nonnegative at lower bounds, and is nonpositive at upper bounds
+static scalar kktError( const SparseMatrixsc& Q, const VectorXs& b, const VectorXs& l, const VectorXs& u, const VectorXs& x )
+{
+  const VectorXs g{ Q * x + b };
+  scalar error{ 0.0 };
+  for( int var = 0; var < x.size(); ++var )
+  {
+    error = std::max( error, l( var ) - x( var ) );
+    error = std::max( error, x( var ) - u( var ) );
+    // A positive gradient requires the variable at its lower bound, and a negative one at its upper bound
+    error = std::max( error, std::min( x( var ) - l( var ), std::max( g( var ), 0.0 ) ) );
+    error = std::max( error, std::min( u( var ) - x( var ), std::max( -g( var ), 0.0 ) ) );
+  }
+  return error;
+}
+
+// Dense reference: enumerates every assignment of the variables to their lower bound, upper bound, or the free set,
+// solves for the free variables, and keeps the KKT point of least objective
+static bool solveByEnumeration( const SparseMatrixsc& Q, const VectorXs& b, const VectorXs& l, const VectorXs& u, VectorXs& x_best )
+{
+  const int n{ int( Q.rows() ) };
+  const MatrixXXsc Q_dense{ Q };
+  std::vector<int> state( std::vector<int>::size_type( n ), 0 );
+  scalar best_objective{ INF };
+  while( true )
+  {
+    bool admissible{ true };
+    VectorXs x{ VectorXs::Zero( n ) };
+    std::vector<int> free_vars;
+    for( int var = 0; var < n; ++var )
+    {
+      if( state[var] == 0 )
+      {
+        free_vars.emplace_back( var );
+      }
+      else
+      {
+        const scalar bound{ state[var] == 1 ? l( var ) : u( var ) };
+        admissible = admissible && std::isfinite( bound );
+        x( var ) = bound;
+      }
+    }
+    if( admissible && !free_vars.empty() )
+    {
+      const int nfree{ int( free_vars.size() ) };
+      MatrixXXsc Q_free{ nfree, nfree };
+      VectorXs rhs{ nfree };
+      for( int row = 0; row < nfree; ++row )
+      {
+        rhs( row ) = -b( free_vars[row] ) - Q_dense.row( free_vars[row] ).dot( x );
+        for( int col = 0; col < nfree; ++col )
+        {
+          Q_free( row, col ) = Q_dense( free_vars[row], free_vars[col] );
+        }
+      }
+      const Eigen::CompleteOrthogonalDecomposition<MatrixXXsc> decomposition{ Q_free };
+      const VectorXs x_free{ decomposition.solve( rhs ) };
+      admissible = ( Q_free * x_free - rhs ).lpNorm<Eigen::Infinity>() <= 1.0e-9;
+      for( int row = 0; row < nfree; ++row )
+      {
+        x( free_vars[row] ) = x_free( row );
+      }
+    }
+    if( admissible && kktError( Q, b, l, u, x ) <= 1.0e-9 && objective( Q, b, x ) < best_objective )
+    {
+      best_objective = objective( Q, b, x );
+      x_best = x;
+    }
+
+    int var{ 0 };
+    while( var < n && state[var] == 2 )
+    {
+      state[var] = 0;
+      ++var;
+    }
+    if( var == n )
+    {
+      break;
+    }
+    ++state[var];
+  }
+  return std::isfinite( best_objective );
+}
+
+// Solves from a zero and from a nonzero initial guess and checks the KKT conditions and the objective against the
+// dense reference at each solution
+static int executeReferenceTest( const SparseMatrixsc& Q, const VectorXs& b, const VectorXs& l, const VectorXs& u, const bool compare_solution )
+{
+  VectorXs x_reference;
+  if( !solveByEnumeration( Q, b, l, u, x_reference ) )
+  {
+    std::cerr << "Failed to find a reference solution" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const scalar reference_objective{ objective( Q, b, x_reference ) };
+
+  SparseActiveSetQP qp{ 1.0e-12, 100 };
+  bool succeeded{ true };
+  scalar max_kkt_error{ 0.0 };
+  scalar max_objective_error{ 0.0 };
+  scalar max_solution_error{ 0.0 };
+  scalar max_gradient_error{ 0.0 };
+  unsigned max_iterations{ 0 };
+  for( const VectorXs& x0 : { VectorXs{ VectorXs::Zero( Q.rows() ) }, sampleVector( int( Q.rows() ), 2.3, 3.0 ) } )
+  {
+    VectorXs x{ x0 };
+    succeeded = qp.solve( Q, b, l, u, x ) && succeeded;
+    max_iterations = std::max( max_iterations, qp.lastSolveIterations() );
+    max_kkt_error = std::max( max_kkt_error, kktError( Q, b, l, u, x ) );
+    max_objective_error = std::max( max_objective_error, std::fabs( objective( Q, b, x ) - reference_objective ) );
+    // The gradient at a minimizer of a convex QP is unique even when the minimizer is not
+    max_gradient_error = std::max( max_gradient_error, ( qp.gradient() - ( Q * x_reference + b ) ).lpNorm<Eigen::Infinity>() );
+    if( compare_solution )
+    {
+      max_solution_error = std::max( max_solution_error, ( x - x_reference ).lpNorm<Eigen::Infinity>() );
+    }
+  }
+
+  const bool passed{ succeeded && max_kkt_error <= 1.0e-10 && max_objective_error <= 1.0e-10 && max_gradient_error <= 1.0e-8 && max_solution_error <= 1.0e-8 };
+
+  std::cout << "Num variables:        " << Q.rows() << std::endl;
+  std::cout << "Converged:            " << succeeded << std::endl;
+  std::cout << "Max iterations:       " << max_iterations << std::endl;
+  std::cout << "Max KKT error:        " << max_kkt_error << std::endl;
+  std::cout << "Max objective error:  " << max_objective_error << std::endl;
+  std::cout << "Max gradient error:   " << max_gradient_error << std::endl;
+  std::cout << "Max solution error:   " << max_solution_error << std::endl;
+
+  if( passed )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+// Positive definite Q with finite bounds on some variables and a single infinite bound on others
+static int executePositiveDefiniteTest()
+{
+  const SparseMatrixsc N{ chainContactJacobian( 4, 0 ) };
+  const SparseMatrixsc Q{ delassusOperator( N ) };
+  const int n{ int( Q.rows() ) };
+  const VectorXs b{ sampleVector( n, 1.3, 2.0 ) };
+  VectorXs l{ n };
+  VectorXs u{ n };
+  for( int var = 0; var < n; ++var )
+  {
+    l( var ) = var % 3 == 2 ? -INF : -0.5;
+    u( var ) = var % 3 == 1 ? INF : 0.5;
+  }
+  return executeReferenceTest( Q, b, l, u, true );
+}
+
+// Semi-definite Q from contacts duplicated in the active set. Duplicated contacts share their entry of b = N^T v, so
+// both copies can be free at once and the free block is singular. The minimizer is not unique, so only the objective,
+// gradient, and KKT conditions are compared.
+static int executeSemiDefiniteTest()
+{
+  const SparseMatrixsc N{ chainContactJacobian( 3, 2 ) };
+  const SparseMatrixsc Q{ delassusOperator( N ) };
+  const int n{ int( Q.rows() ) };
+  const VectorXs b{ N.transpose() * sampleVector( int( N.rows() ), 0.7, 1.5 ) };
+  const VectorXs l{ VectorXs::Constant( n, -0.4 ) };
+  const VectorXs u{ VectorXs::Constant( n, 0.6 ) };
+  return executeReferenceTest( Q, b, l, u, false );
+}
+
+// The LCP 0 <= x _|_ Q x + b >= 0 of frictionless impact, with redundant contacts and no upper bounds
+static int executeLCPTest()
+{
+  const SparseMatrixsc N{ chainContactJacobian( 4, 1 ) };
+  const SparseMatrixsc Q{ delassusOperator( N ) };
+  const int n{ int( Q.rows() ) };
+  const VectorXs b{ N.transpose() * sampleVector( int( N.rows() ), 1.9, 1.0 ) };
+  const VectorXs l{ VectorXs::Zero( n ) };
+  const VectorXs u{ VectorXs::Constant( n, INF ) };
+  return executeReferenceTest( Q, b, l, u, false );
+}
+
+// Largest violation of the KKT conditions of the friction problem with disks: each pair lies in its disk, the gradient
+// vanishes at a pair inside its disk, and points inward along the radius at a pair on the edge
+static scalar diskKKTError( const SparseMatrixsc& Q, const VectorXs& b, const VectorXs& radii, const VectorXs& beta )
+{
+  const VectorXs g{ Q * beta + b };
+  scalar error{ 0.0 };
+  for( int con = 0; con < radii.size(); ++con )
+  {
+    const Vector2s pair{ beta.segment<2>( 2 * con ) };
+    const Vector2s gradient{ g.segment<2>( 2 * con ) };
+    error = std::max( error, pair.norm() - radii( con ) );
+    if( pair.norm() < radii( con ) - 1.0e-12 )
+    {
+      error = std::max( error, gradient.norm() );
+    }
+    else
+    {
+      const Vector2s direction{ pair.normalized() };
+      error = std::max( error, ( gradient - gradient.dot( direction ) * direction ).norm() );
+      error = std::max( error, gradient.dot( direction ) );
+    }
+  }
+  return error;
+}
+
+// Two friction impulses per contact, with contacts sliding in directions that the square around each disk would
+// otherwise send to its corners
+static int executeFrictionDiskTest()
+{
+  const SparseMatrixsc N{ chainContactJacobian( 5, 0 ) };
+  const SparseMatrixsc D{ N.leftCols( 8 ) };
+  const SparseMatrixsc Q{ delassusOperator( D ) };
+  const int ncons{ int( D.cols() / 2 ) };
+  const VectorXs v0{ sampleVector( int( D.rows() ), 0.8, 3.0 ) };
+  const VectorXs gdotD{ VectorXs::Zero( D.cols() ) };
+  const VectorXs b{ D.transpose() * v0 };
+  const VectorXs mu{ VectorXs::Constant( ncons, 0.5 ) };
+  const VectorXs alpha{ sampleVector( ncons, 1.1, 1.0 ).cwiseAbs() };
+  const VectorXs radii{ mu.cwiseProduct( alpha ) };
+
+  // The solution over the squares alone
+  VectorXs upper{ D.cols() };
+  for( int con = 0; con < ncons; ++con )
+  {
+    upper.segment<2>( 2 * con ).setConstant( radii( con ) );
+  }
+  VectorXs beta_square{ VectorXs::Zero( D.cols() ) };
+  SparseActiveSetQP qp{ 1.0e-12, 1000 };
+  qp.solve( Q, b, -upper, upper, beta_square );
+  scalar max_square_ratio{ 0.0 };
+  for( int con = 0; con < ncons; ++con )
+  {
+    max_square_ratio = std::max( max_square_ratio, beta_square.segment<2>( 2 * con ).norm() / radii( con ) );
+  }
+
+  MDPOperatorSparseActiveSet friction_operator{ 2, 1.0e-12, 1000 };
+  const SparseMatrixsc Minv{ VectorXs::Ones( D.rows() ).asDiagonal() };
+  VectorXs beta{ VectorXs::Zero( D.cols() ) };
+  VectorXs lambda{ ncons };
+  friction_operator.flow( 0.0, Minv, v0, D, Q, gdotD, mu, alpha, beta, lambda );
+  const scalar kkt_error{ diskKKTError( Q, b, radii, beta ) };
+
+  std::cout << "Max square ratio:   " << max_square_ratio << std::endl;
+  std::cout << "Disk KKT error:     " << kkt_error << std::endl;
+
+  // The squares alone must leave some pair outside its disk for the test to exercise the disks
+  if( max_square_ratio > 1.01 && kkt_error <= 1.0e-8 )
+  {
+    return EXIT_SUCCESS;
+  }
+
+  return EXIT_FAILURE;
+}
+
+int main( int argc, char** argv )
+{
+  if( argc != 2 )
+  {
+    std::cerr << "Usage: " << argv[0] << " test_name" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if( std::string{ argv[1] } == "positive_definite_00" )
+  {
+    return executePositiveDefiniteTest();
+  }
+  else if( std::string{ argv[1] } == "semi_definite_00" )
+  {
+    return executeSemiDefiniteTest();
+  }
+  else if( std::string{ argv[1] } == "lcp_00" )
+  {
+    return executeLCPTest();
+  }
+  else if( std::string{ argv[1] } == "friction_disk_00" )
+  {
+    return executeFrictionDiskTest();
+  }
+
+  std::cerr << "Invalid test specified: " << argv[1] << std::endl;
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,396 @@
+#include "BenchmarkUtilities.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <getopt.h>
+#include <sys/resource.h>
+
+#include "scisim/CompileDefinitions.h"
+#include "scisim/StringUtilities.h"
+#include "scisim/Timer/Profiler.h"
+
+// A contact solver setup, given as the xml elements that select it in a scene file. The ball2d and rigidbody3d
+// parsers accept the same elements; attributes one of them does not use are ignored.
+struct SolverConfiguration final
+{
+  std::string name;
+  std::string xml;
+};
+
+struct BenchmarkOptions final
+{
+  std::vector<unsigned> body_counts{ 1000 };
+  unsigned nsteps{ 100 };
+  std::vector<std::string> scene_names;
+  std::vector<std::string> solver_names;
+  std::string output_file_name;
+  bool json_output{ false };
+  std::string scene_directory{ "." };
+  bool help_mode_enabled{ false };
+  bool list_mode_enabled{ false };
+};
+
+// Measurements of one scene run with one solver configuration
+struct BenchmarkResult final
+{
+  std::string scene;
+  unsigned nbodies;
+  std::string solver;
+  unsigned nsteps;
+  double setup_seconds;
+  double step_seconds;
+  std::uint64_t contacts;
+  std::uint64_t peak_rss_bytes;
+};
+
+static std::vector<SolverConfiguration> solverConfigurations()
+{
+  return
+  {
+    { "pgs", "<impact_operator type=\"lcp\" CoR=\"0.5\" cache_impulses=\"0\">\n    <solver name=\"pgs\" max_iters=\"50\"/>\n  </impact_operator>" },
+    { "pgs_islands", "<impact_operator type=\"islands\" CoR=\"0.5\" cache_impulses=\"0\">\n    <operator type=\"lcp\">\n      <solver name=\"pgs\" max_iters=\"50\"/>\n    </operator>\n  </impact_operator>" },
+    { "policy_iteration", "<impact_operator type=\"lcp\" CoR=\"0.5\" cache_impulses=\"0\">\n    <solver name=\"policy_iteration\" max_iters=\"100\" tol=\"1.0e-6\"/>\n  </impact_operator>" },
+    { "sobogus", "<sobogus_friction_solver mu=\"0.3\" CoR=\"0.5\" max_iters=\"100\" tol=\"1.0e-6\" eval_every=\"10\" staggering=\"geometric\" cache_impulses=\"none\"/>" },
+    { "sobogus_islands", "<sobogus_friction_solver mu=\"0.3\" CoR=\"0.5\" max_iters=\"100\" tol=\"1.0e-6\" eval_every=\"10\" staggering=\"geometric\" cache_impulses=\"none\" islands=\"1\"/>" }
+  };
+}
+
+std::mt19937_64 BenchmarkUtilities::sceneRandomEngine()
+{
+  return std::mt19937_64{ 5489u };
+}
+
+double BenchmarkUtilities::jitter( std::mt19937_64& engine )
+{
+  return 2.0 * ( double( engine() ) / double( std::mt19937_64::max() ) ) - 1.0;
+}
+
+// Restarts the peak resident set size measurement where the platform allows it, so that each run reports its own peak
+static void resetPeakResidentSetSize()
+{
+  #ifdef __linux__
+  std::ofstream clear_refs{ "/proc/self/clear_refs" };
+  if( clear_refs.is_open() )
+  {
+    clear_refs << "5";
+  }
+  #endif
+}
+
+// Peak resident set size of the process in bytes
+static std::uint64_t peakResidentSetSize()
+{
+  #ifdef __linux__
+  std::ifstream status{ "/proc/self/status" };
+  std::string line;
+  while( std::getline( status, line ) )
+  {
+    if( line.compare( 0, 6, "VmHWM:" ) == 0 )
+    {
+      std::uint64_t kilobytes;
+      if( StringUtilities::extractFromString( line.substr( 6 ), kilobytes ) )
+      {
+        return 1024 * kilobytes;
+      }
+    }
+  }
+  #endif
+  rusage usage;
+  if( getrusage( RUSAGE_SELF, &usage ) != 0 )
+  {
+    return 0;
+  }
+  #ifdef __APPLE__
+  return std::uint64_t( usage.ru_maxrss );
+  #else
+  return 1024 * std::uint64_t( usage.ru_maxrss );
+  #endif
+}
+
+static void printUsage( const std::string& executable_name, const std::vector<BenchmarkScene>& scenes )
+{
+  std::cout << "Usage: " << executable_name << " [options]" << std::endl;
+  std::cout << "Options are:" << std::endl;
+  std::cout << "   -h/--help                : prints this help message and exits" << std::endl;
+  std::cout << "   -l/--list                : prints the available scenes and solver configurations and exits" << std::endl;
+  std::cout << "   -n/--bodies list         : comma separated body counts to generate each scene at, default 1000" << std::endl;
+  std::cout << "   -s/--steps integer       : number of timesteps to take in each run, default 100" << std::endl;
+  std::cout << "   -g/--scenes list         : comma separated names of the scenes to run, default all of:";
+  for( const BenchmarkScene& scene : scenes )
+  {
+    std::cout << ' ' << scene.name;
+  }
+  std::cout << std::endl;
+  std::cout << "   -c/--solvers list        : comma separated names of the solver configurations to run, default all" << std::endl;
+  std::cout << "   -o/--output file         : appends the records to the given file instead of printing them" << std::endl;
+  std::cout << "   -j/--json                : writes one JSON object per record instead of csv" << std::endl;
+  std::cout << "   -w/--scene_dir dir       : directory to write the generated scene files to, default ." << std::endl;
+}
+
+static bool parseBodyCounts( const std::string& list, std::vector<unsigned>& body_counts )
+{
+  body_counts.clear();
+  for( const std::string& token : StringUtilities::tokenize( list, ',' ) )
+  {
+    unsigned count;
+    if( !StringUtilities::extractFromString( token, count ) || count == 0 )
+    {
+      return false;
+    }
+    body_counts.emplace_back( count );
+  }
+  return !body_counts.empty();
+}
+
+static bool parseCommandLineOptions( int* argc, char*** argv, BenchmarkOptions& options )
+{
+  const struct option long_options[] =
+  {
+    { "help", no_argument, nullptr, 'h' },
+    { "list", no_argument, nullptr, 'l' },
+    { "bodies", required_argument, nullptr, 'n' },
+    { "steps", required_argument, nullptr, 's' },
+    { "scenes", required_argument, nullptr, 'g' },
+    { "solvers", required_argument, nullptr, 'c' },
+    { "output", required_argument, nullptr, 'o' },
+    { "json", no_argument, nullptr, 'j' },
+    { "scene_dir", required_argument, nullptr, 'w' },
+    { nullptr, 0, nullptr, 0 }
+  };
+
+  while( true )
+  {
+    int option_index = 0;
+    const int c{ getopt_long( *argc, *argv, "hln:s:g:c:o:jw:", long_options, &option_index ) };
+    if( c == -1 )
+    {
+      break;
+    }
+    switch( c )
+    {
+      case 'h':
+      {
+        options.help_mode_enabled = true;
+        break;
+      }
+      case 'l':
+      {
+        options.list_mode_enabled = true;
+        break;
+      }
+      case 'n':
+      {
+        if( !parseBodyCounts( optarg, options.body_counts ) )
+        {
+          std::cerr << "Failed to read value for argument for -n/--bodies. Value must be a comma separated list of positive integers." << std::endl;
+          return false;
+        }
+        break;
+      }
+      case 's':
+      {
+        if( !StringUtilities::extractFromString( optarg, options.nsteps ) || options.nsteps == 0 )
+        {
+          std::cerr << "Failed to read value for argument for -s/--steps. Value must be a positive integer." << std::endl;
+          return false;
+        }
+        break;
+      }
+      case 'g':
+      {
+        options.scene_names = StringUtilities::tokenize( optarg, ',' );
+        break;
+      }
+      case 'c':
+      {
+        options.solver_names = StringUtilities::tokenize( optarg, ',' );
+        break;
+      }
+      case 'o':
+      {
+        options.output_file_name = optarg;
+        break;
+      }
+      case 'j':
+      {
+        options.json_output = true;
+        break;
+      }
+      case 'w':
+      {
+        options.scene_directory = optarg;
+        break;
+      }
+      case '?':
+      {
+        return false;
+      }
+      default:
+      {
+        std::cerr << "This is a bug in the command line parser. Please file a report." << std::endl;
+        return false;
+      }
+    }
+  }
+
+  if( *argc != optind )
+  {
+    std::cerr << "Invalid arguments. The benchmarks take no positional arguments." << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+// Keeps the entries named in the list, in the order of the list; an empty list keeps every entry
+template<typename T>
+static bool selectByName( const std::vector<std::string>& names, const std::string& kind, std::vector<T>& entries )
+{
+  if( names.empty() )
+  {
+    return true;
+  }
+  std::vector<T> selected;
+  for( const std::string& name : names )
+  {
+    const auto entry = std::find_if( entries.cbegin(), entries.cend(), [&name]( const T& candidate ) { return candidate.name == name; } );
+    if( entry == entries.cend() )
+    {
+      std::cerr << "Unknown " << kind << ": " << name << std::endl;
+      return false;
+    }
+    selected.emplace_back( *entry );
+  }
+  entries = std::move( selected );
+  return true;
+}
+
+static void writeHeader( const bool json_output, std::ostream& output_stream )
+{
+  if( !json_output )
+  {
+    output_stream << "revision,scene,bodies,solver,steps,setup_s,run_s,steps_per_s,contacts,contacts_per_s,peak_rss_bytes\n";
+  }
+}
+
+static void writeResult( const BenchmarkResult& result, const bool json_output, std::ostream& output_stream )
+{
+  const double steps_per_second{ result.step_seconds > 0.0 ? double( result.nsteps ) / result.step_seconds : 0.0 };
+  const double contacts_per_second{ result.step_seconds > 0.0 ? double( result.contacts ) / result.step_seconds : 0.0 };
+  if( json_output )
+  {
+    output_stream << "{\"revision\":\"" << CompileDefinitions::GitSHA1 << "\",\"scene\":\"" << result.scene << "\",\"bodies\":" << result.nbodies;
+    output_stream << ",\"solver\":\"" << result.solver << "\",\"steps\":" << result.nsteps << ",\"setup_s\":" << result.setup_seconds;
+    output_stream << ",\"run_s\":" << result.step_seconds << ",\"steps_per_s\":" << steps_per_second << ",\"contacts\":" << result.contacts;
+    output_stream << ",\"contacts_per_s\":" << contacts_per_second << ",\"peak_rss_bytes\":" << result.peak_rss_bytes << "}\n";
+  }
+  else
+  {
+    output_stream << CompileDefinitions::GitSHA1 << ',' << result.scene << ',' << result.nbodies << ',' << result.solver << ',' << result.nsteps << ',';
+    output_stream << result.setup_seconds << ',' << result.step_seconds << ',' << steps_per_second << ',' << result.contacts << ',';
+    output_stream << contacts_per_second << ',' << result.peak_rss_bytes << '\n';
+  }
+  output_stream.flush();
+}
+
+int BenchmarkUtilities::runBenchmarks( int argc, char** argv, const std::vector<BenchmarkScene>& scenes, const BenchmarkSceneRunner& runner )
+{
+  BenchmarkOptions options;
+  if( !parseCommandLineOptions( &argc, &argv, options ) )
+  {
+    return EXIT_FAILURE;
+  }
+
+  if( options.help_mode_enabled )
+  {
+    printUsage( argv[0], scenes );
+    return EXIT_SUCCESS;
+  }
+
+  std::vector<BenchmarkScene> selected_scenes{ scenes };
+  std::vector<SolverConfiguration> solvers{ solverConfigurations() };
+  if( !selectByName( options.scene_names, "scene", selected_scenes ) || !selectByName( options.solver_names, "solver configuration", solvers ) )
+  {
+    return EXIT_FAILURE;
+  }
+
+  if( options.list_mode_enabled )
+  {
+    for( const BenchmarkScene& scene : selected_scenes )
+    {
+      std::cout << "scene " << scene.name << std::endl;
+    }
+    for( const SolverConfiguration& solver : solvers )
+    {
+      std::cout << "solver " << solver.name << std::endl;
+    }
+    return EXIT_SUCCESS;
+  }
+
+  std::ofstream output_file;
+  if( !options.output_file_name.empty() )
+  {
+    // Records accumulate across runs, so only a new file gets a header
+    const bool new_file{ !std::ifstream{ options.output_file_name }.is_open() };
+    output_file.open( options.output_file_name, std::ios::app );
+    if( !output_file.is_open() )
+    {
+      std::cerr << "Failed to open output file: " << options.output_file_name << std::endl;
+      return EXIT_FAILURE;
+    }
+    if( new_file )
+    {
+      writeHeader( options.json_output, output_file );
+    }
+  }
+  else
+  {
+    writeHeader( options.json_output, std::cout );
+  }
+  std::ostream& output_stream{ options.output_file_name.empty() ? std::cout : output_file };
+
+  // Contacts are counted by the profiler; no report is written
+  Profiler::enable( nullptr, ProfileFormat::CSV );
+
+  for( const BenchmarkScene& scene : selected_scenes )
+  {
+    for( const unsigned nbodies : options.body_counts )
+    {
+      for( const SolverConfiguration& solver : solvers )
+      {
+        const std::string file_name{ options.scene_directory + "/" + scene.name + "_" + std::to_string( nbodies ) + "_" + solver.name + ".xml" };
+        {
+          std::ofstream scene_file{ file_name };
+          if( !scene_file.is_open() )
+          {
+            std::cerr << "Failed to write scene file: " << file_name << std::endl;
+            return EXIT_FAILURE;
+          }
+          scene_file << scene.generate( nbodies, solver.xml );
+        }
+
+        Profiler::reset();
+        resetPeakResidentSetSize();
+
+        BenchmarkResult result;
+        result.scene = scene.name;
+        result.nbodies = nbodies;
+        result.solver = solver.name;
+        result.nsteps = options.nsteps;
+        if( !runner( file_name, options.nsteps, result.setup_seconds, result.step_seconds ) )
+        {
+          std::cerr << "Failed to load generated scene: " << file_name << std::endl;
+          return EXIT_FAILURE;
+        }
+        result.contacts = Profiler::totalCount( ProfileCounter::CONTACTS );
+        result.peak_rss_bytes = peakResidentSetSize();
+
+        writeResult( result, options.json_output, output_stream );
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,38 @@
+#ifndef BENCHMARK_UTILITIES_H
+#define BENCHMARK_UTILITIES_H
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+// A procedurally generated scene; generate returns the xml of the scene with the given number of bodies and with
+// the given elements that select the contact solver
+struct BenchmarkScene final
+{
+  std::string name;
+  std::function<std::string( const unsigned nbodies, const std::string& solver_xml )> generate;
+};
+
+// Loads a scene file and takes the given number of steps. Each step must be bracketed by a ProfiledStep so that
+// the contacts of the step are counted. Returns false if the scene could not be loaded.
+using BenchmarkSceneRunner = std::function<bool( const std::string& file_name, const unsigned nsteps, double& setup_seconds, double& step_seconds )>;
+
+namespace BenchmarkUtilities
+{
+
+  // Seeded with a fixed value so that a scene is identical from run to run and from commit to commit
+  std::mt19937_64 sceneRandomEngine();
+
+  // Uniformly distributed in [-1, 1]; computed directly from the engine's output, which is portable, rather than
+  // with a distribution, which is not
+  double jitter( std::mt19937_64& engine );
+
+  // Parses the command line shared by the benchmark executables, then runs every selected scene at every body
+  // count with every selected solver configuration and writes one record per run
+  int runBenchmarks( int argc, char** argv, const std::vector<BenchmarkScene>& scenes, const BenchmarkSceneRunner& runner );
+
+}
+
+#endif
@@ -0,0 +1,144 @@
+// Procedurally generates two dimensional ball scenes at a range of sizes, steps each with each of a set of solver
+// configurations, and reports the throughput and peak memory use of each run. See BenchmarkUtilities for options.
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+
+#include "scisim/ConstrainedMaps/FrictionSolver.h"
+#include "scisim/ConstrainedMaps/ImpactFrictionMap.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactMap.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperator.h"
+#include "scisim/Math/MathDefines.h"
+#include "scisim/Math/Rational.h"
+#include "scisim/Timer/Profiler.h"
+#include "scisim/UnconstrainedMaps/UnconstrainedMap.h"
+
+#include "ball2d/Ball2DSim.h"
+#include "ball2d/PythonScripting.h"
+
+#include "ball2dutils/Ball2DSceneParser.h"
+
+#include "BenchmarkUtilities.h"
+
+// Balls are laid out on a square lattice with this spacing relative to their nominal radius
+static constexpr double LATTICE_SPACING{ 2.4 };
+
+// Balls poured as a block from the top of a drum that holds about three times their area
+static std::string drumPourScene( const unsigned nballs, const std::string& solver_xml )
+{
+  std::mt19937_64 engine{ BenchmarkUtilities::sceneRandomEngine() };
+  const double r{ 0.05 };
+  const double spacing{ LATTICE_SPACING * r };
+  const unsigned columns{ unsigned( std::ceil( std::sqrt( double( nballs ) ) ) ) };
+  const double block_width{ columns * spacing };
+
+  std::ostringstream scene;
+  scene << "<ball2d_scene>\n\n";
+  scene << "  <integrator type=\"verlet\" dt=\"0.005\"/>\n\n";
+  scene << "  " << solver_xml << "\n\n";
+  scene << "  <gravity fx=\"0.0\" fy=\"-10.0\"/>\n\n";
+  scene << "  <static_drum x=\"0.0\" y=\"0.0\" r=\"" << block_width << "\"/>\n\n";
+  for( unsigned ball = 0; ball < nballs; ++ball )
+  {
+    const double x{ ( ball % columns + 0.5 ) * spacing - 0.5 * block_width };
+    const double y{ ( ball / columns + 0.5 ) * spacing - 0.25 * block_width };
+    const double radius{ r * ( 1.0 + 0.1 * BenchmarkUtilities::jitter( engine ) ) };
+    const double vx{ 0.1 * BenchmarkUtilities::jitter( engine ) };
+    scene << "  <ball x=\"" << x << "\" y=\"" << y << "\" vx=\"" << vx << "\" vy=\"0.0\" m=\"" << PI<double> * radius * radius << "\" r=\"" << radius << "\" fixed=\"0\"/>\n";
+  }
+  scene << "\n</ball2d_scene>\n";
+  return scene.str();
+}
+
+// Balls in a periodic cell sheared by a Lees-Edwards boundary
+static std::string shearCellScene( const unsigned nballs, const std::string& solver_xml )
+{
+  std::mt19937_64 engine{ BenchmarkUtilities::sceneRandomEngine() };
+  const double r{ 0.05 };
+  const double spacing{ LATTICE_SPACING * r };
+  const unsigned columns{ unsigned( std::ceil( std::sqrt( double( nballs ) ) ) ) };
+  const double half_width{ 0.5 * columns * spacing };
+
+  std::ostringstream scene;
+  scene << "<ball2d_scene>\n\n";
+  scene << "  <integrator type=\"verlet\" dt=\"0.005\"/>\n\n";
+  scene << "  " << solver_xml << "\n\n";
+  scene << "  <static_plane x=\"" << -half_width << " 0.0\" n=\"1.0 0.0\"/>\n";
+  scene << "  <static_plane x=\"" << half_width << " 0.0\" n=\"-1.0 0.0\"/>\n";
+  scene << "  <static_plane x=\"0.0 " << -half_width << "\" n=\"0.0 1.0\"/>\n";
+  scene << "  <static_plane x=\"0.0 " << half_width << "\" n=\"0.0 -1.0\"/>\n\n";
+  scene << "  <lees_edwards_portal planeA=\"0\" planeB=\"1\" v=\"1.0\" bounds=\"" << half_width << "\"/>\n";
+  scene << "  <planar_portal planeA=\"2\" planeB=\"3\"/>\n\n";
+  for( unsigned ball = 0; ball < nballs; ++ball )
+  {
+    const double x{ ( ball % columns + 0.5 ) * spacing - half_width };
+    const double y{ ( ball / columns + 0.5 ) * spacing - half_width };
+    const double radius{ r * ( 1.0 + 0.1 * BenchmarkUtilities::jitter( engine ) ) };
+    const double vx{ 0.5 * BenchmarkUtilities::jitter( engine ) };
+    const double vy{ 0.5 * BenchmarkUtilities::jitter( engine ) };
+    scene << "  <ball x=\"" << x << "\" y=\"" << y << "\" vx=\"" << vx << "\" vy=\"" << vy << "\" m=\"" << PI<double> * radius * radius << "\" r=\"" << radius << "\" fixed=\"0\"/>\n";
+  }
+  scene << "\n</ball2d_scene>\n";
+  return scene.str();
+}
+
+static bool runScene( const std::string& file_name, const unsigned nsteps, double& setup_seconds, double& step_seconds )
+{
+  const std::chrono::steady_clock::time_point setup_start{ std::chrono::steady_clock::now() };
+
+  Ball2DState state;
+  std::string scripting_callback_name;
+  std::unique_ptr<UnconstrainedMap> unconstrained_map;
+  std::string dt_string;
+  Rational<std::intmax_t> dt;
+  scalar end_time;
+  std::unique_ptr<ImpactOperator> impact_operator;
+  std::unique_ptr<ImpactMap> impact_map;
+  scalar CoR;
+  std::unique_ptr<FrictionSolver> friction_solver;
+  scalar mu;
+  std::unique_ptr<ImpactFrictionMap> impact_friction_map;
+  if( !Ball2DSceneParser::parseXMLSceneFile( file_name, scripting_callback_name, state, unconstrained_map, dt_string, dt, end_time, impact_operator, impact_map, CoR, friction_solver, mu, impact_friction_map ) )
+  {
+    return false;
+  }
+  Ball2DSim sim;
+  using std::swap;
+  swap( state, sim.state() );
+  PythonScripting scripting;
+
+  const std::chrono::steady_clock::time_point step_start{ std::chrono::steady_clock::now() };
+  setup_seconds = std::chrono::duration<double>{ step_start - setup_start }.count();
+
+  for( unsigned iteration = 1; iteration <= nsteps; ++iteration )
+  {
+    const ProfiledStep profiled_step{ iteration };
+    if( impact_friction_map != nullptr )
+    {
+      sim.flow( scripting, iteration, dt, *unconstrained_map, CoR, mu, *friction_solver, *impact_friction_map );
+    }
+    else if( impact_map != nullptr )
+    {
+      sim.flow( scripting, iteration, dt, *unconstrained_map, *impact_operator, CoR, *impact_map );
+    }
+    else
+    {
+      sim.flow( scripting, iteration, dt, *unconstrained_map );
+    }
+  }
+
+  step_seconds = std::chrono::duration<double>{ std::chrono::steady_clock::now() - step_start }.count();
+  return true;
+}
+
+int main( int argc, char** argv )
+{
+  const std::vector<BenchmarkScene> scenes
+  {
+    { "ball2d_drum_pour", drumPourScene },
+    { "ball2d_shear_cell", shearCellScene }
+  };
+  return BenchmarkUtilities::runBenchmarks( argc, argv, scenes, runScene );
+}
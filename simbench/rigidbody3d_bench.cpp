@@ -0,0 +1,161 @@
+// Procedurally generates three dimensional rigid body scenes at a range of sizes, steps each with each of a set of
+// solver configurations, and reports the throughput and peak memory use of each run. See BenchmarkUtilities for options.
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+
+#include "scisim/ConstrainedMaps/FrictionSolver.h"
+#include "scisim/ConstrainedMaps/ImpactFrictionMap.h"
+#include "scisim/ConstrainedMaps/ImpactMaps/ImpactOperator.h"
+#include "scisim/Math/MathDefines.h"
+#include "scisim/Math/Rational.h"
+#include "scisim/Timer/Profiler.h"
+#include "scisim/UnconstrainedMaps/UnconstrainedMap.h"
+
+#include "rigidbody3d/RigidBody3DSim.h"
+#include "rigidbody3d/PythonScripting.h"
+
+#include "rigidbody3dutils/RigidBody3DSceneParser.h"
+#include "rigidbody3dutils/RenderingState.h"
+
+#include "BenchmarkUtilities.h"
+
+// Distance between neighboring bodies of the initial lattice; bodies are at most one unit across
+static constexpr double LATTICE_SPACING{ 1.2 };
+
+static unsigned latticeWidth( const unsigned nbodies )
+{
+  return unsigned( std::ceil( std::cbrt( double( nbodies ) ) ) );
+}
+
+static void writeSceneHeader( const std::string& solver_xml, const std::string& geometry_xml, std::ostringstream& scene )
+{
+  scene << "<rigidbody3d_scene>\n\n";
+  scene << "  <integrator type=\"split_ham\" dt=\"0.01\"/>\n\n";
+  scene << "  " << solver_xml << "\n\n";
+  scene << "  <near_earth_gravity f=\"0.0 -9.81 0.0\"/>\n\n";
+  scene << "  " << geometry_xml << "\n\n";
+}
+
+// Bodies dropped as a cube onto a floor, with walls around the cube's footprint
+static std::string pileScene( const unsigned nbodies, const std::string& solver_xml, const std::string& geometry_xml, const double omega )
+{
+  std::mt19937_64 engine{ BenchmarkUtilities::sceneRandomEngine() };
+  const unsigned width{ latticeWidth( nbodies ) };
+  const double half_width{ 0.5 * width * LATTICE_SPACING };
+
+  std::ostringstream scene;
+  writeSceneHeader( solver_xml, geometry_xml, scene );
+  scene << "  <static_plane x=\"0.0 0.0 0.0\" n=\"0.0 1.0 0.0\"/>\n";
+  scene << "  <static_plane x=\"" << -half_width << " 0.0 0.0\" n=\"1.0 0.0 0.0\"/>\n";
+  scene << "  <static_plane x=\"" << half_width << " 0.0 0.0\" n=\"-1.0 0.0 0.0\"/>\n";
+  scene << "  <static_plane x=\"0.0 0.0 " << -half_width << "\" n=\"0.0 0.0 1.0\"/>\n";
+  scene << "  <static_plane x=\"0.0 0.0 " << half_width << "\" n=\"0.0 0.0 -1.0\"/>\n\n";
+  for( unsigned body = 0; body < nbodies; ++body )
+  {
+    const double x{ ( body % width + 0.5 ) * LATTICE_SPACING - half_width + 0.05 * BenchmarkUtilities::jitter( engine ) };
+    const double z{ ( ( body / width ) % width + 0.5 ) * LATTICE_SPACING - half_width + 0.05 * BenchmarkUtilities::jitter( engine ) };
+    const double y{ ( body / ( width * width ) + 0.5 ) * LATTICE_SPACING + 0.05 * BenchmarkUtilities::jitter( engine ) };
+    scene << "  <rigid_body_with_density x=\"" << x << ' ' << y << ' ' << z << "\" v=\"0.0 0.0 0.0\" omega=\"";
+    scene << omega * BenchmarkUtilities::jitter( engine ) << ' ' << omega * BenchmarkUtilities::jitter( engine ) << ' ' << omega * BenchmarkUtilities::jitter( engine );
+    scene << "\" rho=\"1.0\" fixed=\"0\" geo_idx=\"0\"/>\n";
+  }
+  scene << "\n</rigidbody3d_scene>\n";
+  return scene.str();
+}
+
+static std::string spherePileScene( const unsigned nbodies, const std::string& solver_xml )
+{
+  return pileScene( nbodies, solver_xml, "<geometry type=\"sphere\" r=\"0.5\"/>", 0.0 );
+}
+
+static std::string boxPileScene( const unsigned nbodies, const std::string& solver_xml )
+{
+  return pileScene( nbodies, solver_xml, "<geometry type=\"box\" r=\"0.4 0.4 0.4\"/>", 1.0 );
+}
+
+// Boxes swirling about the axis of a capped cylinder, starting from a cube inscribed in the cylinder
+static std::string tumblerScene( const unsigned nbodies, const std::string& solver_xml )
+{
+  std::mt19937_64 engine{ BenchmarkUtilities::sceneRandomEngine() };
+  const unsigned width{ latticeWidth( nbodies ) };
+  const double half_width{ 0.5 * width * LATTICE_SPACING };
+  const double swirl_rate{ 1.0 };
+
+  std::ostringstream scene;
+  writeSceneHeader( solver_xml, "<geometry type=\"box\" r=\"0.4 0.4 0.4\"/>", scene );
+  scene << "  <static_cylinder x=\"0.0 0.0 0.0\" axis=\"0.0 0.0 1.0\" R=\"" << std::sqrt( 2.0 ) * half_width + LATTICE_SPACING << "\"/>\n";
+  scene << "  <static_plane x=\"0.0 0.0 " << -half_width << "\" n=\"0.0 0.0 1.0\"/>\n";
+  scene << "  <static_plane x=\"0.0 0.0 " << half_width << "\" n=\"0.0 0.0 -1.0\"/>\n\n";
+  for( unsigned body = 0; body < nbodies; ++body )
+  {
+    const double x{ ( body % width + 0.5 ) * LATTICE_SPACING - half_width + 0.05 * BenchmarkUtilities::jitter( engine ) };
+    const double y{ ( ( body / width ) % width + 0.5 ) * LATTICE_SPACING - half_width + 0.05 * BenchmarkUtilities::jitter( engine ) };
+    const double z{ ( body / ( width * width ) + 0.5 ) * LATTICE_SPACING - half_width };
+    scene << "  <rigid_body_with_density x=\"" << x << ' ' << y << ' ' << z << "\" v=\"" << -swirl_rate * y << ' ' << swirl_rate * x << " 0.0\"";
+    scene << " omega=\"0.0 0.0 0.0\" rho=\"1.0\" fixed=\"0\" geo_idx=\"0\"/>\n";
+  }
+  scene << "\n</rigidbody3d_scene>\n";
+  return scene.str();
+}
+
+static bool runScene( const std::string& file_name, const unsigned nsteps, double& setup_seconds, double& step_seconds )
+{
+  const std::chrono::steady_clock::time_point setup_start{ std::chrono::steady_clock::now() };
+
+  RigidBody3DState state;
+  std::string scripting_callback_name;
+  std::unique_ptr<UnconstrainedMap> unconstrained_map;
+  std::string dt_string;
+  Rational<std::intmax_t> dt;
+  scalar end_time;
+  std::unique_ptr<ImpactOperator> impact_operator;
+  scalar CoR;
+  std::unique_ptr<FrictionSolver> friction_solver;
+  scalar mu;
+  std::unique_ptr<ImpactFrictionMap> impact_friction_map;
+  RenderingState rendering_state;
+  if( !RigidBody3DSceneParser::parseXMLSceneFile( file_name, scripting_callback_name, state, unconstrained_map, dt_string, dt, end_time, impact_operator, CoR, friction_solver, mu, impact_friction_map, rendering_state ) )
+  {
+    return false;
+  }
+  RigidBody3DSim sim;
+  sim.getState() = std::move( state );
+  PythonScripting scripting;
+
+  const std::chrono::steady_clock::time_point step_start{ std::chrono::steady_clock::now() };
+  setup_seconds = std::chrono::duration<double>{ step_start - setup_start }.count();
+
+  for( unsigned iteration = 1; iteration <= nsteps; ++iteration )
+  {
+    const ProfiledStep profiled_step{ iteration };
+    if( impact_friction_map != nullptr )
+    {
+      sim.flow( scripting, iteration, dt, *unconstrained_map, CoR, mu, *friction_solver, *impact_friction_map );
+    }
+    else if( impact_operator != nullptr )
+    {
+      sim.flow( scripting, iteration, dt, *unconstrained_map, *impact_operator, CoR );
+    }
+    else
+    {
+      sim.flow( scripting, iteration, dt, *unconstrained_map );
+    }
+  }
+
+  step_seconds = std::chrono::duration<double>{ std::chrono::steady_clock::now() - step_start }.count();
+  return true;
+}
+
+int main( int argc, char** argv )
+{
+  const std::vector<BenchmarkScene> scenes
+  {
+    { "rigidbody3d_sphere_pile", spherePileScene },
+    { "rigidbody3d_box_pile", boxPileScene },
+    { "rigidbody3d_tumbler", tumblerScene }
+  };
+  return BenchmarkUtilities::runBenchmarks( argc, argv, scenes, runScene );
+}